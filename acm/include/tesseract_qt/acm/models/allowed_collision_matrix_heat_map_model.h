@@ -0,0 +1,78 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_MODEL_H
+#define TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_MODEL_H
+
+#ifndef Q_MOC_RUN
+#include <array>
+#include <memory>
+#include <string>
+#include <QAbstractTableModel>
+#endif
+
+namespace tesseract::gui
+{
+class AllowedCollisionMatrixModel;
+
+/**
+ * @brief A virtual N x N table model over the links of an AllowedCollisionMatrixModel
+ * @details No items are created, each cell is resolved on demand from the interned link table so only the visible
+ * cells are ever evaluated. Allowed cells are colored by reason and the reason is provided as the tool tip.
+ */
+class AllowedCollisionMatrixHeatMapModel : public QAbstractTableModel
+{
+  Q_OBJECT
+public:
+  explicit AllowedCollisionMatrixHeatMapModel(QObject* parent = nullptr);
+  ~AllowedCollisionMatrixHeatMapModel() override;
+
+  /**
+   * @brief Set the source model
+   * @param model The model which owns the data, it must outlive this model or be reset to nullptr
+   */
+  void setSourceModel(AllowedCollisionMatrixModel* model);
+  AllowedCollisionMatrixModel* getSourceModel() const;
+
+  /**
+   * @brief Get the link names for a cell
+   * @return The link names, empty if the index is invalid
+   */
+  std::array<std::string, 2> getLinkNames(const QModelIndex& index) const;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+  Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+private Q_SLOTS:
+  void onLinksChanged();
+  void onEntryChanged(int link1_index, int link2_index);
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_MODEL_H
@@ -32,6 +32,7 @@
 namespace tesseract::gui
 {
 class ComponentInfo;
+class AllowedCollisionMatrixTable;
 class AllowedCollisionMatrixModel : public QStandardItemModel
 {
   Q_OBJECT
@@ -48,6 +49,22 @@ public:
 
   tesseract::common::AllowedCollisionMatrix getAllowedCollisionMatrix() const;
 
+  /** @brief Get the interned link table backing the model */
+  const AllowedCollisionMatrixTable& getTable() const;
+
+  /**
+   * @brief Get the index of the entry item listed under the first link
+   * @return The index, invalid if there is no entry between the links
+   */
+  QModelIndex getEntryIndex(const std::string& link1_name, const std::string& link2_name) const;
+
+Q_SIGNALS:
+  /** @brief Emitted when the set of links with entries changed or the model was reset */
+  void linksChanged();
+
+  /** @brief Emitted when a single entry between two links changed */
+  void entryChanged(int link1_index, int link2_index);
+
 private:
   struct Implementation;
   std::unique_ptr<Implementation> data_;
@@ -58,6 +75,10 @@ private:
   void remove(const std::string& link_name);
   void clear();
 
+  QStandardItem* getLinkItem(int link_index);
+  void appendEntryItem(QStandardItem& link_item, int link_index, int partner_index, const std::string& reason);
+  void appendEntryItems(int link1_index, int link2_index, const std::string& reason);
+
   // Documentation inherited
   bool eventFilter(QObject* obj, QEvent* event) override;
 };
@@ -0,0 +1,140 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_TABLE_H
+#define TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_TABLE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <tesseract/common/fwd.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief A sparse symmetric allowed collision matrix backed by interned link and reason tables
+ * @details Link names are interned once and referenced by a stable integer index until clear() is called. Each link
+ * stores its allowed partners in a hash map so add, remove and lookup are O(1), and removing a link is O(degree).
+ * Reasons are interned as well since most matrices only use a handful of distinct values (Adjacent, Never, ...).
+ */
+class AllowedCollisionMatrixTable
+{
+public:
+  /** @brief The index returned when a link name is not interned */
+  static constexpr int INVALID_INDEX = -1;
+
+  /** @brief Return the key used to identify the unordered pair (link1_index, link2_index) */
+  static std::uint64_t makeKey(int link1_index, int link2_index);
+
+  /** @brief Clear all entries and interned names */
+  void clear();
+
+  /** @brief Replace the content with the provided allowed collision matrix in a single pass */
+  void set(const tesseract::common::AllowedCollisionMatrix& acm);
+
+  /**
+   * @brief Add or update an entry
+   * @return True if the entry did not exist, false if only the reason was updated
+   */
+  bool add(const std::string& link1_name, const std::string& link2_name, const std::string& reason);
+
+  /**
+   * @brief Remove an entry
+   * @return True if the entry existed
+   */
+  bool remove(int link1_index, int link2_index);
+
+  /**
+   * @brief Remove all entries of a link
+   * @return The indices of the links that were paired with the removed link
+   */
+  std::vector<int> remove(int link_index);
+
+  /** @brief Check if the pair is allowed to be in collision */
+  bool isAllowed(int link1_index, int link2_index) const;
+
+  /**
+   * @brief Get the reason for an entry
+   * @return The reason, nullptr if the pair is not allowed to be in collision
+   */
+  const std::string* getReason(int link1_index, int link2_index) const;
+
+  /**
+   * @brief Get the reason index for an entry
+   * @return The reason index, INVALID_INDEX if the pair is not allowed to be in collision
+   */
+  int getReasonIndex(int link1_index, int link2_index) const;
+
+  /** @brief Get the reason for a reason index */
+  const std::string& getReasonName(int reason_index) const;
+
+  /** @brief Get the number of distinct reasons */
+  int getReasonCount() const;
+
+  /**
+   * @brief Get the interned index of a link
+   * @return The index, INVALID_INDEX if the link is unknown
+   */
+  int getIndex(const std::string& link_name) const;
+
+  /** @brief Get the name of an interned link */
+  const std::string& getName(int link_index) const;
+
+  /** @brief Get the number of interned links, including links which currently have no entries */
+  int getLinkCount() const;
+
+  /** @brief Get the number of entries of a link */
+  std::size_t getLinkEntryCount(int link_index) const;
+
+  /**
+   * @brief Get the entries of a link
+   * @return Map of partner link index to reason index
+   */
+  const std::unordered_map<int, int>& getLinkEntries(int link_index) const;
+
+  /** @brief Get the indices of all links which have at least one entry, sorted by name */
+  std::vector<int> getActiveLinks() const;
+
+  /** @brief Get the number of entries */
+  std::size_t size() const;
+
+  /** @brief Check if there are no entries */
+  bool empty() const;
+
+  /** @brief Convert to a tesseract allowed collision matrix */
+  tesseract::common::AllowedCollisionMatrix toAllowedCollisionMatrix() const;
+
+private:
+  std::vector<std::string> link_names_;
+  std::unordered_map<std::string, int> link_indices_;
+  std::vector<std::string> reason_names_;
+  std::unordered_map<std::string, int> reason_indices_;
+  std::vector<std::unordered_map<int, int>> entries_;
+  std::size_t size_{ 0 };
+
+  int internLink(const std::string& link_name);
+  int internReason(const std::string& reason);
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_TABLE_H
@@ -65,6 +65,7 @@ public Q_SLOTS:
   void onAddButtonClicked();
   void onGenerateButtonClicked();
   void onApplyButtonClicked();
+  void onMatrixViewToggled(bool checked);
 
 private:
   struct Implementation;
@@ -0,0 +1,68 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_WIDGET_H
+#define TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_WIDGET_H
+
+#ifndef Q_MOC_RUN
+#include <memory>
+#include <QWidget>
+#endif
+
+class QTableView;
+
+namespace tesseract::gui
+{
+class AllowedCollisionMatrixModel;
+class AllowedCollisionMatrixHeatMapModel;
+
+/** @brief Shows the allowed collision matrix as a dense N x N grid of fixed size cells */
+class AllowedCollisionMatrixHeatMapWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit AllowedCollisionMatrixHeatMapWidget(QWidget* parent = nullptr);
+  ~AllowedCollisionMatrixHeatMapWidget();
+
+  void setModel(std::shared_ptr<AllowedCollisionMatrixModel> model);
+  std::shared_ptr<AllowedCollisionMatrixModel> getModel();
+  std::shared_ptr<const AllowedCollisionMatrixModel> getModel() const;
+
+  /** @brief Set the size in pixels of each cell */
+  void setCellSize(int size);
+  int getCellSize() const;
+
+  QTableView& getTableView();
+  const QTableView& getTableView() const;
+
+Q_SIGNALS:
+  /** @brief Emitted when a cell is selected */
+  void entrySelected(const QString& link1_name, const QString& link2_name);
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
+}  // namespace tesseract::gui
+#endif  // TESSERACT_QT_ACM_ALLOWED_COLLISION_MATRIX_HEAT_MAP_WIDGET_H
@@ -53,6 +53,13 @@ public:
   QItemSelectionModel& getSelectionModel();
   const QItemSelectionModel& getSelectionModel() const;
 
+  /**
+   * @brief Show the dense N x N matrix view instead of the tree view
+   * @details The matrix view is only connected to the model while it is visible
+   */
+  void setMatrixViewVisible(bool visible);
+  bool isMatrixViewVisible() const;
+
 private:
   struct Implementation;
   std::unique_ptr<Implementation> data_;
@@ -0,0 +1,210 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/acm/models/allowed_collision_matrix_heat_map_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_table.h>
+
+#include <QBrush>
+#include <QColor>
+#include <QPointer>
+
+namespace tesseract::gui
+{
+struct AllowedCollisionMatrixHeatMapModel::Implementation
+{
+  QPointer<AllowedCollisionMatrixModel> source;
+
+  /** @brief The interned link index for each row and column sorted by name */
+  std::vector<int> links;
+
+  /** @brief The row and column for each interned link index, -1 if not shown */
+  std::vector<int> positions;
+
+  /** @brief The brush for each reason index */
+  mutable std::vector<QBrush> reason_brushes;
+
+  QBrush diagonal_brush{ QColor(128, 128, 128, 64) };
+
+  const QBrush& getReasonBrush(int reason_index) const
+  {
+    while (static_cast<int>(reason_brushes.size()) <= reason_index)
+    {
+      // Spread the hue using the golden angle so the first few reasons are easy to tell apart
+      const int hue = static_cast<int>((reason_brushes.size() * 137) % 360);
+      reason_brushes.emplace_back(QColor::fromHsv(hue, 170, 220));
+    }
+    return reason_brushes[static_cast<std::size_t>(reason_index)];
+  }
+
+  void update()
+  {
+    links.clear();
+    positions.clear();
+    if (source == nullptr)
+      return;
+
+    const AllowedCollisionMatrixTable& table = source->getTable();
+    links = table.getActiveLinks();
+    positions.resize(static_cast<std::size_t>(table.getLinkCount()), -1);
+    for (std::size_t i = 0; i < links.size(); ++i)
+      positions[static_cast<std::size_t>(links[i])] = static_cast<int>(i);
+  }
+};
+
+AllowedCollisionMatrixHeatMapModel::AllowedCollisionMatrixHeatMapModel(QObject* parent)
+  : QAbstractTableModel(parent), data_(std::make_unique<Implementation>())
+{
+}
+
+AllowedCollisionMatrixHeatMapModel::~AllowedCollisionMatrixHeatMapModel() = default;
+
+void AllowedCollisionMatrixHeatMapModel::setSourceModel(AllowedCollisionMatrixModel* model)
+{
+  beginResetModel();
+  if (data_->source != nullptr)
+    disconnect(data_->source, nullptr, this, nullptr);
+
+  data_->source = model;
+  if (data_->source != nullptr)
+  {
+    connect(data_->source,
+            &AllowedCollisionMatrixModel::linksChanged,
+            this,
+            &AllowedCollisionMatrixHeatMapModel::onLinksChanged);
+    connect(data_->source,
+            &AllowedCollisionMatrixModel::entryChanged,
+            this,
+            &AllowedCollisionMatrixHeatMapModel::onEntryChanged);
+  }
+
+  data_->update();
+  endResetModel();
+}
+
+AllowedCollisionMatrixModel* AllowedCollisionMatrixHeatMapModel::getSourceModel() const { return data_->source; }
+
+std::array<std::string, 2> AllowedCollisionMatrixHeatMapModel::getLinkNames(const QModelIndex& index) const
+{
+  if (!index.isValid() || data_->source == nullptr)
+    return {};
+
+  const AllowedCollisionMatrixTable& table = data_->source->getTable();
+  return { table.getName(data_->links[static_cast<std::size_t>(index.row())]),
+           table.getName(data_->links[static_cast<std::size_t>(index.column())]) };
+}
+
+int AllowedCollisionMatrixHeatMapModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : static_cast<int>(data_->links.size());
+}
+
+int AllowedCollisionMatrixHeatMapModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : static_cast<int>(data_->links.size());
+}
+
+QVariant AllowedCollisionMatrixHeatMapModel::data(const QModelIndex& index, int role) const
+{
+  if (!index.isValid() || data_->source == nullptr)
+    return {};
+
+  if (role != Qt::BackgroundRole && role != Qt::ToolTipRole)
+    return {};
+
+  const AllowedCollisionMatrixTable& table = data_->source->getTable();
+  const int link1_index = data_->links[static_cast<std::size_t>(index.row())];
+  const int link2_index = data_->links[static_cast<std::size_t>(index.column())];
+  const int reason_index = table.getReasonIndex(link1_index, link2_index);
+
+  if (role == Qt::BackgroundRole)
+  {
+    if (reason_index != AllowedCollisionMatrixTable::INVALID_INDEX)
+      return data_->getReasonBrush(reason_index);
+
+    if (link1_index == link2_index)
+      return data_->diagonal_brush;
+
+    return {};
+  }
+
+  // Qt::ToolTipRole
+  QString tool_tip = QString::fromStdString(table.getName(link1_index) + " / " + table.getName(link2_index));
+  if (reason_index != AllowedCollisionMatrixTable::INVALID_INDEX)
+    tool_tip += QString(": %1").arg(QString::fromStdString(table.getReasonName(reason_index)));
+
+  return tool_tip;
+}
+
+QVariant AllowedCollisionMatrixHeatMapModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if (data_->source == nullptr || section < 0 || section >= static_cast<int>(data_->links.size()))
+    return {};
+
+  const std::string& link_name = data_->source->getTable().getName(data_->links[static_cast<std::size_t>(section)]);
+
+  // Column headers only show the row number of the link to keep the columns narrow
+  if (role == Qt::DisplayRole)
+    return (orientation == Qt::Vertical) ? QVariant(QString::fromStdString(link_name)) : QVariant(section + 1);
+
+  if (role == Qt::ToolTipRole)
+    return QString::fromStdString(link_name);
+
+  return {};
+}
+
+Qt::ItemFlags AllowedCollisionMatrixHeatMapModel::flags(const QModelIndex& index) const
+{
+  if (!index.isValid())
+    return Qt::NoItemFlags;
+
+  return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void AllowedCollisionMatrixHeatMapModel::onLinksChanged()
+{
+  beginResetModel();
+  data_->update();
+  endResetModel();
+}
+
+void AllowedCollisionMatrixHeatMapModel::onEntryChanged(int link1_index, int link2_index)
+{
+  const auto position = [this](int link_index) {
+    return (link_index < 0 || link_index >= static_cast<int>(data_->positions.size())) ?
+               -1 :
+               data_->positions[static_cast<std::size_t>(link_index)];
+  };
+
+  const int row = position(link1_index);
+  const int col = position(link2_index);
+  if (row < 0 || col < 0)
+  {
+    onLinksChanged();
+    return;
+  }
+
+  Q_EMIT dataChanged(index(row, col), index(row, col), { Qt::BackgroundRole, Qt::ToolTipRole });
+  Q_EMIT dataChanged(index(col, row), index(col, row), { Qt::BackgroundRole, Qt::ToolTipRole });
+}
+}  // namespace tesseract::gui
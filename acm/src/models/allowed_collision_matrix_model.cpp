@@ -22,6 +22,7 @@
  */
 
 #include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_table.h>
 #include <tesseract_qt/common/events/allowed_collision_matrix_events.h>
 #include <tesseract_qt/common/events/scene_graph_events.h>
 #include <tesseract_qt/common/models/standard_item_utils.h>
@@ -34,6 +35,8 @@
 #include <tesseract/common/allowed_collision_matrix.h>
 #include <tesseract/environment/environment.h>
 
+#include <algorithm>
+
 #include <QApplication>
 
 namespace tesseract::gui
@@ -41,7 +44,18 @@ namespace tesseract::gui
 struct AllowedCollisionMatrixModel::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
-  std::unordered_map<std::string, QStandardItem*> items;
+
+  /** @brief The interned link table which is the source of truth for the entries */
+  AllowedCollisionMatrixTable table;
+
+  /** @brief The top level item for each interned link index, nullptr if the link has no entries */
+  std::vector<QStandardItem*> link_items;
+
+  /**
+   * @brief The two child items for each entry keyed by AllowedCollisionMatrixTable::makeKey
+   * @details The first is the child of the link with the lower index and the second the child of the other link
+   */
+  std::unordered_map<std::uint64_t, std::array<QStandardItem*, 2>> entry_items;
 };
 
 AllowedCollisionMatrixModel::AllowedCollisionMatrixModel(QObject* parent) : AllowedCollisionMatrixModel(nullptr, parent)
@@ -90,120 +104,147 @@ std::shared_ptr<const ComponentInfo> AllowedCollisionMatrixModel::getComponentIn
   return data_->component_info;
 }
 
+const AllowedCollisionMatrixTable& AllowedCollisionMatrixModel::getTable() const { return data_->table; }
+
+QModelIndex AllowedCollisionMatrixModel::getEntryIndex(const std::string& link1_name,
+                                                       const std::string& link2_name) const
+{
+  const int link1_index = data_->table.getIndex(link1_name);
+  const int link2_index = data_->table.getIndex(link2_name);
+  if (link1_index == AllowedCollisionMatrixTable::INVALID_INDEX ||
+      link2_index == AllowedCollisionMatrixTable::INVALID_INDEX)
+    return {};
+
+  auto it = data_->entry_items.find(AllowedCollisionMatrixTable::makeKey(link1_index, link2_index));
+  if (it == data_->entry_items.end())
+    return {};
+
+  QStandardItem* entry_item = it->second[(link1_index <= link2_index) ? 0 : 1];
+  return (entry_item == nullptr) ? QModelIndex() : entry_item->index();
+}
+
 void AllowedCollisionMatrixModel::set(const tesseract::common::AllowedCollisionMatrix& acm)
 {
   clear();
 
-  for (const auto& ac : acm.getAllAllowedCollisions())
-    add(ac.first.first, ac.first.second, ac.second);
+  data_->table.set(acm);
+  data_->link_items.resize(static_cast<std::size_t>(data_->table.getLinkCount()), nullptr);
+  data_->entry_items.reserve(data_->table.size());
+
+  // Build the detached tree already sorted so it is inserted with a single notification instead of sorting after
+  QList<QStandardItem*> rows;
+  const std::vector<int> links = data_->table.getActiveLinks();
+  rows.reserve(static_cast<int>(links.size()));
+  for (int link_index : links)
+  {
+    std::vector<std::pair<int, int>> link_entries(data_->table.getLinkEntries(link_index).begin(),
+                                                  data_->table.getLinkEntries(link_index).end());
+    std::sort(link_entries.begin(), link_entries.end(), [this](const auto& a, const auto& b) {
+      return data_->table.getName(a.first) < data_->table.getName(b.first);
+    });
+
+    auto* item = new QStandardItem(QString::fromStdString(data_->table.getName(link_index)));
+    item->setCheckable(true);
+    for (const auto& entry : link_entries)
+      appendEntryItem(*item, link_index, entry.first, data_->table.getReasonName(entry.second));
+
+    data_->link_items[static_cast<std::size_t>(link_index)] = item;
+    rows.append(item);
+  }
+
+  invisibleRootItem()->appendRows(rows);
 
-  sort(0);
+  Q_EMIT linksChanged();
 }
 
 void AllowedCollisionMatrixModel::add(const std::string& link1_name,
                                       const std::string& link2_name,
                                       const std::string& reason)
 {
-  auto it1 = data_->items.find(link1_name);
-  if (it1 == data_->items.end())
-  {
-    auto* item = new QStandardItem(QString::fromStdString(link1_name));
-    item->setCheckable(true);
-    data_->items[link1_name] = item;
+  const int link_count = data_->table.getLinkCount();
+  const bool link1_active = (data_->table.getLinkEntryCount(data_->table.getIndex(link1_name)) > 0);
+  const bool link2_active = (data_->table.getLinkEntryCount(data_->table.getIndex(link2_name)) > 0);
+  const bool inserted = data_->table.add(link1_name, link2_name, reason);
+  const int link1_index = data_->table.getIndex(link1_name);
+  const int link2_index = data_->table.getIndex(link2_name);
 
-    auto item_value = createStandardItemString(link2_name, reason);
-    item_value.first()->setCheckable(true);
+  if (data_->table.getLinkCount() != link_count)
+    data_->link_items.resize(static_cast<std::size_t>(data_->table.getLinkCount()), nullptr);
 
-    item->appendRow(item_value);
-    appendRow(item);
+  if (inserted)
+  {
+    appendEntryItems(link1_index, link2_index, reason);
   }
   else
   {
-    auto item_value = createStandardItemString(link2_name, reason);
-    item_value.first()->setCheckable(true);
+    // The entry already exists so only update the reason
+    const auto& entry_items = data_->entry_items.at(AllowedCollisionMatrixTable::makeKey(link1_index, link2_index));
+    for (QStandardItem* entry_item : entry_items)
+    {
+      if (entry_item == nullptr)
+        continue;
 
-    it1->second->appendRow(item_value);
+      QStandardItem* reason_item = entry_item->parent()->child(entry_item->row(), 1);
+      reason_item->setText(QString::fromStdString(reason));
+    }
   }
 
-  auto it2 = data_->items.find(link2_name);
-  if (it2 == data_->items.end())
-  {
-    auto* item = new QStandardItem(QString::fromStdString(link2_name));
-    item->setCheckable(true);
-    data_->items[link2_name] = item;
-
-    auto item_value = createStandardItemString(link1_name, reason);
-    item_value.first()->setCheckable(true);
-
-    item->appendRow(item_value);
-    appendRow(item);
-  }
+  if (link1_active && link2_active)
+    Q_EMIT entryChanged(link1_index, link2_index);
   else
-  {
-    auto item_value = createStandardItemString(link1_name, reason);
-    item_value.first()->setCheckable(true);
-
-    it2->second->appendRow(item_value);
-  }
+    Q_EMIT linksChanged();
 }
 
 void AllowedCollisionMatrixModel::remove(const std::string& link1_name, const std::string& link2_name)
 {
-  auto it1 = data_->items.find(link1_name);
-  if (it1 != data_->items.end())
+  const int link1_index = data_->table.getIndex(link1_name);
+  const int link2_index = data_->table.getIndex(link2_name);
+  if (!data_->table.remove(link1_index, link2_index))
+    return;
+
+  auto it = data_->entry_items.find(AllowedCollisionMatrixTable::makeKey(link1_index, link2_index));
+  for (QStandardItem* entry_item : it->second)
   {
-    for (int row = 0; row < it1->second->rowCount(); ++row)
-    {
-      QStandardItem* child = it1->second->child(row);
-      if (child->text().toStdString() == link2_name)
-      {
-        QModelIndex idx = indexFromItem(child);
-        QStandardItemModel::removeRows(row, 1, idx.parent());
-        break;
-      }
-    }
-    if (it1->second->rowCount() == 0)
-    {
-      QModelIndex idx = indexFromItem(it1->second);
-      QStandardItemModel::removeRows(idx.row(), 1, idx.parent());
-      data_->items.erase(link1_name);
-    }
+    // Entries between a link and itself only have a single item
+    if (entry_item == nullptr)
+      continue;
+
+    QStandardItem* parent = entry_item->parent();
+    parent->removeRow(entry_item->row());
   }
+  data_->entry_items.erase(it);
 
-  auto it2 = data_->items.find(link2_name);
-  if (it2 != data_->items.end())
+  bool links_changed{ false };
+  for (int link_index : { link1_index, link2_index })
   {
-    for (int row = 0; row < it2->second->rowCount(); ++row)
+    QStandardItem*& link_item = data_->link_items[static_cast<std::size_t>(link_index)];
+    if (link_item != nullptr && data_->table.getLinkEntryCount(link_index) == 0)
     {
-      QStandardItem* child = it2->second->child(row);
-      if (child->text().toStdString() == link1_name)
-      {
-        QModelIndex idx = indexFromItem(child);
-        QStandardItemModel::removeRows(row, 1, idx.parent());
-        break;
-      }
-    }
-    if (it2->second->rowCount() == 0)
-    {
-      QModelIndex idx = indexFromItem(it2->second);
-      QStandardItemModel::removeRows(idx.row(), 1, idx.parent());
-      data_->items.erase(link2_name);
+      invisibleRootItem()->removeRow(link_item->row());
+      link_item = nullptr;
+      links_changed = true;
     }
   }
+
+  if (links_changed)
+    Q_EMIT linksChanged();
+  else
+    Q_EMIT entryChanged(link1_index, link2_index);
 }
 
 void AllowedCollisionMatrixModel::remove(const std::string& link_name)
 {
-  auto it1 = data_->items.find(link_name);
-  if (it1 != data_->items.end())
-  {
-    std::vector<std::array<std::string, 2>> link_pairs;
-    for (int row = 0; row < it1->second->rowCount(); ++row)
-      link_pairs.push_back({ link_name, it1->second->child(row)->text().toStdString() });
+  const int link_index = data_->table.getIndex(link_name);
+  if (data_->table.getLinkEntryCount(link_index) == 0)
+    return;
 
-    for (const auto& link_pair : link_pairs)
-      remove(link_pair[0], link_pair[1]);
-  }
+  std::vector<int> partners;
+  partners.reserve(data_->table.getLinkEntryCount(link_index));
+  for (const auto& entry : data_->table.getLinkEntries(link_index))
+    partners.push_back(entry.first);
+
+  for (int partner_index : partners)
+    remove(link_name, data_->table.getName(partner_index));
 }
 
 void AllowedCollisionMatrixModel::clear()
@@ -211,24 +252,49 @@ void AllowedCollisionMatrixModel::clear()
   QStandardItemModel::clear();
   setColumnCount(2);
   setHorizontalHeaderLabels({ "Name", "Values" });
-  data_->items.clear();
+  data_->table.clear();
+  data_->link_items.clear();
+  data_->entry_items.clear();
+
+  Q_EMIT linksChanged();
 }
 
-tesseract::common::AllowedCollisionMatrix AllowedCollisionMatrixModel::getAllowedCollisionMatrix() const
+QStandardItem* AllowedCollisionMatrixModel::getLinkItem(int link_index)
 {
-  tesseract::common::AllowedCollisionMatrix acm;
-  for (int parent_rows = 0; parent_rows < invisibleRootItem()->rowCount(); ++parent_rows)
+  QStandardItem*& link_item = data_->link_items[static_cast<std::size_t>(link_index)];
+  if (link_item == nullptr)
   {
-    QStandardItem* parent = invisibleRootItem()->child(parent_rows);
-    for (int child_row = 0; child_row < parent->rowCount(); ++child_row)
-    {
-      QStandardItem* child = parent->child(child_row);
-      QStandardItem* reason = parent->child(child_row, 1);
-      acm.addAllowedCollision(parent->text().toStdString(), child->text().toStdString(), reason->text().toStdString());
-    }
+    link_item = new QStandardItem(QString::fromStdString(data_->table.getName(link_index)));
+    link_item->setCheckable(true);
+    appendRow(link_item);
   }
+  return link_item;
+}
+
+void AllowedCollisionMatrixModel::appendEntryItem(QStandardItem& link_item,
+                                                  int link_index,
+                                                  int partner_index,
+                                                  const std::string& reason)
+{
+  auto item_value = createStandardItemString(data_->table.getName(partner_index), reason);
+  item_value.first()->setCheckable(true);
+  link_item.appendRow(item_value);
 
-  return acm;
+  auto& entry_items = data_->entry_items[AllowedCollisionMatrixTable::makeKey(link_index, partner_index)];
+  entry_items[(link_index <= partner_index) ? 0 : 1] = item_value.first();
+}
+
+void AllowedCollisionMatrixModel::appendEntryItems(int link1_index, int link2_index, const std::string& reason)
+{
+  // Entries between a link and itself only have a single item, the same as when set from a full matrix
+  appendEntryItem(*getLinkItem(link1_index), link1_index, link2_index, reason);
+  if (link1_index != link2_index)
+    appendEntryItem(*getLinkItem(link2_index), link2_index, link1_index, reason);
+}
+
+tesseract::common::AllowedCollisionMatrix AllowedCollisionMatrixModel::getAllowedCollisionMatrix() const
+{
+  return data_->table.toAllowedCollisionMatrix();
 }
 
 bool AllowedCollisionMatrixModel::setData(const QModelIndex& index, const QVariant& value, int role)
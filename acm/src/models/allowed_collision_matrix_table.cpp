@@ -0,0 +1,240 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/acm/models/allowed_collision_matrix_table.h>
+
+#include <tesseract/common/allowed_collision_matrix.h>
+
+#include <algorithm>
+
+namespace tesseract::gui
+{
+namespace
+{
+const std::unordered_map<int, int> EMPTY_ENTRIES;
+}
+
+std::uint64_t AllowedCollisionMatrixTable::makeKey(int link1_index, int link2_index)
+{
+  const auto a = static_cast<std::uint32_t>(std::min(link1_index, link2_index));
+  const auto b = static_cast<std::uint32_t>(std::max(link1_index, link2_index));
+  return (static_cast<std::uint64_t>(a) << 32U) | b;
+}
+
+void AllowedCollisionMatrixTable::clear()
+{
+  link_names_.clear();
+  link_indices_.clear();
+  reason_names_.clear();
+  reason_indices_.clear();
+  entries_.clear();
+  size_ = 0;
+}
+
+void AllowedCollisionMatrixTable::set(const tesseract::common::AllowedCollisionMatrix& acm)
+{
+  clear();
+
+  const auto& allowed_collisions = acm.getAllAllowedCollisions();
+  link_indices_.reserve(allowed_collisions.size());
+  for (const auto& ac : allowed_collisions)
+  {
+    const int i = internLink(ac.first.first);
+    const int j = internLink(ac.first.second);
+    const int r = internReason(ac.second);
+    if (entries_[static_cast<std::size_t>(i)].emplace(j, r).second)
+    {
+      entries_[static_cast<std::size_t>(j)][i] = r;
+      ++size_;
+    }
+  }
+}
+
+bool AllowedCollisionMatrixTable::add(const std::string& link1_name,
+                                      const std::string& link2_name,
+                                      const std::string& reason)
+{
+  const int i = internLink(link1_name);
+  const int j = internLink(link2_name);
+  const int r = internReason(reason);
+
+  auto result = entries_[static_cast<std::size_t>(i)].insert_or_assign(j, r);
+  entries_[static_cast<std::size_t>(j)][i] = r;
+  if (result.second)
+    ++size_;
+
+  return result.second;
+}
+
+bool AllowedCollisionMatrixTable::remove(int link1_index, int link2_index)
+{
+  if (link1_index < 0 || link2_index < 0 || link1_index >= getLinkCount() || link2_index >= getLinkCount())
+    return false;
+
+  if (entries_[static_cast<std::size_t>(link1_index)].erase(link2_index) == 0)
+    return false;
+
+  entries_[static_cast<std::size_t>(link2_index)].erase(link1_index);
+  --size_;
+  return true;
+}
+
+std::vector<int> AllowedCollisionMatrixTable::remove(int link_index)
+{
+  std::vector<int> partners;
+  if (link_index < 0 || link_index >= getLinkCount())
+    return partners;
+
+  auto& link_entries = entries_[static_cast<std::size_t>(link_index)];
+  partners.reserve(link_entries.size());
+  for (const auto& entry : link_entries)
+  {
+    partners.push_back(entry.first);
+    if (entry.first != link_index)
+      entries_[static_cast<std::size_t>(entry.first)].erase(link_index);
+  }
+
+  size_ -= link_entries.size();
+  link_entries.clear();
+  return partners;
+}
+
+bool AllowedCollisionMatrixTable::isAllowed(int link1_index, int link2_index) const
+{
+  return (getReasonIndex(link1_index, link2_index) != INVALID_INDEX);
+}
+
+const std::string* AllowedCollisionMatrixTable::getReason(int link1_index, int link2_index) const
+{
+  const int r = getReasonIndex(link1_index, link2_index);
+  return (r == INVALID_INDEX) ? nullptr : &reason_names_[static_cast<std::size_t>(r)];
+}
+
+int AllowedCollisionMatrixTable::getReasonIndex(int link1_index, int link2_index) const
+{
+  if (link1_index < 0 || link2_index < 0 || link1_index >= getLinkCount() || link2_index >= getLinkCount())
+    return INVALID_INDEX;
+
+  const auto& link_entries = entries_[static_cast<std::size_t>(link1_index)];
+  auto it = link_entries.find(link2_index);
+  return (it == link_entries.end()) ? INVALID_INDEX : it->second;
+}
+
+const std::string& AllowedCollisionMatrixTable::getReasonName(int reason_index) const
+{
+  return reason_names_.at(static_cast<std::size_t>(reason_index));
+}
+
+int AllowedCollisionMatrixTable::getReasonCount() const { return static_cast<int>(reason_names_.size()); }
+
+int AllowedCollisionMatrixTable::getIndex(const std::string& link_name) const
+{
+  auto it = link_indices_.find(link_name);
+  return (it == link_indices_.end()) ? INVALID_INDEX : it->second;
+}
+
+const std::string& AllowedCollisionMatrixTable::getName(int link_index) const
+{
+  return link_names_.at(static_cast<std::size_t>(link_index));
+}
+
+int AllowedCollisionMatrixTable::getLinkCount() const { return static_cast<int>(link_names_.size()); }
+
+std::size_t AllowedCollisionMatrixTable::getLinkEntryCount(int link_index) const
+{
+  return getLinkEntries(link_index).size();
+}
+
+const std::unordered_map<int, int>& AllowedCollisionMatrixTable::getLinkEntries(int link_index) const
+{
+  if (link_index < 0 || link_index >= getLinkCount())
+    return EMPTY_ENTRIES;
+
+  return entries_[static_cast<std::size_t>(link_index)];
+}
+
+std::vector<int> AllowedCollisionMatrixTable::getActiveLinks() const
+{
+  std::vector<int> links;
+  links.reserve(link_names_.size());
+  for (std::size_t i = 0; i < entries_.size(); ++i)
+  {
+    if (!entries_[i].empty())
+      links.push_back(static_cast<int>(i));
+  }
+
+  std::sort(links.begin(), links.end(), [this](int a, int b) {
+    return link_names_[static_cast<std::size_t>(a)] < link_names_[static_cast<std::size_t>(b)];
+  });
+
+  return links;
+}
+
+std::size_t AllowedCollisionMatrixTable::size() const { return size_; }
+
+bool AllowedCollisionMatrixTable::empty() const { return (size_ == 0); }
+
+tesseract::common::AllowedCollisionMatrix AllowedCollisionMatrixTable::toAllowedCollisionMatrix() const
+{
+  tesseract::common::AllowedCollisionMatrix acm;
+  for (std::size_t i = 0; i < entries_.size(); ++i)
+  {
+    for (const auto& entry : entries_[i])
+    {
+      // Each entry is stored in both directions so only add it once
+      if (static_cast<std::size_t>(entry.first) < i)
+        continue;
+
+      acm.addAllowedCollision(link_names_[i],
+                              link_names_[static_cast<std::size_t>(entry.first)],
+                              reason_names_[static_cast<std::size_t>(entry.second)]);
+    }
+  }
+  return acm;
+}
+
+int AllowedCollisionMatrixTable::internLink(const std::string& link_name)
+{
+  auto it = link_indices_.find(link_name);
+  if (it != link_indices_.end())
+    return it->second;
+
+  const int index = static_cast<int>(link_names_.size());
+  link_names_.push_back(link_name);
+  link_indices_[link_name] = index;
+  entries_.emplace_back();
+  return index;
+}
+
+int AllowedCollisionMatrixTable::internReason(const std::string& reason)
+{
+  auto it = reason_indices_.find(reason);
+  if (it != reason_indices_.end())
+    return it->second;
+
+  const int index = static_cast<int>(reason_names_.size());
+  reason_names_.push_back(reason);
+  reason_indices_[reason] = index;
+  return index;
+}
+}  // namespace tesseract::gui
@@ -64,6 +64,7 @@ AllowedCollisionMatrixEditorWidget::AllowedCollisionMatrixEditorWidget(
   connect(ui_->removePushButton, SIGNAL(clicked()), this, SLOT(onRemoveButtonClicked()));
   connect(ui_->addPushButton, SIGNAL(clicked()), this, SLOT(onAddButtonClicked()));
   connect(ui_->applyPushButton, SIGNAL(clicked()), this, SLOT(onApplyButtonClicked()));
+  connect(ui_->matrixViewCheckBox, SIGNAL(toggled(bool)), this, SLOT(onMatrixViewToggled(bool)));
 }
 
 AllowedCollisionMatrixEditorWidget::~AllowedCollisionMatrixEditorWidget() = default;
@@ -140,4 +141,10 @@ void AllowedCollisionMatrixEditorWidget::onApplyButtonClicked()
   QApplication::sendEvent(qApp, &event);
 }
 
+void AllowedCollisionMatrixEditorWidget::onMatrixViewToggled(bool checked)
+{
+  ui_->acm_widget->setMatrixViewVisible(checked);
+  ui_->removePushButton->setEnabled(!checked);
+}
+
 }  // namespace tesseract::gui
@@ -0,0 +1,107 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/acm/widgets/allowed_collision_matrix_heat_map_widget.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_heat_map_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
+
+#include <QVBoxLayout>
+#include <QTableView>
+#include <QHeaderView>
+
+namespace tesseract::gui
+{
+struct AllowedCollisionMatrixHeatMapWidget::Implementation
+{
+  std::shared_ptr<AllowedCollisionMatrixModel> model;
+  AllowedCollisionMatrixHeatMapModel* heat_map_model;
+  QVBoxLayout* layout;
+  QTableView* table_view;
+  int cell_size{ 16 };
+};
+
+AllowedCollisionMatrixHeatMapWidget::AllowedCollisionMatrixHeatMapWidget(QWidget* parent)
+  : QWidget(parent), data_(std::make_unique<Implementation>())
+{
+  data_->heat_map_model = new AllowedCollisionMatrixHeatMapModel(this);
+
+  // Create table view, fixed section sizes avoid measuring every cell when the matrix is large
+  data_->table_view = new QTableView();
+  data_->table_view->setEditTriggers(QAbstractItemView::EditTrigger::NoEditTriggers);
+  data_->table_view->setSelectionMode(QAbstractItemView::SelectionMode::SingleSelection);
+  data_->table_view->setWordWrap(false);
+  data_->table_view->horizontalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  data_->table_view->horizontalHeader()->setMinimumSectionSize(1);
+  data_->table_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  data_->table_view->verticalHeader()->setMinimumSectionSize(1);
+  data_->table_view->setModel(data_->heat_map_model);
+  setCellSize(data_->cell_size);
+
+  connect(data_->table_view->selectionModel(),
+          &QItemSelectionModel::currentChanged,
+          this,
+          [this](const QModelIndex& current, const QModelIndex& /*previous*/) {
+            if (!current.isValid())
+              return;
+
+            auto link_names = data_->heat_map_model->getLinkNames(current);
+            Q_EMIT entrySelected(QString::fromStdString(link_names[0]), QString::fromStdString(link_names[1]));
+          });
+
+  // Create layout
+  data_->layout = new QVBoxLayout();
+  data_->layout->setMargin(0);
+  data_->layout->setSpacing(0);
+  data_->layout->addWidget(data_->table_view);
+
+  // Set layout
+  setLayout(data_->layout);
+}
+
+AllowedCollisionMatrixHeatMapWidget::~AllowedCollisionMatrixHeatMapWidget() = default;
+
+void AllowedCollisionMatrixHeatMapWidget::setModel(std::shared_ptr<AllowedCollisionMatrixModel> model)
+{
+  data_->model = std::move(model);
+  data_->heat_map_model->setSourceModel(data_->model.get());
+}
+
+std::shared_ptr<AllowedCollisionMatrixModel> AllowedCollisionMatrixHeatMapWidget::getModel() { return data_->model; }
+std::shared_ptr<const AllowedCollisionMatrixModel> AllowedCollisionMatrixHeatMapWidget::getModel() const
+{
+  return data_->model;
+}
+
+void AllowedCollisionMatrixHeatMapWidget::setCellSize(int size)
+{
+  data_->cell_size = size;
+  data_->table_view->horizontalHeader()->setDefaultSectionSize(size);
+  data_->table_view->verticalHeader()->setDefaultSectionSize(size);
+}
+
+int AllowedCollisionMatrixHeatMapWidget::getCellSize() const { return data_->cell_size; }
+
+QTableView& AllowedCollisionMatrixHeatMapWidget::getTableView() { return *data_->table_view; }
+const QTableView& AllowedCollisionMatrixHeatMapWidget::getTableView() const { return *data_->table_view; }
+
+}  // namespace tesseract::gui
@@ -22,11 +22,14 @@
  */
 
 #include <tesseract_qt/acm/widgets/allowed_collision_matrix_widget.h>
+#include <tesseract_qt/acm/widgets/allowed_collision_matrix_heat_map_widget.h>
 #include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
 #include <tesseract_qt/common/widgets/tree_view.h>
 #include <tesseract_qt/common/component_info.h>
 
 #include <QVBoxLayout>
+#include <QItemSelectionModel>
+#include <QStackedWidget>
 
 namespace tesseract::gui
 {
@@ -34,7 +37,9 @@ struct AllowedCollisionMatrixWidget::Implementation
 {
   std::shared_ptr<AllowedCollisionMatrixModel> model;
   QVBoxLayout* layout;
+  QStackedWidget* stacked_widget;
   TreeView* tree_view;
+  AllowedCollisionMatrixHeatMapWidget* heat_map_widget;
 };
 
 AllowedCollisionMatrixWidget::AllowedCollisionMatrixWidget(QWidget* parent)
@@ -54,11 +59,31 @@ AllowedCollisionMatrixWidget::AllowedCollisionMatrixWidget(std::shared_ptr<const
   data_->tree_view->setEditTriggers(QAbstractItemView::EditTrigger::NoEditTriggers);
   data_->tree_view->setModel(data_->model.get());
 
+  // Create matrix view
+  data_->heat_map_widget = new AllowedCollisionMatrixHeatMapWidget();
+  connect(data_->heat_map_widget,
+          &AllowedCollisionMatrixHeatMapWidget::entrySelected,
+          this,
+          [this](const QString& link1_name, const QString& link2_name) {
+            // Keep the tree selection in sync so actions on the selection apply to the cell picked in the matrix
+            QModelIndex index = data_->model->getEntryIndex(link1_name.toStdString(), link2_name.toStdString());
+            if (!index.isValid())
+              return;
+
+            data_->tree_view->selectionModel()->setCurrentIndex(
+                index, QItemSelectionModel::ClearAndSelect | QItemSelectionModel::Rows);
+            data_->tree_view->scrollTo(index);
+          });
+
+  data_->stacked_widget = new QStackedWidget();
+  data_->stacked_widget->addWidget(data_->tree_view);
+  data_->stacked_widget->addWidget(data_->heat_map_widget);
+
   // Create layout
   data_->layout = new QVBoxLayout();
   data_->layout->setMargin(0);
   data_->layout->setSpacing(0);
-  data_->layout->addWidget(data_->tree_view);
+  data_->layout->addWidget(data_->stacked_widget);
 
   // Set layout
   setLayout(data_->layout);
@@ -70,6 +95,8 @@ void AllowedCollisionMatrixWidget::setComponentInfo(std::shared_ptr<const Compon
   // Create model
   data_->model = std::make_shared<AllowedCollisionMatrixModel>(std::move(component_info));
   data_->tree_view->setModel(data_->model.get());
+  if (isMatrixViewVisible())
+    data_->heat_map_widget->setModel(data_->model);
 }
 
 std::shared_ptr<const ComponentInfo> AllowedCollisionMatrixWidget::getComponentInfo() const
@@ -81,6 +108,8 @@ void AllowedCollisionMatrixWidget::setModel(std::shared_ptr<AllowedCollisionMatr
 {
   data_->model = std::move(model);
   data_->tree_view->setModel(data_->model.get());
+  if (isMatrixViewVisible())
+    data_->heat_map_widget->setModel(data_->model);
 }
 std::shared_ptr<AllowedCollisionMatrixModel> AllowedCollisionMatrixWidget::getModel() { return data_->model; }
 std::shared_ptr<const AllowedCollisionMatrixModel> AllowedCollisionMatrixWidget::getModel() const
@@ -94,4 +123,16 @@ const QItemSelectionModel& AllowedCollisionMatrixWidget::getSelectionModel() con
   return *data_->tree_view->selectionModel();
 }
 
+void AllowedCollisionMatrixWidget::setMatrixViewVisible(bool visible)
+{
+  data_->heat_map_widget->setModel(visible ? data_->model : nullptr);
+  data_->stacked_widget->setCurrentWidget(visible ? static_cast<QWidget*>(data_->heat_map_widget) :
+                                                    static_cast<QWidget*>(data_->tree_view));
+}
+
+bool AllowedCollisionMatrixWidget::isMatrixViewVisible() const
+{
+  return (data_->stacked_widget->currentWidget() == data_->heat_map_widget);
+}
+
 }  // namespace tesseract::gui
@@ -0,0 +1,174 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <tesseract_qt/common/entity_manager.h>
+#include <tesseract_qt/common/entity_container.h>
+#include <tesseract_qt/common/entity_registry.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> createNames(std::size_t size)
+{
+  std::vector<std::string> names;
+  names.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+    names.push_back("link_" + std::to_string(i));
+
+  return names;
+}
+}  // namespace
+
+static void BM_EntityManagerCreateEntity(benchmark::State& state)
+{
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  for (auto _ : state)
+    benchmark::DoNotOptimize(manager->createEntity());
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EntityManagerCreateEntity);
+
+static void BM_EntityContainerAddTrackedEntity(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  for (auto _ : state)
+  {
+    auto container = manager->getEntityContainer("benchmark");
+    for (const auto& name : names)
+      benchmark::DoNotOptimize(container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name));
+
+    state.PauseTiming();
+    manager->removeEntityContainer("benchmark");
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerAddTrackedEntity)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityContainerAddTrackedEntities(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  for (auto _ : state)
+  {
+    auto container = manager->getEntityContainer("benchmark");
+    benchmark::DoNotOptimize(container->addTrackedEntities(tesseract::gui::EntityContainer::VISUAL_NS, names));
+
+    state.PauseTiming();
+    manager->removeEntityContainer("benchmark");
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerAddTrackedEntities)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityContainerGetTrackedEntity(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  auto container = manager->getEntityContainer("benchmark");
+  for (const auto& name : names)
+    container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name);
+
+  for (auto _ : state)
+  {
+    for (const auto& name : names)
+      benchmark::DoNotOptimize(container->getTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerGetTrackedEntity)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityContainerHasTrackedEntity(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  auto container = manager->getEntityContainer("benchmark");
+  for (const auto& name : names)
+    container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name);
+
+  for (auto _ : state)
+  {
+    for (const auto& name : names)
+      benchmark::DoNotOptimize(container->hasTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerHasTrackedEntity)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityContainerGetTrackedEntities(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  auto container = manager->getEntityContainer("benchmark");
+  for (const auto& name : names)
+    container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, name);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(container->getTrackedEntities(tesseract::gui::EntityContainer::VISUAL_NS));
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerGetTrackedEntities)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityContainerGetEntityIds(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  auto container = manager->getEntityContainer("benchmark");
+  container->addTrackedEntities(tesseract::gui::EntityContainer::VISUAL_NS, names);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(container->getEntityIds());
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityContainerGetEntityIds)->RangeMultiplier(10)->Range(100, 100000);
+
+static void BM_EntityRegistryGetId(benchmark::State& state)
+{
+  const std::vector<std::string> names = createNames(static_cast<std::size_t>(state.range(0)));
+  auto manager = std::make_shared<tesseract::gui::EntityManager>();
+  auto container = manager->getEntityContainer("benchmark");
+  container->addTrackedEntities(tesseract::gui::EntityContainer::VISUAL_NS, names);
+
+  tesseract::gui::EntityHandleVector handles;
+  handles.reserve(names.size());
+  for (const auto& name : names)
+    handles.push_back(container->getTrackedEntityHandle(tesseract::gui::EntityContainer::VISUAL_NS, name));
+
+  const tesseract::gui::EntityRegistry& registry = manager->getRegistry();
+  for (auto _ : state)
+  {
+    for (const auto& handle : handles)
+      benchmark::DoNotOptimize(registry.getId(handle));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityRegistryGetId)->RangeMultiplier(10)->Range(100, 100000);
@@ -0,0 +1,109 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <QApplication>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/component_info_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/scene_graph/models/scene_graph_model.h>
+#include <tesseract_qt/scene_graph/models/scene_state_model.h>
+#include <tesseract_qt/environment/models/environment_commands_model.h>
+#include <tesseract_qt/kinematic_groups/models/kinematic_groups_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/common/resource_locator.h>
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace
+{
+std::shared_ptr<tesseract::environment::Environment> createEnvironment()
+{
+  auto locator = std::make_shared<tesseract::common::GeneralResourceLocator>();
+  std::filesystem::path urdf_path(
+      locator->locateResource("package://tesseract/support/urdf/lbr_iiwa_14_r820.urdf")->getFilePath());
+  std::filesystem::path srdf_path(
+      locator->locateResource("package://tesseract/support/urdf/lbr_iiwa_14_r820.srdf")->getFilePath());
+
+  auto env = std::make_shared<tesseract::environment::Environment>();
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+}  // namespace
+
+/**
+ * @brief Measures the cost of sending a scene state event through the application event filters
+ * @details The argument is the number of scene state models listening on the same component info which is
+ * representative of the number of widgets displaying the same environment.
+ */
+static void BM_SceneStateChangedDispatch(benchmark::State& state)
+{
+  auto env = createEnvironment();
+  auto component_info = tesseract::gui::ComponentInfoManager::create("benchmark");
+
+  std::vector<std::unique_ptr<tesseract::gui::SceneStateModel>> models;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    models.push_back(std::make_unique<tesseract::gui::SceneStateModel>(component_info));
+
+  const tesseract::scene_graph::SceneState scene_state = env->getState();
+  for (auto _ : state)
+  {
+    tesseract::gui::events::SceneStateChanged event(component_info, scene_state);
+    QApplication::sendEvent(qApp, &event);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SceneStateChangedDispatch)->Arg(0)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Measures the full environment broadcast consumed by the environment related models
+ * @details The argument is the number of copies of each listening model.
+ */
+static void BM_EnvironmentWrapperBroadcast(benchmark::State& state)
+{
+  auto component_info = tesseract::gui::ComponentInfoManager::create("benchmark");
+  tesseract::gui::DefaultEnvironmentWrapper env_wrapper(component_info, createEnvironment());
+
+  std::vector<std::unique_ptr<QObject>> models;
+  for (int64_t i = 0; i < state.range(0); ++i)
+  {
+    models.push_back(std::make_unique<tesseract::gui::SceneGraphModel>(component_info));
+    models.push_back(std::make_unique<tesseract::gui::SceneStateModel>(component_info));
+    models.push_back(std::make_unique<tesseract::gui::EnvironmentCommandsModel>(component_info));
+    models.push_back(std::make_unique<tesseract::gui::KinematicGroupsModel>(component_info));
+    models.push_back(std::make_unique<tesseract::gui::AllowedCollisionMatrixModel>(component_info));
+  }
+
+  for (auto _ : state)
+    env_wrapper.broadcast();
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EnvironmentWrapperBroadcast)->Arg(0)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,97 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+
+#include <tesseract/common/joint_state.h>
+
+#include <QDir>
+#include <QFile>
+
+#include <cmath>
+#include <string>
+
+namespace
+{
+tesseract::common::JointTrajectory createJointTrajectory(std::size_t size, Eigen::Index dof)
+{
+  std::vector<std::string> joint_names;
+  for (Eigen::Index j = 0; j < dof; ++j)
+    joint_names.push_back("joint_" + std::to_string(j));
+
+  tesseract::common::JointTrajectory trajectory;
+  trajectory.states.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const double t = 0.01 * static_cast<double>(i);
+    tesseract::common::JointState state;
+    state.joint_names = joint_names;
+    state.position = Eigen::VectorXd::Constant(dof, std::sin(t));
+    state.velocity = Eigen::VectorXd::Constant(dof, std::cos(t));
+    state.acceleration = Eigen::VectorXd::Constant(dof, -std::sin(t));
+    state.time = t;
+    trajectory.states.push_back(std::move(state));
+  }
+  return trajectory;
+}
+}  // namespace
+
+static void BM_JointTrajectoryBufferCreate(benchmark::State& state)
+{
+  const tesseract::common::JointTrajectory trajectory =
+      createJointTrajectory(static_cast<std::size_t>(state.range(0)), 7);
+  for (auto _ : state)
+  {
+    tesseract::gui::JointTrajectoryBuffer buffer(trajectory);
+    benchmark::DoNotOptimize(buffer.getPosition().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JointTrajectoryBufferCreate)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+/** @brief Open an archive of range(0) trajectories and read one column of the last, which is what browsing does */
+static void BM_JointTrajectoryArchiveOpen(benchmark::State& state)
+{
+  const std::string filename = QDir::temp().filePath("tesseract_qt_benchmark.jta").toStdString();
+  {
+    const tesseract::gui::JointTrajectoryBuffer buffer(createJointTrajectory(1000, 7));
+    tesseract::gui::JointTrajectoryArchiveWriter writer(filename);
+    for (int64_t i = 0; i < state.range(0); ++i)
+      writer.append("run_" + std::to_string(i % 10), "trajectory_" + std::to_string(i), buffer);
+    writer.close();
+  }
+
+  for (auto _ : state)
+  {
+    tesseract::gui::JointTrajectoryArchive archive(filename);
+    const std::size_t last = archive.size() - 1;
+    double sum = archive.getValues(last, tesseract::gui::JointTrajectoryBuffer::Quantity::POSITION).col(0).sum();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  QFile::remove(QString::fromStdString(filename));
+}
+BENCHMARK(BM_JointTrajectoryArchiveOpen)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,175 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <QApplication>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/component_info_manager.h>
+#include <tesseract_qt/common/tool_path.h>
+#include <tesseract_qt/common/events/allowed_collision_matrix_events.h>
+#include <tesseract_qt/common/events/contact_results_events.h>
+#include <tesseract_qt/common/events/tool_path_events.h>
+#include <tesseract_qt/scene_graph/models/scene_state_model.h>
+#include <tesseract_qt/tool_path/models/tool_path_model.h>
+#include <tesseract_qt/collision/models/contact_results_model.h>
+#include <tesseract_qt/acm/models/allowed_collision_matrix_model.h>
+
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/common/allowed_collision_matrix.h>
+
+#include <algorithm>
+#include <string>
+
+namespace
+{
+tesseract::scene_graph::SceneState createSceneState(std::size_t size)
+{
+  tesseract::scene_graph::SceneState scene_state;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const std::string joint_name = "joint_" + std::to_string(i);
+    const std::string link_name = "link_" + std::to_string(i);
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(0, 0, 0.1 * static_cast<double>(i));
+
+    scene_state.joints[joint_name] = 0.01 * static_cast<double>(i);
+    scene_state.joint_transforms[joint_name] = pose;
+    scene_state.link_transforms[link_name] = pose;
+  }
+  return scene_state;
+}
+
+tesseract::gui::ToolPath createToolPath(std::size_t size)
+{
+  const std::size_t segment_size = 100;
+  tesseract::gui::ToolPath tool_path("benchmark");
+  tool_path.reserve((size / segment_size) + 1);
+  for (std::size_t i = 0; i < size; i += segment_size)
+  {
+    tesseract::gui::ToolPathSegment segment;
+    segment.reserve(segment_size);
+    for (std::size_t j = i; j < std::min(i + segment_size, size); ++j)
+    {
+      Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+      pose.translation() = Eigen::Vector3d(0.001 * static_cast<double>(j), 0, 0);
+      segment.push_back(tesseract::gui::ToolPathPose(pose));
+    }
+    tool_path.push_back(segment);
+  }
+  return tool_path;
+}
+
+tesseract::gui::ContactResultMap createContactResults(std::size_t size)
+{
+  const std::size_t pair_size = 10;
+  tesseract::gui::ContactResultMap contact_results;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    tesseract::collision::ContactResult contact_result;
+    contact_result.link_names[0] = "link_" + std::to_string(i / pair_size);
+    contact_result.link_names[1] = "link_" + std::to_string((i / pair_size) + 1);
+    contact_result.distance = -0.001 * static_cast<double>(i % pair_size);
+    contact_result.nearest_points[0] = Eigen::Vector3d::Zero();
+    contact_result.nearest_points[1] = Eigen::Vector3d::UnitX();
+    contact_result.normal = Eigen::Vector3d::UnitX();
+
+    auto key = std::make_pair(contact_result.link_names[0], contact_result.link_names[1]);
+    contact_results[key]().push_back(tesseract::gui::ContactResult(contact_result));
+  }
+  return contact_results;
+}
+
+tesseract::common::AllowedCollisionMatrix createAllowedCollisionMatrix(std::size_t link_count, std::size_t size)
+{
+  tesseract::common::AllowedCollisionMatrix acm;
+  std::size_t count{ 0 };
+  for (std::size_t i = 0; i < link_count && count < size; ++i)
+  {
+    for (std::size_t j = i + 1; j < link_count && count < size; ++j, ++count)
+      acm.addAllowedCollision("link_" + std::to_string(i), "link_" + std::to_string(j), "Never");
+  }
+  return acm;
+}
+}  // namespace
+
+static void BM_SceneStateModelSetState(benchmark::State& state)
+{
+  const tesseract::scene_graph::SceneState scene_state = createSceneState(static_cast<std::size_t>(state.range(0)));
+  tesseract::gui::SceneStateModel model;
+  for (auto _ : state)
+    model.setState(scene_state);
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SceneStateModelSetState)->RangeMultiplier(4)->Range(8, 512)->Unit(benchmark::kMicrosecond);
+
+static void BM_ToolPathModelAdd(benchmark::State& state)
+{
+  auto component_info = tesseract::gui::ComponentInfoManager::create("benchmark");
+  const tesseract::gui::ToolPath tool_path = createToolPath(static_cast<std::size_t>(state.range(0)));
+  tesseract::gui::ToolPathModel model(component_info);
+  for (auto _ : state)
+  {
+    tesseract::gui::events::ToolPathAdd add_event(component_info, tool_path);
+    QApplication::sendEvent(qApp, &add_event);
+
+    state.PauseTiming();
+    tesseract::gui::events::ToolPathRemoveAll remove_event(component_info);
+    QApplication::sendEvent(qApp, &remove_event);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToolPathModelAdd)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ContactResultsModelSet(benchmark::State& state)
+{
+  auto component_info = tesseract::gui::ComponentInfoManager::create("benchmark");
+  const tesseract::gui::ContactResultMap contact_results =
+      createContactResults(static_cast<std::size_t>(state.range(0)));
+  tesseract::gui::ContactResultsModel model(component_info);
+  for (auto _ : state)
+  {
+    tesseract::gui::events::ContactResultsSet event(component_info, contact_results);
+    QApplication::sendEvent(qApp, &event);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ContactResultsModelSet)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+
+static void BM_AllowedCollisionMatrixModelSet(benchmark::State& state)
+{
+  auto component_info = tesseract::gui::ComponentInfoManager::create("benchmark");
+  const tesseract::common::AllowedCollisionMatrix acm =
+      createAllowedCollisionMatrix(200, static_cast<std::size_t>(state.range(0)));
+  tesseract::gui::AllowedCollisionMatrixModel model(component_info);
+  for (auto _ : state)
+  {
+    tesseract::gui::events::AllowedCollisionMatrixSet event(component_info, acm);
+    QApplication::sendEvent(qApp, &event);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AllowedCollisionMatrixModelSet)->RangeMultiplier(10)->Range(200, 20000)->Unit(benchmark::kMillisecond);
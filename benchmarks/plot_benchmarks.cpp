@@ -0,0 +1,221 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <tesseract_qt/plot/plot_data.h>
+#include <tesseract_qt/plot/point_series_xy.h>
+
+#include <cmath>
+
+namespace
+{
+/** @brief Sample period of a 250 Hz signal */
+constexpr double SAMPLE_PERIOD = 0.004;
+
+void fill(tesseract::gui::PlotData& plot_data, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const double t = static_cast<double>(i) * SAMPLE_PERIOD;
+    plot_data.pushBack({ t, std::sin(t) });
+  }
+}
+}  // namespace
+
+static void BM_PlotDataPushBack(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state)
+  {
+    tesseract::gui::PlotData plot_data("benchmark", nullptr);
+    fill(plot_data, size);
+    benchmark::DoNotOptimize(plot_data.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PlotDataPushBack)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_PlotDataPushBackOutOfOrder(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state)
+  {
+    tesseract::gui::PlotData plot_data("benchmark", nullptr);
+    fill(plot_data, size);
+
+    // Late samples which have to be inserted in order
+    for (std::size_t i = 0; i < 100; ++i)
+      plot_data.pushBack({ static_cast<double>(size - (i * 10)) * SAMPLE_PERIOD, 0.0 });
+
+    benchmark::DoNotOptimize(plot_data.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PlotDataPushBackOutOfOrder)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_PlotDataPushBackMaximumRange(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotData plot_data("benchmark", nullptr);
+  plot_data.setMaximumRangeX(10.0);
+  double t{ 0 };
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      plot_data.pushBack({ t, std::sin(t) });
+      t += SAMPLE_PERIOD;
+    }
+  }
+  benchmark::DoNotOptimize(plot_data.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PlotDataPushBackMaximumRange)->Arg(1000)->Arg(100000);
+
+static void BM_PlotDataGetIndexFromX(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotData plot_data("benchmark", nullptr);
+  fill(plot_data, size);
+
+  const double range = static_cast<double>(size) * SAMPLE_PERIOD;
+  double x{ 0 };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(plot_data.getIndexFromX(x));
+    x = std::fmod(x + 0.37, range);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlotDataGetIndexFromX)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_PlotDataGetYFromX(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotData plot_data("benchmark", nullptr);
+  fill(plot_data, size);
+
+  const double range = static_cast<double>(size) * SAMPLE_PERIOD;
+  double x{ 0 };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(plot_data.getYfromX(x));
+    x = std::fmod(x + 0.37, range);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlotDataGetYFromX)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_PlotDataRange(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotData plot_data("benchmark", nullptr);
+  fill(plot_data, size);
+
+  for (auto _ : state)
+  {
+    // Popping the front sample marks the cached ranges dirty forcing a full scan
+    state.PauseTiming();
+    plot_data.popFront();
+    plot_data.pushBack({ plot_data.back().x + SAMPLE_PERIOD, 0.0 });
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(plot_data.rangeX());
+    benchmark::DoNotOptimize(plot_data.rangeY());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PlotDataRange)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_PlotDataMapRefGetOrCreateNumeric(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<std::string> names;
+  names.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+    names.push_back("/joint_" + std::to_string(i) + "/position");
+
+  tesseract::gui::PlotDataMapRef plot_data_map;
+  for (const auto& name : names)
+    plot_data_map.getOrCreateNumeric(name);
+
+  for (auto _ : state)
+  {
+    for (const auto& name : names)
+      benchmark::DoNotOptimize(&plot_data_map.getOrCreateNumeric(name));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PlotDataMapRefGetOrCreateNumeric)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_PointSeriesXYUpdateCacheAppend(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotData x_data("x", nullptr);
+  tesseract::gui::PlotData y_data("y", nullptr);
+  fill(x_data, size);
+  fill(y_data, size);
+
+  tesseract::gui::PointSeriesXY series(&x_data, &y_data);
+  series.setDecimation(QRectF(-1, -1, 2, 2), 1000, 600);
+  double t = static_cast<double>(size) * SAMPLE_PERIOD;
+  for (auto _ : state)
+  {
+    // Append one refresh worth of samples and join the tail
+    for (std::size_t i = 0; i < 10; ++i, t += SAMPLE_PERIOD)
+    {
+      x_data.pushBack({ t, std::sin(t) });
+      y_data.pushBack({ t, std::cos(t) });
+    }
+
+    series.updateCache(false);
+    benchmark::DoNotOptimize(series.size());
+  }
+}
+BENCHMARK(BM_PointSeriesXYUpdateCacheAppend)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_PlotDataMapRefIngestAndDrain(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  tesseract::gui::PlotDataMapRef plot_data_map;
+  std::vector<tesseract::gui::PlotDataIngestBuffer::Ptr> buffers;
+  for (std::size_t i = 0; i < size; ++i)
+    buffers.push_back(plot_data_map.getOrCreateIngestBuffer("/joint_" + std::to_string(i) + "/position"));
+
+  plot_data_map.setMaximumRangeX(10.0);
+  double t{ 0 };
+  for (auto _ : state)
+  {
+    // One frame worth of samples at 1 kHz for each series
+    for (std::size_t i = 0; i < 16; ++i, t += 0.001)
+    {
+      for (auto& buffer : buffers)
+        buffer->push({ t, std::sin(t) });
+    }
+
+    benchmark::DoNotOptimize(plot_data_map.drainIngestBuffers());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 16);
+}
+BENCHMARK(BM_PlotDataMapRefIngestAndDrain)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,80 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <tesseract_qt/rendering/gazebo_utils.h>
+
+#include <tesseract/geometry/impl/mesh.h>
+
+#include <gz/common/SubMesh.hh>
+
+namespace
+{
+/** @brief Create a triangulated grid mesh with (size + 1)^2 vertices and 2 * size^2 triangles */
+std::shared_ptr<tesseract::geometry::Mesh> createGridMesh(int size)
+{
+  auto vertices = std::make_shared<tesseract::common::VectorVector3d>();
+  vertices->reserve(static_cast<std::size_t>((size + 1) * (size + 1)));
+  for (int i = 0; i <= size; ++i)
+  {
+    for (int j = 0; j <= size; ++j)
+      vertices->emplace_back(0.01 * i, 0.01 * j, 0.0);
+  }
+
+  auto faces = std::make_shared<Eigen::VectorXi>(8 * size * size);
+  int idx{ 0 };
+  for (int i = 0; i < size; ++i)
+  {
+    for (int j = 0; j < size; ++j)
+    {
+      const int v0 = (i * (size + 1)) + j;
+      const int v1 = v0 + 1;
+      const int v2 = v0 + size + 1;
+      const int v3 = v2 + 1;
+      (*faces)(idx++) = 3;
+      (*faces)(idx++) = v0;
+      (*faces)(idx++) = v1;
+      (*faces)(idx++) = v3;
+      (*faces)(idx++) = 3;
+      (*faces)(idx++) = v0;
+      (*faces)(idx++) = v3;
+      (*faces)(idx++) = v2;
+    }
+  }
+
+  return std::make_shared<tesseract::geometry::Mesh>(vertices, faces);
+}
+}  // namespace
+
+static void BM_ConvertPolygonMesh(benchmark::State& state)
+{
+  auto mesh = createGridMesh(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    gz::common::SubMesh sub_mesh = tesseract::gui::convert(*mesh);
+    benchmark::DoNotOptimize(sub_mesh.IndexCount());
+  }
+  state.SetItemsProcessed(state.iterations() * mesh->getFaceCount());
+}
+BENCHMARK(BM_ConvertPolygonMesh)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,53 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COLLISION_CONTACT_RESULT_TIME_STANDARD_ITEM_H
+#define TESSERACT_QT_COLLISION_CONTACT_RESULT_TIME_STANDARD_ITEM_H
+
+#include <tesseract_qt/collision/models/contact_result_map_standard_item.h>
+
+namespace tesseract::gui
+{
+/** @brief The contacts of one trajectory state, selecting it moves the joint trajectory player to its time */
+class ContactResultTimeStandardItem : public ContactResultMapStandardItem
+{
+public:
+  explicit ContactResultTimeStandardItem(const ContactResultTimelineEntry& entry);
+  int type() const override;
+
+  /** @brief The trajectory state index */
+  std::size_t getIndex() const;
+
+  /** @brief The trajectory time */
+  double getTime() const;
+
+  /** @brief The smallest contact distance */
+  double getMinimumDistance() const;
+
+private:
+  std::size_t index_;
+  double time_;
+  double min_distance_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COLLISION_CONTACT_RESULT_TIME_STANDARD_ITEM_H
@@ -34,21 +34,54 @@ struct uuid;
 
 namespace tesseract::gui
 {
+/**
+ * @brief Item representing the contact results of a link pair
+ * @details When lazy the contact items are created on demand in batches through fetchMore(), so only the link pairs
+ * which are expanded create the items of their contacts.
+ */
 class ContactResultVectorStandardItem : public QStandardItem
 {
 public:
-  ContactResultVectorStandardItem(const ContactResultVector& contact_results);
-  explicit ContactResultVectorStandardItem(const QString& text, const ContactResultVector& contact_results);
-  ContactResultVectorStandardItem(const QIcon& icon, const QString& text, const ContactResultVector& contact_resultss);
+  ContactResultVectorStandardItem(const ContactResultVector& contact_results, bool lazy = false);
+  explicit ContactResultVectorStandardItem(const QString& text,
+                                           const ContactResultVector& contact_results,
+                                           bool lazy = false);
+  ContactResultVectorStandardItem(const QIcon& icon,
+                                  const QString& text,
+                                  const ContactResultVector& contact_resultss,
+                                  bool lazy = false);
+  ~ContactResultVectorStandardItem() override;
   int type() const override;
 
   const boost::uuids::uuid& getUUID() const;
 
+  /** @brief The smallest contact distance, infinity if there are no contacts */
+  double getMinDistance() const;
+
+  /** @brief The number of contact items created per fetchMore() call */
+  static const int FETCH_BATCH_SIZE;
+
+  /** @brief Check if there are contacts which do not have an item yet */
+  bool canFetchMore() const;
+
+  /**
+   * @brief Create the items of the next contacts
+   * @param count The maximum number of contact items to create
+   */
+  void fetchMore(int count = FETCH_BATCH_SIZE);
+
+  /**
+   * @brief Replace the contact results while keeping this item, so its selection and expansion are kept
+   * @details If the contact items were fetched before the first batch is fetched again
+   */
+  void setContactResults(const ContactResultVector& contact_results);
+
 private:
   struct Implementation;
   std::unique_ptr<Implementation> data_;
 
   void ctor(const ContactResultVector& contact_results);
+  QList<QStandardItem*> createRow(std::size_t index, const ContactResult& contact_result) const;
 };
 }  // namespace tesseract::gui
 
@@ -43,11 +43,61 @@ public:
   ~ContactResultsModel() override;
 
   std::shared_ptr<const ComponentInfo> getComponentInfo() const;
+
+  /**
+   * @brief Suspend updates, for example while the views of the model are hidden
+   * @details While suspended the updates of each namespace are collapsed into their net change which is applied once
+   * resumed. Clearing is still applied immediately since it is cheap.
+   * @param suspended True to suspend, false to resume
+   */
+  void setSuspended(bool suspended);
+  bool isSuspended() const;
+
   bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
 
+  /**
+   * @brief Get the distance of the n-th closest contact of the namespace containing the index
+   * @return The distance, or infinity if n is zero, the namespace has n or less contacts or is a trajectory namespace
+   */
+  double getWorstDistance(const QModelIndex& index, std::size_t n) const;
+
+  // Documentation inherited
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  // Documentation inherited
+  bool canFetchMore(const QModelIndex& parent) const override;
+
+  // Documentation inherited
+  void fetchMore(const QModelIndex& parent) override;
+
+Q_SIGNALS:
+  /** @brief Emitted after the contacts of a namespace changed, the worst distances may have changed */
+  void contactResultsChanged();
+
 protected:
+  /**
+   * @brief Set the contact results of a namespace
+   * @details The items of link pairs whose contact results did not change are kept and changed link pairs are updated
+   * in place, so the selection and expansion of the views stay stable across refreshes. The items of the contacts are
+   * created when their link pair is expanded.
+   */
   void setContactResults(const QString& ns, const ContactResultVector& contact_results);
   void setContactResults(const QString& ns, const ContactResultMap& contact_results);
+
+  /**
+   * @brief Append trajectory contact results to a namespace, entries without contacts are skipped
+   * @details Entries are kept sorted by trajectory time because scans deliver them out of order
+   */
+  void appendContactResults(const QString& ns, const ContactResultTimeline& contact_results);
+
+  /**
+   * @brief Remove the link pair items of removed, update the items of changed in place and add items for added
+   * @details Other link pairs are left untouched
+   */
+  void updateContactResults(const QString& ns,
+                            const ContactResultMap& added,
+                            const ContactResultMap& changed,
+                            const ContactResultMap& removed);
   void removeNamespace(const QString& ns);
   void clear();
 
@@ -0,0 +1,70 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COLLISION_CONTACT_RESULTS_PROXY_MODEL_H
+#define TESSERACT_QT_COLLISION_CONTACT_RESULTS_PROXY_MODEL_H
+
+#ifndef Q_MOC_RUN
+#include <QSortFilterProxyModel>
+#include <cstddef>
+#endif
+
+namespace tesseract::gui
+{
+class ContactResultsModel;
+
+/**
+ * @brief Sorts the link pairs and contacts of a ContactResultsModel by distance and filters the worst contacts
+ * @details Rows without a distance, like namespaces and trajectory states, keep the order of the source model. The
+ * worst contacts filter uses the distance of the n-th closest contact of each namespace, so contacts with the same
+ * distance as the n-th contact are shown too.
+ */
+class ContactResultsProxyModel : public QSortFilterProxyModel
+{
+  Q_OBJECT
+
+public:
+  explicit ContactResultsProxyModel(QObject* parent = nullptr);
+  ~ContactResultsProxyModel() override;
+
+  /** @brief Set the source model, it must be a ContactResultsModel */
+  void setSourceModel(QAbstractItemModel* source_model) override;
+
+  /**
+   * @brief Only show the closest contacts of each namespace
+   * @param n The number of contacts to show, zero shows all contacts
+   */
+  void setWorstContactsLimit(std::size_t n);
+  std::size_t getWorstContactsLimit() const;
+
+protected:
+  bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
+  bool lessThan(const QModelIndex& source_left, const QModelIndex& source_right) const override;
+
+private:
+  ContactResultsModel* model_{ nullptr };
+  std::size_t limit_{ 0 };
+  QMetaObject::Connection connection_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COLLISION_CONTACT_RESULTS_PROXY_MODEL_H
@@ -0,0 +1,88 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COLLISION_CONTACT_RESULTS_STORE_H
+#define TESSERACT_QT_COLLISION_CONTACT_RESULTS_STORE_H
+
+#include <boost/uuid/uuid.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tesseract_qt/common/contact_results_types.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief Column oriented summary of the contacts of a namespace
+ * @details Each contact is a row of the link pair and distance columns, so sorting and filtering by distance does not
+ * have to visit the items of the model. The distances are also kept sorted so the distance of the n-th closest contact
+ * is a lookup, and updates merge the changed distances instead of sorting all of them again.
+ */
+class ContactResultsStore
+{
+public:
+  using LinkPair = std::pair<std::string, std::string>;
+
+  /** @brief Replace the contacts, the contacts of a vector are stored under an empty link pair */
+  void set(const ContactResultVector& contact_results);
+  void set(const ContactResultMap& contact_results);
+
+  /** @brief Remove the link pairs of removed, matched by uuid, and add the link pairs of added */
+  void update(const ContactResultMap& added, const ContactResultMap& removed);
+
+  void clear();
+
+  /** @brief The number of contacts */
+  std::size_t size() const;
+  bool empty() const;
+
+  /** @brief The link pairs, indexed by the link pair column */
+  const std::vector<LinkPair>& getLinkPairs() const;
+
+  /** @brief The link pair column, the index of the link pair of each contact */
+  const std::vector<std::size_t>& getLinkPairIndices() const;
+
+  /** @brief The distance column */
+  const std::vector<double>& getDistances() const;
+
+  /**
+   * @brief The distance of the n-th closest contact
+   * @return The distance, or infinity if n is zero or there are n or less contacts
+   */
+  double getWorstDistance(std::size_t n) const;
+
+private:
+  std::vector<LinkPair> link_pairs_;
+  std::vector<boost::uuids::uuid> link_pair_uuids_;
+
+  std::vector<std::size_t> link_pair_indices_;
+  std::vector<double> distances_;
+
+  /** @brief The distance column sorted ascending */
+  std::vector<double> sorted_distances_;
+
+  void append(const LinkPair& link_pair, const ContactResultVector& contact_results);
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COLLISION_CONTACT_RESULTS_STORE_H
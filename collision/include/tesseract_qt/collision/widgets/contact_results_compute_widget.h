@@ -26,6 +26,7 @@
 #ifndef Q_MOC_RUN
 #include <memory>
 #include <QWidget>
+#include <tesseract/collision/types.h>
 #endif
 
 namespace Ui
@@ -60,10 +61,16 @@ public:
 
 protected Q_SLOTS:
   void onComputeClicked();
+  void onScanTrajectoryClicked();
+  void onMonitorToggled(bool checked);
+  void onMonitorSettingsChanged();
 
 private:
   std::unique_ptr<Ui::ContactResultsComputeWidget> ui;
 
+  tesseract::collision::ContactManagerConfig getContactManagerConfig() const;
+  tesseract::collision::CollisionCheckConfig getCollisionCheckConfig() const;
+
   void ctor(std::shared_ptr<const ComponentInfo> component_info);
 };
 }  // namespace tesseract::gui
@@ -29,6 +29,7 @@
 #endif
 
 class QItemSelectionModel;
+class QModelIndex;
 
 namespace tesseract::gui
 {
@@ -50,12 +51,18 @@ public:
   std::shared_ptr<ContactResultsModel> getModel();
   std::shared_ptr<const ContactResultsModel> getModel() const;
 
+  /** @brief The selection model of the view, its indexes belong to the proxy model sorting and filtering the model */
   QItemSelectionModel& getSelectionModel();
   const QItemSelectionModel& getSelectionModel() const;
 
+private Q_SLOTS:
+  void onCurrentRowChanged(const QModelIndex& current, const QModelIndex& previous);
+
 private:
   struct Implementation;
   std::unique_ptr<Implementation> data_;
+
+  void connectSelectionModel();
 };
 
 }  // namespace tesseract::gui
@@ -0,0 +1,50 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/collision/models/contact_result_time_standard_item.h>
+#include <tesseract_qt/common/models/standard_item_type.h>
+#include <tesseract_qt/common/icon_utils.h>
+
+namespace tesseract::gui
+{
+ContactResultTimeStandardItem::ContactResultTimeStandardItem(const ContactResultTimelineEntry& entry)
+  : ContactResultMapStandardItem(icons::getCollisionIcon(),
+                                 QString("[%1] %2 s").arg(entry.index).arg(entry.time, 0, 'f', 3),
+                                 entry.contacts)
+  , index_(entry.index)
+  , time_(entry.time)
+  , min_distance_(entry.min_distance)
+{
+}
+
+int ContactResultTimeStandardItem::type() const
+{
+  return static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_TIME);
+}
+
+std::size_t ContactResultTimeStandardItem::getIndex() const { return index_; }
+
+double ContactResultTimeStandardItem::getTime() const { return time_; }
+
+double ContactResultTimeStandardItem::getMinimumDistance() const { return min_distance_; }
+}  // namespace tesseract::gui
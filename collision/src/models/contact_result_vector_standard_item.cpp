@@ -25,34 +25,52 @@
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/icon_utils.h>
 
+#include <algorithm>
+#include <limits>
+#include <map>
+
 namespace tesseract::gui
 {
 struct ContactResultVectorStandardItem::Implementation
 {
   boost::uuids::uuid uuid;
+  double min_distance{ std::numeric_limits<double>::infinity() };
+
+  /** @brief True if the contact items are created through fetchMore() */
+  bool lazy{ false };
+
+  /** @brief The contact results which do not have an item yet are created from, only kept when lazy */
+  ContactResultVector contact_results;
 };
 
-ContactResultVectorStandardItem::ContactResultVectorStandardItem(const ContactResultVector& contact_results)
+ContactResultVectorStandardItem::ContactResultVectorStandardItem(const ContactResultVector& contact_results, bool lazy)
   : QStandardItem(icons::getCollisionIcon(), "Contact Results"), data_(std::make_unique<Implementation>())
 {
+  data_->lazy = lazy;
   ctor(contact_results);
 }
 
 ContactResultVectorStandardItem::ContactResultVectorStandardItem(const QString& text,
-                                                                 const ContactResultVector& contact_results)
+                                                                 const ContactResultVector& contact_results,
+                                                                 bool lazy)
   : QStandardItem(icons::getCollisionIcon(), text), data_(std::make_unique<Implementation>())
 {
+  data_->lazy = lazy;
   ctor(contact_results);
 }
 
 ContactResultVectorStandardItem::ContactResultVectorStandardItem(const QIcon& icon,
                                                                  const QString& text,
-                                                                 const ContactResultVector& contact_results)
+                                                                 const ContactResultVector& contact_results,
+                                                                 bool lazy)
   : QStandardItem(icon, text), data_(std::make_unique<Implementation>())
 {
+  data_->lazy = lazy;
   ctor(contact_results);
 }
 
+ContactResultVectorStandardItem::~ContactResultVectorStandardItem() = default;
+
 int ContactResultVectorStandardItem::type() const
 {
   return static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR);
@@ -60,16 +78,89 @@ int ContactResultVectorStandardItem::type() const
 
 const boost::uuids::uuid& ContactResultVectorStandardItem::getUUID() const { return data_->uuid; }
 
+double ContactResultVectorStandardItem::getMinDistance() const { return data_->min_distance; }
+
+const int ContactResultVectorStandardItem::FETCH_BATCH_SIZE = 256;
+
+bool ContactResultVectorStandardItem::canFetchMore() const
+{
+  return (data_->lazy && static_cast<std::size_t>(rowCount()) < data_->contact_results().size());
+}
+
+void ContactResultVectorStandardItem::fetchMore(int count)
+{
+  if (!data_->lazy)
+    return;
+
+  const auto begin = static_cast<std::size_t>(rowCount());
+  const std::size_t end = std::min(begin + static_cast<std::size_t>(count), data_->contact_results().size());
+  if (begin >= end)
+    return;
+
+  QList<QList<QStandardItem*>> rows;
+  rows.reserve(static_cast<int>(end - begin));
+  for (std::size_t i = begin; i < end; ++i)
+    rows.append(createRow(i, data_->contact_results()[i]));
+
+  for (auto& row : rows)
+    appendRow(row);
+}
+
+void ContactResultVectorStandardItem::setContactResults(const ContactResultVector& contact_results)
+{
+  // Contacts which keep their uuid keep the check state chosen by the user
+  std::map<boost::uuids::uuid, Qt::CheckState> check_states;
+  for (int row = 0; row < rowCount(); ++row)
+  {
+    if (const auto* item = dynamic_cast<const ContactResultStandardItem*>(child(row)))
+      check_states[item->contact_result.getUUID()] = item->checkState();
+  }
+
+  const bool fetched = (rowCount() > 0);
+  removeRows(0, rowCount());
+  ctor(contact_results);
+
+  if (fetched)
+    fetchMore();
+
+  for (int row = 0; row < rowCount(); ++row)
+  {
+    auto* item = dynamic_cast<ContactResultStandardItem*>(child(row));
+    if (item == nullptr)
+      continue;
+
+    auto it = check_states.find(item->contact_result.getUUID());
+    if (it != check_states.end())
+      item->setCheckState(it->second);
+  }
+
+  // Let sorting views know the min distance may have changed
+  emitDataChanged();
+}
+
 void ContactResultVectorStandardItem::ctor(const ContactResultVector& contact_results)
 {
   setCheckable(true);
   data_->uuid = contact_results.getUUID();
+  data_->min_distance = std::numeric_limits<double>::infinity();
+  for (const auto& contact_result : contact_results())
+    data_->min_distance = std::min(data_->min_distance, contact_result().distance);
 
-  for (std::size_t i = 0; i < contact_results().size(); ++i)
+  if (data_->lazy)
   {
-    auto* cr_item = new ContactResultStandardItem(QString("[%1]").arg(i), contact_results()[i]);
-    auto* cr_value_item = new QStandardItem(QString("{ distance: %1 }").arg(contact_results()[i]().distance));
-    appendRow({ cr_item, cr_value_item });
+    data_->contact_results = contact_results;
+    return;
   }
+
+  for (std::size_t i = 0; i < contact_results().size(); ++i)
+    appendRow(createRow(i, contact_results()[i]));
+}
+
+QList<QStandardItem*> ContactResultVectorStandardItem::createRow(std::size_t index,
+                                                                 const ContactResult& contact_result) const
+{
+  auto* cr_item = new ContactResultStandardItem(QString("[%1]").arg(index), contact_result);
+  auto* cr_value_item = new QStandardItem(QString("{ distance: %1 }").arg(contact_result().distance));
+  return { cr_item, cr_value_item };
 }
 }  // namespace tesseract::gui
@@ -22,22 +22,147 @@
  */
 
 #include <tesseract_qt/collision/models/contact_results_model.h>
+#include <tesseract_qt/collision/models/contact_results_store.h>
 #include <tesseract_qt/collision/models/contact_result_standard_item.h>
 #include <tesseract_qt/collision/models/contact_result_vector_standard_item.h>
+#include <tesseract_qt/collision/models/contact_result_time_standard_item.h>
 #include <tesseract_qt/common/events/contact_results_events.h>
 #include <tesseract_qt/common/models/namespace_standard_item.h>
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/models/standard_item_utils.h>
 #include <tesseract_qt/common/component_info.h>
 
+#include <boost/uuid/uuid.hpp>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <variant>
+
 #include <QApplication>
 
 namespace tesseract::gui
 {
+namespace
+{
+QString getLinkPairText(const std::pair<std::string, std::string>& link_pair)
+{
+  return QString("%1::%2").arg(QString::fromStdString(link_pair.first), QString::fromStdString(link_pair.second));
+}
+
+QString getLinkPairValueText(const ContactResultVectorStandardItem& item)
+{
+  return QString("{ min distance: %1 }").arg(item.getMinDistance());
+}
+
+/** @brief Create the row of a link pair, its contact items are created when it is expanded */
+QList<QStandardItem*> createLinkPairRow(const std::pair<std::string, std::string>& link_pair,
+                                        const ContactResultVector& contact_results)
+{
+  auto* link_pair_item = new ContactResultVectorStandardItem(getLinkPairText(link_pair), contact_results, true);
+  auto* value_item = new QStandardItem(getLinkPairValueText(*link_pair_item));
+  return { link_pair_item, value_item };
+}
+
+/** @brief The net change of a namespace received while suspended */
+struct PendingContactResults
+{
+  /** @brief The contact results replacing the namespace, applied before the other changes */
+  std::optional<std::variant<ContactResultVector, ContactResultMap>> results;
+
+  /** @brief Link pairs to add to the namespace */
+  ContactResultMap added;
+
+  /** @brief Link pairs to update in place, they keep the uuid of the results in the model */
+  ContactResultMap changed;
+
+  /** @brief Link pairs to remove from the namespace */
+  ContactResultMap removed;
+
+  /** @brief Trajectory contact results to append to the namespace */
+  ContactResultTimeline appended;
+
+  void update(const ContactResultMap& added_results,
+              const ContactResultMap& changed_results,
+              const ContactResultMap& removed_results)
+  {
+    // Once the namespace is replaced by a map the changes are applied to it directly
+    if (results.has_value() && results->index() == 1)
+    {
+      auto& map = std::get<ContactResultMap>(*results);
+      for (const auto& pair : removed_results)
+      {
+        auto it = map.find(pair.first);
+        if (it != map.end() && it->second.getUUID() == pair.second.getUUID())
+          map.erase(it);
+      }
+
+      for (const auto& pair : changed_results)
+        map.insert_or_assign(pair.first, pair.second);
+
+      for (const auto& pair : added_results)
+        map.insert_or_assign(pair.first, pair.second);
+
+      return;
+    }
+
+    // Link pairs added while suspended never reached the model so removing them cancels the addition
+    for (const auto& pair : removed_results)
+    {
+      changed.erase(pair.first);
+
+      auto it = added.find(pair.first);
+      if (it != added.end() && it->second.getUUID() == pair.second.getUUID())
+        added.erase(it);
+      else
+        removed.insert_or_assign(pair.first, pair.second);
+    }
+
+    // A change of a link pair added while suspended is still an addition
+    for (const auto& pair : changed_results)
+    {
+      auto it = added.find(pair.first);
+      if (it != added.end() && it->second.getUUID() == pair.second.getUUID())
+        it->second = pair.second;
+      else
+        changed.insert_or_assign(pair.first, pair.second);
+    }
+
+    for (const auto& pair : added_results)
+      added.insert_or_assign(pair.first, pair.second);
+  }
+};
+}  // namespace
+
 struct ContactResultsModel::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
   std::unordered_map<std::string, QStandardItem*> namespace_map;
+
+  /** @brief The contacts of the map and vector namespaces, trajectory namespaces do not have a store */
+  std::unordered_map<std::string, ContactResultsStore> stores;
+
+  /** @brief True while suspended */
+  bool suspended{ false };
+
+  /** @brief The changes received while suspended, in the order the namespaces were first changed */
+  std::vector<std::pair<std::string, PendingContactResults>> pending;
+
+  PendingContactResults& getPending(const std::string& ns)
+  {
+    auto it = std::find_if(pending.begin(), pending.end(), [&ns](const auto& p) { return p.first == ns; });
+    if (it != pending.end())
+      return it->second;
+
+    return pending.emplace_back(ns, PendingContactResults()).second;
+  }
+
+  void removePending(const std::string& ns)
+  {
+    pending.erase(std::remove_if(pending.begin(), pending.end(), [&ns](const auto& p) { return p.first == ns; }),
+                  pending.end());
+  }
 };
 
 ContactResultsModel::ContactResultsModel(QObject* parent)
@@ -64,6 +189,36 @@ ContactResultsModel::~ContactResultsModel() = default;
 
 std::shared_ptr<const ComponentInfo> ContactResultsModel::getComponentInfo() const { return data_->component_info; }
 
+void ContactResultsModel::setSuspended(bool suspended)
+{
+  data_->suspended = suspended;
+  if (suspended)
+    return;
+
+  std::vector<std::pair<std::string, PendingContactResults>> pending;
+  pending.swap(data_->pending);
+  for (const auto& p : pending)
+  {
+    const QString ns = QString::fromStdString(p.first);
+    const PendingContactResults& changes = p.second;
+    if (changes.results.has_value())
+    {
+      if (changes.results->index() == 0)
+        setContactResults(ns, std::get<ContactResultVector>(*changes.results));
+      else
+        setContactResults(ns, std::get<ContactResultMap>(*changes.results));
+    }
+
+    if (!changes.added.empty() || !changes.changed.empty() || !changes.removed.empty())
+      updateContactResults(ns, changes.added, changes.changed, changes.removed);
+
+    if (!changes.appended.empty())
+      appendContactResults(ns, changes.appended);
+  }
+}
+
+bool ContactResultsModel::isSuspended() const { return data_->suspended; }
+
 bool ContactResultsModel::setData(const QModelIndex& index, const QVariant& value, int role)
 {
   // Need emit application event to change visible
@@ -98,28 +253,209 @@ bool ContactResultsModel::setData(const QModelIndex& index, const QVariant& valu
 
 void ContactResultsModel::setContactResults(const QString& ns, const ContactResultVector& contact_results)
 {
-  removeNamespace(ns);
+  auto it = data_->namespace_map.find(ns.toStdString());
+  if (it != data_->namespace_map.end() &&
+      it->second->type() == static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR))
+  {
+    auto* crv_item = static_cast<ContactResultVectorStandardItem*>(it->second);
+    if (crv_item->getUUID() == contact_results.getUUID())
+      return;
 
-  auto* crv_item = new ContactResultVectorStandardItem(ns, contact_results);
-  appendRow(crv_item);
+    crv_item->setContactResults(contact_results);
+  }
+  else
+  {
+    removeNamespace(ns);
+
+    auto* crv_item = new ContactResultVectorStandardItem(ns, contact_results, true);
+    appendRow(crv_item);
 
-  data_->namespace_map[ns.toStdString()] = crv_item;
+    data_->namespace_map[ns.toStdString()] = crv_item;
+  }
+
+  data_->stores[ns.toStdString()].set(contact_results);
+  Q_EMIT contactResultsChanged();
 }
 
 void ContactResultsModel::setContactResults(const QString& ns, const ContactResultMap& contact_results)
 {
-  removeNamespace(ns);
+  QStandardItem* ns_item{ nullptr };
+  auto it = data_->namespace_map.find(ns.toStdString());
+  if (it != data_->namespace_map.end() && it->second->type() == static_cast<int>(StandardItemType::COMMON_NAMESPACE))
+  {
+    // Only link pair namespaces are updated in place, trajectory namespaces are replaced
+    ns_item = it->second;
+    for (int row = 0; row < ns_item->rowCount(); ++row)
+    {
+      if (ns_item->child(row)->type() != static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR))
+      {
+        ns_item = nullptr;
+        break;
+      }
+    }
+  }
+
+  if (ns_item == nullptr)
+  {
+    removeNamespace(ns);
+
+    ns_item = new NamespaceStandardItem(ns);
+    for (const auto& pair : contact_results)
+      ns_item->appendRow(createLinkPairRow(pair.first, pair.second));
+
+    appendRow(ns_item);
+    data_->namespace_map[ns.toStdString()] = ns_item;
+  }
+  else
+  {
+    std::map<QString, const ContactResultMap::value_type*> link_pairs;
+    for (const auto& pair : contact_results)
+      link_pairs[getLinkPairText(pair.first)] = &pair;
+
+    // Keep the items of unchanged link pairs, update changed ones and remove the others
+    for (int row = ns_item->rowCount() - 1; row >= 0; --row)
+    {
+      auto* item = static_cast<ContactResultVectorStandardItem*>(ns_item->child(row));
+      auto link_pair_it = link_pairs.find(item->text());
+      if (link_pair_it == link_pairs.end())
+      {
+        ns_item->removeRow(row);
+        continue;
+      }
+
+      const ContactResultVector& contacts = link_pair_it->second->second;
+      if (item->getUUID() != contacts.getUUID())
+      {
+        item->setContactResults(contacts);
+        if (QStandardItem* value_item = ns_item->child(row, 1))
+          value_item->setText(getLinkPairValueText(*item));
+      }
+
+      link_pairs.erase(link_pair_it);
+    }
+
+    // Add the new link pairs in the order of the map
+    for (const auto& pair : contact_results)
+    {
+      if (link_pairs.count(getLinkPairText(pair.first)) > 0)
+        ns_item->appendRow(createLinkPairRow(pair.first, pair.second));
+    }
+  }
+
+  data_->stores[ns.toStdString()].set(contact_results);
+  Q_EMIT contactResultsChanged();
+}
+
+void ContactResultsModel::appendContactResults(const QString& ns, const ContactResultTimeline& contact_results)
+{
+  // The worst contacts are only tracked for link pair namespaces
+  if (data_->stores.erase(ns.toStdString()) > 0)
+    Q_EMIT contactResultsChanged();
+
+  QStandardItem* ns_item{ nullptr };
+  auto it = data_->namespace_map.find(ns.toStdString());
+  if (it != data_->namespace_map.end())
+  {
+    ns_item = it->second;
+  }
+  else
+  {
+    ns_item = new NamespaceStandardItem(ns);
+    appendRow(ns_item);
+    data_->namespace_map[ns.toStdString()] = ns_item;
+  }
 
-  QStandardItem* ns_item = new NamespaceStandardItem(ns);
-  for (const auto& pair : contact_results)
+  for (const auto& entry : contact_results)
   {
-    auto text =
-        QString("%1::%2").arg(QString::fromStdString(pair.first.first), QString::fromStdString(pair.first.second));
-    auto* link_pair_item = new ContactResultVectorStandardItem(text, pair.second);
-    ns_item->appendRow(link_pair_item);
+    if (entry.contacts.empty())
+      continue;
+
+    // Binary search for the insert row, the children are sorted by time
+    int first = 0;
+    int last = ns_item->rowCount();
+    while (first < last)
+    {
+      const int mid = first + ((last - first) / 2);
+      const auto* item = dynamic_cast<const ContactResultTimeStandardItem*>(ns_item->child(mid));
+      if (item == nullptr || item->getTime() < entry.time)
+        first = mid + 1;
+      else
+        last = mid;
+    }
+
+    auto* time_item = new ContactResultTimeStandardItem(entry);
+    auto* value_item = new QStandardItem(QString("{ min distance: %1 }").arg(entry.min_distance));
+    ns_item->insertRow(first, { time_item, value_item });
   }
-  appendRow(ns_item);
-  data_->namespace_map[ns.toStdString()] = ns_item;
+}
+
+void ContactResultsModel::updateContactResults(const QString& ns,
+                                               const ContactResultMap& added,
+                                               const ContactResultMap& changed,
+                                               const ContactResultMap& removed)
+{
+  QStandardItem* ns_item{ nullptr };
+  auto it = data_->namespace_map.find(ns.toStdString());
+  if (it != data_->namespace_map.end())
+  {
+    ns_item = it->second;
+  }
+  else
+  {
+    ns_item = new NamespaceStandardItem(ns);
+    appendRow(ns_item);
+    data_->namespace_map[ns.toStdString()] = ns_item;
+  }
+
+  // Rows are matched by link pair so existing ones are updated in place, keeping their selection and expansion
+  std::map<QString, const ContactResultVector*> updated;
+  for (const auto& pair : changed)
+    updated[getLinkPairText(pair.first)] = &pair.second;
+
+  for (const auto& pair : added)
+    updated[getLinkPairText(pair.first)] = &pair.second;
+
+  std::set<QString> removed_names;
+  for (const auto& pair : removed)
+    removed_names.insert(getLinkPairText(pair.first));
+
+  for (int row = ns_item->rowCount() - 1; row >= 0; --row)
+  {
+    auto* item = dynamic_cast<ContactResultVectorStandardItem*>(ns_item->child(row));
+    if (item == nullptr)
+      continue;
+
+    auto updated_it = updated.find(item->text());
+    if (updated_it != updated.end())
+    {
+      item->setContactResults(*updated_it->second);
+      if (QStandardItem* value_item = ns_item->child(row, 1))
+        value_item->setText(getLinkPairValueText(*item));
+
+      updated.erase(updated_it);
+    }
+    else if (removed_names.count(item->text()) > 0)
+    {
+      ns_item->removeRow(row);
+    }
+  }
+
+  for (const auto& pair : added)
+  {
+    if (updated.count(getLinkPairText(pair.first)) > 0)
+      ns_item->appendRow(createLinkPairRow(pair.first, pair.second));
+  }
+
+  // The store replaces link pairs by uuid, so a changed link pair is removed and added again
+  ContactResultMap store_added(added);
+  ContactResultMap store_removed(removed);
+  for (const auto& pair : changed)
+  {
+    store_added.insert_or_assign(pair.first, pair.second);
+    store_removed.insert_or_assign(pair.first, pair.second);
+  }
+  data_->stores[ns.toStdString()].update(store_added, store_removed);
+  Q_EMIT contactResultsChanged();
 }
 
 void ContactResultsModel::clear()
@@ -128,6 +464,8 @@ void ContactResultsModel::clear()
   setColumnCount(2);
   setHorizontalHeaderLabels({ "Name", "Values" });
   data_->namespace_map.clear();
+  data_->stores.clear();
+  Q_EMIT contactResultsChanged();
 }
 
 void ContactResultsModel::removeNamespace(const QString& ns)
@@ -139,6 +477,57 @@ void ContactResultsModel::removeNamespace(const QString& ns)
     removeRow(idx.row(), idx.parent());
     data_->namespace_map.erase(ns.toStdString());
   }
+
+  if (data_->stores.erase(ns.toStdString()) > 0)
+    Q_EMIT contactResultsChanged();
+}
+
+double ContactResultsModel::getWorstDistance(const QModelIndex& index, std::size_t n) const
+{
+  QModelIndex top_level = index;
+  while (top_level.parent().isValid())
+    top_level = top_level.parent();
+
+  const QStandardItem* ns_item = itemFromIndex(top_level);
+  for (const auto& pair : data_->namespace_map)
+  {
+    if (pair.second != ns_item)
+      continue;
+
+    auto it = data_->stores.find(pair.first);
+    if (it == data_->stores.end())
+      break;
+
+    return it->second.getWorstDistance(n);
+  }
+
+  return std::numeric_limits<double>::infinity();
+}
+
+bool ContactResultsModel::hasChildren(const QModelIndex& parent) const
+{
+  if (canFetchMore(parent))
+    return true;
+
+  return QStandardItemModel::hasChildren(parent);
+}
+
+bool ContactResultsModel::canFetchMore(const QModelIndex& parent) const
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR))
+    return false;
+
+  return static_cast<ContactResultVectorStandardItem*>(item)->canFetchMore();
+}
+
+void ContactResultsModel::fetchMore(const QModelIndex& parent)
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR))
+    return;
+
+  static_cast<ContactResultVectorStandardItem*>(item)->fetchMore();
 }
 
 ContactResultVectorStandardItem* findContactResultsItem(QStandardItem* item)
@@ -155,7 +544,13 @@ bool ContactResultsModel::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::ContactResultsSet*>(event) != nullptr);
     auto* e = static_cast<events::ContactResultsSet*>(event);
-    if (e->getComponentInfo() == data_->component_info)
+    if (e->getComponentInfo() == data_->component_info && data_->suspended)
+    {
+      PendingContactResults& pending = data_->getPending(e->getNamespace());
+      pending = PendingContactResults();
+      pending.results = e->getContactResults();
+    }
+    else if (e->getComponentInfo() == data_->component_info)
     {
       if (e->getContactResults().index() == 0)
         setContactResults(e->getNamespace().c_str(), std::get<ContactResultVector>(e->getContactResults()));
@@ -168,7 +563,41 @@ bool ContactResultsModel::eventFilter(QObject* obj, QEvent* event)
     assert(dynamic_cast<events::ContactResultsClear*>(event) != nullptr);
     auto* e = static_cast<events::ContactResultsClear*>(event);
     if (e->getComponentInfo() == data_->component_info)
-      clear();
+    {
+      if (e->getNamespace().empty())
+      {
+        data_->pending.clear();
+        clear();
+      }
+      else
+      {
+        data_->removePending(e->getNamespace());
+        removeNamespace(e->getNamespace().c_str());
+      }
+    }
+  }
+  else if (event->type() == events::EventType::CONTACT_RESULTS_APPEND)
+  {
+    assert(dynamic_cast<events::ContactResultsAppend*>(event) != nullptr);
+    auto* e = static_cast<events::ContactResultsAppend*>(event);
+    if (e->getComponentInfo() == data_->component_info && data_->suspended)
+    {
+      ContactResultTimeline& appended = data_->getPending(e->getNamespace()).appended;
+      appended.insert(appended.end(), e->getContactResults().begin(), e->getContactResults().end());
+    }
+    else if (e->getComponentInfo() == data_->component_info)
+    {
+      appendContactResults(e->getNamespace().c_str(), e->getContactResults());
+    }
+  }
+  else if (event->type() == events::EventType::CONTACT_RESULTS_UPDATE)
+  {
+    assert(dynamic_cast<events::ContactResultsUpdate*>(event) != nullptr);
+    auto* e = static_cast<events::ContactResultsUpdate*>(event);
+    if (e->getComponentInfo() == data_->component_info && data_->suspended)
+      data_->getPending(e->getNamespace()).update(e->getAdded(), e->getChanged(), e->getRemoved());
+    else if (e->getComponentInfo() == data_->component_info)
+      updateContactResults(e->getNamespace().c_str(), e->getAdded(), e->getChanged(), e->getRemoved());
   }
   else if (event->type() == events::EventType::CONTACT_RESULTS_REMOVE)
   {
@@ -0,0 +1,119 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/collision/models/contact_results_proxy_model.h>
+#include <tesseract_qt/collision/models/contact_results_model.h>
+#include <tesseract_qt/collision/models/contact_result_standard_item.h>
+#include <tesseract_qt/collision/models/contact_result_vector_standard_item.h>
+#include <tesseract_qt/common/models/standard_item_type.h>
+
+#include <cassert>
+#include <optional>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief The min distance of a link pair or the distance of a contact */
+std::optional<double> getDistance(const QStandardItem* item)
+{
+  if (item == nullptr)
+    return std::nullopt;
+
+  if (item->type() == static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_VECTOR))
+    return static_cast<const ContactResultVectorStandardItem*>(item)->getMinDistance();
+
+  if (item->type() == static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT))
+    return static_cast<const ContactResultStandardItem*>(item)->contact_result().distance;
+
+  return std::nullopt;
+}
+}  // namespace
+
+ContactResultsProxyModel::ContactResultsProxyModel(QObject* parent) : QSortFilterProxyModel(parent) {}
+
+ContactResultsProxyModel::~ContactResultsProxyModel() = default;
+
+void ContactResultsProxyModel::setSourceModel(QAbstractItemModel* source_model)
+{
+  disconnect(connection_);
+
+  model_ = qobject_cast<ContactResultsModel*>(source_model);
+  assert(source_model == nullptr || model_ != nullptr);
+
+  QSortFilterProxyModel::setSourceModel(source_model);
+
+  // The worst distances change with the contacts so the filter must be applied again
+  if (model_ != nullptr)
+  {
+    connection_ = connect(model_, &ContactResultsModel::contactResultsChanged, this, [this]() {
+      if (limit_ > 0)
+        invalidateFilter();
+    });
+  }
+}
+
+void ContactResultsProxyModel::setWorstContactsLimit(std::size_t n)
+{
+  if (limit_ == n)
+    return;
+
+  limit_ = n;
+  invalidateFilter();
+}
+
+std::size_t ContactResultsProxyModel::getWorstContactsLimit() const { return limit_; }
+
+bool ContactResultsProxyModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const
+{
+  if (limit_ == 0 || model_ == nullptr)
+    return true;
+
+  const QModelIndex index = model_->index(source_row, 0, source_parent);
+  const std::optional<double> distance = getDistance(model_->itemFromIndex(index));
+  if (!distance.has_value())
+    return true;
+
+  return (*distance <= model_->getWorstDistance(index, limit_));
+}
+
+bool ContactResultsProxyModel::lessThan(const QModelIndex& source_left, const QModelIndex& source_right) const
+{
+  if (model_ != nullptr)
+  {
+    const std::optional<double> left = getDistance(model_->itemFromIndex(source_left.sibling(source_left.row(), 0)));
+    const std::optional<double> right =
+        getDistance(model_->itemFromIndex(source_right.sibling(source_right.row(), 0)));
+    if (left.has_value() && right.has_value())
+    {
+      if (*left < *right)
+        return true;
+
+      if (*right < *left)
+        return false;
+    }
+  }
+
+  return (source_left.row() < source_right.row());
+}
+}  // namespace tesseract::gui
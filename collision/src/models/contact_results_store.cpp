@@ -0,0 +1,163 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/collision/models/contact_results_store.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <set>
+
+namespace tesseract::gui
+{
+void ContactResultsStore::set(const ContactResultVector& contact_results)
+{
+  clear();
+  append(LinkPair(), contact_results);
+  sorted_distances_ = distances_;
+  std::sort(sorted_distances_.begin(), sorted_distances_.end());
+}
+
+void ContactResultsStore::set(const ContactResultMap& contact_results)
+{
+  clear();
+  for (const auto& pair : contact_results)
+    append(pair.first, pair.second);
+
+  sorted_distances_ = distances_;
+  std::sort(sorted_distances_.begin(), sorted_distances_.end());
+}
+
+void ContactResultsStore::update(const ContactResultMap& added, const ContactResultMap& removed)
+{
+  std::vector<double> removed_distances;
+  if (!removed.empty())
+  {
+    std::set<boost::uuids::uuid> removed_uuids;
+    for (const auto& pair : removed)
+      removed_uuids.insert(pair.second.getUUID());
+
+    // Compact the link pairs and remap the link pair column
+    std::vector<std::size_t> remap(link_pairs_.size(), std::numeric_limits<std::size_t>::max());
+    std::size_t kept{ 0 };
+    for (std::size_t i = 0; i < link_pairs_.size(); ++i)
+    {
+      if (removed_uuids.count(link_pair_uuids_[i]) > 0)
+        continue;
+
+      remap[i] = kept;
+      if (kept != i)
+      {
+        link_pairs_[kept] = std::move(link_pairs_[i]);
+        link_pair_uuids_[kept] = link_pair_uuids_[i];
+      }
+      ++kept;
+    }
+    link_pairs_.resize(kept);
+    link_pair_uuids_.resize(kept);
+
+    // Compact the contact columns
+    std::size_t row{ 0 };
+    for (std::size_t i = 0; i < distances_.size(); ++i)
+    {
+      const std::size_t link_pair_index = remap[link_pair_indices_[i]];
+      if (link_pair_index == std::numeric_limits<std::size_t>::max())
+      {
+        removed_distances.push_back(distances_[i]);
+        continue;
+      }
+
+      link_pair_indices_[row] = link_pair_index;
+      distances_[row] = distances_[i];
+      ++row;
+    }
+    link_pair_indices_.resize(row);
+    distances_.resize(row);
+  }
+
+  const std::size_t first_added = distances_.size();
+  for (const auto& pair : added)
+    append(pair.first, pair.second);
+
+  // Update the sorted distances by merging instead of sorting all of them again
+  std::vector<double> added_distances(distances_.begin() + static_cast<std::ptrdiff_t>(first_added), distances_.end());
+  std::sort(removed_distances.begin(), removed_distances.end());
+  std::sort(added_distances.begin(), added_distances.end());
+
+  std::vector<double> kept_distances;
+  kept_distances.reserve(sorted_distances_.size() - removed_distances.size());
+  std::set_difference(sorted_distances_.begin(),
+                      sorted_distances_.end(),
+                      removed_distances.begin(),
+                      removed_distances.end(),
+                      std::back_inserter(kept_distances));
+
+  sorted_distances_.clear();
+  sorted_distances_.reserve(kept_distances.size() + added_distances.size());
+  std::merge(kept_distances.begin(),
+             kept_distances.end(),
+             added_distances.begin(),
+             added_distances.end(),
+             std::back_inserter(sorted_distances_));
+}
+
+void ContactResultsStore::clear()
+{
+  link_pairs_.clear();
+  link_pair_uuids_.clear();
+  link_pair_indices_.clear();
+  distances_.clear();
+  sorted_distances_.clear();
+}
+
+std::size_t ContactResultsStore::size() const { return distances_.size(); }
+
+bool ContactResultsStore::empty() const { return distances_.empty(); }
+
+const std::vector<ContactResultsStore::LinkPair>& ContactResultsStore::getLinkPairs() const { return link_pairs_; }
+
+const std::vector<std::size_t>& ContactResultsStore::getLinkPairIndices() const { return link_pair_indices_; }
+
+const std::vector<double>& ContactResultsStore::getDistances() const { return distances_; }
+
+double ContactResultsStore::getWorstDistance(std::size_t n) const
+{
+  if (n == 0 || n >= sorted_distances_.size())
+    return std::numeric_limits<double>::infinity();
+
+  return sorted_distances_[n - 1];
+}
+
+void ContactResultsStore::append(const LinkPair& link_pair, const ContactResultVector& contact_results)
+{
+  const std::size_t link_pair_index = link_pairs_.size();
+  link_pairs_.push_back(link_pair);
+  link_pair_uuids_.push_back(contact_results.getUUID());
+
+  for (const auto& contact_result : contact_results())
+  {
+    link_pair_indices_.push_back(link_pair_index);
+    distances_.push_back(contact_result().distance);
+  }
+}
+}  // namespace tesseract::gui
@@ -5,6 +5,9 @@
 
 #include <QTreeView>
 
+#include <array>
+#include <chrono>
+
 namespace tesseract::gui
 {
 ContactResultsComputeWidget::ContactResultsComputeWidget(QWidget* parent)
@@ -20,7 +23,14 @@ ContactResultsComputeWidget::ContactResultsComputeWidget(std::shared_ptr<const C
   ctor(std::move(component_info));
 }
 
-ContactResultsComputeWidget::~ContactResultsComputeWidget() = default;
+ContactResultsComputeWidget::~ContactResultsComputeWidget()
+{
+  if (ui->monitor_push_button->isChecked())
+  {
+    events::ContactResultsMonitor event(getComponentInfo());
+    QApplication::sendEvent(qApp, &event);
+  }
+}
 
 void ContactResultsComputeWidget::setComponentInfo(std::shared_ptr<const ComponentInfo> component_info)
 {
@@ -56,19 +66,72 @@ const QItemSelectionModel& ContactResultsComputeWidget::getSelectionModel() cons
 
 void ContactResultsComputeWidget::onComputeClicked()
 {
-  tesseract::collision::ContactManagerConfig contact_manager_config(ui->contact_threshold->value());
+  events::ContactResultsCompute event(getComponentInfo(),
+                                      getContactManagerConfig(),
+                                      getCollisionCheckConfig(),
+                                      events::ContactResultsCompute::StateType::CURRENT_STATE,
+                                      "Contact Results");
+  QApplication::sendEvent(qApp, &event);
+}
+
+void ContactResultsComputeWidget::onScanTrajectoryClicked()
+{
+  static const std::array<tesseract::collision::CollisionEvaluatorType, 4> evaluator_types{
+    tesseract::collision::CollisionEvaluatorType::DISCRETE,
+    tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE,
+    tesseract::collision::CollisionEvaluatorType::CONTINUOUS,
+    tesseract::collision::CollisionEvaluatorType::LVS_CONTINUOUS
+  };
+
+  tesseract::collision::CollisionCheckConfig collision_check_config = getCollisionCheckConfig();
+  collision_check_config.type = evaluator_types.at(static_cast<std::size_t>(ui->trajectory_check_type->currentIndex()));
+  collision_check_config.longest_valid_segment_length = ui->longest_valid_segment_length->value();
+
+  events::ContactResultsCompute event(getComponentInfo(),
+                                      getContactManagerConfig(),
+                                      collision_check_config,
+                                      events::ContactResultsCompute::StateType::TRAJECTORY,
+                                      "Trajectory Contact Results");
+  QApplication::sendEvent(qApp, &event);
+}
+
+void ContactResultsComputeWidget::onMonitorToggled(bool checked)
+{
+  if (!checked)
+  {
+    events::ContactResultsMonitor event(getComponentInfo());
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  events::ContactResultsMonitor event(getComponentInfo(),
+                                      getContactManagerConfig(),
+                                      getCollisionCheckConfig(),
+                                      std::chrono::milliseconds(ui->monitor_interval->value()),
+                                      "Monitored Contact Results");
+  QApplication::sendEvent(qApp, &event);
+}
+
+void ContactResultsComputeWidget::onMonitorSettingsChanged()
+{
+  // Restart the monitor with the new settings
+  if (ui->monitor_push_button->isChecked())
+    onMonitorToggled(true);
+}
+
+tesseract::collision::ContactManagerConfig ContactResultsComputeWidget::getContactManagerConfig() const
+{
+  return tesseract::collision::ContactManagerConfig(ui->contact_threshold->value());
+}
+
+tesseract::collision::CollisionCheckConfig ContactResultsComputeWidget::getCollisionCheckConfig() const
+{
   tesseract::collision::CollisionCheckConfig collision_check_config;
   collision_check_config.contact_request.calculate_distance = ui->calculate_distance->isChecked();
   collision_check_config.contact_request.calculate_penetration = ui->calculate_penetration->isChecked();
   collision_check_config.contact_request.type =
       static_cast<tesseract::collision::ContactTestType>(ui->contact_test_type->currentIndex());
-
-  events::ContactResultsCompute event(getComponentInfo(),
-                                      contact_manager_config,
-                                      collision_check_config,
-                                      events::ContactResultsCompute::StateType::CURRENT_STATE,
-                                      "Contact Results");
-  QApplication::sendEvent(qApp, &event);
+  return collision_check_config;
 }
 
 void ContactResultsComputeWidget::ctor(std::shared_ptr<const ComponentInfo> component_info)
@@ -78,6 +141,13 @@ void ContactResultsComputeWidget::ctor(std::shared_ptr<const ComponentInfo> comp
   ui->contact_results_widget->setComponentInfo(std::move(component_info));
 
   connect(ui->compute_push_button, SIGNAL(clicked()), this, SLOT(onComputeClicked()));
+  connect(ui->scan_trajectory_push_button, SIGNAL(clicked()), this, SLOT(onScanTrajectoryClicked()));
+  connect(ui->monitor_push_button, SIGNAL(toggled(bool)), this, SLOT(onMonitorToggled(bool)));
+  connect(ui->contact_threshold, SIGNAL(valueChanged(double)), this, SLOT(onMonitorSettingsChanged()));
+  connect(ui->contact_test_type, SIGNAL(currentIndexChanged(int)), this, SLOT(onMonitorSettingsChanged()));
+  connect(ui->calculate_penetration, SIGNAL(toggled(bool)), this, SLOT(onMonitorSettingsChanged()));
+  connect(ui->calculate_distance, SIGNAL(toggled(bool)), this, SLOT(onMonitorSettingsChanged()));
+  connect(ui->monitor_interval, SIGNAL(valueChanged(int)), this, SLOT(onMonitorSettingsChanged()));
 }
 
 }  // namespace tesseract::gui
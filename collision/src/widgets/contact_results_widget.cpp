@@ -23,17 +23,29 @@
 
 #include <tesseract_qt/collision/widgets/contact_results_widget.h>
 #include <tesseract_qt/collision/models/contact_results_model.h>
+#include <tesseract_qt/collision/models/contact_results_proxy_model.h>
+#include <tesseract_qt/collision/models/contact_result_time_standard_item.h>
+#include <tesseract_qt/common/events/joint_trajectory_events.h>
+#include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/widgets/tree_view.h>
 #include <tesseract_qt/common/component_info.h>
 
+#include <QApplication>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QSpinBox>
 #include <QVBoxLayout>
 
+#include <limits>
+
 namespace tesseract::gui
 {
 struct ContactResultsWidget::Implementation
 {
   std::shared_ptr<ContactResultsModel> model;
+  ContactResultsProxyModel* proxy_model;
   QVBoxLayout* layout;
+  QSpinBox* worst_contacts;
   TreeView* tree_view;
 };
 
@@ -45,27 +57,51 @@ ContactResultsWidget::ContactResultsWidget(std::shared_ptr<const ComponentInfo>
   // Create model
   data_->model = std::make_shared<ContactResultsModel>(std::move(component_info));
 
+  // Create proxy model sorting by distance
+  data_->proxy_model = new ContactResultsProxyModel(this);
+  data_->proxy_model->setSourceModel(data_->model.get());
+
   // Create tree widget
   data_->tree_view = new TreeView();
   data_->tree_view->setEditTriggers(QAbstractItemView::EditTrigger::NoEditTriggers);
-  data_->tree_view->setModel(data_->model.get());
+  data_->tree_view->setModel(data_->proxy_model);
+  data_->tree_view->setSortingEnabled(true);
+  data_->tree_view->sortByColumn(0, Qt::AscendingOrder);
+
+  // Create worst contacts filter
+  data_->worst_contacts = new QSpinBox();
+  data_->worst_contacts->setRange(0, std::numeric_limits<int>::max());
+  data_->worst_contacts->setSpecialValueText("All");
+  data_->worst_contacts->setToolTip("Only show the closest contacts of each namespace");
+  connect(data_->worst_contacts, QOverload<int>::of(&QSpinBox::valueChanged), this, [this](int value) {
+    data_->proxy_model->setWorstContactsLimit(static_cast<std::size_t>(value));
+  });
+
+  auto* filter_layout = new QHBoxLayout();
+  filter_layout->setMargin(3);
+  filter_layout->addWidget(new QLabel("Worst contacts:"));
+  filter_layout->addWidget(data_->worst_contacts, 1);
 
   // Create layout
   data_->layout = new QVBoxLayout();
   data_->layout->setMargin(0);
   data_->layout->setSpacing(0);
+  data_->layout->addLayout(filter_layout);
   data_->layout->addWidget(data_->tree_view);
 
   // Set layout
   setLayout(data_->layout);
+
+  connectSelectionModel();
 }
 ContactResultsWidget::~ContactResultsWidget() = default;
 
 void ContactResultsWidget::setComponentInfo(std::shared_ptr<const ComponentInfo> component_info)
 {
   // Create model
-  data_->model = std::make_shared<ContactResultsModel>(std::move(component_info));
-  data_->tree_view->setModel(data_->model.get());
+  auto model = std::make_shared<ContactResultsModel>(std::move(component_info));
+  data_->proxy_model->setSourceModel(model.get());
+  data_->model = std::move(model);
 }
 
 std::shared_ptr<const ComponentInfo> ContactResultsWidget::getComponentInfo() const
@@ -75,8 +111,8 @@ std::shared_ptr<const ComponentInfo> ContactResultsWidget::getComponentInfo() co
 
 void ContactResultsWidget::setModel(std::shared_ptr<ContactResultsModel> model)
 {
+  data_->proxy_model->setSourceModel(model.get());
   data_->model = std::move(model);
-  data_->tree_view->setModel(data_->model.get());
 }
 std::shared_ptr<ContactResultsModel> ContactResultsWidget::getModel() { return data_->model; }
 std::shared_ptr<const ContactResultsModel> ContactResultsWidget::getModel() const { return data_->model; }
@@ -87,4 +123,28 @@ const QItemSelectionModel& ContactResultsWidget::getSelectionModel() const
   return *data_->tree_view->selectionModel();
 }
 
+void ContactResultsWidget::onCurrentRowChanged(const QModelIndex& current, const QModelIndex& /*previous*/)
+{
+  // Selecting anything below a trajectory contact result moves the player to its time
+  const QModelIndex source_current = data_->proxy_model->mapToSource(current);
+  for (QStandardItem* item = data_->model->itemFromIndex(source_current); item != nullptr; item = item->parent())
+  {
+    if (item->type() == static_cast<int>(StandardItemType::COLLISION_CONTACT_RESULT_TIME))
+    {
+      assert(dynamic_cast<ContactResultTimeStandardItem*>(item) != nullptr);
+      events::JointTrajectoryPlayerSeek event(data_->model->getComponentInfo(),
+                                              static_cast<ContactResultTimeStandardItem*>(item)->getTime());
+      QApplication::sendEvent(qApp, &event);
+      return;
+    }
+  }
+}
+
+void ContactResultsWidget::connectSelectionModel()
+{
+  connect(data_->tree_view->selectionModel(),
+          SIGNAL(currentRowChanged(QModelIndex, QModelIndex)),
+          this,
+          SLOT(onCurrentRowChanged(QModelIndex, QModelIndex)));
+}
 }  // namespace tesseract::gui
@@ -0,0 +1,109 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_BACKGROUND_LOADER_H
+#define TESSERACT_QT_COMMON_BACKGROUND_LOADER_H
+
+#ifndef Q_MOC_RUN
+#include <atomic>
+#include <functional>
+#include <memory>
+#endif
+
+#include <QObject>
+#include <QString>
+
+namespace tesseract::gui
+{
+/**
+ * @brief Runs loading jobs (e.g. decoding archives) one after another on a worker thread
+ * @details A job reports progress and checks for cancellation through its Context. Results are handed back to the
+ * main thread with Context::deliver as soon as they are available, so large files can be handed to models and render
+ * managers piece by piece instead of in one blocking call. All signals are emitted on the main thread.
+ */
+class BackgroundLoader : public QObject
+{
+  Q_OBJECT
+public:
+  /** @brief The interface of a running job to the loader */
+  class Context
+  {
+  public:
+    /** @brief Check if the job was canceled, a job should return as soon as possible when it is */
+    bool isCanceled() const;
+
+    /**
+     * @brief Report the progress of the job
+     * @param value The progress in percent [0, 100], a negative value if the progress of the step is unknown
+     * @param text A short description of the current step
+     */
+    void setProgress(int value, const QString& text = QString());
+
+    /**
+     * @brief Run the function on the main thread, in order of delivery
+     * @details The function is dropped if the job is canceled before it runs
+     */
+    void deliver(std::function<void()> fn);
+
+  private:
+    friend class BackgroundLoader;
+    Context(BackgroundLoader& loader, QString name, std::shared_ptr<std::atomic<bool>> canceled);
+
+    BackgroundLoader& loader_;
+    QString name_;
+    std::shared_ptr<std::atomic<bool>> canceled_;
+  };
+
+  /** @brief A job returns true on success and may throw to report an error */
+  using Job = std::function<bool(Context& context)>;
+
+  explicit BackgroundLoader(QObject* parent = nullptr);
+  ~BackgroundLoader() override;
+
+  /**
+   * @brief Queue a job, it is started once the previous jobs are finished
+   * @param name The name reported in the signals, usually the file name
+   * @param job The job to run on the worker thread
+   */
+  void load(const QString& name, Job job);
+
+  /** @brief Cancel the running job and all pending jobs */
+  void cancel();
+
+  /** @brief Check if a job is running or pending */
+  bool isBusy() const;
+
+  /** @brief The message of the finished signal of a canceled job */
+  static QString canceledMessage();
+
+Q_SIGNALS:
+  void started(const QString& name);
+  void progress(const QString& name, int value, const QString& text);
+  void finished(const QString& name, bool success, const QString& message);
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_BACKGROUND_LOADER_H
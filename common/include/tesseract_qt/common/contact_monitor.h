@@ -0,0 +1,100 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_CONTACT_MONITOR_H
+#define TESSERACT_QT_COMMON_CONTACT_MONITOR_H
+
+#ifndef Q_MOC_RUN
+#include <chrono>
+#include <memory>
+#include <string>
+#include <tesseract/collision/types.h>
+#include <tesseract/common/types.h>
+#include <tesseract/environment/fwd.h>
+#endif
+
+#include <QObject>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+
+/** @brief Settings for monitoring the current state for contacts */
+struct ContactMonitorConfig
+{
+  tesseract::collision::ContactManagerConfig contact_manager_config;
+
+  /** @brief Only the contact request is used, the state is always checked discretely */
+  tesseract::collision::CollisionCheckConfig collision_check_config;
+
+  /** @brief The minimum time between two checks, states arriving in between are coalesced to the latest */
+  std::chrono::milliseconds min_interval{ 100 };
+
+  /** @brief Contacts whose distance and nearest points moved less than this are considered unchanged */
+  double tolerance{ 1e-6 };
+};
+
+/**
+ * @brief Checks the current state of an environment for contacts on a worker thread every time it changes
+ * @details The monitor listens for SceneStateChanged events of its component. A persistent clone of the environment
+ * contact manager is kept and only its transforms are updated, it is cloned again when the environment revision
+ * changes. Only the link pairs which changed since the previous check are sent as a ContactResultsUpdate event, so
+ * models and render managers do not rebuild everything on every state change.
+ */
+class ContactMonitor : public QObject
+{
+  Q_OBJECT
+public:
+  explicit ContactMonitor(std::shared_ptr<const ComponentInfo> component_info, QObject* parent = nullptr);
+  ~ContactMonitor() override;
+
+  /**
+   * @brief Start monitoring, restarting it if it is already running
+   * @details The namespace is cleared and the current state of the environment is checked right away
+   * @param env The environment to monitor, it must have a discrete contact manager
+   * @param config The monitor settings
+   * @param ns The contact results namespace
+   */
+  void start(std::shared_ptr<const tesseract::environment::Environment> env,
+             ContactMonitorConfig config,
+             std::string ns);
+
+  /** @brief Stop monitoring, the last results are kept */
+  void stop();
+
+  /** @brief Check if the monitor is running */
+  bool isRunning() const;
+
+  /** @brief Queue link transforms to check, replacing queued transforms which have not been checked yet */
+  void update(const tesseract::common::TransformMap& link_transforms);
+
+protected:
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_CONTACT_MONITOR_H
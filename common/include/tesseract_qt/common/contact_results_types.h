@@ -23,6 +23,8 @@
 #ifndef TESSERACT_QT_COLLISION_CONTACT_RESULTS_TYPES_H
 #define TESSERACT_QT_COLLISION_CONTACT_RESULTS_TYPES_H
 
+#include <limits>
+#include <vector>
 #include <tesseract/collision/types.h>
 
 #include <tesseract_qt/common/tracked_object.h>
@@ -37,5 +39,24 @@ ContactResultMap convert(const tesseract::collision::ContactResultMap& contact_r
 
 std::vector<ContactResultMap> convert(const std::vector<tesseract::collision::ContactResultMap>& contact_results);
 
+/** @brief The contacts found at one state (discrete) or segment (continuous) of a trajectory */
+struct ContactResultTimelineEntry
+{
+  /** @brief The index of the trajectory state, for continuous checks the state the segment starts from */
+  std::size_t index{ 0 };
+
+  /** @brief The trajectory time of the state */
+  double time{ 0 };
+
+  /** @brief The smallest contact distance, infinity if no contacts were found */
+  double min_distance{ std::numeric_limits<double>::infinity() };
+
+  /** @brief The contacts, empty if no contacts were found */
+  ContactResultMap contacts;
+};
+
+/** @brief Contact results of a trajectory ordered by state index */
+using ContactResultTimeline = std::vector<ContactResultTimelineEntry>;
+
 }  // namespace tesseract::gui
 #endif  // TESSERACT_QT_COLLISION_CONTACT_RESULTS_TYPES_H
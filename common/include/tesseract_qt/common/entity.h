@@ -24,6 +24,7 @@
 #ifndef TESSERACT_GUI_COMMON_ENTITY_H
 #define TESSERACT_GUI_COMMON_ENTITY_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -37,6 +38,24 @@ struct Entity
   std::string unique_name;
 };
 
+/**
+ * @brief A handle to an entity stored in an EntityRegistry
+ * @details The generation detects handles to entities which have been destroyed and whose slot has been reused
+ */
+struct EntityHandle
+{
+  static constexpr std::uint32_t INVALID_INDEX{ 0xFFFFFFFF };
+
+  std::uint32_t index{ INVALID_INDEX };
+  std::uint32_t generation{ 0 };
+
+  bool isNull() const { return (index == INVALID_INDEX); }
+  bool operator==(const EntityHandle& rhs) const { return (index == rhs.index && generation == rhs.generation); }
+  bool operator!=(const EntityHandle& rhs) const { return !operator==(rhs); }
+};
+
+using EntityHandleVector = std::vector<EntityHandle>;
+
 using EntityMap = std::unordered_map<std::string, Entity>;
 using EntityVector = std::vector<Entity>;
 
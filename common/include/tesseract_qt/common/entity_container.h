@@ -29,11 +29,18 @@
 #include <shared_mutex>
 
 #include <tesseract_qt/common/entity.h>
+#include <tesseract_qt/common/entity_registry.h>
 
 namespace tesseract::gui
 {
 class EntityManager;
 
+/**
+ * @brief Tracks the entities of a single owner, for example a render manager
+ * @details The entities are stored in the entity manager's EntityRegistry, the container keeps their handles by
+ * namespace along with one interned name table per namespace. Prefer the bulk methods and getEntityIds() when working
+ * with a large number of entities.
+ */
 class EntityContainer
 {
 public:
@@ -45,6 +52,11 @@ public:
   static const std::string RESOURCE_NS;
 
   EntityContainer(std::shared_ptr<EntityManager> manager, std::string name);
+  ~EntityContainer();
+  EntityContainer(const EntityContainer&) = delete;
+  EntityContainer& operator=(const EntityContainer&) = delete;
+  EntityContainer(EntityContainer&&) = delete;
+  EntityContainer& operator=(EntityContainer&&) = delete;
 
   /**
    * @brief Get the name of the container
@@ -61,6 +73,14 @@ public:
    */
   Entity addTrackedEntity(const std::string& ns, const std::string& name);
 
+  /**
+   * @brief Add tracked entities with a single lock
+   * @param ns The namespace to store them under
+   * @param names The tracked names
+   * @return The entities in the same order as the names
+   */
+  EntityVector addTrackedEntities(const std::string& ns, const std::vector<std::string>& names);
+
   /**
    * @brief Get a tracked entity
    * @throws If either the namespace or name do not exist
@@ -78,6 +98,15 @@ public:
    */
   bool hasTrackedEntity(const std::string& ns, const std::string& name) const;
 
+  /**
+   * @brief Get the handle of a tracked entity
+   * @details The entity id can be read from the handle without locking using EntityManager::getEntity
+   * @param ns The namespace to search under
+   * @param name The name to locate
+   * @return The handle, null if it does not exist
+   */
+  EntityHandle getTrackedEntityHandle(const std::string& ns, const std::string& name) const;
+
   /**
    * @brief Get the tracked entities under the provided namespace
    * @param ns The namespace to return
@@ -98,6 +127,14 @@ public:
    */
   Entity addUntrackedEntity(const std::string& ns);
 
+  /**
+   * @brief Add untracked entities under the provided namespace with a single lock
+   * @param ns The namespace to store them under
+   * @param count The number of entities
+   * @return The entities
+   */
+  EntityVector addUntrackedEntities(const std::string& ns, std::size_t count);
+
   /**
    * @brief Get the untracked entities under the provided namespace
    * @param ns The namespace to return
@@ -168,6 +205,12 @@ public:
    */
   std::unordered_map<std::string, UnmanagedObjectVector> getUntrackedUnmanagedObjects() const;
 
+  /**
+   * @brief Get the ids of all tracked and untracked entities
+   * @details This avoids building the entity maps when only the ids are needed, for example when clearing a scene
+   */
+  std::vector<int> getEntityIds() const;
+
   /** @brief Check if empty */
   bool empty() const;
 
@@ -181,12 +224,25 @@ public:
 private:
   std::shared_ptr<EntityManager> manager_;
   std::string name_;
-  std::unordered_map<std::string, EntityMap> tracked_entity_map_;
-  std::unordered_map<std::string, EntityVector> untracked_entity_map_;
+
+  struct EntityNamespace
+  {
+    /** @brief The tracked entity names, the name id is the index into tracked */
+    EntityNameTable names;
+    EntityHandleVector tracked;
+    EntityHandleVector untracked;
+  };
+  std::unordered_map<std::string, EntityNamespace> entity_map_;
   std::unordered_map<std::string, UnmanagedObjectMap> tracked_unmanaged_objects_map_;
   std::unordered_map<std::string, UnmanagedObjectVector> untracked_unmanaged_objects_map_;
 
   mutable std::shared_mutex mutex_;
+
+  EntityHandle getTrackedEntityHandleHelper(const std::string& ns, const std::string& name) const;
+  void addTrackedEntitiesHelper(EntityNamespace& entity_ns,
+                                const std::vector<std::string>& names,
+                                const EntityVector& entities);
+  void clearEntitiesHelper();
 };
 }  // namespace tesseract::gui
 #endif  // TESSERACT_GUI_COMMON_ENTITY_CONTAINER_H
@@ -24,6 +24,7 @@
 #ifndef TESSERACT_GUI_COMMON_ENTITY_MANAGER_H
 #define TESSERACT_GUI_COMMON_ENTITY_MANAGER_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -33,6 +34,7 @@
 namespace tesseract::gui
 {
 class EntityContainer;
+class EntityRegistry;
 
 class EntityManager : public std::enable_shared_from_this<EntityManager>
 {
@@ -40,8 +42,13 @@ public:
   using Ptr = std::shared_ptr<EntityManager>;
   using ConstPtr = std::shared_ptr<const EntityManager>;
 
-  EntityManager() = default;
-  virtual ~EntityManager() = default;
+  EntityManager();
+  virtual ~EntityManager();
+  EntityManager(const EntityManager&) = delete;
+  EntityManager& operator=(const EntityManager&) = delete;
+  EntityManager(EntityManager&&) = delete;
+  EntityManager& operator=(EntityManager&&) = delete;
+
   /**
    * @brief Get entity container. If it does not exist one is created.
    * @param name The name of the container
@@ -66,6 +73,24 @@ public:
    */
   Entity createEntity();
 
+  /**
+   * @brief Create a range of new entity IDs
+   * @param count The number of entities to create
+   * @return The new entities
+   */
+  EntityVector createEntities(std::size_t count);
+
+  /**
+   * @brief Get the entity of a handle
+   * @details This is lock free so it may be called from the render thread
+   * @return The entity, the id is -1 if the handle is no longer valid
+   */
+  Entity getEntity(const EntityHandle& handle) const;
+
+  /** @brief Get the registry storing the entities of all containers */
+  EntityRegistry& getRegistry();
+  const EntityRegistry& getRegistry() const;
+
   /** @brief Check if empty */
   bool empty() const;
 
@@ -76,7 +101,8 @@ private:
   mutable std::shared_mutex mutex_;
   std::unordered_map<std::string, std::shared_ptr<EntityContainer>> containers_;
   std::unordered_map<std::string, std::shared_ptr<const EntityContainer>> containers_const_;
-  static int entity_counter_; /**< Start entity counter to avoid clashing with gazebo */
+  std::unique_ptr<EntityRegistry> registry_;
+  static std::atomic<int> entity_counter_; /**< Start entity counter to avoid clashing with gazebo */
 };
 }  // namespace tesseract::gui
 #endif  // TESSERACT_GUI_COMMON_ENTITY_MANAGER_H
@@ -0,0 +1,110 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_GUI_COMMON_ENTITY_REGISTRY_H
+#define TESSERACT_GUI_COMMON_ENTITY_REGISTRY_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <tesseract_qt/common/entity.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief Stores entity ids in a slot map addressed by generation checked handles
+ * @details Destroying an entity bumps the generation of its slot so outstanding handles become invalid and the slot
+ * can be reused. Create and destroy are serialized by a mutex, one lock per call so the bulk versions should be
+ * preferred. Reading through a handle is lock free and may be done from any thread, for example the render thread,
+ * while other threads create or destroy entities.
+ */
+class EntityRegistry
+{
+public:
+  EntityRegistry();
+  ~EntityRegistry();
+  EntityRegistry(const EntityRegistry&) = delete;
+  EntityRegistry& operator=(const EntityRegistry&) = delete;
+  EntityRegistry(EntityRegistry&&) = delete;
+  EntityRegistry& operator=(EntityRegistry&&) = delete;
+
+  /**
+   * @brief Store an entity id
+   * @throws If the registry is full
+   */
+  EntityHandle create(int id);
+
+  /** @brief Store entity ids under a single lock */
+  EntityHandleVector create(const std::vector<int>& ids);
+
+  /** @brief Destroy an entity, invalid handles are ignored */
+  void destroy(const EntityHandle& handle);
+
+  /** @brief Destroy entities under a single lock, invalid handles are ignored */
+  void destroy(const EntityHandleVector& handles);
+
+  /** @brief Check if the handle refers to a live entity, lock free */
+  bool isValid(const EntityHandle& handle) const;
+
+  /** @brief Get the entity id of the handle, -1 if the handle is invalid, lock free */
+  int getId(const EntityHandle& handle) const;
+
+  /** @brief The number of live entities */
+  std::size_t size() const;
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
+/**
+ * @brief Interns names to dense integer ids
+ * @details Each name is stored once, lookups by id are a vector index. It is not thread safe, the owner has to guard
+ * it.
+ */
+class EntityNameTable
+{
+public:
+  /** @brief Get the id of the name, adding the name if it is not in the table yet */
+  std::uint32_t intern(const std::string& name);
+
+  /** @brief Get the id of the name, INVALID_ID if it is not in the table */
+  std::uint32_t find(const std::string& name) const;
+
+  /** @brief Get the name of an id */
+  const std::string& getName(std::uint32_t id) const;
+
+  std::size_t size() const;
+  void clear();
+
+  static constexpr std::uint32_t INVALID_ID = EntityHandle::INVALID_INDEX;
+
+private:
+  std::unordered_map<std::string, std::uint32_t> ids_;
+  std::vector<const std::string*> names_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_GUI_COMMON_ENTITY_REGISTRY_H
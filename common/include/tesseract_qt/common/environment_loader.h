@@ -0,0 +1,60 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_ENVIRONMENT_LOADER_H
+#define TESSERACT_QT_COMMON_ENVIRONMENT_LOADER_H
+
+#ifndef Q_MOC_RUN
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <tesseract/common/fwd.h>
+#include <tesseract/environment/fwd.h>
+#endif
+
+namespace tesseract::gui
+{
+class BackgroundLoader;
+class ComponentInfo;
+
+/**
+ * @brief Parse a URDF and optional SRDF and initialize the environment on the loader's worker thread
+ * @details Parsing includes loading the meshes, which is usually the slowest part. Once done the environment is
+ * registered with the EnvironmentManager on the main thread using a DefaultEnvironmentWrapper, which publishes the
+ * scene graph first and the remaining data in later event loop iterations. A failed load is reported by the
+ * loader's finished signal.
+ * @param loader The loader to run the job on
+ * @param component_info The component info to register the environment with
+ * @param urdf_filepath The URDF file path
+ * @param srdf_filepath The SRDF file path, empty to load the URDF only
+ * @param locator The resource locator used to resolve the package urls
+ * @param on_loaded Optional function called on the main thread after the environment was registered
+ */
+void loadEnvironmentAsync(BackgroundLoader& loader,
+                          std::shared_ptr<const ComponentInfo> component_info,
+                          const std::filesystem::path& urdf_filepath,
+                          const std::filesystem::path& srdf_filepath,
+                          std::shared_ptr<tesseract::common::ResourceLocator> locator,
+                          std::function<void(std::shared_ptr<tesseract::environment::Environment>)> on_loaded = {});
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_ENVIRONMENT_LOADER_H
@@ -27,6 +27,7 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <vector>
 #endif
 
 namespace tesseract::gui
@@ -50,6 +51,8 @@ public:
 
   /**
    * @brief Store the environment wrapper
+   * @details The wrapper is initialized, which broadcasts its data, after the manager lock is released so event
+   * handlers can access the manager
    * @param env The environment wrapper to store
    * @param set_default Indicate if this should be set as the default. The first environment wrapper added is
    * automatically assigned as the default
@@ -108,12 +111,15 @@ private:
   static void initSingleton();
   static std::shared_ptr<EnvironmentManager> instance();
 
-  void setHelper(std::shared_ptr<EnvironmentWrapper> env, bool set_default);
+  /** @brief Returns the removed wrappers, they must be released after the lock because they send events */
+  std::vector<std::shared_ptr<EnvironmentWrapper>> setHelper(std::shared_ptr<EnvironmentWrapper> env,
+                                                             bool set_default);
   std::shared_ptr<EnvironmentWrapper> getHelper(const std::shared_ptr<const ComponentInfo>& component_info) const;
   std::shared_ptr<EnvironmentWrapper> findHelper(const std::shared_ptr<const ComponentInfo>& component_info) const;
   void setDefaultHelper(const std::shared_ptr<const ComponentInfo>& component_info);
   std::shared_ptr<EnvironmentWrapper> getDefaultHelper() const;
-  void removeHelper(const std::shared_ptr<const ComponentInfo>& component_info);
+  std::vector<std::shared_ptr<EnvironmentWrapper>>
+  removeHelper(const std::shared_ptr<const ComponentInfo>& component_info);
 };
 }  // namespace tesseract::gui
 
@@ -32,6 +32,7 @@
 namespace tesseract::gui
 {
 class ComponentInfo;
+class ContactMonitor;
 class EnvironmentWrapper : public QObject
 {
   Q_OBJECT
@@ -47,7 +48,10 @@ public:
   virtual const tesseract::environment::Environment& environment() const = 0;
   virtual tesseract::environment::Environment& environment() = 0;
 
-  /** @brief This broadcast events with associated data for models */
+  /**
+   * @brief This broadcast events with associated data for models
+   * @details The scene graph is sent right away, the state and then the commands, ACM and kinematics are queued
+   */
   void broadcast() const;
 
 protected:
@@ -57,6 +61,9 @@ protected:
   bool initialized_{ false };
   int revision_{ 0 };
 
+  /** @brief Checks the current state for contacts while monitoring is enabled by a ContactResultsMonitor event */
+  std::unique_ptr<ContactMonitor> contact_monitor_;
+
   /** @brief This function is called when added to the environment manager */
   void init();
 };
@@ -23,6 +23,7 @@
 #ifndef TESSERACT_QT_COMMON_CONTACT_RESULTS_EVENTS_H
 #define TESSERACT_QT_COMMON_CONTACT_RESULTS_EVENTS_H
 
+#include <chrono>
 #include <memory>
 #include <variant>
 #include <tesseract/scene_graph/fwd.h>
@@ -61,6 +62,51 @@ private:
   std::variant<ContactResultVector, ContactResultMap> contact_results_;
 };
 
+/** @brief Event called to append a batch of trajectory contact results to a namespace, creating it if needed */
+class ContactResultsAppend : public ComponentEvent
+{
+public:
+  ContactResultsAppend(std::shared_ptr<const ComponentInfo> component_info,
+                       ContactResultTimeline contact_results,
+                       std::string ns = "");
+  ~ContactResultsAppend() override;
+
+  const std::string& getNamespace() const;
+  const ContactResultTimeline& getContactResults() const;
+
+private:
+  std::string ns_;
+  ContactResultTimeline contact_results_;
+};
+
+/**
+ * @brief Event called to update a namespace with the link pairs that changed since the last results
+ * @details A link pair whose contacts changed is listed in changed with the uuid of its previous results, so items
+ * and render entities are updated in place and keep their check state and visibility. Link pairs which did not change
+ * are not listed.
+ */
+class ContactResultsUpdate : public ComponentEvent
+{
+public:
+  ContactResultsUpdate(std::shared_ptr<const ComponentInfo> component_info,
+                       ContactResultMap added,
+                       ContactResultMap changed,
+                       ContactResultMap removed,
+                       std::string ns = "");
+  ~ContactResultsUpdate() override;
+
+  const std::string& getNamespace() const;
+  const ContactResultMap& getAdded() const;
+  const ContactResultMap& getChanged() const;
+  const ContactResultMap& getRemoved() const;
+
+private:
+  std::string ns_;
+  ContactResultMap added_;
+  ContactResultMap changed_;
+  ContactResultMap removed_;
+};
+
 class ContactResultsRemove : public ComponentEventUUID
 {
 public:
@@ -96,7 +142,9 @@ public:
   {
     CURRENT_STATE,
     NAMED_STATE,
-    USER_DEFINED_STATE
+    USER_DEFINED_STATE,
+    /** @brief Scan the trajectory selected in the joint trajectory widget */
+    TRAJECTORY
   };
 
   ContactResultsCompute(std::shared_ptr<const ComponentInfo> component_info,
@@ -118,6 +166,38 @@ private:
   StateType state_type_;
 };
 
+/** @brief Event called to start or stop checking the current state for contacts every time it changes */
+class ContactResultsMonitor : public ComponentEvent
+{
+public:
+  /** @brief Stop monitoring */
+  ContactResultsMonitor(std::shared_ptr<const ComponentInfo> component_info);
+
+  /**
+   * @brief Start monitoring, restarting it if it is already running
+   * @param min_interval The minimum time between two checks, state changes in between are coalesced
+   */
+  ContactResultsMonitor(std::shared_ptr<const ComponentInfo> component_info,
+                        tesseract::collision::ContactManagerConfig contact_manager_config,
+                        tesseract::collision::CollisionCheckConfig collision_check_config,
+                        std::chrono::milliseconds min_interval,
+                        std::string ns = "");
+  ~ContactResultsMonitor() override;
+
+  bool isEnabled() const;
+  const std::string& getNamespace() const;
+  const tesseract::collision::ContactManagerConfig& getContactManagerConfig() const;
+  const tesseract::collision::CollisionCheckConfig& getCollisionCheckConfig() const;
+  std::chrono::milliseconds getMinInterval() const;
+
+private:
+  bool enabled_{ false };
+  std::string ns_;
+  tesseract::collision::ContactManagerConfig contact_manager_config_;
+  tesseract::collision::CollisionCheckConfig collision_check_config_;
+  std::chrono::milliseconds min_interval_{ 0 };
+};
+
 }  // namespace tesseract::gui::events
 
 #endif  // TESSERACT_QT_COMMON_CONTACT_RESULTS_EVENTS_H
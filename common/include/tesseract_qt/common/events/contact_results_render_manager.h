@@ -57,6 +57,13 @@ protected:
   // Documentation inherited
   bool eventFilter(QObject* obj, QEvent* event) override;
 
+  /**
+   * @brief Drop the queued events of a component
+   * @details Clear and set replace all the contact results of a component, so the events queued before them are
+   * dropped. Together with merging consecutive updates this keeps the queue bounded while rendering is paused.
+   */
+  void removeQueuedEvents(const std::shared_ptr<const ComponentInfo>& component_info);
+
   virtual void render() = 0;
 };
 }  // namespace tesseract::gui
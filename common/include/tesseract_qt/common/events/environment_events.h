@@ -55,14 +55,25 @@ private:
 class EnvironmentCommandsAppend : public ComponentEvent
 {
 public:
+  /**
+   * @brief Append commands to the command history
+   * @param component_info The component info
+   * @param commands The commands to append
+   * @param start_revision The revision of the history before the commands were applied, or -1 if unknown
+   */
   EnvironmentCommandsAppend(std::shared_ptr<const ComponentInfo> component_info,
-                            const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands);
+                            const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands,
+                            int start_revision = -1);
   ~EnvironmentCommandsAppend() override;
 
   const std::vector<std::shared_ptr<const tesseract::environment::Command>>& getCommands() const;
 
+  /** @brief The revision of the history the commands are appended to, -1 if unknown */
+  int getStartRevision() const;
+
 private:
   std::vector<std::shared_ptr<const tesseract::environment::Command>> commands_;
+  int start_revision_{ -1 };
 };
 
 class EnvironmentApplyCommand : public ComponentEvent
@@ -53,6 +53,7 @@ struct EventType
   static const int SCROLL_ON_SCENE;
   static const int DRAG_ON_SCENE;
   static const int MOUSE_PRESS_ON_SCENE;
+  static const int PICK_ON_SCENE;
 
   // Tool Path
   static const int TOOL_PATH_ADD;
@@ -78,16 +79,20 @@ struct EventType
   static const int SCENE_GRAPH_REPLACE_JOINT;
   static const int SCENE_GRAPH_MODIFY_LINK_VISIBILITY;
   static const int SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL;
+  static const int SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT;
   static const int SCENE_GRAPH_STATE_CHANGED;
   static const int SCENE_GRAPH_PLOT;
 
   // Contact Results
   static const int CONTACT_RESULTS_CLEAR;
   static const int CONTACT_RESULTS_SET;
+  static const int CONTACT_RESULTS_APPEND;
+  static const int CONTACT_RESULTS_UPDATE;
   static const int CONTACT_RESULTS_REMOVE;
   static const int CONTACT_RESULTS_VISIBILITY;
   static const int CONTACT_RESULTS_VISIBILITY_ALL;
   static const int CONTACT_RESULTS_COMPUTE;
+  static const int CONTACT_RESULTS_MONITOR;
 
   // Contact Results
   static const int ACM_CLEAR;
@@ -138,6 +143,7 @@ struct EventType
 
   // Joint Trajectory
   static const int JOINT_TRAJECTORY_ADD;
+  static const int JOINT_TRAJECTORY_ARCHIVE_ADD;
   static const int JOINT_TRAJECTORY_REMOVE;
   static const int JOINT_TRAJECTORY_REMOVE_NAMESPACE;
   static const int JOINT_TRAJECTORY_REMOVE_SELECTED;
@@ -146,10 +152,20 @@ struct EventType
   static const int JOINT_TRAJECTORY_SAVE;
   static const int JOINT_TRAJECTORY_PLOT;
   static const int JOINT_TRAJECTORY_TOOLBAR_STATE;
+  static const int JOINT_TRAJECTORY_PLAYER_SEEK;
+  static const int JOINT_TRAJECTORY_GHOST;
+  static const int JOINT_TRAJECTORY_GHOST_SET;
+  static const int JOINT_TRAJECTORY_GHOST_CLEAR;
 
   // Manipulation
   static const int MANIPULATION_CHANGED;
 
+  // Reachability Map
+  static const int REACHABILITY_MAP_CLEAR;
+  static const int REACHABILITY_MAP_SET;
+  static const int REACHABILITY_MAP_REFINE;
+  static const int REACHABILITY_MAP_REFINE_FAILED;
+
   // Task Composer
   static const int TASK_COMPOSER_LOAD_CONFIG;
   static const int TASK_COMPOSER_LOAD_LOG;
@@ -169,6 +185,9 @@ struct EventType
   static const int STATUS_LOG_INFO_TOGGLE_OFF;
   static const int STATUS_LOG_WARN_TOGGLE_OFF;
   static const int STATUS_LOG_ERROR_TOGGLE_OFF;
+
+  /** @brief Get the name of a registered event type, used to label trace zones */
+  static const char* getName(int type);
 };
 }  // namespace tesseract::gui::events
 
@@ -33,6 +33,12 @@ namespace tesseract::common
 class JointTrajectorySet;
 }
 
+namespace tesseract::gui
+{
+struct TrajectoryGhost;
+class JointTrajectoryArchive;
+}  // namespace tesseract::gui
+
 namespace tesseract::gui::events
 {
 /** @brief Event called to add a joint trajectory */
@@ -61,6 +67,24 @@ private:
   std::unique_ptr<Implementation> data_;
 };
 
+/**
+ * @brief Event called to add the trajectory sets of a joint trajectory archive
+ * @details The archive is kept open by the model so the trajectories are only read when they are used
+ */
+class JointTrajectoryArchiveAdd : public ComponentEvent
+{
+public:
+  JointTrajectoryArchiveAdd(std::shared_ptr<const ComponentInfo> component_info,
+                            std::shared_ptr<const JointTrajectoryArchive> archive);
+  JointTrajectoryArchiveAdd(const JointTrajectoryArchiveAdd& other);
+  ~JointTrajectoryArchiveAdd() override;
+
+  const std::shared_ptr<const JointTrajectoryArchive>& getArchive() const;
+
+private:
+  std::shared_ptr<const JointTrajectoryArchive> archive_;
+};
+
 /** @brief Event called to remove a joint trajectory */
 class JointTrajectoryRemove : public ComponentEventUUID
 {
@@ -143,5 +167,60 @@ public:
   bool save_enabled{ true };
   bool plot_enabled{ true };
 };
+
+/** @brief Event called to move the joint trajectory player to a time of the current trajectory */
+class JointTrajectoryPlayerSeek : public ComponentEvent
+{
+public:
+  JointTrajectoryPlayerSeek(std::shared_ptr<const ComponentInfo> component_info, double time);
+  JointTrajectoryPlayerSeek(const JointTrajectoryPlayerSeek& other);
+  ~JointTrajectoryPlayerSeek() override;
+
+  double getTime() const;
+
+private:
+  double time_{ 0 };
+};
+
+/**
+ * @brief Event called to show or hide the ghost of the current joint trajectory
+ * @details A sample count of zero hides the ghost
+ */
+class JointTrajectoryGhost : public ComponentEvent
+{
+public:
+  JointTrajectoryGhost(std::shared_ptr<const ComponentInfo> component_info, std::size_t sample_count);
+  JointTrajectoryGhost(const JointTrajectoryGhost& other);
+  ~JointTrajectoryGhost() override;
+
+  std::size_t getSampleCount() const;
+
+private:
+  std::size_t sample_count_{ 0 };
+};
+
+/** @brief Event called to render a joint trajectory ghost, it replaces the current one */
+class JointTrajectoryGhostSet : public ComponentEvent
+{
+public:
+  JointTrajectoryGhostSet(std::shared_ptr<const ComponentInfo> component_info,
+                          std::shared_ptr<const TrajectoryGhost> ghost);
+  JointTrajectoryGhostSet(const JointTrajectoryGhostSet& other);
+  ~JointTrajectoryGhostSet() override;
+
+  const std::shared_ptr<const TrajectoryGhost>& getTrajectoryGhost() const;
+
+private:
+  std::shared_ptr<const TrajectoryGhost> ghost_;
+};
+
+/** @brief Event called to remove the rendered joint trajectory ghost */
+class JointTrajectoryGhostClear : public ComponentEvent
+{
+public:
+  JointTrajectoryGhostClear(std::shared_ptr<const ComponentInfo> component_info);
+  JointTrajectoryGhostClear(const JointTrajectoryGhostClear& other);
+  ~JointTrajectoryGhostClear() override;
+};
 }  // namespace tesseract::gui::events
 #endif  // TESSERACT_QT_COMMON_JOINT_TRAJECTORY_EVENTS_H
@@ -0,0 +1,108 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_REACHABILITY_MAP_EVENTS_H
+#define TESSERACT_QT_COMMON_REACHABILITY_MAP_EVENTS_H
+
+#include <memory>
+#include <vector>
+
+#include <tesseract_qt/common/events/event_type.h>
+#include <tesseract_qt/common/events/component_events.h>
+
+namespace tesseract::gui
+{
+class ReachabilityMap;
+struct ReachabilityVoxelKey;
+}  // namespace tesseract::gui
+
+namespace tesseract::gui::events
+{
+/** @brief Event called to remove the reachability map */
+class ReachabilityMapClear : public ComponentEvent
+{
+public:
+  ReachabilityMapClear(std::shared_ptr<const ComponentInfo> component_info);
+  ReachabilityMapClear(const ReachabilityMapClear& other);
+  ~ReachabilityMapClear() override;
+};
+
+/** @brief Event called to show a reachability map, it replaces the current one */
+class ReachabilityMapSet : public ComponentEvent
+{
+public:
+  ReachabilityMapSet(std::shared_ptr<const ComponentInfo> component_info,
+                     std::shared_ptr<const ReachabilityMap> reachability_map);
+  ReachabilityMapSet(const ReachabilityMapSet& other);
+  ~ReachabilityMapSet() override;
+
+  const std::shared_ptr<const ReachabilityMap>& getReachabilityMap() const;
+
+private:
+  /** @brief Private data pointer */
+  class Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
+/**
+ * @brief Event called to request finer voxels
+ * @details The render manager sends this for the leaf voxels which appear large in the view
+ */
+class ReachabilityMapRefine : public ComponentEvent
+{
+public:
+  ReachabilityMapRefine(std::shared_ptr<const ComponentInfo> component_info, std::vector<ReachabilityVoxelKey> keys);
+  ReachabilityMapRefine(const ReachabilityMapRefine& other);
+  ~ReachabilityMapRefine() override;
+
+  /** @brief The voxels to split into their children */
+  const std::vector<ReachabilityVoxelKey>& getKeys() const;
+
+private:
+  /** @brief Private data pointer */
+  class Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
+/**
+ * @brief Event called when refining voxels failed
+ * @details The render manager may request these voxels again
+ */
+class ReachabilityMapRefineFailed : public ComponentEvent
+{
+public:
+  ReachabilityMapRefineFailed(std::shared_ptr<const ComponentInfo> component_info,
+                              std::vector<ReachabilityVoxelKey> keys);
+  ReachabilityMapRefineFailed(const ReachabilityMapRefineFailed& other);
+  ~ReachabilityMapRefineFailed() override;
+
+  /** @brief The voxels which were not split */
+  const std::vector<ReachabilityVoxelKey>& getKeys() const;
+
+private:
+  /** @brief Private data pointer */
+  class Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui::events
+
+#endif  // TESSERACT_QT_COMMON_REACHABILITY_MAP_EVENTS_H
@@ -39,8 +39,17 @@ public:
   /** @brief Get the scene name the event is associated with */
   const std::string& getSceneName() const;
 
+  /**
+   * @brief Set the camera the event originates from
+   * @details Several render widgets may render the same scene with their own camera, this lets receivers tell them
+   * apart. Empty if the event applies to every camera of the scene.
+   */
+  void setCameraName(std::string camera_name);
+  const std::string& getCameraName() const;
+
 private:
   std::string scene_name_;
+  std::string camera_name_;
 };
 
 /**
@@ -241,6 +241,28 @@ private:
   std::unique_ptr<Implementation> data_;
 };
 
+/**
+ * @brief Event called to highlight links, for example the link under the mouse
+ * @details A highlighted link shows its wire box without changing the user visibility of the link
+ */
+class SceneGraphModifyLinkHighlight : public ComponentEvent
+{
+public:
+  SceneGraphModifyLinkHighlight(std::shared_ptr<const ComponentInfo> component_info,
+                                std::vector<std::string> link_names,
+                                bool highlight);
+  SceneGraphModifyLinkHighlight(const SceneGraphModifyLinkHighlight& other);
+  ~SceneGraphModifyLinkHighlight() override;
+
+  const std::vector<std::string>& getLinkNames() const;
+  bool highlight() const;
+
+private:
+  /** @brief Private data pointer */
+  class Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
 /** @brief Event called to plot scene graph */
 class SceneGraphPlot : public ComponentEvent
 {
@@ -103,6 +103,14 @@ public:
    */
   void applyEnvironment(std::unique_ptr<tesseract::environment::Environment> env);
 
+  /**
+   * @brief Replace the environment with one that already reflects this set, typically shared with other sets
+   * @details The stored commands are cleared because the environment is expected to already contain them. Shared
+   * environments must only have their state changed, clone them before changing anything else.
+   * @param env The environment to use
+   */
+  void setEnvironment(std::shared_ptr<tesseract::environment::Environment> env);
+
   /**
    * @brief Get the environment for the joint trajectory set
    * @details This can be a nullptr. If nullptr then check for commands which should be applied to the existing
@@ -129,7 +129,8 @@ enum class StandardItemType : int
   ENV_COMMAND_SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER = SG_TYPES_END + 22,
   ENV_COMMAND_ADD_TRAJECTORY_LINK                   = SG_TYPES_END + 23,
   ENV_COMMAND_COMMANDS                              = SG_TYPES_END + 24,
-  ENV_COMMAND_TYPES_END                             = SG_TYPES_END + 25,
+  ENV_COMMAND_ENTRY                                 = SG_TYPES_END + 25,
+  ENV_COMMAND_TYPES_END                             = SG_TYPES_END + 26,
 
   // Environment Type
   ENVIRONMENT           = ENV_COMMAND_TYPES_END + 1,
@@ -143,7 +144,8 @@ enum class StandardItemType : int
   COLLISION_CONTACT_REQUEST           = ENVIRONMENT_TYPES_END + 5,
   COLLISION_CONTACT_DETAILS           = ENVIRONMENT_TYPES_END + 6,
   COLLISION_COLLISION_MARGIN_DATA     = ENVIRONMENT_TYPES_END + 7,
-  COLLISION_TYPES_END                 = ENVIRONMENT_TYPES_END + 8,
+  COLLISION_CONTACT_RESULT_TIME       = ENVIRONMENT_TYPES_END + 8,
+  COLLISION_TYPES_END                 = ENVIRONMENT_TYPES_END + 9,
 
   // COMMAND_LANGUAGE Types
   CL_CARTESIAN_WAYPOINT      = COLLISION_TYPES_END + 1,
@@ -0,0 +1,59 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_PARALLEL_BATCHES_H
+#define TESSERACT_QT_COMMON_PARALLEL_BATCHES_H
+
+#include <cstddef>
+#include <functional>
+
+namespace tesseract::gui
+{
+/**
+ * @brief Get the number of workers used to process items in batches
+ * @param thread_count The requested number of workers, zero uses the number of hardware threads
+ * @param total The number of items
+ * @param batch_size The number of items a worker claims at a time, zero is treated as one
+ * @return The number of workers, never more than the number of batches
+ */
+std::size_t getBatchThreadCount(std::size_t thread_count, std::size_t total, std::size_t batch_size);
+
+/**
+ * @brief Process items in batches across worker threads, the calling thread works as well
+ * @details Workers claim batches of consecutive items until all are processed. The first exception thrown by a worker
+ * cancels the others and is rethrown once they have stopped.
+ * @param total The number of items
+ * @param batch_size The number of items a worker claims at a time, zero is treated as one
+ * @param thread_count The number of workers, it should come from getBatchThreadCount
+ * @param process Called for every item with the index of the worker and the item, it is called concurrently
+ * @param completed Optional, called after every batch with its range and the number of items processed so far. It is
+ * called from the worker threads but never concurrently, return false to cancel.
+ * @return False if processing was canceled
+ */
+bool runParallelBatches(std::size_t total,
+                        std::size_t batch_size,
+                        std::size_t thread_count,
+                        const std::function<void(std::size_t worker, std::size_t index)>& process,
+                        const std::function<bool(std::size_t begin, std::size_t end, std::size_t done)>& completed);
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_PARALLEL_BATCHES_H
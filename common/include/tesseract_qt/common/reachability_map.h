@@ -0,0 +1,200 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_REACHABILITY_MAP_H
+#define TESSERACT_QT_COMMON_REACHABILITY_MAP_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+
+#include <tesseract/common/types.h>
+#include <tesseract/environment/fwd.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief The key of a reachability voxel
+ * @details Level zero voxels have the map resolution, every level halves it. Voxels are aligned to the origin of the
+ * working frame, so the children of (level, x, y, z) are (level + 1, 2x + i, 2y + j, 2z + k) with i, j, k in {0, 1}.
+ */
+struct ReachabilityVoxelKey
+{
+  int level{ 0 };
+  int x{ 0 };
+  int y{ 0 };
+  int z{ 0 };
+
+  bool operator==(const ReachabilityVoxelKey& other) const;
+  bool operator!=(const ReachabilityVoxelKey& other) const;
+
+  /** @brief Get the key of the parent voxel, the key itself for level zero */
+  ReachabilityVoxelKey getParent() const;
+
+  /** @brief Get the keys of the eight child voxels */
+  std::vector<ReachabilityVoxelKey> getChildren() const;
+};
+
+struct ReachabilityVoxelKeyHash
+{
+  std::size_t operator()(const ReachabilityVoxelKey& key) const;
+};
+
+/** @brief Settings for computing a reachability map */
+struct ReachabilityMapConfig
+{
+  /** @brief The kinematic group to solve */
+  std::string group_name;
+
+  /** @brief The frame the grid is defined in */
+  std::string working_frame;
+
+  /** @brief The link placed at the voxel centers */
+  std::string tip_link;
+
+  /** @brief The edge length of level zero voxels */
+  double resolution{ 0.1 };
+
+  /** @brief The tip link orientations tried at every voxel, relative to the working frame */
+  tesseract::common::VectorIsometry3d orientations{ Eigen::Isometry3d::Identity() };
+
+  /** @brief The number of worker threads, zero uses the number of hardware threads */
+  std::size_t thread_count{ 0 };
+
+  /** @brief The number of voxels a worker claims at a time */
+  std::size_t batch_size{ 16 };
+};
+
+/**
+ * @brief A sparse multi resolution reachability map
+ * @details Each voxel stores the fraction of orientations with a valid IK solution at its center. A voxel is a leaf if
+ * none of its children were computed, only leaves are shown.
+ */
+class ReachabilityMap
+{
+public:
+  using Ptr = std::shared_ptr<ReachabilityMap>;
+  using ConstPtr = std::shared_ptr<const ReachabilityMap>;
+  using Voxels = std::unordered_map<ReachabilityVoxelKey, float, ReachabilityVoxelKeyHash>;
+
+  ReachabilityMap() = default;
+  ReachabilityMap(std::string key, std::string working_frame, double resolution);
+
+  /** @brief The cache key of the settings the map was computed with, see getReachabilityMapKey */
+  const std::string& getKey() const;
+
+  const std::string& getWorkingFrame() const;
+  double getResolution() const;
+
+  /** @brief Get the edge length of the voxels of a level */
+  double getVoxelSize(int level) const;
+
+  /** @brief Get the center of a voxel in the working frame */
+  Eigen::Vector3d getVoxelCenter(const ReachabilityVoxelKey& key) const;
+
+  /** @brief Get the level zero keys of all voxels overlapping the bounds */
+  std::vector<ReachabilityVoxelKey> getVoxelKeys(const Eigen::AlignedBox3d& bounds) const;
+
+  /** @brief Check if a voxel has no computed children */
+  bool isLeaf(const ReachabilityVoxelKey& key) const;
+
+  /** @brief Get the keys in the list which are not computed yet */
+  std::vector<ReachabilityVoxelKey> getMissing(const std::vector<ReachabilityVoxelKey>& keys) const;
+
+  void setVoxel(const ReachabilityVoxelKey& key, float score);
+  const Voxels& getVoxels() const;
+  bool empty() const;
+
+private:
+  std::string key_;
+  std::string working_frame_;
+  double resolution_{ 0.1 };
+  Voxels voxels_;
+};
+
+/**
+ * @brief Create a set of tool orientations
+ * @details The approach directions (tool z axis) are spread evenly over the sphere, each is rotated about itself in
+ * equal steps.
+ * @param approach_count The number of approach directions
+ * @param roll_count The number of rotations about each approach direction
+ */
+tesseract::common::VectorIsometry3d createReachabilityOrientations(std::size_t approach_count, std::size_t roll_count);
+
+/**
+ * @brief Get the key identifying the results of a configuration
+ * @details This includes a fingerprint of the environment command history, so any change to the environment
+ * invalidates the cache while reloading the same environment reuses it. The joint values outside the group are part
+ * of the key as well. The bounds are not part of the key so maps of different regions share their voxels.
+ */
+std::string getReachabilityMapKey(const tesseract::environment::Environment& env, const ReachabilityMapConfig& config);
+
+/**
+ * @brief Called with every batch of computed voxels as soon as it is done
+ * @details This is called from the worker threads, but never concurrently. Batches are not ordered.
+ * @param batch The computed voxels and their scores
+ * @param computed The number of voxels computed so far
+ * @param total The number of voxels to compute
+ * @return False to cancel
+ */
+using ReachabilityMapCallback = std::function<bool(const std::vector<std::pair<ReachabilityVoxelKey, float>>& batch,
+                                                   std::size_t computed,
+                                                   std::size_t total)>;
+
+/**
+ * @brief Compute the reachability of voxels in parallel
+ * @details Each worker gets its own kinematic group, so the environment is only read. The current state is used as IK
+ * seed and solutions outside the joint limits are ignored.
+ * @param env The environment
+ * @param config The settings, must match the settings the map was created with
+ * @param keys The voxels to compute, voxels already in the map are skipped
+ * @param map The map the results are added to
+ * @param callback Optional callback receiving results while the computation runs
+ * @throws If the kinematic group or the working frame do not exist
+ * @return False if canceled, the map is left unchanged then
+ */
+bool computeReachability(const tesseract::environment::Environment& env,
+                         const ReachabilityMapConfig& config,
+                         const std::vector<ReachabilityVoxelKey>& keys,
+                         ReachabilityMap& map,
+                         const ReachabilityMapCallback& callback = nullptr);
+
+/** @brief Get the cache file name of a map key */
+std::string getReachabilityMapCacheFileName(const std::string& key);
+
+/**
+ * @brief Load a map from a cache file
+ * @param file_path The cache file
+ * @param key The expected key, the file is ignored if it was written for a different key
+ * @return The map, nullptr if the file does not exist or does not match
+ */
+ReachabilityMap::Ptr loadReachabilityMap(const std::string& file_path, const std::string& key);
+
+/** @brief Save a map to a cache file, returns false on failure */
+bool saveReachabilityMap(const std::string& file_path, const ReachabilityMap& map);
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_REACHABILITY_MAP_H
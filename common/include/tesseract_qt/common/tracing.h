@@ -0,0 +1,150 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_TRACING_H
+#define TESSERACT_QT_COMMON_TRACING_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace tesseract::gui
+{
+/** @brief A completed trace zone, times are in nanoseconds since the tracer started */
+struct TraceRecord
+{
+  /** @brief The zone name, a string with static storage duration */
+  const char* name{ nullptr };
+  std::int64_t start{ 0 };
+  std::int64_t duration{ 0 };
+
+  /** @brief The index of the thread the zone ran on */
+  std::uint32_t thread{ 0 };
+};
+
+/** @brief Duration statistics of a trace zone, all times are in milliseconds */
+struct TraceStatistics
+{
+  std::string name;
+  std::size_t count{ 0 };
+  double total{ 0 };
+  double mean{ 0 };
+  double p50{ 0 };
+  double p99{ 0 };
+  double max{ 0 };
+};
+
+/**
+ * @brief Collects trace zones into per thread ring buffers
+ * @details Each thread writes into its own fixed size buffer without locking, a lock is only taken the first time a
+ * thread records a zone. When a buffer is full the oldest records are overwritten. Recording is disabled by default
+ * and the zones only exist when the library is configured with TESSERACT_QT_ENABLE_TRACING so release builds pay
+ * nothing.
+ */
+class Tracer
+{
+public:
+  /** @brief The number of records kept per thread */
+  static constexpr std::size_t BUFFER_CAPACITY{ 1U << 15U };
+
+  /** @brief Check if the zones are compiled in */
+  static bool isAvailable();
+
+  /** @brief Enable or disable recording at runtime */
+  static void setEnabled(bool enabled);
+  static bool isEnabled();
+
+  /** @brief The current time in nanoseconds since the tracer started */
+  static std::int64_t now();
+
+  /**
+   * @brief Record a zone for the calling thread
+   * @param name The zone name, it must have static storage duration
+   * @param start The start time returned by now()
+   * @param end The end time returned by now()
+   */
+  static void record(const char* name, std::int64_t start, std::int64_t end);
+
+  /** @brief Get a copy of the records of all threads sorted by start time */
+  static std::vector<TraceRecord> collect();
+
+  /** @brief Drop the records collected so far */
+  static void clear();
+
+  /** @brief Compute the statistics of each zone, sorted by total time */
+  static std::vector<TraceStatistics> computeStatistics(const std::vector<TraceRecord>& records);
+
+  /**
+   * @brief Write records in the Chrome trace event format
+   * @details The output can be opened with chrome://tracing or https://ui.perfetto.dev
+   */
+  static void writeChromeTrace(std::ostream& os, const std::vector<TraceRecord>& records);
+
+  /**
+   * @brief Write the collected records to a Chrome trace file
+   * @return False if the file could not be written
+   */
+  static bool saveChromeTrace(const std::string& file_path);
+};
+
+/** @brief Records the lifetime of the object as a trace zone */
+class TraceZone
+{
+public:
+  explicit TraceZone(const char* name)
+    : name_(Tracer::isEnabled() ? name : nullptr), start_((name_ != nullptr) ? Tracer::now() : 0)
+  {
+  }
+
+  ~TraceZone()
+  {
+    if (name_ != nullptr)
+      Tracer::record(name_, start_, Tracer::now());
+  }
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+  TraceZone(TraceZone&&) = delete;
+  TraceZone& operator=(TraceZone&&) = delete;
+
+private:
+  const char* name_;
+  std::int64_t start_;
+};
+}  // namespace tesseract::gui
+
+#define TESSERACT_QT_TRACE_CONCAT_IMPL(a, b) a##b
+#define TESSERACT_QT_TRACE_CONCAT(a, b) TESSERACT_QT_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Trace the rest of the enclosing scope as a zone
+ * @param name The zone name, it must have static storage duration
+ */
+#ifdef TESSERACT_QT_TRACING
+#define TESSERACT_QT_TRACE_ZONE(name)                                                                                  \
+  const tesseract::gui::TraceZone TESSERACT_QT_TRACE_CONCAT(tesseract_qt_trace_zone_, __LINE__)(name)
+#else
+#define TESSERACT_QT_TRACE_ZONE(name) (void)0
+#endif
+
+#endif  // TESSERACT_QT_COMMON_TRACING_H
@@ -0,0 +1,50 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_TRACING_APPLICATION_H
+#define TESSERACT_QT_COMMON_TRACING_APPLICATION_H
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+/**
+ * @brief An application which traces the dispatch of the tesseract events
+ * @details Every event with a type registered in events::EventType is recorded as a trace zone named after the type
+ * while tracing is enabled. The Qt events are ignored to keep the trace readable.
+ */
+class TracingApplication : public QApplication
+{
+  Q_OBJECT
+public:
+  TracingApplication(int& argc, char** argv);
+  ~TracingApplication() override;
+  TracingApplication(const TracingApplication&) = delete;
+  TracingApplication& operator=(const TracingApplication&) = delete;
+  TracingApplication(TracingApplication&&) = delete;
+  TracingApplication& operator=(TracingApplication&&) = delete;
+
+  bool notify(QObject* receiver, QEvent* event) override;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_TRACING_APPLICATION_H
@@ -0,0 +1,89 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_TRAJECTORY_CONTACT_SCAN_H
+#define TESSERACT_QT_COMMON_TRAJECTORY_CONTACT_SCAN_H
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+
+#include <tesseract/collision/types.h>
+#include <tesseract/environment/fwd.h>
+
+#include <tesseract_qt/common/contact_results_types.h>
+
+namespace tesseract::gui
+{
+/** @brief Settings for scanning a trajectory for contacts */
+struct TrajectoryContactScanConfig
+{
+  tesseract::collision::ContactManagerConfig contact_manager_config;
+
+  /**
+   * @brief The contact request and evaluator type
+   * @details DISCRETE checks every state, CONTINUOUS every segment between consecutive states. The LVS variants
+   * subdivide each segment so no step is longer than longest_valid_segment_length in joint space.
+   */
+  tesseract::collision::CollisionCheckConfig collision_check_config;
+
+  /** @brief The number of worker threads, zero uses the number of hardware threads */
+  std::size_t thread_count{ 0 };
+
+  /** @brief The number of states a worker claims at a time */
+  std::size_t batch_size{ 16 };
+};
+
+/**
+ * @brief Called with every batch of checked states as soon as it is done
+ * @details This is called from the worker threads, but never concurrently. Batches are not ordered.
+ * @param batch The checked entries
+ * @param checked The number of entries checked so far
+ * @param total The number of entries to check
+ * @return False to cancel the scan
+ */
+using TrajectoryContactScanCallback =
+    std::function<bool(const ContactResultTimeline& batch, std::size_t checked, std::size_t total)>;
+
+/**
+ * @brief Check every state or segment of a trajectory for contacts in parallel
+ * @details Each worker gets its own clone of the environment contact manager and state solver, so the environment is
+ * only read. Joints with a NaN value are left at their current environment value.
+ * @param env The environment to check against
+ * @param joint_names The joint names of the position columns
+ * @param time The time of each state
+ * @param positions The joint positions, one row per state
+ * @param config The scan settings
+ * @param callback Optional callback receiving results while the scan runs
+ * @throws If the trajectory dimensions do not match or the environment does not have the required contact manager
+ * @return One entry per state (discrete) or segment (continuous), empty if the scan was canceled
+ */
+ContactResultTimeline scanTrajectoryContacts(const tesseract::environment::Environment& env,
+                                             const std::vector<std::string>& joint_names,
+                                             const Eigen::Ref<const Eigen::VectorXd>& time,
+                                             const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                                             const TrajectoryContactScanConfig& config,
+                                             const TrajectoryContactScanCallback& callback = nullptr);
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_TRAJECTORY_CONTACT_SCAN_H
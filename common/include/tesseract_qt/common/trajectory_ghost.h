@@ -0,0 +1,101 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_TRAJECTORY_GHOST_H
+#define TESSERACT_QT_COMMON_TRAJECTORY_GHOST_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+
+#include <tesseract/common/types.h>
+#include <tesseract/environment/fwd.h>
+#include <tesseract/scene_graph/fwd.h>
+
+namespace tesseract::gui
+{
+/** @brief Settings for computing the ghost of a trajectory */
+struct TrajectoryGhostConfig
+{
+  /** @brief The number of states shown, evenly spaced in time */
+  std::size_t sample_count{ 10 };
+
+  /** @brief The link traced by the path, empty uses the child link of the last trajectory joint */
+  std::string tcp_link;
+
+  /** @brief The number of worker threads, zero uses the number of hardware threads */
+  std::size_t thread_count{ 0 };
+
+  /** @brief The number of states a worker claims at a time */
+  std::size_t batch_size{ 64 };
+};
+
+/** @brief Sampled states of a trajectory, used to show many poses of the moving links at once */
+struct TrajectoryGhost
+{
+  /** @brief The links moved by the trajectory joints which have visuals */
+  std::vector<std::shared_ptr<const tesseract::scene_graph::Link>> links;
+
+  /** @brief The time of every sampled state */
+  std::vector<double> times;
+
+  /** @brief The world transforms of the links for every sampled state, in the order of links */
+  std::vector<tesseract::common::VectorIsometry3d> link_transforms;
+
+  /** @brief The link traced by the path */
+  std::string tcp_link;
+
+  /** @brief The world position of the tcp link for every state of the trajectory */
+  std::vector<Eigen::Vector3d> tcp_path;
+};
+
+/**
+ * @brief Called as states are computed
+ * @details This is called from the worker threads, but never concurrently
+ * @return False to cancel
+ */
+using TrajectoryGhostCallback = std::function<bool(std::size_t computed, std::size_t total)>;
+
+/**
+ * @brief Compute the link transforms of sampled states and the tcp path of a trajectory in parallel
+ * @details Each worker gets its own clone of the environment state solver, so the environment is only read. Joints
+ * with a NaN value are left at their current environment value.
+ * @param env The environment
+ * @param joint_names The joint names of the position columns
+ * @param time The time of each state
+ * @param positions The joint positions, one row per state
+ * @param config The settings
+ * @param callback Optional callback reporting progress
+ * @throws If the trajectory dimensions do not match or the tcp link does not exist
+ * @return The ghost, empty if the computation was canceled
+ */
+TrajectoryGhost computeTrajectoryGhost(const tesseract::environment::Environment& env,
+                                       const std::vector<std::string>& joint_names,
+                                       const Eigen::Ref<const Eigen::VectorXd>& time,
+                                       const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                                       const TrajectoryGhostConfig& config,
+                                       const TrajectoryGhostCallback& callback = nullptr);
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_TRAJECTORY_GHOST_H
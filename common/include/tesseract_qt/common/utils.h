@@ -23,10 +23,14 @@
 #ifndef TESSERACT_QT_COMMON_UTILS_H
 #define TESSERACT_QT_COMMON_UTILS_H
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include <filesystem>
 
+#include <tesseract/environment/fwd.h>
+
 class QMainWindow;
 class QMenuBar;
 class QMenu;
@@ -100,6 +104,18 @@ QMenu* getMainWindowMenu(const QString& text);
  * @return If not found nullptr, otherwise menu action item
  */
 QAction* getMainWindowMenuAction(QMenu* menu, const QString& text);
+
+/**
+ * @brief Compute a fingerprint of a sequence of environment commands
+ * @details The commands are hashed through their binary serialization so equal commands loaded from different
+ * files produce the same fingerprint, and the result is stable between runs unlike std::hash
+ * @param commands The commands to hash
+ * @param seed The fingerprint of the commands preceding these, used to chain a base history with extra commands
+ * @return The fingerprint
+ */
+std::uint64_t
+getCommandsFingerprint(const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands,
+                       std::uint64_t seed = 0);
 }  // namespace tesseract::gui
 
 #endif  // TESSERACT_QT_COMMON_UTILS_H
@@ -0,0 +1,53 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_LOADER_PROGRESS_DIALOG_H
+#define TESSERACT_QT_COMMON_LOADER_PROGRESS_DIALOG_H
+
+#include <QProgressDialog>
+
+namespace tesseract::gui
+{
+class BackgroundLoader;
+
+/**
+ * @brief Shows the progress of a background loader
+ * @details The dialog shows itself while jobs are running, the cancel button cancels all jobs of the loader and
+ * failed jobs are reported to the status log.
+ */
+class LoaderProgressDialog : public QProgressDialog
+{
+  Q_OBJECT
+public:
+  explicit LoaderProgressDialog(BackgroundLoader* loader, QWidget* parent = nullptr);
+
+private Q_SLOTS:
+  void onStarted(const QString& name);
+  void onProgress(const QString& name, int value, const QString& text);
+  void onFinished(const QString& name, bool success, const QString& message);
+
+private:
+  BackgroundLoader* loader_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_LOADER_PROGRESS_DIALOG_H
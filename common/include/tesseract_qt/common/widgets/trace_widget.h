@@ -0,0 +1,57 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_COMMON_TRACE_WIDGET_H
+#define TESSERACT_QT_COMMON_TRACE_WIDGET_H
+
+#ifndef Q_MOC_RUN
+#include <memory>
+#include <QWidget>
+#endif
+
+namespace tesseract::gui
+{
+/**
+ * @brief Shows the statistics of the trace zones and the recent frame times
+ * @details The widget polls the tracer once a second and can export the collected zones to a Chrome trace file.
+ */
+class TraceWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit TraceWidget(QWidget* parent = nullptr);
+  ~TraceWidget() override;
+
+public Q_SLOTS:
+  void setTracingEnabled(bool enabled);
+  void refresh();
+  void clear();
+  void exportChromeTrace();
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_COMMON_TRACE_WIDGET_H
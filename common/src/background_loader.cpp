@@ -0,0 +1,187 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/background_loader.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <QMetaObject>
+
+namespace tesseract::gui
+{
+struct BackgroundLoader::Implementation
+{
+  struct Task
+  {
+    QString name;
+    Job job;
+    std::shared_ptr<std::atomic<bool>> canceled;
+  };
+
+  BackgroundLoader* loader{ nullptr };
+
+  /** @brief Guards the pending tasks and the running task shared with the worker thread */
+  mutable std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<Task> pending;
+  std::shared_ptr<std::atomic<bool>> running;
+  bool stop{ false };
+  std::thread worker;
+
+  void run()
+  {
+    while (true)
+    {
+      Task task;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return stop || !pending.empty(); });
+        if (stop)
+          return;
+
+        task = std::move(pending.front());
+        pending.pop_front();
+        running = task.canceled;
+      }
+
+      execute(task);
+
+      std::unique_lock<std::mutex> lock(mutex);
+      running = nullptr;
+    }
+  }
+
+  void execute(Task& task)
+  {
+    QMetaObject::invokeMethod(
+        loader, [this, name = task.name]() { Q_EMIT loader->started(name); }, Qt::QueuedConnection);
+
+    bool success{ false };
+    QString message;
+    try
+    {
+      Context context(*loader, task.name, task.canceled);
+      success = task.job(context);
+    }
+    catch (const std::exception& ex)
+    {
+      message = QString::fromStdString(ex.what());
+    }
+
+    // The finished signal is queued after everything delivered by the job
+    QMetaObject::invokeMethod(
+        loader,
+        [this, name = task.name, canceled = task.canceled, success, message]() {
+          if (canceled->load())
+            Q_EMIT loader->finished(name, false, BackgroundLoader::canceledMessage());
+          else
+            Q_EMIT loader->finished(name, success, message);
+        },
+        Qt::QueuedConnection);
+  }
+};
+
+BackgroundLoader::Context::Context(BackgroundLoader& loader, QString name, std::shared_ptr<std::atomic<bool>> canceled)
+  : loader_(loader), name_(std::move(name)), canceled_(std::move(canceled))
+{
+}
+
+bool BackgroundLoader::Context::isCanceled() const { return canceled_->load(); }
+
+void BackgroundLoader::Context::setProgress(int value, const QString& text)
+{
+  QMetaObject::invokeMethod(
+      &loader_,
+      [loader = &loader_, name = name_, value, text]() { Q_EMIT loader->progress(name, value, text); },
+      Qt::QueuedConnection);
+}
+
+void BackgroundLoader::Context::deliver(std::function<void()> fn)
+{
+  QMetaObject::invokeMethod(
+      &loader_,
+      [canceled = canceled_, fn = std::move(fn)]() {
+        if (!canceled->load())
+          fn();
+      },
+      Qt::QueuedConnection);
+}
+
+BackgroundLoader::BackgroundLoader(QObject* parent) : QObject(parent), data_(std::make_unique<Implementation>())
+{
+  data_->loader = this;
+  data_->worker = std::thread([this]() { data_->run(); });
+}
+
+BackgroundLoader::~BackgroundLoader()
+{
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->stop = true;
+    if (data_->running != nullptr)
+      data_->running->store(true);
+
+    for (auto& task : data_->pending)
+      task.canceled->store(true);
+
+    data_->pending.clear();
+  }
+  data_->cv.notify_all();
+  data_->worker.join();
+}
+
+void BackgroundLoader::load(const QString& name, Job job)
+{
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->pending.push_back({ name, std::move(job), std::make_shared<std::atomic<bool>>(false) });
+  }
+  data_->cv.notify_one();
+}
+
+void BackgroundLoader::cancel()
+{
+  std::deque<Implementation::Task> canceled;
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    if (data_->running != nullptr)
+      data_->running->store(true);
+
+    canceled.swap(data_->pending);
+  }
+
+  for (const auto& task : canceled)
+    Q_EMIT finished(task.name, false, canceledMessage());
+}
+
+QString BackgroundLoader::canceledMessage() { return QStringLiteral("Canceled"); }
+
+bool BackgroundLoader::isBusy() const
+{
+  std::unique_lock<std::mutex> lock(data_->mutex);
+  return (data_->running != nullptr || !data_->pending.empty());
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,310 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/contact_monitor.h>
+#include <tesseract_qt/common/contact_results_types.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/contact_results_events.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/common/events/status_log_events.h>
+
+#include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/environment/environment.h>
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <QApplication>
+#include <QMetaObject>
+
+namespace tesseract::gui
+{
+namespace
+{
+bool isEqual(const tesseract::collision::ContactResult& a,
+             const tesseract::collision::ContactResult& b,
+             double tolerance)
+{
+  return (a.link_names == b.link_names && a.shape_id == b.shape_id && a.subshape_id == b.subshape_id &&
+          std::abs(a.distance - b.distance) <= tolerance &&
+          (a.nearest_points[0] - b.nearest_points[0]).norm() <= tolerance &&
+          (a.nearest_points[1] - b.nearest_points[1]).norm() <= tolerance);
+}
+
+bool isEqual(const ContactResultVector& a, const tesseract::collision::ContactResultVector& b, double tolerance)
+{
+  if (a().size() != b.size())
+    return false;
+
+  for (std::size_t i = 0; i < b.size(); ++i)
+  {
+    if (!isEqual(a()[i](), b[i], tolerance))
+      return false;
+  }
+  return true;
+}
+}  // namespace
+
+struct ContactMonitor::Implementation
+{
+  ContactMonitor* monitor{ nullptr };
+  std::shared_ptr<const ComponentInfo> component_info;
+
+  std::shared_ptr<const tesseract::environment::Environment> env;
+  ContactMonitorConfig config;
+  std::string ns;
+
+  /** @brief Set when the monitor is stopped, deliveries of a stopped run are dropped */
+  std::shared_ptr<std::atomic<bool>> canceled;
+
+  /** @brief Guards the pending transforms shared with the worker thread */
+  std::mutex mutex;
+  std::condition_variable cv;
+  tesseract::common::TransformMap pending;
+  bool has_pending{ false };
+  bool stop{ true };
+  std::thread worker;
+
+  /** @brief The worker state, only accessed by the worker thread */
+  std::unique_ptr<tesseract::collision::DiscreteContactManager> contact_manager;
+  int revision{ -1 };
+  ContactResultMap current;
+
+  void run(const std::shared_ptr<std::atomic<bool>>& run_canceled)
+  {
+    auto next_check = std::chrono::steady_clock::now();
+    while (true)
+    {
+      tesseract::common::TransformMap link_transforms;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return stop || has_pending; });
+        if (stop)
+          return;
+
+        // Rate limit, states arriving while waiting replace the pending one
+        if (cv.wait_until(lock, next_check, [this]() { return stop; }))
+          return;
+
+        link_transforms = std::move(pending);
+        pending.clear();
+        has_pending = false;
+      }
+
+      next_check = std::chrono::steady_clock::now() + config.min_interval;
+
+      try
+      {
+        check(link_transforms, run_canceled);
+      }
+      catch (const std::exception& ex)
+      {
+        QMetaObject::invokeMethod(
+            monitor,
+            [message = std::string("ContactMonitor, ") + ex.what()]() {
+              events::StatusLogError event(message);
+              QApplication::sendEvent(qApp, &event);
+            },
+            Qt::QueuedConnection);
+        return;
+      }
+    }
+  }
+
+  void check(const tesseract::common::TransformMap& link_transforms,
+             const std::shared_ptr<std::atomic<bool>>& run_canceled)
+  {
+    // The revision is read first so a change while cloning causes another clone on the next check
+    const int env_revision = env->getRevision();
+    if (contact_manager == nullptr || env_revision != revision)
+    {
+      contact_manager = env->getDiscreteContactManager();
+      if (contact_manager == nullptr)
+        throw std::runtime_error("the environment does not have a discrete contact manager");
+
+      contact_manager->applyContactManagerConfig(config.contact_manager_config);
+      revision = env_revision;
+    }
+
+    contact_manager->setCollisionObjectsTransform(link_transforms);
+
+    tesseract::collision::ContactResultMap results;
+    contact_manager->contactTest(results, config.collision_check_config.contact_request);
+
+    // Diff against the previous results, changed link pairs keep their uuids so they are updated in place
+    ContactResultMap added;
+    ContactResultMap changed;
+    ContactResultMap removed;
+    for (auto it = current.begin(); it != current.end();)
+    {
+      auto result_it = results.find(it->first);
+      if (result_it == results.end())
+      {
+        removed.insert(*it);
+        it = current.erase(it);
+        continue;
+      }
+
+      if (!isEqual(it->second, result_it->second, config.tolerance))
+      {
+        // Contacts are matched by index so the ones still present keep their uuid, and with it their visibility
+        const auto& previous = it->second();
+        ContactResultVector crv(tesseract::common::AlignedVector<ContactResult>(), it->second.getUUID());
+        for (std::size_t i = 0; i < result_it->second.size(); ++i)
+        {
+          if (i < previous.size())
+            crv().emplace_back(ContactResult(result_it->second[i], previous[i].getUUID()));
+          else
+            crv().emplace_back(ContactResult(result_it->second[i]));
+        }
+
+        it->second = crv;
+        changed[it->first] = crv;
+      }
+      ++it;
+    }
+
+    for (const auto& pair : results)
+    {
+      if (current.find(pair.first) != current.end())
+        continue;
+
+      ContactResultVector crv;
+      for (const auto& result : pair.second)
+        crv().emplace_back(ContactResult(result));
+
+      current[pair.first] = crv;
+      added[pair.first] = crv;
+    }
+
+    if (added.empty() && changed.empty() && removed.empty())
+      return;
+
+    QMetaObject::invokeMethod(
+        monitor,
+        [this,
+         canceled = run_canceled,
+         added = std::move(added),
+         changed = std::move(changed),
+         removed = std::move(removed),
+         ns = ns]() {
+          if (canceled->load())
+            return;
+
+          events::ContactResultsUpdate event(component_info, added, changed, removed, ns);
+          QApplication::sendEvent(qApp, &event);
+        },
+        Qt::QueuedConnection);
+  }
+};
+
+ContactMonitor::ContactMonitor(std::shared_ptr<const ComponentInfo> component_info, QObject* parent)
+  : QObject(parent), data_(std::make_unique<Implementation>())
+{
+  data_->monitor = this;
+  data_->component_info = std::move(component_info);
+
+  qApp->installEventFilter(this);
+}
+
+ContactMonitor::~ContactMonitor() { stop(); }
+
+void ContactMonitor::start(std::shared_ptr<const tesseract::environment::Environment> env,
+                           ContactMonitorConfig config,
+                           std::string ns)
+{
+  stop();
+
+  data_->env = std::move(env);
+  data_->config = std::move(config);
+  data_->ns = std::move(ns);
+  data_->contact_manager = nullptr;
+  data_->revision = -1;
+  data_->current.clear();
+  data_->canceled = std::make_shared<std::atomic<bool>>(false);
+
+  // The first update adds every link pair in contact
+  events::ContactResultsClear event(data_->component_info, data_->ns);
+  QApplication::sendEvent(qApp, &event);
+
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->pending = data_->env->getState().link_transforms;
+    data_->has_pending = true;
+    data_->stop = false;
+  }
+
+  data_->worker = std::thread([this, canceled = data_->canceled]() { data_->run(canceled); });
+}
+
+void ContactMonitor::stop()
+{
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->stop = true;
+    data_->has_pending = false;
+    data_->pending.clear();
+  }
+  data_->cv.notify_all();
+
+  if (data_->worker.joinable())
+    data_->worker.join();
+
+  if (data_->canceled != nullptr)
+    data_->canceled->store(true);
+}
+
+bool ContactMonitor::isRunning() const { return data_->worker.joinable(); }
+
+void ContactMonitor::update(const tesseract::common::TransformMap& link_transforms)
+{
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    if (data_->stop)
+      return;
+
+    data_->pending = link_transforms;
+    data_->has_pending = true;
+  }
+  data_->cv.notify_all();
+}
+
+bool ContactMonitor::eventFilter(QObject* obj, QEvent* event)
+{
+  if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+  {
+    assert(dynamic_cast<events::SceneStateChanged*>(event) != nullptr);
+    auto* e = static_cast<events::SceneStateChanged*>(event);
+    if (e->getComponentInfo() == data_->component_info)
+      update(e->getState().link_transforms);
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+
+}  // namespace tesseract::gui
@@ -38,76 +38,165 @@ EntityContainer::EntityContainer(std::shared_ptr<EntityManager> manager, std::st
 
 std::string EntityContainer::getName() const { return name_; }
 
+EntityContainer::~EntityContainer() { clearEntitiesHelper(); }
+
 Entity EntityContainer::addTrackedEntity(const std::string& ns, const std::string& name)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   Entity entity = manager_->createEntity();
-  tracked_entity_map_[ns][name] = entity;
+  addTrackedEntitiesHelper(entity_map_[ns], { name }, { entity });
   return entity;
 }
 
+EntityVector EntityContainer::addTrackedEntities(const std::string& ns, const std::vector<std::string>& names)
+{
+  EntityVector entities = manager_->createEntities(names.size());
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addTrackedEntitiesHelper(entity_map_[ns], names, entities);
+  return entities;
+}
+
 Entity EntityContainer::getTrackedEntity(const std::string& ns, const std::string& name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  auto ns_it = tracked_entity_map_.find(ns);
-  if (ns_it == tracked_entity_map_.end())
+  auto ns_it = entity_map_.find(ns);
+  if (ns_it == entity_map_.end())
     throw std::runtime_error("Tracked entity namespace does not exist for name '" + ns + "'.");
 
-  auto it = ns_it->second.find(name);
-  if (it == ns_it->second.end())
+  EntityHandle handle = getTrackedEntityHandleHelper(ns, name);
+  if (handle.isNull())
     throw std::runtime_error("Tracked entity '" + name + "' does not exist under namespace '" + ns + "'.");
 
-  return it->second;
+  return manager_->getEntity(handle);
 }
 
 bool EntityContainer::hasTrackedEntity(const std::string& ns, const std::string& name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  auto ns_it = tracked_entity_map_.find(ns);
-  if (ns_it == tracked_entity_map_.end())
-    return false;
+  return !getTrackedEntityHandleHelper(ns, name).isNull();
+}
 
-  return (ns_it->second.find(name) != ns_it->second.end());
+EntityHandle EntityContainer::getTrackedEntityHandle(const std::string& ns, const std::string& name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return getTrackedEntityHandleHelper(ns, name);
 }
 
 EntityMap EntityContainer::getTrackedEntities(const std::string& ns) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  auto ns_it = tracked_entity_map_.find(ns);
-  if (ns_it == tracked_entity_map_.end())
+  auto ns_it = entity_map_.find(ns);
+  if (ns_it == entity_map_.end())
     return {};
 
-  return ns_it->second;
+  const EntityNamespace& entity_ns = ns_it->second;
+  EntityMap entities;
+  entities.reserve(entity_ns.tracked.size());
+  for (std::size_t i = 0; i < entity_ns.tracked.size(); ++i)
+  {
+    if (!entity_ns.tracked[i].isNull())
+      entities[entity_ns.names.getName(static_cast<std::uint32_t>(i))] = manager_->getEntity(entity_ns.tracked[i]);
+  }
+
+  return entities;
 }
 
 std::unordered_map<std::string, EntityMap> EntityContainer::getTrackedEntities() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return tracked_entity_map_;
+  std::unordered_map<std::string, EntityMap> entities;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& ns : entity_map_)
+      entities[ns.first];
+  }
+
+  for (auto& ns : entities)
+    ns.second = getTrackedEntities(ns.first);
+
+  return entities;
 }
 
 Entity EntityContainer::addUntrackedEntity(const std::string& ns)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   Entity entity = manager_->createEntity();
-  untracked_entity_map_[ns].push_back(entity);
+  entity_map_[ns].untracked.push_back(manager_->getRegistry().create(entity.id));
   return entity;
 }
 
+EntityVector EntityContainer::addUntrackedEntities(const std::string& ns, std::size_t count)
+{
+  EntityVector entities = manager_->createEntities(count);
+
+  std::vector<int> ids;
+  ids.reserve(entities.size());
+  for (const auto& entity : entities)
+    ids.push_back(entity.id);
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  EntityHandleVector handles = manager_->getRegistry().create(ids);
+  EntityHandleVector& untracked = entity_map_[ns].untracked;
+  untracked.insert(untracked.end(), handles.begin(), handles.end());
+  return entities;
+}
+
 EntityVector EntityContainer::getUntrackedEntities(const std::string& ns) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  auto ns_it = untracked_entity_map_.find(ns);
-  if (ns_it == untracked_entity_map_.end())
+  auto ns_it = entity_map_.find(ns);
+  if (ns_it == entity_map_.end())
     return {};
 
-  return ns_it->second;
+  EntityVector entities;
+  entities.reserve(ns_it->second.untracked.size());
+  for (const auto& handle : ns_it->second.untracked)
+    entities.push_back(manager_->getEntity(handle));
+
+  return entities;
 }
 
 std::unordered_map<std::string, EntityVector> EntityContainer::getUntrackedEntities() const
+{
+  std::unordered_map<std::string, EntityVector> entities;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& ns : entity_map_)
+    {
+      if (!ns.second.untracked.empty())
+        entities[ns.first];
+    }
+  }
+
+  for (auto& ns : entities)
+    ns.second = getUntrackedEntities(ns.first);
+
+  return entities;
+}
+
+std::vector<int> EntityContainer::getEntityIds() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return untracked_entity_map_;
+  const EntityRegistry& registry = manager_->getRegistry();
+  std::vector<int> ids;
+  for (const auto& ns : entity_map_)
+  {
+    for (const auto& handle : ns.second.tracked)
+    {
+      int id = registry.getId(handle);
+      if (id != -1)
+        ids.push_back(id);
+    }
+
+    for (const auto& handle : ns.second.untracked)
+    {
+      int id = registry.getId(handle);
+      if (id != -1)
+        ids.push_back(id);
+    }
+  }
+
+  return ids;
 }
 
 void EntityContainer::addTrackedUnmanagedObject(const std::string& ns, const std::string& name, UnmanagedObject object)
@@ -181,18 +270,9 @@ std::unordered_map<std::string, UnmanagedObjectVector> EntityContainer::getUntra
 bool EntityContainer::empty() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  if (tracked_entity_map_.empty() && untracked_entity_map_.empty())
-    return true;
-
-  for (const auto& ns : tracked_entity_map_)
+  for (const auto& ns : entity_map_)
   {
-    if (!ns.second.empty())
-      return false;
-  }
-
-  for (const auto& ns : untracked_entity_map_)
-  {
-    if (!ns.second.empty())
+    if (ns.second.names.size() > 0 || !ns.second.untracked.empty())
       return false;
   }
 
@@ -214,8 +294,7 @@ bool EntityContainer::empty() const
 void EntityContainer::clear()
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  tracked_entity_map_.clear();
-  untracked_entity_map_.clear();
+  clearEntitiesHelper();
   tracked_unmanaged_objects_map_.clear();
   untracked_unmanaged_objects_map_.clear();
 }
@@ -223,4 +302,60 @@ void EntityContainer::clear()
 EntityManager& EntityContainer::getEntityManager() { return *manager_; }
 const EntityManager& EntityContainer::getEntityManager() const { return *manager_; }
 
+EntityHandle EntityContainer::getTrackedEntityHandleHelper(const std::string& ns, const std::string& name) const
+{
+  auto ns_it = entity_map_.find(ns);
+  if (ns_it == entity_map_.end())
+    return {};
+
+  std::uint32_t name_id = ns_it->second.names.find(name);
+  if (name_id == EntityNameTable::INVALID_ID)
+    return {};
+
+  return ns_it->second.tracked[name_id];
+}
+
+void EntityContainer::addTrackedEntitiesHelper(EntityNamespace& entity_ns,
+                                               const std::vector<std::string>& names,
+                                               const EntityVector& entities)
+{
+  std::vector<int> ids;
+  ids.reserve(entities.size());
+  for (const auto& entity : entities)
+    ids.push_back(entity.id);
+
+  EntityRegistry& registry = manager_->getRegistry();
+  EntityHandleVector handles = registry.create(ids);
+  EntityHandleVector replaced;
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    std::uint32_t name_id = entity_ns.names.intern(names[i]);
+    if (name_id < entity_ns.tracked.size())
+    {
+      replaced.push_back(entity_ns.tracked[name_id]);
+      entity_ns.tracked[name_id] = handles[i];
+    }
+    else
+    {
+      entity_ns.tracked.push_back(handles[i]);
+    }
+  }
+
+  if (!replaced.empty())
+    registry.destroy(replaced);
+}
+
+void EntityContainer::clearEntitiesHelper()
+{
+  EntityHandleVector handles;
+  for (const auto& ns : entity_map_)
+  {
+    handles.insert(handles.end(), ns.second.tracked.begin(), ns.second.tracked.end());
+    handles.insert(handles.end(), ns.second.untracked.begin(), ns.second.untracked.end());
+  }
+
+  manager_->getRegistry().destroy(handles);
+  entity_map_.clear();
+}
+
 }  // namespace tesseract::gui
@@ -22,10 +22,26 @@
  */
 #include <tesseract_qt/common/entity_manager.h>
 #include <tesseract_qt/common/entity_container.h>
+#include <tesseract_qt/common/entity_registry.h>
 
 namespace tesseract::gui
 {
-int EntityManager::entity_counter_ = 10000;  // NOLINT
+namespace
+{
+Entity makeEntity(int id)
+{
+  Entity entity;
+  entity.id = id;
+  entity.unique_name = "TesseractEntity::" + std::to_string(entity.id);
+  return entity;
+}
+}  // namespace
+
+std::atomic<int> EntityManager::entity_counter_ = 10000;  // NOLINT
+
+EntityManager::EntityManager() : registry_(std::make_unique<EntityRegistry>()) {}
+
+EntityManager::~EntityManager() = default;
 
 std::shared_ptr<EntityContainer> EntityManager::getEntityContainer(const std::string& name)
 {
@@ -77,15 +93,29 @@ std::unordered_map<std::string, std::shared_ptr<const EntityContainer>> EntityMa
   return containers_const_;
 }
 
-Entity EntityManager::createEntity()
+Entity EntityManager::createEntity() { return makeEntity(++entity_counter_); }
+
+EntityVector EntityManager::createEntities(std::size_t count)
+{
+  const int first = entity_counter_.fetch_add(static_cast<int>(count)) + 1;
+
+  EntityVector entities;
+  entities.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    entities.push_back(makeEntity(first + static_cast<int>(i)));
+
+  return entities;
+}
+
+Entity EntityManager::getEntity(const EntityHandle& handle) const
 {
-  std::unique_lock<std::shared_mutex> lock(mutex_);
-  Entity entity;
-  entity.id = ++entity_counter_;
-  entity.unique_name = "TesseractEntity::" + std::to_string(entity.id);
-  return entity;
+  const int id = registry_->getId(handle);
+  return (id == -1) ? Entity() : makeEntity(id);
 }
 
+EntityRegistry& EntityManager::getRegistry() { return *registry_; }
+const EntityRegistry& EntityManager::getRegistry() const { return *registry_; }
+
 bool EntityManager::empty() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -105,5 +135,6 @@ void EntityManager::clear()
     c.second->clear();
 
   containers_.clear();
+  containers_const_.clear();
 }
 }  // namespace tesseract::gui
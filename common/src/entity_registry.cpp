@@ -0,0 +1,210 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/entity_registry.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief Slots are allocated in chunks which are never moved so readers do not need a lock */
+constexpr std::uint32_t CHUNK_BITS = 12;
+constexpr std::uint32_t CHUNK_SIZE = 1U << CHUNK_BITS;
+constexpr std::uint32_t CHUNK_COUNT = 4096;
+
+struct Slot
+{
+  /** @brief Incremented when the entity is destroyed */
+  std::atomic<std::uint32_t> generation{ 0 };
+  std::atomic<int> id{ -1 };
+};
+
+using Chunk = std::array<Slot, CHUNK_SIZE>;
+}  // namespace
+
+struct EntityRegistry::Implementation
+{
+  std::array<std::atomic<Chunk*>, CHUNK_COUNT> chunks{};
+
+  /** @brief Guards the slot allocation, readers never take it */
+  std::mutex mutex;
+  std::uint32_t slot_count{ 0 };
+  std::vector<std::uint32_t> free_slots;
+  std::atomic<std::size_t> size{ 0 };
+
+  ~Implementation()
+  {
+    for (auto& chunk : chunks)
+      delete chunk.load();
+  }
+
+  const Slot* findSlot(const EntityHandle& handle) const
+  {
+    if (handle.index >= CHUNK_COUNT * CHUNK_SIZE)
+      return nullptr;
+
+    const Chunk* chunk = chunks[handle.index >> CHUNK_BITS].load(std::memory_order_acquire);
+    if (chunk == nullptr)
+      return nullptr;
+
+    return &(*chunk)[handle.index & (CHUNK_SIZE - 1)];
+  }
+
+  /** @brief Must be called with the mutex locked */
+  EntityHandle createLocked(int id)
+  {
+    std::uint32_t index{ 0 };
+    if (!free_slots.empty())
+    {
+      index = free_slots.back();
+      free_slots.pop_back();
+    }
+    else
+    {
+      if (slot_count >= CHUNK_COUNT * CHUNK_SIZE)
+        throw std::runtime_error("EntityRegistry, the maximum number of entities is reached");
+
+      index = slot_count++;
+      auto& chunk = chunks[index >> CHUNK_BITS];
+      if (chunk.load(std::memory_order_relaxed) == nullptr)
+        chunk.store(new Chunk(), std::memory_order_release);
+    }
+
+    Slot& slot = (*chunks[index >> CHUNK_BITS].load(std::memory_order_relaxed))[index & (CHUNK_SIZE - 1)];
+    slot.id.store(id, std::memory_order_release);
+    ++size;
+
+    EntityHandle handle;
+    handle.index = index;
+    handle.generation = slot.generation.load(std::memory_order_relaxed);
+    return handle;
+  }
+
+  /** @brief Must be called with the mutex locked */
+  void destroyLocked(const EntityHandle& handle)
+  {
+    auto* slot = const_cast<Slot*>(findSlot(handle));
+    if (slot == nullptr || slot->generation.load(std::memory_order_relaxed) != handle.generation)
+      return;
+
+    // Bumping the generation first invalidates the handle before the id is reset
+    slot->generation.fetch_add(1, std::memory_order_release);
+    slot->id.store(-1, std::memory_order_release);
+    free_slots.push_back(handle.index);
+    --size;
+  }
+};
+
+EntityRegistry::EntityRegistry() : data_(std::make_unique<Implementation>()) {}
+
+EntityRegistry::~EntityRegistry() = default;
+
+EntityHandle EntityRegistry::create(int id)
+{
+  std::scoped_lock lock(data_->mutex);
+  return data_->createLocked(id);
+}
+
+EntityHandleVector EntityRegistry::create(const std::vector<int>& ids)
+{
+  EntityHandleVector handles;
+  handles.reserve(ids.size());
+
+  std::scoped_lock lock(data_->mutex);
+  for (int id : ids)
+    handles.push_back(data_->createLocked(id));
+
+  return handles;
+}
+
+void EntityRegistry::destroy(const EntityHandle& handle)
+{
+  std::scoped_lock lock(data_->mutex);
+  data_->destroyLocked(handle);
+}
+
+void EntityRegistry::destroy(const EntityHandleVector& handles)
+{
+  std::scoped_lock lock(data_->mutex);
+  for (const auto& handle : handles)
+    data_->destroyLocked(handle);
+}
+
+bool EntityRegistry::isValid(const EntityHandle& handle) const { return (getId(handle) != -1); }
+
+int EntityRegistry::getId(const EntityHandle& handle) const
+{
+  const Slot* slot = data_->findSlot(handle);
+  if (slot == nullptr)
+    return -1;
+
+  // The generation is checked before and after reading the id in case the entity is destroyed meanwhile
+  if (slot->generation.load(std::memory_order_acquire) != handle.generation)
+    return -1;
+
+  const int id = slot->id.load(std::memory_order_acquire);
+  if (slot->generation.load(std::memory_order_acquire) != handle.generation)
+    return -1;
+
+  return id;
+}
+
+std::size_t EntityRegistry::size() const { return data_->size.load(); }
+
+//////////////////////////////////////////
+
+std::uint32_t EntityNameTable::intern(const std::string& name)
+{
+  auto it = ids_.find(name);
+  if (it != ids_.end())
+    return it->second;
+
+  const auto id = static_cast<std::uint32_t>(names_.size());
+  auto result = ids_.emplace(name, id);
+
+  // The keys of an unordered map are never moved so the table can point to them
+  names_.push_back(&result.first->first);
+  return id;
+}
+
+std::uint32_t EntityNameTable::find(const std::string& name) const
+{
+  auto it = ids_.find(name);
+  return (it == ids_.end()) ? INVALID_ID : it->second;
+}
+
+const std::string& EntityNameTable::getName(std::uint32_t id) const { return *names_.at(id); }
+
+std::size_t EntityNameTable::size() const { return names_.size(); }
+
+void EntityNameTable::clear()
+{
+  ids_.clear();
+  names_.clear();
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,74 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/environment_loader.h>
+#include <tesseract_qt/common/background_loader.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+
+#include <tesseract/common/resource_locator.h>
+#include <tesseract/environment/environment.h>
+
+#include <QString>
+
+namespace tesseract::gui
+{
+void loadEnvironmentAsync(BackgroundLoader& loader,
+                          std::shared_ptr<const ComponentInfo> component_info,
+                          const std::filesystem::path& urdf_filepath,
+                          const std::filesystem::path& srdf_filepath,
+                          std::shared_ptr<tesseract::common::ResourceLocator> locator,
+                          std::function<void(std::shared_ptr<tesseract::environment::Environment>)> on_loaded)
+{
+  auto job = [component_info = std::move(component_info),
+              urdf_filepath,
+              srdf_filepath,
+              locator = std::move(locator),
+              on_loaded = std::move(on_loaded)](BackgroundLoader::Context& context) {
+    context.setProgress(-1, "Parsing URDF/SRDF");
+    auto env = std::make_shared<tesseract::environment::Environment>();
+    bool loaded{ false };
+    if (srdf_filepath.empty())
+      loaded = env->init(urdf_filepath, locator);
+    else
+      loaded = env->init(urdf_filepath, srdf_filepath, locator);
+
+    if (!loaded || !env->isInitialized())
+      return false;
+
+    if (context.isCanceled())
+      return false;
+
+    context.setProgress(90, "Publishing environment");
+    context.deliver([component_info, env, on_loaded]() {
+      EnvironmentManager::set(std::make_shared<DefaultEnvironmentWrapper>(component_info, env));
+      if (on_loaded)
+        on_loaded(env);
+    });
+    context.setProgress(100);
+    return true;
+  };
+
+  loader.load(QString::fromStdString(urdf_filepath.filename().string()), std::move(job));
+}
+}  // namespace tesseract::gui
@@ -26,6 +26,7 @@
 #include <tesseract_qt/common/component_info.h>
 
 #include <map>
+#include <vector>
 #include <unordered_map>
 #include <shared_mutex>
 
@@ -49,8 +50,15 @@ void EnvironmentManager::initSingleton() { singleton = std::make_shared<Environm
 void EnvironmentManager::set(std::shared_ptr<EnvironmentWrapper> env, bool set_default)
 {
   std::shared_ptr<EnvironmentManager> obj = instance();
-  std::unique_lock lock(obj->data_->mutex);
-  obj->setHelper(env, set_default);
+  std::vector<std::shared_ptr<EnvironmentWrapper>> removed;
+  {
+    std::unique_lock lock(obj->data_->mutex);
+    removed = obj->setHelper(env, set_default);
+  }
+
+  // Both send events whose handlers may call back into the manager, so the lock must not be held
+  removed.clear();
+  env->init();
 }
 
 std::shared_ptr<EnvironmentWrapper> EnvironmentManager::get(const std::shared_ptr<const ComponentInfo>& component_info)
@@ -91,16 +99,22 @@ void EnvironmentManager::setDefault(std::shared_ptr<const ComponentInfo> compone
 void EnvironmentManager::remove(const std::shared_ptr<const ComponentInfo>& component_info)
 {
   std::shared_ptr<EnvironmentManager> obj = instance();
-  std::unique_lock lock(obj->data_->mutex);
-  obj->removeHelper(component_info);
+  std::vector<std::shared_ptr<EnvironmentWrapper>> removed;
+  {
+    std::unique_lock lock(obj->data_->mutex);
+    removed = obj->removeHelper(component_info);
+  }
 }
 
 void EnvironmentManager::clear()
 {
   std::shared_ptr<EnvironmentManager> obj = instance();
-  std::unique_lock lock(obj->data_->mutex);
-  obj->data_->environments.clear();
-  obj->data_->default_component_info = nullptr;
+  std::map<std::shared_ptr<const ComponentInfo>, std::shared_ptr<EnvironmentWrapper>> removed;
+  {
+    std::unique_lock lock(obj->data_->mutex);
+    removed.swap(obj->data_->environments);
+    obj->data_->default_component_info = nullptr;
+  }
 }
 
 std::shared_ptr<EnvironmentManager> EnvironmentManager::instance()
@@ -109,22 +123,21 @@ std::shared_ptr<EnvironmentManager> EnvironmentManager::instance()
   return singleton;
 }
 
-void EnvironmentManager::setHelper(std::shared_ptr<EnvironmentWrapper> env, bool set_default)
+std::vector<std::shared_ptr<EnvironmentWrapper>>
+EnvironmentManager::setHelper(std::shared_ptr<EnvironmentWrapper> env, bool set_default)
 {
   std::shared_ptr<const ComponentInfo> component_info = env->getComponentInfo();
 
   // Remove any existing wrappers associated with component info
-  removeHelper(component_info);
-
-  // Initialize environment wrapper
-  env->init();
+  std::vector<std::shared_ptr<EnvironmentWrapper>> removed = removeHelper(component_info);
 
   // Set default if not already set
   if (data_->environments.empty() || set_default)
     data_->default_component_info = component_info;
 
-  // Store the wrapper
+  // Store the wrapper, it is initialized by the caller once the lock is released
   data_->environments[component_info] = env;
+  return removed;
 }
 
 std::shared_ptr<EnvironmentWrapper>
@@ -164,7 +177,8 @@ std::shared_ptr<EnvironmentWrapper> EnvironmentManager::getDefaultHelper() const
   return getHelper(data_->default_component_info);
 }
 
-void EnvironmentManager::removeHelper(const std::shared_ptr<const ComponentInfo>& component_info)
+std::vector<std::shared_ptr<EnvironmentWrapper>>
+EnvironmentManager::removeHelper(const std::shared_ptr<const ComponentInfo>& component_info)
 {
   bool update_default{ false };
   std::vector<std::shared_ptr<const ComponentInfo>> remove_component_infos;
@@ -179,8 +193,12 @@ void EnvironmentManager::removeHelper(const std::shared_ptr<const ComponentInfo>
     }
   }
 
+  std::vector<std::shared_ptr<EnvironmentWrapper>> removed;
   for (const auto& rci : remove_component_infos)
+  {
+    removed.push_back(data_->environments.at(rci));
     data_->environments.erase(rci);
+  }
 
   if (update_default)
   {
@@ -188,6 +206,8 @@ void EnvironmentManager::removeHelper(const std::shared_ptr<const ComponentInfo>
     if (!data_->environments.empty())
       data_->default_component_info = data_->environments.begin()->first;
   }
+
+  return removed;
 }
 
 }  // namespace tesseract::gui
@@ -23,6 +23,9 @@
 
 #include <tesseract_qt/common/environment_wrapper.h>
 #include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/contact_monitor.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/tracing.h>
 
 #include <tesseract_qt/common/events/allowed_collision_matrix_events.h>
 #include <tesseract_qt/common/events/contact_results_events.h>
@@ -68,6 +71,16 @@ void invokeOnAppThread(Fn&& fn)
   else
     QMetaObject::invokeMethod(qApp, std::forward<Fn>(fn), Qt::QueuedConnection);
 }
+
+/** @brief Run on the app thread after the events already queued, even when called from the app thread */
+template <typename Fn>
+void queueOnAppThread(Fn&& fn)
+{
+  if (qApp == nullptr)
+    fn();
+  else
+    QMetaObject::invokeMethod(qApp, std::forward<Fn>(fn), Qt::QueuedConnection);
+}
 }  // namespace
 
 static const std::string DEFAULT_CONTACT_MANAGER_PLUGINS =
@@ -105,6 +118,10 @@ void applyDefaultContactManager(tesseract::environment::Environment& env)
 
 ///////////////////////////////////////
 
+void broadcastHelper(const std::shared_ptr<const tesseract::gui::ComponentInfo>& component_info,
+                     const std::shared_ptr<const tesseract::environment::Environment>& env,
+                     bool send_commands = true);
+
 void tesseractEventFilterHelper(const tesseract::environment::Event& event,
                                 tesseract::gui::EnvironmentWrapper& env_wrapper,
                                 int& current_revision)
@@ -170,8 +187,22 @@ void tesseractEventFilterHelper(const tesseract::environment::Event& event,
             }
           }
         }
+
+        // Only the commands past the last known revision are sent so the command history is not copied on every change
+        if (e.revision > current_revision)
+        {
+          tesseract::environment::Commands appended(e.commands.begin() + current_revision,
+                                                    e.commands.begin() + e.revision);
+          invokeOnAppThread([component_info = env_wrapper.getComponentInfo(),
+                             commands = std::move(appended),
+                             start_revision = current_revision]() {
+            tesseract::gui::events::EnvironmentCommandsAppend event(component_info, commands, start_revision);
+            QApplication::sendEvent(qApp, &event);
+          });
+        }
+
         if (broadcast)
-          env_wrapper.broadcast();
+          broadcastHelper(env_wrapper.getComponentInfo(), env_wrapper.getEnvironment(), false);
       }
       current_revision = e.revision;
       break;
@@ -191,8 +222,10 @@ void tesseractEventFilterHelper(const tesseract::environment::Event& event,
 void eventFilterHelper(QObject* /*obj*/,
                        QEvent* event,
                        const std::shared_ptr<const tesseract::gui::ComponentInfo>& component_info,
-                       tesseract::environment::Environment& env)
+                       const std::shared_ptr<tesseract::environment::Environment>& env_ptr,
+                       tesseract::gui::ContactMonitor& contact_monitor)
 {
+  tesseract::environment::Environment& env = *env_ptr;
   if (event->type() == tesseract::gui::events::EventType::CONTACT_RESULTS_COMPUTE)
   {
     assert(dynamic_cast<tesseract::gui::events::ContactResultsCompute*>(event) != nullptr);
@@ -223,6 +256,11 @@ void eventFilterHelper(QObject* /*obj*/,
       {
         break;
       }
+      case tesseract::gui::events::ContactResultsCompute::StateType::TRAJECTORY:
+      {
+        // Handled by the joint trajectory widget which owns the trajectory
+        return;
+      }
     }
 
     // Convert to tracked objects
@@ -239,6 +277,28 @@ void eventFilterHelper(QObject* /*obj*/,
     tesseract::gui::events::ContactResultsSet event(component_info, tracked_object, e->getNamespace());
     QApplication::sendEvent(qApp, &event);
   }
+  else if (event->type() == tesseract::gui::events::EventType::CONTACT_RESULTS_MONITOR)
+  {
+    assert(dynamic_cast<tesseract::gui::events::ContactResultsMonitor*>(event) != nullptr);
+    auto* e = static_cast<tesseract::gui::events::ContactResultsMonitor*>(event);
+    if (e->getComponentInfo() != component_info)
+      return;
+
+    if (!e->isEnabled())
+    {
+      contact_monitor.stop();
+      return;
+    }
+
+    if (env.getDiscreteContactManager() == nullptr)
+      applyDefaultContactManager(env);
+
+    tesseract::gui::ContactMonitorConfig config;
+    config.contact_manager_config = e->getContactManagerConfig();
+    config.collision_check_config = e->getCollisionCheckConfig();
+    config.min_interval = e->getMinInterval();
+    contact_monitor.start(env_ptr, config, e->getNamespace());
+  }
   else if (event->type() == tesseract::gui::events::EventType::ACM_GENERATE)
   {
     assert(dynamic_cast<tesseract::gui::events::AllowedCollisionMatrixGenerate*>(event) != nullptr);
@@ -317,33 +377,70 @@ void eventFilterHelper(QObject* /*obj*/,
   }
 }
 
+/**
+ * @brief Check if the environment is still the one registered for the component when a queued stage runs
+ * @details The wrapper is registered before it broadcasts, so no registered wrapper means it was removed meanwhile
+ */
+bool isCurrentEnvironment(const std::shared_ptr<const tesseract::gui::ComponentInfo>& component_info,
+                          const std::shared_ptr<const tesseract::environment::Environment>& env)
+{
+  if (env == nullptr)
+    return false;
+
+  auto env_wrapper = tesseract::gui::EnvironmentManager::get(component_info);
+  return (env_wrapper != nullptr && env_wrapper->getEnvironment() == env);
+}
+
 void broadcastHelper(const std::shared_ptr<const tesseract::gui::ComponentInfo>& component_info,
-                     const tesseract::environment::Environment& env)
+                     const std::shared_ptr<const tesseract::environment::Environment>& env,
+                     bool send_commands)
 {
-  auto lock = env.lockRead();
+  TESSERACT_QT_TRACE_ZONE("EnvironmentWrapper::broadcast");
+  auto lock = env->lockRead();
 
-  if (!env.isInitialized())
+  if (!env->isInitialized())
     return;
 
-  auto scene_graph_clone = env.getSceneGraph()->clone();
+  auto scene_graph_clone = env->getSceneGraph()->clone();
   std::shared_ptr<tesseract::scene_graph::SceneGraph> scene_graph_shared(std::move(scene_graph_clone));
-  auto scene_state = env.getState();
-  auto command_history = env.getCommandHistory();
-  auto acm = *env.getAllowedCollisionMatrix();
-  auto kin_info = env.getKinematicsInformation();
 
   lock.unlock();
 
-  invokeOnAppThread([component_info, scene_graph_shared, scene_state, command_history, acm, kin_info]() {
-    // Broadcast environment data
+  // The data is published in stages so the scene graph can be rendered before the rest is processed. The later stages
+  // are queued and read the environment when they run, so they never publish data older than an event sent meanwhile.
+  invokeOnAppThread([component_info, scene_graph_shared]() {
     tesseract::gui::events::SceneGraphSet set_scene_graph_event(component_info, scene_graph_shared);
     QApplication::sendEvent(qApp, &set_scene_graph_event);
+  });
+
+  std::weak_ptr<const tesseract::environment::Environment> weak_env = env;
+  queueOnAppThread([component_info, weak_env]() {
+    auto env = weak_env.lock();
+    if (!isCurrentEnvironment(component_info, env))
+      return;
 
-    tesseract::gui::events::SceneStateChanged scene_state_changed_event(component_info, scene_state);
+    tesseract::gui::events::SceneStateChanged scene_state_changed_event(component_info, env->getState());
     QApplication::sendEvent(qApp, &scene_state_changed_event);
+  });
+
+  queueOnAppThread([component_info, weak_env, send_commands]() {
+    auto env = weak_env.lock();
+    if (!isCurrentEnvironment(component_info, env))
+      return;
 
-    tesseract::gui::events::EnvironmentCommandsSet set_environment_commands_event(component_info, command_history);
-    QApplication::sendEvent(qApp, &set_environment_commands_event);
+    auto lock = env->lockRead();
+    tesseract::environment::Commands command_history;
+    if (send_commands)
+      command_history = env->getCommandHistory();
+    auto acm = *env->getAllowedCollisionMatrix();
+    auto kin_info = env->getKinematicsInformation();
+    lock.unlock();
+
+    if (send_commands)
+    {
+      tesseract::gui::events::EnvironmentCommandsSet set_environment_commands_event(component_info, command_history);
+      QApplication::sendEvent(qApp, &set_environment_commands_event);
+    }
 
     tesseract::gui::events::AllowedCollisionMatrixSet set_acm_event(component_info, acm);
     QApplication::sendEvent(qApp, &set_acm_event);
@@ -364,11 +461,14 @@ namespace tesseract::gui
 {
 EnvironmentWrapper::EnvironmentWrapper(std::shared_ptr<const ComponentInfo> component_info)
   : component_info_(std::move(component_info))
+  , contact_monitor_(std::make_unique<ContactMonitor>(component_info_))
 {
 }
 
 EnvironmentWrapper::~EnvironmentWrapper()
 {
+  contact_monitor_->stop();
+
   // clear environment data
   events::SceneGraphClear clear_scene_graph_event(component_info_);
   QApplication::sendEvent(qApp, &clear_scene_graph_event);
@@ -391,7 +491,7 @@ EnvironmentWrapper::~EnvironmentWrapper()
 
 std::shared_ptr<const ComponentInfo> EnvironmentWrapper::getComponentInfo() const { return component_info_; }
 
-void EnvironmentWrapper::broadcast() const { broadcastHelper(getComponentInfo(), *getEnvironment()); }
+void EnvironmentWrapper::broadcast() const { broadcastHelper(getComponentInfo(), getEnvironment()); }
 
 void EnvironmentWrapper::init()
 {
@@ -445,7 +545,7 @@ tesseract::environment::Environment& DefaultEnvironmentWrapper::environment() {
 
 bool DefaultEnvironmentWrapper::eventFilter(QObject* obj, QEvent* event)
 {
-  eventFilterHelper(obj, event, getComponentInfo(), *env_);
+  eventFilterHelper(obj, event, getComponentInfo(), env_, *contact_monitor_);
 
   // Standard event processing
   return QObject::eventFilter(obj, event);
@@ -502,7 +602,7 @@ MonitorEnvironmentWrapper::getEnvironmentMonitor() const
 
 bool MonitorEnvironmentWrapper::eventFilter(QObject* obj, QEvent* event)
 {
-  eventFilterHelper(obj, event, getComponentInfo(), env_monitor_->environment());
+  eventFilterHelper(obj, event, getComponentInfo(), env_monitor_->getEnvironment(), *contact_monitor_);
 
   // Standard event processing
   return QObject::eventFilter(obj, event);
@@ -56,6 +56,44 @@ const std::variant<ContactResultVector, ContactResultMap>& ContactResultsSet::ge
 
 //////////////////////////////////////////
 
+ContactResultsAppend::ContactResultsAppend(std::shared_ptr<const ComponentInfo> component_info,
+                                           ContactResultTimeline contact_results,
+                                           std::string ns)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::CONTACT_RESULTS_APPEND))
+  , ns_(std::move(ns))
+  , contact_results_(std::move(contact_results))
+{
+}
+
+ContactResultsAppend::~ContactResultsAppend() = default;
+
+const std::string& ContactResultsAppend::getNamespace() const { return ns_; }
+const ContactResultTimeline& ContactResultsAppend::getContactResults() const { return contact_results_; }
+
+//////////////////////////////////////////
+
+ContactResultsUpdate::ContactResultsUpdate(std::shared_ptr<const ComponentInfo> component_info,
+                                           ContactResultMap added,
+                                           ContactResultMap changed,
+                                           ContactResultMap removed,
+                                           std::string ns)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::CONTACT_RESULTS_UPDATE))
+  , ns_(std::move(ns))
+  , added_(std::move(added))
+  , changed_(std::move(changed))
+  , removed_(std::move(removed))
+{
+}
+
+ContactResultsUpdate::~ContactResultsUpdate() = default;
+
+const std::string& ContactResultsUpdate::getNamespace() const { return ns_; }
+const ContactResultMap& ContactResultsUpdate::getAdded() const { return added_; }
+const ContactResultMap& ContactResultsUpdate::getChanged() const { return changed_; }
+const ContactResultMap& ContactResultsUpdate::getRemoved() const { return removed_; }
+
+//////////////////////////////////////////
+
 ContactResultsRemove::ContactResultsRemove(std::shared_ptr<const ComponentInfo> component_info, boost::uuids::uuid uuid)
   : ComponentEventUUID(std::move(component_info), uuid, QEvent::Type(EventType::CONTACT_RESULTS_REMOVE))
 {
@@ -134,4 +172,39 @@ ContactResultsCompute::StateType ContactResultsCompute::getStateType() const { r
 
 //////////////////////////////////////////
 
+ContactResultsMonitor::ContactResultsMonitor(std::shared_ptr<const ComponentInfo> component_info)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::CONTACT_RESULTS_MONITOR))
+{
+}
+
+ContactResultsMonitor::ContactResultsMonitor(std::shared_ptr<const ComponentInfo> component_info,
+                                             tesseract::collision::ContactManagerConfig contact_manager_config,
+                                             tesseract::collision::CollisionCheckConfig collision_check_config,
+                                             std::chrono::milliseconds min_interval,
+                                             std::string ns)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::CONTACT_RESULTS_MONITOR))
+  , enabled_(true)
+  , ns_(std::move(ns))
+  , contact_manager_config_(std::move(contact_manager_config))
+  , collision_check_config_(std::move(collision_check_config))
+  , min_interval_(min_interval)
+{
+}
+
+ContactResultsMonitor::~ContactResultsMonitor() = default;
+
+bool ContactResultsMonitor::isEnabled() const { return enabled_; }
+const std::string& ContactResultsMonitor::getNamespace() const { return ns_; }
+const tesseract::collision::ContactManagerConfig& ContactResultsMonitor::getContactManagerConfig() const
+{
+  return contact_manager_config_;
+}
+const tesseract::collision::CollisionCheckConfig& ContactResultsMonitor::getCollisionCheckConfig() const
+{
+  return collision_check_config_;
+}
+std::chrono::milliseconds ContactResultsMonitor::getMinInterval() const { return min_interval_; }
+
+//////////////////////////////////////////
+
 }  // namespace tesseract::gui::events
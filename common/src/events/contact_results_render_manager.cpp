@@ -28,13 +28,55 @@
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/environment_manager.h>
 #include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/tracing.h>
 
 #include <tesseract/environment/environment.h>
 
+#include <algorithm>
+
 #include <QApplication>
 
 namespace tesseract::gui
 {
+namespace
+{
+/** @brief Merge two consecutive updates of a namespace into their net change */
+std::unique_ptr<events::ContactResultsUpdate> mergeUpdates(const events::ContactResultsUpdate& first,
+                                                           const events::ContactResultsUpdate& second)
+{
+  ContactResultMap added(first.getAdded());
+  ContactResultMap changed(first.getChanged());
+  ContactResultMap removed(first.getRemoved());
+
+  // Link pairs added by the first update were never rendered, so removing them cancels the addition
+  for (const auto& pair : second.getRemoved())
+  {
+    changed.erase(pair.first);
+
+    auto it = added.find(pair.first);
+    if (it != added.end() && it->second.getUUID() == pair.second.getUUID())
+      added.erase(it);
+    else
+      removed.insert_or_assign(pair.first, pair.second);
+  }
+
+  for (const auto& pair : second.getChanged())
+  {
+    auto it = added.find(pair.first);
+    if (it != added.end() && it->second.getUUID() == pair.second.getUUID())
+      it->second = pair.second;
+    else
+      changed.insert_or_assign(pair.first, pair.second);
+  }
+
+  for (const auto& pair : second.getAdded())
+    added.insert_or_assign(pair.first, pair.second);
+
+  return std::make_unique<events::ContactResultsUpdate>(
+      second.getComponentInfo(), added, changed, removed, second.getNamespace());
+}
+}  // namespace
+
 ContactResultsRenderManager::ContactResultsRenderManager(std::shared_ptr<const ComponentInfo> component_info)
   : component_info_(std::move(component_info))
 {
@@ -43,6 +85,16 @@ ContactResultsRenderManager::ContactResultsRenderManager(std::shared_ptr<const C
 
 ContactResultsRenderManager::~ContactResultsRenderManager() = default;
 
+void ContactResultsRenderManager::removeQueuedEvents(const std::shared_ptr<const ComponentInfo>& component_info)
+{
+  events_.erase(std::remove_if(events_.begin(),
+                               events_.end(),
+                               [&component_info](const auto& queued) {
+                                 return (queued->getComponentInfo() == component_info);
+                               }),
+                events_.end());
+}
+
 bool ContactResultsRenderManager::eventFilter(QObject* obj, QEvent* event)
 {
   std::scoped_lock lock(mutex_);
@@ -51,14 +103,37 @@ bool ContactResultsRenderManager::eventFilter(QObject* obj, QEvent* event)
     assert(dynamic_cast<events::ContactResultsClear*>(event) != nullptr);
     auto* e = static_cast<events::ContactResultsClear*>(event);
     if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+    {
+      removeQueuedEvents(e->getComponentInfo());
       events_.push_back(std::make_unique<events::ContactResultsClear>(*e));
+    }
   }
   else if (event->type() == events::EventType::CONTACT_RESULTS_SET)
   {
     assert(dynamic_cast<events::ContactResultsSet*>(event) != nullptr);
     auto* e = static_cast<events::ContactResultsSet*>(event);
     if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+    {
+      removeQueuedEvents(e->getComponentInfo());
       events_.push_back(std::make_unique<events::ContactResultsSet>(*e));
+    }
+  }
+  else if (event->type() == events::EventType::CONTACT_RESULTS_UPDATE)
+  {
+    assert(dynamic_cast<events::ContactResultsUpdate*>(event) != nullptr);
+    auto* e = static_cast<events::ContactResultsUpdate*>(event);
+    if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+    {
+      // While rendering is paused a monitor keeps sending updates, so they are merged with the last queued one
+      auto it = std::find_if(events_.rbegin(), events_.rend(), [e](const auto& queued) {
+        return (queued->getComponentInfo() == e->getComponentInfo());
+      });
+      if (it != events_.rend() && (*it)->type() == events::EventType::CONTACT_RESULTS_UPDATE &&
+          static_cast<events::ContactResultsUpdate&>(**it).getNamespace() == e->getNamespace())
+        *it = mergeUpdates(static_cast<events::ContactResultsUpdate&>(**it), *e);
+      else
+        events_.push_back(std::make_unique<events::ContactResultsUpdate>(*e));
+    }
   }
   else if (event->type() == events::EventType::CONTACT_RESULTS_REMOVE)
   {
@@ -85,7 +160,10 @@ bool ContactResultsRenderManager::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::PreRender*>(event) != nullptr);
     if (static_cast<events::PreRender*>(event)->getSceneName() == component_info_->getSceneName())
+    {
+      TESSERACT_QT_TRACE_ZONE("ContactResultsRenderManager::render");
       render();
+    }
   }
 
   // Standard event processing
@@ -48,8 +48,11 @@ const tesseract::environment::Commands& EnvironmentCommandsSet::getCommands() co
 //////////////////////////////////////////
 
 EnvironmentCommandsAppend::EnvironmentCommandsAppend(std::shared_ptr<const ComponentInfo> component_info,
-                                                     const tesseract::environment::Commands& commands)
-  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::ENVIRONMENT_COMMANDS_APPEND)), commands_(commands)
+                                                     const tesseract::environment::Commands& commands,
+                                                     int start_revision)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::ENVIRONMENT_COMMANDS_APPEND))
+  , commands_(commands)
+  , start_revision_(start_revision)
 {
 }
 
@@ -57,6 +60,8 @@ EnvironmentCommandsAppend::~EnvironmentCommandsAppend() = default;
 
 const tesseract::environment::Commands& EnvironmentCommandsAppend::getCommands() const { return commands_; }
 
+int EnvironmentCommandsAppend::getStartRevision() const { return start_revision_; }
+
 //////////////////////////////////////////
 
 EnvironmentApplyCommand::EnvironmentApplyCommand(std::shared_ptr<const ComponentInfo> component_info,
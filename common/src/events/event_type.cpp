@@ -1,6 +1,7 @@
 #include <tesseract_qt/common/events/event_type.h>
 
 #include <qcoreevent.h>
+#include <unordered_map>
 
 namespace tesseract::gui::events
 {
@@ -29,6 +30,7 @@ const int EventType::DROP_ON_SCENE = QEvent::registerEventType();
 const int EventType::SCROLL_ON_SCENE = QEvent::registerEventType();
 const int EventType::DRAG_ON_SCENE = QEvent::registerEventType();
 const int EventType::MOUSE_PRESS_ON_SCENE = QEvent::registerEventType();
+const int EventType::PICK_ON_SCENE = QEvent::registerEventType();
 
 // Tool Path
 const int EventType::TOOL_PATH_ADD = QEvent::registerEventType();
@@ -54,16 +56,20 @@ const int EventType::SCENE_GRAPH_REMOVE_JOINT = QEvent::registerEventType();
 const int EventType::SCENE_GRAPH_REPLACE_JOINT = QEvent::registerEventType();
 const int EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY = QEvent::registerEventType();
 const int EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL = QEvent::registerEventType();
+const int EventType::SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT = QEvent::registerEventType();
 const int EventType::SCENE_GRAPH_STATE_CHANGED = QEvent::registerEventType();
 const int EventType::SCENE_GRAPH_PLOT = QEvent::registerEventType();
 
 // Contact Results
 const int EventType::CONTACT_RESULTS_CLEAR = QEvent::registerEventType();
 const int EventType::CONTACT_RESULTS_SET = QEvent::registerEventType();
+const int EventType::CONTACT_RESULTS_APPEND = QEvent::registerEventType();
+const int EventType::CONTACT_RESULTS_UPDATE = QEvent::registerEventType();
 const int EventType::CONTACT_RESULTS_REMOVE = QEvent::registerEventType();
 const int EventType::CONTACT_RESULTS_VISIBILITY = QEvent::registerEventType();
 const int EventType::CONTACT_RESULTS_VISIBILITY_ALL = QEvent::registerEventType();
 const int EventType::CONTACT_RESULTS_COMPUTE = QEvent::registerEventType();
+const int EventType::CONTACT_RESULTS_MONITOR = QEvent::registerEventType();
 
 // Contact Results
 const int EventType::ACM_CLEAR = QEvent::registerEventType();
@@ -114,6 +120,7 @@ const int EventType::ENVIRONMENT_SET_STATE = QEvent::registerEventType();
 
 // Joint Trajectory
 const int EventType::JOINT_TRAJECTORY_ADD = QEvent::registerEventType();
+const int EventType::JOINT_TRAJECTORY_ARCHIVE_ADD = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_REMOVE = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_REMOVE_NAMESPACE = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_REMOVE_SELECTED = QEvent::registerEventType();
@@ -122,10 +129,20 @@ const int EventType::JOINT_TRAJECTORY_OPEN = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_SAVE = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_PLOT = QEvent::registerEventType();
 const int EventType::JOINT_TRAJECTORY_TOOLBAR_STATE = QEvent::registerEventType();
+const int EventType::JOINT_TRAJECTORY_PLAYER_SEEK = QEvent::registerEventType();
+const int EventType::JOINT_TRAJECTORY_GHOST = QEvent::registerEventType();
+const int EventType::JOINT_TRAJECTORY_GHOST_SET = QEvent::registerEventType();
+const int EventType::JOINT_TRAJECTORY_GHOST_CLEAR = QEvent::registerEventType();
 
 // Manipulation
 const int EventType::MANIPULATION_CHANGED = QEvent::registerEventType();
 
+// Reachability Map
+const int EventType::REACHABILITY_MAP_CLEAR = QEvent::registerEventType();
+const int EventType::REACHABILITY_MAP_SET = QEvent::registerEventType();
+const int EventType::REACHABILITY_MAP_REFINE = QEvent::registerEventType();
+const int EventType::REACHABILITY_MAP_REFINE_FAILED = QEvent::registerEventType();
+
 // Task Composer
 const int EventType::TASK_COMPOSER_LOAD_CONFIG = QEvent::registerEventType();
 const int EventType::TASK_COMPOSER_LOAD_LOG = QEvent::registerEventType();
@@ -146,4 +163,137 @@ const int EventType::STATUS_LOG_INFO_TOGGLE_OFF = QEvent::registerEventType();
 const int EventType::STATUS_LOG_WARN_TOGGLE_OFF = QEvent::registerEventType();
 const int EventType::STATUS_LOG_ERROR_TOGGLE_OFF = QEvent::registerEventType();
 
+const char* EventType::getName(int type)
+{
+  static const std::unordered_map<int, const char*> names = {
+    { APP_STATUS_MESSAGE_SHOW, "APP_STATUS_MESSAGE_SHOW" },
+    { APP_STATUS_MESSAGE_CLEAR, "APP_STATUS_MESSAGE_CLEAR" },
+    { PRE_RENDER, "PRE_RENDER" },
+    { RENDER, "RENDER" },
+    { SNAP_INTERVALS, "SNAP_INTERVALS" },
+    { SPAWN_FROM_DESCRIPTION, "SPAWN_FROM_DESCRIPTION" },
+    { SPAWN_FROM_PATH, "SPAWN_FROM_PATH" },
+    { HOVER_TO_SCENE, "HOVER_TO_SCENE" },
+    { LEFT_CLICK_TO_SCENE, "LEFT_CLICK_TO_SCENE" },
+    { RIGHT_CLICK_TO_SCENE, "RIGHT_CLICK_TO_SCENE" },
+    { DROPDOWN_MENU_ENABLED, "DROPDOWN_MENU_ENABLED" },
+    { KEY_RELEASE_ON_SCENE, "KEY_RELEASE_ON_SCENE" },
+    { KEY_PRESS_ON_SCENE, "KEY_PRESS_ON_SCENE" },
+    { LEFT_CLICK_ON_SCENE, "LEFT_CLICK_ON_SCENE" },
+    { RIGHT_CLICK_ON_SCENE, "RIGHT_CLICK_ON_SCENE" },
+    { BLOCK_ORBIT, "BLOCK_ORBIT" },
+    { HOVER_ON_SCENE, "HOVER_ON_SCENE" },
+    { SPAWN_CLONE_FROM_NAME, "SPAWN_CLONE_FROM_NAME" },
+    { DROP_ON_SCENE, "DROP_ON_SCENE" },
+    { SCROLL_ON_SCENE, "SCROLL_ON_SCENE" },
+    { DRAG_ON_SCENE, "DRAG_ON_SCENE" },
+    { MOUSE_PRESS_ON_SCENE, "MOUSE_PRESS_ON_SCENE" },
+    { PICK_ON_SCENE, "PICK_ON_SCENE" },
+    { TOOL_PATH_ADD, "TOOL_PATH_ADD" },
+    { TOOL_PATH_REMOVE, "TOOL_PATH_REMOVE" },
+    { TOOL_PATH_REMOVE_ALL, "TOOL_PATH_REMOVE_ALL" },
+    { TOOL_PATH_REMOVE_SELECTED, "TOOL_PATH_REMOVE_SELECTED" },
+    { TOOL_PATH_HIDE, "TOOL_PATH_HIDE" },
+    { TOOL_PATH_HIDE_ALL, "TOOL_PATH_HIDE_ALL" },
+    { TOOL_PATH_SHOW, "TOOL_PATH_SHOW" },
+    { TOOL_PATH_SHOW_ALL, "TOOL_PATH_SHOW_ALL" },
+    { TOOL_PATH_OPEN, "TOOL_PATH_OPEN" },
+    { TOOL_PATH_SAVE, "TOOL_PATH_SAVE" },
+    { SCENE_GRAPH_CLEAR, "SCENE_GRAPH_CLEAR" },
+    { SCENE_GRAPH_SET, "SCENE_GRAPH_SET" },
+    { SCENE_GRAPH_ADD_LINK, "SCENE_GRAPH_ADD_LINK" },
+    { SCENE_GRAPH_ADD_JOINT, "SCENE_GRAPH_ADD_JOINT" },
+    { SCENE_GRAPH_MOVE_LINK, "SCENE_GRAPH_MOVE_LINK" },
+    { SCENE_GRAPH_MOVE_JOINT, "SCENE_GRAPH_MOVE_JOINT" },
+    { SCENE_GRAPH_REMOVE_LINK, "SCENE_GRAPH_REMOVE_LINK" },
+    { SCENE_GRAPH_REMOVE_JOINT, "SCENE_GRAPH_REMOVE_JOINT" },
+    { SCENE_GRAPH_REPLACE_JOINT, "SCENE_GRAPH_REPLACE_JOINT" },
+    { SCENE_GRAPH_MODIFY_LINK_VISIBILITY, "SCENE_GRAPH_MODIFY_LINK_VISIBILITY" },
+    { SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL, "SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL" },
+    { SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT, "SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT" },
+    { SCENE_GRAPH_STATE_CHANGED, "SCENE_GRAPH_STATE_CHANGED" },
+    { SCENE_GRAPH_PLOT, "SCENE_GRAPH_PLOT" },
+    { CONTACT_RESULTS_CLEAR, "CONTACT_RESULTS_CLEAR" },
+    { CONTACT_RESULTS_SET, "CONTACT_RESULTS_SET" },
+    { CONTACT_RESULTS_APPEND, "CONTACT_RESULTS_APPEND" },
+    { CONTACT_RESULTS_UPDATE, "CONTACT_RESULTS_UPDATE" },
+    { CONTACT_RESULTS_REMOVE, "CONTACT_RESULTS_REMOVE" },
+    { CONTACT_RESULTS_VISIBILITY, "CONTACT_RESULTS_VISIBILITY" },
+    { CONTACT_RESULTS_VISIBILITY_ALL, "CONTACT_RESULTS_VISIBILITY_ALL" },
+    { CONTACT_RESULTS_COMPUTE, "CONTACT_RESULTS_COMPUTE" },
+    { CONTACT_RESULTS_MONITOR, "CONTACT_RESULTS_MONITOR" },
+    { ACM_CLEAR, "ACM_CLEAR" },
+    { ACM_SET, "ACM_SET" },
+    { ACM_ADD, "ACM_ADD" },
+    { ACM_REMOVE, "ACM_REMOVE" },
+    { ACM_REMOVE_LINK, "ACM_REMOVE_LINK" },
+    { ACM_VISIBILITY, "ACM_VISIBILITY" },
+    { ACM_GENERATE, "ACM_GENERATE" },
+    { CL_COMPOSITE_INSTRUCTION_CLEAR, "CL_COMPOSITE_INSTRUCTION_CLEAR" },
+    { CL_COMPOSITE_INSTRUCTION_SET, "CL_COMPOSITE_INSTRUCTION_SET" },
+    { CL_COMPOSITE_INSTRUCTION_REMOVE, "CL_COMPOSITE_INSTRUCTION_REMOVE" },
+    { GROUP_JOINT_STATES_CLEAR, "GROUP_JOINT_STATES_CLEAR" },
+    { GROUP_JOINT_STATES_SET, "GROUP_JOINT_STATES_SET" },
+    { GROUP_JOINT_STATES_ADD, "GROUP_JOINT_STATES_ADD" },
+    { GROUP_JOINT_STATES_REMOVE, "GROUP_JOINT_STATES_REMOVE" },
+    { GROUP_JOINT_STATES_REMOVE_GROUP, "GROUP_JOINT_STATES_REMOVE_GROUP" },
+    { GROUP_JOINT_STATES_SHOW, "GROUP_JOINT_STATES_SHOW" },
+    { GROUP_JOINT_STATES_HIDE, "GROUP_JOINT_STATES_HIDE" },
+    { GROUP_TCPS_CLEAR, "GROUP_TCPS_CLEAR" },
+    { GROUP_TCPS_SET, "GROUP_TCPS_SET" },
+    { GROUP_TCPS_ADD, "GROUP_TCPS_ADD" },
+    { GROUP_TCPS_REMOVE, "GROUP_TCPS_REMOVE" },
+    { GROUP_TCPS_REMOVE_GROUP, "GROUP_TCPS_REMOVE_GROUP" },
+    { KINEMATIC_GROUPS_CLEAR, "KINEMATIC_GROUPS_CLEAR" },
+    { KINEMATIC_GROUPS_SET, "KINEMATIC_GROUPS_SET" },
+    { KINEMATIC_GROUPS_ADD_CHAIN, "KINEMATIC_GROUPS_ADD_CHAIN" },
+    { KINEMATIC_GROUPS_ADD_JOINT, "KINEMATIC_GROUPS_ADD_JOINT" },
+    { KINEMATIC_GROUPS_ADD_LINK, "KINEMATIC_GROUPS_ADD_LINK" },
+    { KINEMATIC_GROUPS_REMOVE, "KINEMATIC_GROUPS_REMOVE" },
+    { ENVIRONMENT_COMMANDS_CLEAR, "ENVIRONMENT_COMMANDS_CLEAR" },
+    { ENVIRONMENT_COMMANDS_SET, "ENVIRONMENT_COMMANDS_SET" },
+    { ENVIRONMENT_COMMANDS_APPEND, "ENVIRONMENT_COMMANDS_APPEND" },
+    { ENVIRONMENT_APPLY_COMMANDS, "ENVIRONMENT_APPLY_COMMANDS" },
+    { ENVIRONMENT_SET_STATE, "ENVIRONMENT_SET_STATE" },
+    { JOINT_TRAJECTORY_ADD, "JOINT_TRAJECTORY_ADD" },
+    { JOINT_TRAJECTORY_ARCHIVE_ADD, "JOINT_TRAJECTORY_ARCHIVE_ADD" },
+    { JOINT_TRAJECTORY_REMOVE, "JOINT_TRAJECTORY_REMOVE" },
+    { JOINT_TRAJECTORY_REMOVE_NAMESPACE, "JOINT_TRAJECTORY_REMOVE_NAMESPACE" },
+    { JOINT_TRAJECTORY_REMOVE_SELECTED, "JOINT_TRAJECTORY_REMOVE_SELECTED" },
+    { JOINT_TRAJECTORY_REMOVE_ALL, "JOINT_TRAJECTORY_REMOVE_ALL" },
+    { JOINT_TRAJECTORY_OPEN, "JOINT_TRAJECTORY_OPEN" },
+    { JOINT_TRAJECTORY_SAVE, "JOINT_TRAJECTORY_SAVE" },
+    { JOINT_TRAJECTORY_PLOT, "JOINT_TRAJECTORY_PLOT" },
+    { JOINT_TRAJECTORY_TOOLBAR_STATE, "JOINT_TRAJECTORY_TOOLBAR_STATE" },
+    { JOINT_TRAJECTORY_PLAYER_SEEK, "JOINT_TRAJECTORY_PLAYER_SEEK" },
+    { JOINT_TRAJECTORY_GHOST, "JOINT_TRAJECTORY_GHOST" },
+    { JOINT_TRAJECTORY_GHOST_SET, "JOINT_TRAJECTORY_GHOST_SET" },
+    { JOINT_TRAJECTORY_GHOST_CLEAR, "JOINT_TRAJECTORY_GHOST_CLEAR" },
+    { MANIPULATION_CHANGED, "MANIPULATION_CHANGED" },
+    { REACHABILITY_MAP_CLEAR, "REACHABILITY_MAP_CLEAR" },
+    { REACHABILITY_MAP_SET, "REACHABILITY_MAP_SET" },
+    { REACHABILITY_MAP_REFINE, "REACHABILITY_MAP_REFINE" },
+    { REACHABILITY_MAP_REFINE_FAILED, "REACHABILITY_MAP_REFINE_FAILED" },
+    { TASK_COMPOSER_LOAD_CONFIG, "TASK_COMPOSER_LOAD_CONFIG" },
+    { TASK_COMPOSER_LOAD_LOG, "TASK_COMPOSER_LOAD_LOG" },
+    { TASK_COMPOSER_ADD_LOG, "TASK_COMPOSER_ADD_LOG" },
+    { TASK_COMPOSER_SAVE_LOG, "TASK_COMPOSER_SAVE_LOG" },
+    { TASK_COMPOSER_PLOT_DOTGRAPH, "TASK_COMPOSER_PLOT_DOTGRAPH" },
+    { TASK_COMPOSER_SET_PROFILES, "TASK_COMPOSER_SET_PROFILES" },
+    { STATUS_LOG_INFO, "STATUS_LOG_INFO" },
+    { STATUS_LOG_WARN, "STATUS_LOG_WARN" },
+    { STATUS_LOG_ERROR, "STATUS_LOG_ERROR" },
+    { STATUS_LOG_CLEAR, "STATUS_LOG_CLEAR" },
+    { STATUS_LOG_INFO_TOGGLE_ON, "STATUS_LOG_INFO_TOGGLE_ON" },
+    { STATUS_LOG_WARN_TOGGLE_ON, "STATUS_LOG_WARN_TOGGLE_ON" },
+    { STATUS_LOG_ERROR_TOGGLE_ON, "STATUS_LOG_ERROR_TOGGLE_ON" },
+    { STATUS_LOG_INFO_TOGGLE_OFF, "STATUS_LOG_INFO_TOGGLE_OFF" },
+    { STATUS_LOG_WARN_TOGGLE_OFF, "STATUS_LOG_WARN_TOGGLE_OFF" },
+    { STATUS_LOG_ERROR_TOGGLE_OFF, "STATUS_LOG_ERROR_TOGGLE_OFF" },
+  };
+
+  auto it = names.find(type);
+  return (it != names.end()) ? it->second : "UNKNOWN";
+}
+
 }  // namespace tesseract::gui::events
@@ -63,6 +63,25 @@ bool JointTrajectoryAdd::clearNamespace() const { return data_->clear_namespace;
 
 //////////////////////////////////////////
 
+JointTrajectoryArchiveAdd::JointTrajectoryArchiveAdd(std::shared_ptr<const ComponentInfo> component_info,
+                                                     std::shared_ptr<const JointTrajectoryArchive> archive)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::JOINT_TRAJECTORY_ARCHIVE_ADD))
+  , archive_(std::move(archive))
+{
+}
+JointTrajectoryArchiveAdd::JointTrajectoryArchiveAdd(const JointTrajectoryArchiveAdd& other)
+  : JointTrajectoryArchiveAdd(other.getComponentInfo(), other.archive_)
+{
+}
+JointTrajectoryArchiveAdd::~JointTrajectoryArchiveAdd() = default;
+
+const std::shared_ptr<const JointTrajectoryArchive>& JointTrajectoryArchiveAdd::getArchive() const
+{
+  return archive_;
+}
+
+//////////////////////////////////////////
+
 JointTrajectoryRemove::JointTrajectoryRemove(std::shared_ptr<const ComponentInfo> component_info,
                                              const boost::uuids::uuid& uuid)
   : ComponentEventUUID(std::move(component_info), uuid, QEvent::Type(EventType::JOINT_TRAJECTORY_REMOVE))
@@ -161,4 +180,61 @@ JointTrajectoryToolbarState::JointTrajectoryToolbarState(const JointTrajectoryTo
 {
 }
 JointTrajectoryToolbarState::~JointTrajectoryToolbarState() = default;
+
+//////////////////////////////////////////
+
+JointTrajectoryPlayerSeek::JointTrajectoryPlayerSeek(std::shared_ptr<const ComponentInfo> component_info, double time)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::JOINT_TRAJECTORY_PLAYER_SEEK)), time_(time)
+{
+}
+JointTrajectoryPlayerSeek::JointTrajectoryPlayerSeek(const JointTrajectoryPlayerSeek& other)
+  : JointTrajectoryPlayerSeek(other.getComponentInfo(), other.time_)
+{
+}
+JointTrajectoryPlayerSeek::~JointTrajectoryPlayerSeek() = default;
+
+double JointTrajectoryPlayerSeek::getTime() const { return time_; }
+//////////////////////////////////////////
+
+JointTrajectoryGhost::JointTrajectoryGhost(std::shared_ptr<const ComponentInfo> component_info,
+                                           std::size_t sample_count)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::JOINT_TRAJECTORY_GHOST))
+  , sample_count_(sample_count)
+{
+}
+JointTrajectoryGhost::JointTrajectoryGhost(const JointTrajectoryGhost& other)
+  : JointTrajectoryGhost(other.getComponentInfo(), other.sample_count_)
+{
+}
+JointTrajectoryGhost::~JointTrajectoryGhost() = default;
+
+std::size_t JointTrajectoryGhost::getSampleCount() const { return sample_count_; }
+
+//////////////////////////////////////////
+
+JointTrajectoryGhostSet::JointTrajectoryGhostSet(std::shared_ptr<const ComponentInfo> component_info,
+                                                 std::shared_ptr<const TrajectoryGhost> ghost)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::JOINT_TRAJECTORY_GHOST_SET))
+  , ghost_(std::move(ghost))
+{
+}
+JointTrajectoryGhostSet::JointTrajectoryGhostSet(const JointTrajectoryGhostSet& other)
+  : JointTrajectoryGhostSet(other.getComponentInfo(), other.ghost_)
+{
+}
+JointTrajectoryGhostSet::~JointTrajectoryGhostSet() = default;
+
+const std::shared_ptr<const TrajectoryGhost>& JointTrajectoryGhostSet::getTrajectoryGhost() const { return ghost_; }
+
+//////////////////////////////////////////
+
+JointTrajectoryGhostClear::JointTrajectoryGhostClear(std::shared_ptr<const ComponentInfo> component_info)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::JOINT_TRAJECTORY_GHOST_CLEAR))
+{
+}
+JointTrajectoryGhostClear::JointTrajectoryGhostClear(const JointTrajectoryGhostClear& other)
+  : JointTrajectoryGhostClear(other.getComponentInfo())
+{
+}
+JointTrajectoryGhostClear::~JointTrajectoryGhostClear() = default;
 }  // namespace tesseract::gui::events
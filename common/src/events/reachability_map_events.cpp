@@ -0,0 +1,111 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/events/reachability_map_events.h>
+#include <tesseract_qt/common/reachability_map.h>
+
+namespace tesseract::gui::events
+{
+ReachabilityMapClear::ReachabilityMapClear(std::shared_ptr<const ComponentInfo> component_info)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::REACHABILITY_MAP_CLEAR))
+{
+}
+ReachabilityMapClear::ReachabilityMapClear(const ReachabilityMapClear& other)
+  : ReachabilityMapClear(other.getComponentInfo())
+{
+}
+ReachabilityMapClear::~ReachabilityMapClear() = default;
+
+//////////////////////////////////////////
+
+class ReachabilityMapSet::Implementation
+{
+public:
+  std::shared_ptr<const ReachabilityMap> reachability_map;
+};
+
+ReachabilityMapSet::ReachabilityMapSet(std::shared_ptr<const ComponentInfo> component_info,
+                                       std::shared_ptr<const ReachabilityMap> reachability_map)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::REACHABILITY_MAP_SET))
+  , data_(std::make_unique<Implementation>())
+{
+  data_->reachability_map = std::move(reachability_map);
+}
+ReachabilityMapSet::ReachabilityMapSet(const ReachabilityMapSet& other)
+  : ReachabilityMapSet(other.getComponentInfo(), other.getReachabilityMap())
+{
+}
+ReachabilityMapSet::~ReachabilityMapSet() = default;
+
+const std::shared_ptr<const ReachabilityMap>& ReachabilityMapSet::getReachabilityMap() const
+{
+  return data_->reachability_map;
+}
+
+//////////////////////////////////////////
+
+class ReachabilityMapRefine::Implementation
+{
+public:
+  std::vector<ReachabilityVoxelKey> keys;
+};
+
+ReachabilityMapRefine::ReachabilityMapRefine(std::shared_ptr<const ComponentInfo> component_info,
+                                             std::vector<ReachabilityVoxelKey> keys)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::REACHABILITY_MAP_REFINE))
+  , data_(std::make_unique<Implementation>())
+{
+  data_->keys = std::move(keys);
+}
+ReachabilityMapRefine::ReachabilityMapRefine(const ReachabilityMapRefine& other)
+  : ReachabilityMapRefine(other.getComponentInfo(), other.getKeys())
+{
+}
+ReachabilityMapRefine::~ReachabilityMapRefine() = default;
+
+const std::vector<ReachabilityVoxelKey>& ReachabilityMapRefine::getKeys() const { return data_->keys; }
+
+//////////////////////////////////////////
+
+class ReachabilityMapRefineFailed::Implementation
+{
+public:
+  std::vector<ReachabilityVoxelKey> keys;
+};
+
+ReachabilityMapRefineFailed::ReachabilityMapRefineFailed(std::shared_ptr<const ComponentInfo> component_info,
+                                                         std::vector<ReachabilityVoxelKey> keys)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::REACHABILITY_MAP_REFINE_FAILED))
+  , data_(std::make_unique<Implementation>())
+{
+  data_->keys = std::move(keys);
+}
+ReachabilityMapRefineFailed::ReachabilityMapRefineFailed(const ReachabilityMapRefineFailed& other)
+  : ReachabilityMapRefineFailed(other.getComponentInfo(), other.getKeys())
+{
+}
+ReachabilityMapRefineFailed::~ReachabilityMapRefineFailed() = default;
+
+const std::vector<ReachabilityVoxelKey>& ReachabilityMapRefineFailed::getKeys() const { return data_->keys; }
+
+}  // namespace tesseract::gui::events
@@ -0,0 +1,99 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/events/reachability_map_render_manager.h>
+#include <tesseract_qt/common/events/render_events.h>
+#include <tesseract_qt/common/events/reachability_map_events.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/tracing.h>
+
+#include <algorithm>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+ReachabilityMapRenderManager::ReachabilityMapRenderManager(std::shared_ptr<const ComponentInfo> component_info)
+  : component_info_(std::move(component_info))
+{
+  qApp->installEventFilter(this);
+}
+
+ReachabilityMapRenderManager::~ReachabilityMapRenderManager() = default;
+
+bool ReachabilityMapRenderManager::eventFilter(QObject* obj, QEvent* event)
+{
+  std::scoped_lock lock(mutex_);
+  if (event->type() == events::EventType::REACHABILITY_MAP_CLEAR)
+  {
+    assert(dynamic_cast<events::ReachabilityMapClear*>(event) != nullptr);
+    auto* e = static_cast<events::ReachabilityMapClear*>(event);
+    if (e->getComponentInfo() == component_info_)
+      events_.push_back(std::make_unique<events::ReachabilityMapClear>(*e));
+  }
+  else if (event->type() == events::EventType::REACHABILITY_MAP_SET)
+  {
+    assert(dynamic_cast<events::ReachabilityMapSet*>(event) != nullptr);
+    auto* e = static_cast<events::ReachabilityMapSet*>(event);
+    if (e->getComponentInfo() == component_info_)
+      events_.push_back(std::make_unique<events::ReachabilityMapSet>(*e));
+  }
+  else if (event->type() == events::EventType::REACHABILITY_MAP_REFINE_FAILED)
+  {
+    assert(dynamic_cast<events::ReachabilityMapRefineFailed*>(event) != nullptr);
+    auto* e = static_cast<events::ReachabilityMapRefineFailed*>(event);
+    if (e->getComponentInfo() == component_info_)
+      events_.push_back(std::make_unique<events::ReachabilityMapRefineFailed>(*e));
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+  {
+    assert(dynamic_cast<events::SceneStateChanged*>(event) != nullptr);
+    auto* e = static_cast<events::SceneStateChanged*>(event);
+    if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+    {
+      // Only the working frame is read from the state, so only the latest one is kept
+      events_.erase(std::remove_if(events_.begin(),
+                                   events_.end(),
+                                   [](const auto& queued) {
+                                     return (queued->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED);
+                                   }),
+                    events_.end());
+      events_.push_back(std::make_unique<events::SceneStateChanged>(*e));
+    }
+  }
+  else if (event->type() == events::EventType::PRE_RENDER)
+  {
+    assert(dynamic_cast<events::PreRender*>(event) != nullptr);
+    if (static_cast<events::PreRender*>(event)->getSceneName() == component_info_->getSceneName())
+    {
+      TESSERACT_QT_TRACE_ZONE("ReachabilityMapRenderManager::render");
+      render();
+    }
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+
+}  // namespace tesseract::gui
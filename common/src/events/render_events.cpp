@@ -32,6 +32,9 @@ RenderEvent::~RenderEvent() = default;
 
 const std::string& RenderEvent::getSceneName() const { return scene_name_; }
 
+void RenderEvent::setCameraName(std::string camera_name) { camera_name_ = std::move(camera_name); }
+const std::string& RenderEvent::getCameraName() const { return camera_name_; }
+
 /////////////////////////////////////////////////
 Render::Render(std::string scene_name) : RenderEvent(std::move(scene_name), QEvent::Type(EventType::RENDER)) {}
 Render::~Render() = default;
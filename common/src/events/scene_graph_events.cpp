@@ -332,6 +332,34 @@ bool SceneGraphModifyLinkVisibilityALL::visible() const { return data_->visible;
 
 //////////////////////////////////////////
 
+class SceneGraphModifyLinkHighlight::Implementation
+{
+public:
+  std::vector<std::string> link_names;
+  bool highlight;
+};
+
+SceneGraphModifyLinkHighlight::SceneGraphModifyLinkHighlight(
+    std::shared_ptr<const tesseract::gui::ComponentInfo> component_info,
+    std::vector<std::string> link_names,
+    bool highlight)
+  : ComponentEvent(std::move(component_info), QEvent::Type(EventType::SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT))
+  , data_(std::make_unique<Implementation>())
+{
+  data_->link_names = std::move(link_names);
+  data_->highlight = highlight;
+}
+SceneGraphModifyLinkHighlight::SceneGraphModifyLinkHighlight(const SceneGraphModifyLinkHighlight& other)
+  : SceneGraphModifyLinkHighlight(other.getComponentInfo(), other.getLinkNames(), other.highlight())
+{
+}
+SceneGraphModifyLinkHighlight::~SceneGraphModifyLinkHighlight() = default;
+
+const std::vector<std::string>& SceneGraphModifyLinkHighlight::getLinkNames() const { return data_->link_names; }
+bool SceneGraphModifyLinkHighlight::highlight() const { return data_->highlight; }
+
+//////////////////////////////////////////
+
 SceneGraphPlot::SceneGraphPlot(std::shared_ptr<const ComponentInfo> component_info)
   : ComponentEvent(std::move(component_info), QEvent::Type(EventType::SCENE_GRAPH_PLOT))
 {
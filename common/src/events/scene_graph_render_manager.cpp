@@ -29,10 +29,13 @@
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/environment_manager.h>
 #include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/tracing.h>
 
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/environment/environment.h>
 
+#include <algorithm>
+
 #include <QApplication>
 
 namespace tesseract::gui
@@ -137,18 +140,38 @@ bool SceneGraphRenderManager::eventFilter(QObject* obj, QEvent* event)
     if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
       events_.push_back(std::make_unique<events::SceneGraphModifyLinkVisibilityALL>(*e));
   }
+  else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT)
+  {
+    assert(dynamic_cast<events::SceneGraphModifyLinkHighlight*>(event) != nullptr);
+    auto* e = static_cast<events::SceneGraphModifyLinkHighlight*>(event);
+    if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+      events_.push_back(std::make_unique<events::SceneGraphModifyLinkHighlight>(*e));
+  }
   else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
   {
     assert(dynamic_cast<events::SceneStateChanged*>(event) != nullptr);
     auto* e = static_cast<events::SceneStateChanged*>(event);
     if (e->getComponentInfo() == component_info_ || e->getComponentInfo()->isParent(component_info_))
+    {
+      // The state is complete, so while rendering is paused only the latest one is kept unless the scene graph of
+      // the component changed after it
+      auto it = std::find_if(events_.rbegin(), events_.rend(), [e](const auto& queued) {
+        return (queued->getComponentInfo() == e->getComponentInfo());
+      });
+      if (it != events_.rend() && (*it)->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+        events_.erase(std::next(it).base());
+
       events_.push_back(std::make_unique<events::SceneStateChanged>(*e));
+    }
   }
   else if (event->type() == events::EventType::PRE_RENDER)
   {
     assert(dynamic_cast<events::PreRender*>(event) != nullptr);
     if (static_cast<events::PreRender*>(event)->getSceneName() == component_info_->getSceneName())
+    {
+      TESSERACT_QT_TRACE_ZONE("SceneGraphRenderManager::render");
       render();
+    }
   }
 
   // Standard event processing
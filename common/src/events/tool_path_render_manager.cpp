@@ -25,11 +25,100 @@
 #include <tesseract_qt/common/events/render_events.h>
 #include <tesseract_qt/common/events/tool_path_events.h>
 #include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/tool_path.h>
+#include <tesseract_qt/common/tracing.h>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <algorithm>
+#include <functional>
 
 #include <QApplication>
 
 namespace tesseract::gui
 {
+namespace
+{
+using EventQueue = std::vector<std::unique_ptr<events::ComponentEvent>>;
+
+/** @brief Get the tool path uuid of a queued event, it is nil for events not targeting a single tool path */
+boost::uuids::uuid getToolPathUUID(const events::ComponentEvent& event)
+{
+  if (event.type() == events::EventType::TOOL_PATH_ADD)
+    return static_cast<const events::ToolPathAdd&>(event).getToolPath().getUUID();
+
+  if (event.type() == events::EventType::TOOL_PATH_REMOVE)
+    return static_cast<const events::ToolPathRemove&>(event).getUUID();
+
+  if (event.type() == events::EventType::TOOL_PATH_HIDE)
+    return static_cast<const events::ToolPathHide&>(event).getUUID();
+
+  if (event.type() == events::EventType::TOOL_PATH_SHOW)
+    return static_cast<const events::ToolPathShow&>(event).getUUID();
+
+  return {};
+}
+
+/** @brief Get the child uuid of a queued hide or show event */
+boost::uuids::uuid getToolPathChildUUID(const events::ComponentEvent& event)
+{
+  if (event.type() == events::EventType::TOOL_PATH_HIDE)
+    return static_cast<const events::ToolPathHide&>(event).getChildUUID();
+
+  if (event.type() == events::EventType::TOOL_PATH_SHOW)
+    return static_cast<const events::ToolPathShow&>(event).getChildUUID();
+
+  return {};
+}
+
+bool isVisibilityEvent(const events::ComponentEvent& event)
+{
+  return (event.type() == events::EventType::TOOL_PATH_HIDE || event.type() == events::EventType::TOOL_PATH_SHOW);
+}
+
+/**
+ * @brief Drop the queued events superseded by a new event
+ * @details Adding or removing a tool path rebuilds or removes its visuals, so the queued events of that tool path have
+ * no effect. The same holds for all the events before a remove all and for the visibility events before a hide all or
+ * show all. This keeps the queue bounded while rendering is paused.
+ */
+void removeSupersededEvents(EventQueue& queue, const events::ComponentEvent& event)
+{
+  std::function<bool(const events::ComponentEvent&)> superseded;
+  if (event.type() == events::EventType::TOOL_PATH_ADD || event.type() == events::EventType::TOOL_PATH_REMOVE)
+  {
+    const boost::uuids::uuid uuid = getToolPathUUID(event);
+    superseded = [uuid](const events::ComponentEvent& queued) { return (getToolPathUUID(queued) == uuid); };
+  }
+  else if (event.type() == events::EventType::TOOL_PATH_REMOVE_ALL)
+  {
+    superseded = [](const events::ComponentEvent& /*queued*/) { return true; };
+  }
+  else if (event.type() == events::EventType::TOOL_PATH_HIDE_ALL ||
+           event.type() == events::EventType::TOOL_PATH_SHOW_ALL)
+  {
+    superseded = [](const events::ComponentEvent& queued) {
+      return (isVisibilityEvent(queued) || queued.type() == events::EventType::TOOL_PATH_HIDE_ALL ||
+              queued.type() == events::EventType::TOOL_PATH_SHOW_ALL);
+    };
+  }
+  else
+  {
+    const boost::uuids::uuid uuid = getToolPathUUID(event);
+    const boost::uuids::uuid child_uuid = getToolPathChildUUID(event);
+    superseded = [uuid, child_uuid](const events::ComponentEvent& queued) {
+      return (isVisibilityEvent(queued) && getToolPathUUID(queued) == uuid &&
+              getToolPathChildUUID(queued) == child_uuid);
+    };
+  }
+
+  queue.erase(std::remove_if(queue.begin(),
+                             queue.end(),
+                             [&superseded](const auto& queued) { return superseded(*queued); }),
+              queue.end());
+}
+}  // namespace
+
 ToolPathRenderManager::ToolPathRenderManager(std::shared_ptr<const ComponentInfo> component_info)
   : component_info_(std::move(component_info))
 {
@@ -46,55 +135,79 @@ bool ToolPathRenderManager::eventFilter(QObject* obj, QEvent* event)
     assert(dynamic_cast<events::ToolPathAdd*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathAdd*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathAdd>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_REMOVE)
   {
     assert(dynamic_cast<events::ToolPathRemove*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathRemove*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathRemove>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_REMOVE_ALL)
   {
     assert(dynamic_cast<events::ToolPathRemoveAll*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathRemoveAll*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathRemoveAll>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_HIDE_ALL)
   {
     assert(dynamic_cast<events::ToolPathHideAll*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathHideAll*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathHideAll>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_SHOW_ALL)
   {
     assert(dynamic_cast<events::ToolPathShowAll*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathShowAll*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathShowAll>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_HIDE)
   {
     assert(dynamic_cast<events::ToolPathHide*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathHide*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathHide>(*e));
+    }
   }
   else if (event->type() == events::EventType::TOOL_PATH_SHOW)
   {
     assert(dynamic_cast<events::ToolPathShow*>(event) != nullptr);
     auto* e = static_cast<events::ToolPathShow*>(event);
     if (e->getComponentInfo() == component_info_)
+    {
+      removeSupersededEvents(events_, *e);
       events_.push_back(std::make_unique<events::ToolPathShow>(*e));
+    }
   }
   else if (event->type() == events::EventType::PRE_RENDER)
   {
     assert(dynamic_cast<events::PreRender*>(event) != nullptr);
     if (static_cast<events::PreRender*>(event)->getSceneName() == component_info_->getSceneName())
+    {
+      TESSERACT_QT_TRACE_ZONE("ToolPathRenderManager::render");
       render();
+    }
   }
 
   // Standard event processing
@@ -88,6 +88,12 @@ void JointTrajectorySet::applyEnvironment(std::unique_ptr<tesseract::environment
   commands_.clear();
 }
 
+void JointTrajectorySet::setEnvironment(std::shared_ptr<tesseract::environment::Environment> env)
+{
+  environment_ = std::move(env);
+  commands_.clear();
+}
+
 std::shared_ptr<tesseract::environment::Environment> JointTrajectorySet::getEnvironment() const { return environment_; }
 
 const std::vector<std::shared_ptr<const tesseract::environment::Command>>&
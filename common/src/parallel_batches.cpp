@@ -0,0 +1,101 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/parallel_batches.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tesseract::gui
+{
+std::size_t getBatchThreadCount(std::size_t thread_count, std::size_t total, std::size_t batch_size)
+{
+  batch_size = std::max<std::size_t>(batch_size, 1);
+  if (thread_count == 0)
+    thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+
+  return std::max<std::size_t>(std::min(thread_count, (total + batch_size - 1) / batch_size), 1);
+}
+
+bool runParallelBatches(std::size_t total,
+                        std::size_t batch_size,
+                        std::size_t thread_count,
+                        const std::function<void(std::size_t worker, std::size_t index)>& process,
+                        const std::function<bool(std::size_t begin, std::size_t end, std::size_t done)>& completed)
+{
+  batch_size = std::max<std::size_t>(batch_size, 1);
+  thread_count = std::max<std::size_t>(thread_count, 1);
+
+  std::atomic<std::size_t> next{ 0 };
+  std::atomic<bool> canceled{ false };
+  std::mutex mutex;
+  std::size_t done{ 0 };
+  std::exception_ptr error;
+
+  auto run = [&](std::size_t worker) {
+    try
+    {
+      while (!canceled)
+      {
+        const std::size_t begin = next.fetch_add(batch_size);
+        if (begin >= total)
+          break;
+
+        const std::size_t end = std::min(begin + batch_size, total);
+        for (std::size_t i = begin; i < end && !canceled; ++i)
+          process(worker, i);
+
+        std::scoped_lock lock(mutex);
+        done += end - begin;
+        if (completed && !canceled && !completed(begin, end, done))
+          canceled = true;
+      }
+    }
+    catch (...)
+    {
+      std::scoped_lock lock(mutex);
+      if (!error)
+        error = std::current_exception();
+      canceled = true;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (std::size_t i = 1; i < thread_count; ++i)
+    threads.emplace_back(run, i);
+
+  run(0);
+  for (auto& thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+
+  return !canceled;
+}
+}  // namespace tesseract::gui
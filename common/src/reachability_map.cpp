@@ -0,0 +1,405 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/reachability_map.h>
+#include <tesseract_qt/common/parallel_batches.h>
+#include <tesseract_qt/common/utils.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/kinematics/kinematic_group.h>
+#include <tesseract/common/utils.h>
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+namespace tesseract::gui
+{
+namespace
+{
+const char CACHE_MAGIC[4] = { 'T', 'Q', 'R', 'M' };
+const std::uint32_t CACHE_VERSION{ 1 };
+
+/** @brief A stable hash, std::hash is not guaranteed to be the same between runs */
+std::uint64_t fnv1a(const std::string& text)
+{
+  std::uint64_t hash{ 14695981039346656037ULL };
+  for (const char c : text)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::string toHex(std::uint64_t value)
+{
+  std::ostringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << value;
+  return ss.str();
+}
+
+int floorDiv(int value, int divisor) { return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor); }
+
+template <typename T>
+void writeValue(std::ofstream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::ifstream& stream, T& value)
+{
+  return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void writeString(std::ofstream& stream, const std::string& value)
+{
+  writeValue(stream, static_cast<std::uint32_t>(value.size()));
+  stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+bool readString(std::ifstream& stream, std::string& value)
+{
+  std::uint32_t size{ 0 };
+  if (!readValue(stream, size))
+    return false;
+
+  value.resize(size);
+  return static_cast<bool>(stream.read(value.data(), static_cast<std::streamsize>(size)));
+}
+}  // namespace
+
+bool ReachabilityVoxelKey::operator==(const ReachabilityVoxelKey& other) const
+{
+  return (level == other.level && x == other.x && y == other.y && z == other.z);
+}
+
+bool ReachabilityVoxelKey::operator!=(const ReachabilityVoxelKey& other) const { return !operator==(other); }
+
+ReachabilityVoxelKey ReachabilityVoxelKey::getParent() const
+{
+  if (level == 0)
+    return *this;
+
+  return { level - 1, floorDiv(x, 2), floorDiv(y, 2), floorDiv(z, 2) };
+}
+
+std::vector<ReachabilityVoxelKey> ReachabilityVoxelKey::getChildren() const
+{
+  std::vector<ReachabilityVoxelKey> children;
+  children.reserve(8);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      for (int k = 0; k < 2; ++k)
+        children.push_back({ level + 1, (2 * x) + i, (2 * y) + j, (2 * z) + k });
+    }
+  }
+  return children;
+}
+
+std::size_t ReachabilityVoxelKeyHash::operator()(const ReachabilityVoxelKey& key) const
+{
+  std::size_t hash = std::hash<int>()(key.level);
+  for (int value : { key.x, key.y, key.z })
+    hash ^= std::hash<int>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+ReachabilityMap::ReachabilityMap(std::string key, std::string working_frame, double resolution)
+  : key_(std::move(key)), working_frame_(std::move(working_frame)), resolution_(resolution)
+{
+  if (resolution_ <= 0)
+    throw std::runtime_error("ReachabilityMap: the resolution must be greater than zero");
+}
+
+const std::string& ReachabilityMap::getKey() const { return key_; }
+
+const std::string& ReachabilityMap::getWorkingFrame() const { return working_frame_; }
+
+double ReachabilityMap::getResolution() const { return resolution_; }
+
+double ReachabilityMap::getVoxelSize(int level) const { return std::ldexp(resolution_, -level); }
+
+Eigen::Vector3d ReachabilityMap::getVoxelCenter(const ReachabilityVoxelKey& key) const
+{
+  const double size = getVoxelSize(key.level);
+  return { (key.x + 0.5) * size, (key.y + 0.5) * size, (key.z + 0.5) * size };
+}
+
+std::vector<ReachabilityVoxelKey> ReachabilityMap::getVoxelKeys(const Eigen::AlignedBox3d& bounds) const
+{
+  std::vector<ReachabilityVoxelKey> keys;
+  if (bounds.isEmpty())
+    return keys;
+
+  const Eigen::Vector3i min = (bounds.min() / resolution_).array().floor().cast<int>();
+  const Eigen::Vector3i max =
+      (bounds.max() / resolution_).array().ceil().cast<int>().max(min.array() + 1) - Eigen::Array3i::Ones();
+  keys.reserve(static_cast<std::size_t>((max - min + Eigen::Vector3i::Ones()).prod()));
+  for (int x = min.x(); x <= max.x(); ++x)
+  {
+    for (int y = min.y(); y <= max.y(); ++y)
+    {
+      for (int z = min.z(); z <= max.z(); ++z)
+        keys.push_back({ 0, x, y, z });
+    }
+  }
+  return keys;
+}
+
+bool ReachabilityMap::isLeaf(const ReachabilityVoxelKey& key) const
+{
+  const std::vector<ReachabilityVoxelKey> children = key.getChildren();
+  return std::none_of(
+      children.begin(), children.end(), [this](const ReachabilityVoxelKey& child) { return voxels_.count(child) > 0; });
+}
+
+std::vector<ReachabilityVoxelKey> ReachabilityMap::getMissing(const std::vector<ReachabilityVoxelKey>& keys) const
+{
+  std::vector<ReachabilityVoxelKey> missing;
+  std::unordered_set<ReachabilityVoxelKey, ReachabilityVoxelKeyHash> added;
+  for (const auto& key : keys)
+  {
+    if (voxels_.count(key) == 0 && added.insert(key).second)
+      missing.push_back(key);
+  }
+  return missing;
+}
+
+void ReachabilityMap::setVoxel(const ReachabilityVoxelKey& key, float score) { voxels_[key] = score; }
+
+const ReachabilityMap::Voxels& ReachabilityMap::getVoxels() const { return voxels_; }
+
+bool ReachabilityMap::empty() const { return voxels_.empty(); }
+
+tesseract::common::VectorIsometry3d createReachabilityOrientations(std::size_t approach_count, std::size_t roll_count)
+{
+  tesseract::common::VectorIsometry3d orientations;
+  approach_count = std::max<std::size_t>(approach_count, 1);
+  roll_count = std::max<std::size_t>(roll_count, 1);
+  orientations.reserve(approach_count * roll_count);
+
+  // A single approach direction points along the working frame z axis, more are placed on a fibonacci sphere
+  const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+  for (std::size_t i = 0; i < approach_count; ++i)
+  {
+    Eigen::Vector3d direction = Eigen::Vector3d::UnitZ();
+    if (approach_count > 1)
+    {
+      const double z = 1.0 - (2.0 * (static_cast<double>(i) + 0.5) / static_cast<double>(approach_count));
+      const double r = std::sqrt(std::max(0.0, 1.0 - (z * z)));
+      const double theta = golden_angle * static_cast<double>(i);
+      direction = Eigen::Vector3d(r * std::cos(theta), r * std::sin(theta), z);
+    }
+
+    const Eigen::Quaterniond approach = Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), direction);
+    for (std::size_t j = 0; j < roll_count; ++j)
+    {
+      const double roll = (2.0 * M_PI * static_cast<double>(j)) / static_cast<double>(roll_count);
+      Eigen::Isometry3d orientation{ Eigen::Isometry3d::Identity() };
+      orientation.linear() = (approach * Eigen::AngleAxisd(roll, Eigen::Vector3d::UnitZ())).toRotationMatrix();
+      orientations.push_back(orientation);
+    }
+  }
+  return orientations;
+}
+
+std::string getReachabilityMapKey(const tesseract::environment::Environment& env, const ReachabilityMapConfig& config)
+{
+  std::ostringstream ss;
+  ss << std::setprecision(9);
+  // The name and revision do not identify the content, different environments can share both
+  ss << "env=" << toHex(getCommandsFingerprint(env.getCommandHistory())) << ";group=" << config.group_name
+     << ";working_frame=" << config.working_frame << ";tip_link=" << config.tip_link
+     << ";resolution=" << config.resolution;
+
+  // The joints outside the group can move the working frame relative to the group base
+  std::vector<std::string> group_joints;
+  if (auto kin_group = env.getKinematicGroup(config.group_name))
+    group_joints = kin_group->getJointNames();
+
+  std::ostringstream state;
+  state << std::setprecision(9);
+  const tesseract::scene_graph::SceneState current_state = env.getState();
+  for (const auto& joint : std::map<std::string, double>(current_state.joints.begin(), current_state.joints.end()))
+  {
+    if (std::find(group_joints.begin(), group_joints.end(), joint.first) == group_joints.end())
+      state << joint.first << "=" << joint.second << ";";
+  }
+  ss << ";state=" << toHex(fnv1a(state.str()));
+
+  std::ostringstream orientations;
+  orientations << std::setprecision(9);
+  for (const auto& orientation : config.orientations)
+    orientations << orientation.matrix().format(Eigen::IOFormat(Eigen::FullPrecision, Eigen::DontAlignCols, ",", ","));
+  ss << ";orientations=" << config.orientations.size() << ":" << toHex(fnv1a(orientations.str()));
+
+  return ss.str();
+}
+
+bool computeReachability(const tesseract::environment::Environment& env,
+                         const ReachabilityMapConfig& config,
+                         const std::vector<ReachabilityVoxelKey>& keys,
+                         ReachabilityMap& map,
+                         const ReachabilityMapCallback& callback)
+{
+  if (config.orientations.empty())
+    throw std::runtime_error("computeReachability: at least one orientation is required");
+
+  const std::vector<ReachabilityVoxelKey> missing = map.getMissing(keys);
+  const std::size_t total = missing.size();
+  if (total == 0)
+    return true;
+
+  const std::size_t thread_count = getBatchThreadCount(config.thread_count, total, config.batch_size);
+
+  // Create a kinematic group per worker up front, the environment is only read from here on
+  std::vector<std::unique_ptr<tesseract::kinematics::KinematicGroup>> kin_groups(thread_count);
+  for (auto& kin_group : kin_groups)
+  {
+    kin_group = env.getKinematicGroup(config.group_name);
+    if (kin_group == nullptr)
+      throw std::runtime_error("computeReachability: kinematic group '" + config.group_name + "' does not exist");
+  }
+
+  const Eigen::VectorXd seed = env.getCurrentJointValues(kin_groups.front()->getJointNames());
+  std::vector<float> scores(total, 0);
+
+  auto process = [&](std::size_t worker, std::size_t i) {
+    tesseract::kinematics::KinematicGroup& kin_group = *kin_groups[worker];
+    const auto& limits = kin_group.getLimits().joint_limits;
+
+    Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+    pose.translation() = map.getVoxelCenter(missing[i]);
+
+    std::size_t reached{ 0 };
+    for (const auto& orientation : config.orientations)
+    {
+      pose.linear() = orientation.linear();
+      tesseract::kinematics::KinGroupIKInput input(pose, config.working_frame, config.tip_link);
+      const tesseract::kinematics::IKSolutions solutions = kin_group.calcInvKin(input, seed);
+      if (std::any_of(solutions.begin(), solutions.end(), [&limits](const Eigen::VectorXd& solution) {
+            return tesseract::common::satisfiesLimits<double>(solution, limits);
+          }))
+        ++reached;
+    }
+    scores[i] = static_cast<float>(reached) / static_cast<float>(config.orientations.size());
+  };
+
+  std::function<bool(std::size_t, std::size_t, std::size_t)> completed;
+  if (callback)
+  {
+    completed = [&](std::size_t begin, std::size_t end, std::size_t computed) {
+      std::vector<std::pair<ReachabilityVoxelKey, float>> batch;
+      batch.reserve(end - begin);
+      for (std::size_t i = begin; i < end; ++i)
+        batch.emplace_back(missing[i], scores[i]);
+
+      return callback(batch, computed, total);
+    };
+  }
+
+  if (!runParallelBatches(total, config.batch_size, thread_count, process, completed))
+    return false;
+
+  for (std::size_t i = 0; i < total; ++i)
+    map.setVoxel(missing[i], scores[i]);
+
+  return true;
+}
+
+std::string getReachabilityMapCacheFileName(const std::string& key) { return toHex(fnv1a(key)) + ".rmap"; }
+
+ReachabilityMap::Ptr loadReachabilityMap(const std::string& file_path, const std::string& key)
+{
+  std::ifstream stream(file_path, std::ios::binary);
+  if (!stream)
+    return nullptr;
+
+  char magic[4];
+  std::uint32_t version{ 0 };
+  if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, CACHE_MAGIC) || !readValue(stream, version) ||
+      version != CACHE_VERSION)
+    return nullptr;
+
+  std::string file_key;
+  std::string working_frame;
+  double resolution{ 0 };
+  std::uint64_t count{ 0 };
+  if (!readString(stream, file_key) || file_key != key || !readString(stream, working_frame) ||
+      !readValue(stream, resolution) || resolution <= 0 || !readValue(stream, count))
+    return nullptr;
+
+  auto map = std::make_shared<ReachabilityMap>(file_key, working_frame, resolution);
+  for (std::uint64_t i = 0; i < count; ++i)
+  {
+    std::int32_t values[4];
+    float score{ 0 };
+    if (!stream.read(reinterpret_cast<char*>(values), sizeof(values)) || !readValue(stream, score))
+      return nullptr;
+
+    map->setVoxel({ values[0], values[1], values[2], values[3] }, score);
+  }
+  return map;
+}
+
+bool saveReachabilityMap(const std::string& file_path, const ReachabilityMap& map)
+{
+  // Write to a temporary file first so an interrupted save does not leave a truncated cache behind
+  const std::string tmp_file_path = file_path + ".tmp";
+  {
+    std::ofstream stream(tmp_file_path, std::ios::binary | std::ios::trunc);
+    if (!stream)
+      return false;
+
+    stream.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    writeValue(stream, CACHE_VERSION);
+    writeString(stream, map.getKey());
+    writeString(stream, map.getWorkingFrame());
+    writeValue(stream, map.getResolution());
+    writeValue(stream, static_cast<std::uint64_t>(map.getVoxels().size()));
+    for (const auto& voxel : map.getVoxels())
+    {
+      const std::int32_t values[4] = { voxel.first.level, voxel.first.x, voxel.first.y, voxel.first.z };
+      stream.write(reinterpret_cast<const char*>(values), sizeof(values));
+      writeValue(stream, voxel.second);
+    }
+
+    if (!stream)
+      return false;
+  }
+
+  std::remove(file_path.c_str());
+  return (std::rename(tmp_file_path.c_str(), file_path.c_str()) == 0);
+}
+}  // namespace tesseract::gui
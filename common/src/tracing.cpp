@@ -0,0 +1,268 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/tracing.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace tesseract::gui
+{
+namespace
+{
+/**
+ * @brief A record slot of a thread buffer
+ * @details The collector reads slots while the owning thread may be overwriting them, so the fields are relaxed
+ * atomics and torn copies are detected afterwards using ThreadBuffer::writing.
+ */
+struct TraceSlot
+{
+  std::atomic<const char*> name{ nullptr };
+  std::atomic<std::int64_t> start{ 0 };
+  std::atomic<std::int64_t> duration{ 0 };
+};
+
+struct ThreadBuffer
+{
+  explicit ThreadBuffer(std::uint32_t thread) : thread(thread), slots(Tracer::BUFFER_CAPACITY) {}
+
+  const std::uint32_t thread;
+  std::vector<TraceSlot> slots;
+
+  /** @brief The number of records written, only the owning thread writes it */
+  std::atomic<std::uint64_t> head{ 0 };
+
+  /** @brief The number of records started, it is ahead of head while the owning thread writes a slot */
+  std::atomic<std::uint64_t> writing{ 0 };
+
+  /** @brief Records before this index were cleared */
+  std::atomic<std::uint64_t> tail{ 0 };
+};
+
+struct TracerData
+{
+  const std::chrono::steady_clock::time_point epoch{ std::chrono::steady_clock::now() };
+  std::atomic<bool> enabled{ false };
+
+  /** @brief Only taken when a thread records its first zone and when collecting */
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+TracerData& getTracerData()
+{
+  static TracerData data;
+  return data;
+}
+
+ThreadBuffer& getThreadBuffer()
+{
+  // The tracer keeps the buffer alive so the records of finished threads can still be collected
+  thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+    TracerData& data = getTracerData();
+    std::scoped_lock lock(data.mutex);
+    auto b = std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(data.buffers.size()));
+    data.buffers.push_back(b);
+    return b;
+  }();
+
+  return *buffer;
+}
+
+void writeJsonString(std::ostream& os, const char* str)
+{
+  os << '"';
+  for (const char* c = str; *c != '\0'; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      os << '\\' << *c;
+    else if (static_cast<unsigned char>(*c) < 0x20)
+      os << ' ';
+    else
+      os << *c;
+  }
+  os << '"';
+}
+
+double toMilliseconds(std::int64_t ns) { return static_cast<double>(ns) / 1.0e6; }
+}  // namespace
+
+bool Tracer::isAvailable()
+{
+#ifdef TESSERACT_QT_TRACING
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Tracer::setEnabled(bool enabled) { getTracerData().enabled.store(enabled, std::memory_order_relaxed); }
+
+bool Tracer::isEnabled() { return getTracerData().enabled.load(std::memory_order_relaxed); }
+
+std::int64_t Tracer::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              getTracerData().epoch)
+      .count();
+}
+
+void Tracer::record(const char* name, std::int64_t start, std::int64_t end)
+{
+  ThreadBuffer& buffer = getThreadBuffer();
+  const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+
+  // Announce the slot before overwriting it so a concurrent collect can drop the copy
+  buffer.writing.store(head + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  TraceSlot& slot = buffer.slots[head % BUFFER_CAPACITY];
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.duration.store(end - start, std::memory_order_relaxed);
+
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<TraceRecord> Tracer::collect()
+{
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    TracerData& data = getTracerData();
+    std::scoped_lock lock(data.mutex);
+    buffers = data.buffers;
+  }
+
+  std::vector<TraceRecord> records;
+  for (const auto& buffer : buffers)
+  {
+    const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+    const std::uint64_t oldest = (head > BUFFER_CAPACITY) ? head - BUFFER_CAPACITY : 0;
+    const std::uint64_t begin = std::max(oldest, buffer->tail.load(std::memory_order_relaxed));
+
+    const std::size_t offset = records.size();
+    for (std::uint64_t i = begin; i < head; ++i)
+    {
+      const TraceSlot& slot = buffer->slots[i % BUFFER_CAPACITY];
+      TraceRecord& r = records.emplace_back();
+      r.name = slot.name.load(std::memory_order_relaxed);
+      r.start = slot.start.load(std::memory_order_relaxed);
+      r.duration = slot.duration.load(std::memory_order_relaxed);
+      r.thread = buffer->thread;
+    }
+
+    // The writer does not wait for readers, drop the records it may have started overwriting while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t writing = buffer->writing.load(std::memory_order_relaxed);
+    const std::uint64_t valid = (writing > BUFFER_CAPACITY) ? writing - BUFFER_CAPACITY : 0;
+    if (valid > begin)
+    {
+      const auto dropped = static_cast<std::ptrdiff_t>(std::min(valid, head) - begin);
+      records.erase(records.begin() + static_cast<std::ptrdiff_t>(offset),
+                    records.begin() + static_cast<std::ptrdiff_t>(offset) + dropped);
+    }
+  }
+
+  std::sort(records.begin(), records.end(), [](const TraceRecord& a, const TraceRecord& b) {
+    return (a.start < b.start);
+  });
+  return records;
+}
+
+void Tracer::clear()
+{
+  TracerData& data = getTracerData();
+  std::scoped_lock lock(data.mutex);
+  for (const auto& buffer : data.buffers)
+    buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+std::vector<TraceStatistics> Tracer::computeStatistics(const std::vector<TraceRecord>& records)
+{
+  std::unordered_map<std::string_view, std::vector<std::int64_t>> durations;
+  for (const auto& record : records)
+    durations[record.name].push_back(record.duration);
+
+  std::vector<TraceStatistics> statistics;
+  statistics.reserve(durations.size());
+  for (auto& zone : durations)
+  {
+    std::vector<std::int64_t>& values = zone.second;
+    std::sort(values.begin(), values.end());
+
+    TraceStatistics s;
+    s.name = std::string(zone.first);
+    s.count = values.size();
+    for (std::int64_t value : values)
+      s.total += toMilliseconds(value);
+
+    s.mean = s.total / static_cast<double>(s.count);
+    s.p50 = toMilliseconds(values[(values.size() - 1) / 2]);
+    s.p99 = toMilliseconds(values[((values.size() - 1) * 99) / 100]);
+    s.max = toMilliseconds(values.back());
+    statistics.push_back(s);
+  }
+
+  std::sort(statistics.begin(), statistics.end(), [](const TraceStatistics& a, const TraceStatistics& b) {
+    return (a.total > b.total);
+  });
+  return statistics;
+}
+
+void Tracer::writeChromeTrace(std::ostream& os, const std::vector<TraceRecord>& records)
+{
+  // Complete events ("ph": "X") with timestamps in microseconds
+  os << R"({"displayTimeUnit":"ms","traceEvents":[)";
+  bool first{ true };
+  for (const auto& record : records)
+  {
+    if (!first)
+      os << ',';
+
+    first = false;
+    os << R"({"name":)";
+    writeJsonString(os, record.name);
+    os << R"(,"ph":"X","pid":1,"tid":)" << record.thread;
+    os << R"(,"ts":)" << static_cast<double>(record.start) / 1.0e3;
+    os << R"(,"dur":)" << static_cast<double>(record.duration) / 1.0e3 << '}';
+  }
+  os << "]}\n";
+}
+
+bool Tracer::saveChromeTrace(const std::string& file_path)
+{
+  std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+  if (!file)
+    return false;
+
+  file.precision(15);
+  writeChromeTrace(file, collect());
+  return file.good();
+}
+}  // namespace tesseract::gui
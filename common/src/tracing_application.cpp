@@ -0,0 +1,46 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/tracing_application.h>
+#include <tesseract_qt/common/tracing.h>
+#include <tesseract_qt/common/events/event_type.h>
+
+namespace tesseract::gui
+{
+TracingApplication::TracingApplication(int& argc, char** argv) : QApplication(argc, argv) {}
+
+TracingApplication::~TracingApplication() = default;
+
+bool TracingApplication::notify(QObject* receiver, QEvent* event)
+{
+#ifdef TESSERACT_QT_TRACING
+  if (event->type() >= QEvent::User && Tracer::isEnabled())
+  {
+    const TraceZone zone(events::EventType::getName(event->type()));
+    return QApplication::notify(receiver, event);
+  }
+#endif
+
+  return QApplication::notify(receiver, event);
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,228 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/trajectory_contact_scan.h>
+#include <tesseract_qt/common/parallel_batches.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/continuous_contact_manager.h>
+#include <tesseract/state_solver/state_solver.h>
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace tesseract::gui
+{
+namespace
+{
+struct ScanWorker
+{
+  std::unique_ptr<tesseract::collision::DiscreteContactManager> discrete_manager;
+  std::unique_ptr<tesseract::collision::ContinuousContactManager> continuous_manager;
+  std::unique_ptr<tesseract::scene_graph::StateSolver> state_solver;
+  std::vector<std::string> active_links;
+};
+
+tesseract::scene_graph::SceneState getState(const tesseract::scene_graph::StateSolver& state_solver,
+                                            const std::vector<std::string>& joint_names,
+                                            const Eigen::VectorXd& values)
+{
+  if (!values.hasNaN())
+    return state_solver.getState(joint_names, values);
+
+  // Joints missing from a concatenated trajectory are stored as NaN, leave them at the current state
+  std::vector<std::string> names;
+  Eigen::VectorXd filtered(values.size());
+  for (Eigen::Index i = 0; i < values.size(); ++i)
+  {
+    if (std::isnan(values(i)))
+      continue;
+
+    filtered(static_cast<Eigen::Index>(names.size())) = values(i);
+    names.push_back(joint_names[static_cast<std::size_t>(i)]);
+  }
+  return state_solver.getState(names, filtered.head(static_cast<Eigen::Index>(names.size())));
+}
+
+/** @brief The number of steps needed so no step is longer than the longest valid segment length */
+long getStepCount(const Eigen::VectorXd& start, const Eigen::VectorXd& end, double longest_valid_segment_length)
+{
+  if (longest_valid_segment_length <= 0)
+    return 1;
+
+  const double dist = (end - start).unaryExpr([](double v) { return std::isnan(v) ? 0.0 : v; }).norm();
+  return std::max(1L, static_cast<long>(std::ceil(dist / longest_valid_segment_length)));
+}
+
+void updateMinimumDistance(ContactResultTimelineEntry& entry, const tesseract::collision::ContactResultMap& results)
+{
+  for (const auto& pair : results)
+  {
+    for (const auto& result : pair.second)
+      entry.min_distance = std::min(entry.min_distance, result.distance);
+  }
+}
+
+void checkDiscrete(ScanWorker& worker,
+                   ContactResultTimelineEntry& entry,
+                   const std::vector<std::string>& joint_names,
+                   const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                   const tesseract::collision::CollisionCheckConfig& config,
+                   bool lvs)
+{
+  const auto row = static_cast<Eigen::Index>(entry.index);
+  const Eigen::VectorXd start = positions.row(row).transpose();
+  Eigen::VectorXd end = start;
+  if (lvs && row + 1 < positions.rows())
+    end = positions.row(row + 1).transpose();
+
+  // The end state is checked as the start of the next entry
+  const long steps = (lvs) ? getStepCount(start, end, config.longest_valid_segment_length) : 1;
+  tesseract::collision::ContactResultMap results;
+  for (long s = 0; s < steps; ++s)
+  {
+    const Eigen::VectorXd values = start + (end - start) * (static_cast<double>(s) / static_cast<double>(steps));
+    tesseract::scene_graph::SceneState state = getState(*worker.state_solver, joint_names, values);
+    worker.discrete_manager->setCollisionObjectsTransform(state.link_transforms);
+    worker.discrete_manager->contactTest(results, config.contact_request);
+  }
+
+  updateMinimumDistance(entry, results);
+  entry.contacts = convert(results);
+}
+
+void checkContinuous(ScanWorker& worker,
+                     ContactResultTimelineEntry& entry,
+                     const std::vector<std::string>& joint_names,
+                     const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                     const tesseract::collision::CollisionCheckConfig& config,
+                     bool lvs)
+{
+  const auto row = static_cast<Eigen::Index>(entry.index);
+  const Eigen::VectorXd start = positions.row(row).transpose();
+  const Eigen::VectorXd end = positions.row(row + 1).transpose();
+
+  const long steps = (lvs) ? getStepCount(start, end, config.longest_valid_segment_length) : 1;
+  tesseract::collision::ContactResultMap results;
+  tesseract::scene_graph::SceneState state0 = getState(*worker.state_solver, joint_names, start);
+  for (long s = 1; s <= steps; ++s)
+  {
+    const Eigen::VectorXd values = start + (end - start) * (static_cast<double>(s) / static_cast<double>(steps));
+    tesseract::scene_graph::SceneState state1 = getState(*worker.state_solver, joint_names, values);
+
+    // Static links are placed at the start state, active links are swept from the start to the end state
+    worker.continuous_manager->setCollisionObjectsTransform(state0.link_transforms);
+    for (const auto& link_name : worker.active_links)
+    {
+      worker.continuous_manager->setCollisionObjectsTransform(
+          link_name, state0.link_transforms[link_name], state1.link_transforms[link_name]);
+    }
+    worker.continuous_manager->contactTest(results, config.contact_request);
+    state0 = std::move(state1);
+  }
+
+  updateMinimumDistance(entry, results);
+  entry.contacts = convert(results);
+}
+}  // namespace
+
+ContactResultTimeline scanTrajectoryContacts(const tesseract::environment::Environment& env,
+                                             const std::vector<std::string>& joint_names,
+                                             const Eigen::Ref<const Eigen::VectorXd>& time,
+                                             const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                                             const TrajectoryContactScanConfig& config,
+                                             const TrajectoryContactScanCallback& callback)
+{
+  if (positions.cols() != static_cast<Eigen::Index>(joint_names.size()) || positions.rows() != time.size())
+    throw std::runtime_error("scanTrajectoryContacts: trajectory dimensions do not match the joint names");
+
+  using tesseract::collision::CollisionEvaluatorType;
+  const CollisionEvaluatorType type = config.collision_check_config.type;
+  const bool continuous =
+      (type == CollisionEvaluatorType::CONTINUOUS || type == CollisionEvaluatorType::LVS_CONTINUOUS);
+  const bool lvs = (type == CollisionEvaluatorType::LVS_DISCRETE || type == CollisionEvaluatorType::LVS_CONTINUOUS);
+
+  const auto state_count = static_cast<std::size_t>(positions.rows());
+  const std::size_t total = (continuous) ? std::max<std::size_t>(state_count, 1) - 1 : state_count;
+  ContactResultTimeline timeline(total);
+  for (std::size_t i = 0; i < total; ++i)
+  {
+    timeline[i].index = i;
+    timeline[i].time = time(static_cast<Eigen::Index>(i));
+  }
+
+  if (total == 0)
+    return timeline;
+
+  const std::size_t thread_count = getBatchThreadCount(config.thread_count, total, config.batch_size);
+
+  // Clone the managers up front, the environment is only read from here on
+  std::vector<ScanWorker> workers(thread_count);
+  for (auto& worker : workers)
+  {
+    if (continuous)
+    {
+      worker.continuous_manager = env.getContinuousContactManager();
+      if (worker.continuous_manager == nullptr)
+        throw std::runtime_error("scanTrajectoryContacts: environment does not have a continuous contact manager");
+
+      worker.continuous_manager->applyContactManagerConfig(config.contact_manager_config);
+      worker.active_links = worker.continuous_manager->getActiveCollisionObjects();
+    }
+    else
+    {
+      worker.discrete_manager = env.getDiscreteContactManager();
+      if (worker.discrete_manager == nullptr)
+        throw std::runtime_error("scanTrajectoryContacts: environment does not have a discrete contact manager");
+
+      worker.discrete_manager->applyContactManagerConfig(config.contact_manager_config);
+    }
+    worker.state_solver = env.getStateSolver();
+  }
+
+  auto process = [&](std::size_t worker, std::size_t i) {
+    if (continuous)
+      checkContinuous(workers[worker], timeline[i], joint_names, positions, config.collision_check_config, lvs);
+    else
+      checkDiscrete(workers[worker], timeline[i], joint_names, positions, config.collision_check_config, lvs);
+  };
+
+  std::function<bool(std::size_t, std::size_t, std::size_t)> completed;
+  if (callback)
+  {
+    completed = [&](std::size_t begin, std::size_t end, std::size_t checked) {
+      const ContactResultTimeline batch(timeline.begin() + static_cast<long>(begin),
+                                        timeline.begin() + static_cast<long>(end));
+      return callback(batch, checked, total);
+    };
+  }
+
+  if (!runParallelBatches(total, config.batch_size, thread_count, process, completed))
+    return {};
+
+  return timeline;
+}
+}  // namespace tesseract::gui
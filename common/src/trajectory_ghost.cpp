@@ -0,0 +1,181 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/trajectory_ghost.h>
+#include <tesseract_qt/common/parallel_batches.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/state_solver/state_solver.h>
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/scene_graph/joint.h>
+#include <tesseract/scene_graph/link.h>
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+
+namespace tesseract::gui
+{
+namespace
+{
+tesseract::scene_graph::SceneState getState(const tesseract::scene_graph::StateSolver& state_solver,
+                                            const std::vector<std::string>& joint_names,
+                                            const Eigen::VectorXd& values)
+{
+  if (!values.hasNaN())
+    return state_solver.getState(joint_names, values);
+
+  // Joints missing from a concatenated trajectory are stored as NaN, leave them at the current state
+  std::vector<std::string> names;
+  Eigen::VectorXd filtered(values.size());
+  for (Eigen::Index i = 0; i < values.size(); ++i)
+  {
+    if (std::isnan(values(i)))
+      continue;
+
+    filtered(static_cast<Eigen::Index>(names.size())) = values(i);
+    names.push_back(joint_names[static_cast<std::size_t>(i)]);
+  }
+  return state_solver.getState(names, filtered.head(static_cast<Eigen::Index>(names.size())));
+}
+
+/** @brief Get the rows of the sampled states, evenly spaced in time or by index if the trajectory has no duration */
+std::vector<std::size_t> getSampleRows(const Eigen::Ref<const Eigen::VectorXd>& time, std::size_t sample_count)
+{
+  const auto state_count = static_cast<std::size_t>(time.size());
+  const std::size_t count = std::min(std::max<std::size_t>(sample_count, 1), state_count);
+  std::vector<std::size_t> rows;
+  rows.reserve(count);
+  if (count == 1)
+  {
+    rows.push_back(0);
+    return rows;
+  }
+
+  const double begin = time(0);
+  const double duration = time(time.size() - 1) - begin;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const double fraction = static_cast<double>(i) / static_cast<double>(count - 1);
+    std::size_t row = std::lround(fraction * static_cast<double>(state_count - 1));
+    if (duration > 0)
+    {
+      const double* it = std::lower_bound(time.data(), time.data() + time.size(), begin + (fraction * duration));
+      row = std::min(static_cast<std::size_t>(it - time.data()), state_count - 1);
+    }
+
+    if (rows.empty() || rows.back() != row)
+      rows.push_back(row);
+  }
+  return rows;
+}
+}  // namespace
+
+TrajectoryGhost computeTrajectoryGhost(const tesseract::environment::Environment& env,
+                                       const std::vector<std::string>& joint_names,
+                                       const Eigen::Ref<const Eigen::VectorXd>& time,
+                                       const Eigen::Ref<const Eigen::MatrixXd>& positions,
+                                       const TrajectoryGhostConfig& config,
+                                       const TrajectoryGhostCallback& callback)
+{
+  if (positions.cols() != static_cast<Eigen::Index>(joint_names.size()) || positions.rows() != time.size())
+    throw std::runtime_error("computeTrajectoryGhost: trajectory dimensions do not match the joint names");
+
+  TrajectoryGhost ghost;
+  const auto total = static_cast<std::size_t>(positions.rows());
+  if (total == 0 || joint_names.empty())
+    return ghost;
+
+  // The links moved by the trajectory, only the ones with visuals are shown
+  auto scene_graph = env.getSceneGraph();
+  std::vector<std::string> link_names;
+  for (const auto& link_name : scene_graph->getJointChildrenNames(joint_names))
+  {
+    auto link = scene_graph->getLink(link_name);
+    if (link != nullptr && !link->visual.empty())
+    {
+      ghost.links.push_back(link);
+      link_names.push_back(link_name);
+    }
+  }
+
+  ghost.tcp_link = config.tcp_link;
+  if (ghost.tcp_link.empty())
+  {
+    auto joint = scene_graph->getJoint(joint_names.back());
+    if (joint != nullptr)
+      ghost.tcp_link = joint->child_link_name;
+  }
+
+  if (ghost.tcp_link.empty() || scene_graph->getLink(ghost.tcp_link) == nullptr)
+    throw std::runtime_error("computeTrajectoryGhost: tcp link '" + ghost.tcp_link + "' does not exist");
+
+  // Map the rows of the sampled states to their sample index
+  const std::vector<std::size_t> sample_rows = getSampleRows(time, config.sample_count);
+  std::vector<long> row_samples(total, -1);
+  for (std::size_t i = 0; i < sample_rows.size(); ++i)
+  {
+    row_samples[sample_rows[i]] = static_cast<long>(i);
+    ghost.times.push_back(time(static_cast<Eigen::Index>(sample_rows[i])));
+  }
+  ghost.link_transforms.resize(sample_rows.size());
+  ghost.tcp_path.resize(total);
+
+  const std::size_t thread_count = getBatchThreadCount(config.thread_count, total, config.batch_size);
+
+  // Clone the state solvers up front, the environment is only read from here on
+  std::vector<std::unique_ptr<tesseract::scene_graph::StateSolver>> state_solvers(thread_count);
+  for (auto& state_solver : state_solvers)
+    state_solver = env.getStateSolver();
+
+  auto process = [&](std::size_t worker, std::size_t i) {
+    const Eigen::VectorXd values = positions.row(static_cast<Eigen::Index>(i)).transpose();
+    const tesseract::scene_graph::SceneState state = getState(*state_solvers[worker], joint_names, values);
+    ghost.tcp_path[i] = state.link_transforms.at(ghost.tcp_link).translation();
+
+    // Every sample is written by exactly one worker
+    if (row_samples[i] >= 0)
+    {
+      auto& transforms = ghost.link_transforms[static_cast<std::size_t>(row_samples[i])];
+      transforms.reserve(link_names.size());
+      for (const auto& link_name : link_names)
+        transforms.push_back(state.link_transforms.at(link_name));
+    }
+  };
+
+  std::function<bool(std::size_t, std::size_t, std::size_t)> completed;
+  if (callback)
+  {
+    completed = [&](std::size_t /*begin*/, std::size_t /*end*/, std::size_t computed) {
+      return callback(computed, total);
+    };
+  }
+
+  if (!runParallelBatches(total, config.batch_size, thread_count, process, completed))
+    return {};
+
+  return ghost;
+}
+}  // namespace tesseract::gui
@@ -24,6 +24,9 @@
 #include <tesseract_qt/common/utils.h>
 
 #include <tesseract/common/utils.h>
+#include <tesseract/environment/commands.h>
+#include <tesseract/environment/cereal_serialization.h>
+#include <cereal/archives/binary.hpp>
 #include <boost/algorithm/string.hpp>
 #include <graphviz/gvc.h>
 
@@ -34,9 +37,27 @@
 #include <QApplication>
 
 #include <fstream>
+#include <sstream>
 
 namespace tesseract::gui
 {
+namespace
+{
+/** @brief FNV-1a, chosen so fingerprints are stable between runs unlike std::hash */
+std::uint64_t hashBytes(const std::string& bytes, std::uint64_t seed)
+{
+  constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+  constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+  std::uint64_t hash = fnv_offset ^ seed;
+  for (const char c : bytes)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= fnv_prime;
+  }
+  return hash;
+}
+}  // namespace
+
 std::vector<std::string> getNamespaces(const std::string& namespace_str, const std::string& separator)
 {
   std::vector<std::string> namespaces;
@@ -133,4 +154,21 @@ QAction* getMainWindowMenuAction(QMenu* menu, const QString& text)
   return nullptr;
 }
 
+std::uint64_t
+getCommandsFingerprint(const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands,
+                       std::uint64_t seed)
+{
+  std::uint64_t hash = seed;
+  std::ostringstream os;
+  for (const auto& command : commands)
+  {
+    os.str(std::string());
+    {
+      cereal::BinaryOutputArchive ar(os);
+      ar(command);
+    }
+    hash = hashBytes(os.str(), hash);
+  }
+  return hash;
+}
 }  // namespace tesseract::gui
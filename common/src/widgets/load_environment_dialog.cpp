@@ -23,12 +23,12 @@
 #include <tesseract_qt/common/widgets/load_environment_dialog.h>
 #include "ui_load_environment_dialog.h"
 
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+#include <tesseract_qt/common/background_loader.h>
 #include <tesseract_qt/common/component_info.h>
-#include <tesseract_qt/common/environment_manager.h>
-#include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/environment_loader.h>
 
 #include <tesseract/common/resource_locator.h>
-#include <tesseract/environment/environment.h>
 
 #include <QMessageBox>
 
@@ -38,6 +38,10 @@ struct LoadEnvironmentDialog::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
   tesseract::common::ResourceLocator::Ptr resource_locator;
+
+  /** @brief Parses the files and initializes the environment on a worker thread */
+  std::unique_ptr<BackgroundLoader> loader;
+  std::unique_ptr<LoaderProgressDialog> loader_dialog;
 };
 
 LoadEnvironmentDialog::LoadEnvironmentDialog(QWidget* parent) : LoadEnvironmentDialog(nullptr, parent) {}
@@ -52,8 +56,22 @@ LoadEnvironmentDialog::LoadEnvironmentDialog(std::shared_ptr<const ComponentInfo
 
   data_->component_info = std::move(component_info);
   data_->resource_locator = std::make_shared<tesseract::common::GeneralResourceLocator>();
+  data_->loader = std::make_unique<BackgroundLoader>();
+  data_->loader_dialog = std::make_unique<LoaderProgressDialog>(data_->loader.get(), this);
 
   connect(ui_->button_box, SIGNAL(accepted()), this, SLOT(onAccepted()));
+  connect(data_->loader.get(),
+          &BackgroundLoader::finished,
+          this,
+          [this](const QString& /*name*/, bool success, const QString& /*message*/) {
+            if (success || data_->loader_dialog->wasCanceled())
+              return;
+
+            QMessageBox messageBox;
+            messageBox.critical(0, "Error", "Failed to load environment!");
+            messageBox.setFixedSize(500, 200);
+            messageBox.show();
+          });
 }
 
 LoadEnvironmentDialog::~LoadEnvironmentDialog() = default;
@@ -69,34 +87,14 @@ void LoadEnvironmentDialog::onAccepted()
   std::filesystem::path srdf_filepath(ui_->load_widget->getSRDFFilePath().toStdString());
   bool urdf_filepath_exists = std::filesystem::exists(urdf_filepath);
   bool srdf_filepath_exists = std::filesystem::exists(srdf_filepath);
-  if (urdf_filepath_exists && srdf_filepath_exists)
-  {
-    auto env = std::make_shared<tesseract::environment::Environment>();
-    if (!env->init(urdf_filepath, srdf_filepath, data_->resource_locator) || !env->isInitialized())
-    {
-      QMessageBox messageBox;
-      messageBox.critical(0, "Error", "Failed to load environment!");
-      messageBox.setFixedSize(500, 200);
-      messageBox.show();
-      return;
-    }
-    auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(data_->component_info, env);
-    EnvironmentManager::set(env_wrapper);
-  }
+  if (!urdf_filepath_exists)
+    return;
 
-  if (urdf_filepath_exists && !srdf_filepath_exists)
-  {
-    auto env = std::make_shared<tesseract::environment::Environment>();
-    if (!env->init(urdf_filepath, data_->resource_locator) || !env->isInitialized())
-    {
-      QMessageBox messageBox;
-      messageBox.critical(0, "Error", "Failed to load environment!");
-      messageBox.setFixedSize(500, 200);
-      messageBox.show();
-      return;
-    }
-    auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(data_->component_info, env);
-    EnvironmentManager::set(env_wrapper);
-  }
+  // Parsing and mesh loading can take a while for large cells so it is done on a worker thread
+  loadEnvironmentAsync(*data_->loader,
+                       data_->component_info,
+                       urdf_filepath,
+                       (srdf_filepath_exists) ? srdf_filepath : std::filesystem::path(),
+                       data_->resource_locator);
 }
 }  // namespace tesseract::gui
@@ -0,0 +1,89 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+#include <tesseract_qt/common/background_loader.h>
+#include <tesseract_qt/common/events/status_log_events.h>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+LoaderProgressDialog::LoaderProgressDialog(BackgroundLoader* loader, QWidget* parent)
+  : QProgressDialog(parent), loader_(loader)
+{
+  setWindowTitle("Loading");
+  setWindowModality(Qt::NonModal);
+  setAutoClose(false);
+  setAutoReset(false);
+  setMinimumDuration(500);
+  setRange(0, 100);
+  reset();
+
+  connect(loader_, &BackgroundLoader::started, this, &LoaderProgressDialog::onStarted);
+  connect(loader_, &BackgroundLoader::progress, this, &LoaderProgressDialog::onProgress);
+  connect(loader_, &BackgroundLoader::finished, this, &LoaderProgressDialog::onFinished);
+  connect(this, &QProgressDialog::canceled, loader_, &BackgroundLoader::cancel);
+}
+
+void LoaderProgressDialog::onStarted(const QString& name)
+{
+  setLabelText(QString("Loading %1").arg(name));
+  setRange(0, 100);
+  setValue(0);
+}
+
+void LoaderProgressDialog::onProgress(const QString& name, int value, const QString& text)
+{
+  setLabelText(text.isEmpty() ? QString("Loading %1").arg(name) : QString("%1: %2").arg(name, text));
+
+  // A busy indicator is shown while the progress is unknown
+  if (value < 0)
+  {
+    setRange(0, 0);
+    setValue(0);
+  }
+  else
+  {
+    setRange(0, 100);
+    setValue(value);
+  }
+}
+
+void LoaderProgressDialog::onFinished(const QString& name, bool success, const QString& message)
+{
+  // Jobs are also canceled by their owner when superseded, which is not a failure
+  if (!success && !wasCanceled() && message != BackgroundLoader::canceledMessage())
+  {
+    QString text = QString("Failed to load '%1'").arg(name);
+    if (!message.isEmpty())
+      text += QString(": %1").arg(message);
+
+    events::StatusLogError event(text);
+    QApplication::sendEvent(qApp, &event);
+  }
+
+  if (!loader_->isBusy())
+    reset();
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,208 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/common/widgets/trace_widget.h>
+#include <tesseract_qt/common/tracing.h>
+
+#include <algorithm>
+#include <cstring>
+#include <QCheckBox>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPainter>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief The zone measuring a complete frame of a render widget */
+const char* const FRAME_ZONE_NAME = "RenderWidget::paintGL";
+
+/** @brief The number of frames shown in the frame time chart */
+const std::size_t FRAME_COUNT{ 240 };
+
+/** @brief A bar chart of the most recent frame times */
+class FrameTimeChart : public QWidget
+{
+public:
+  explicit FrameTimeChart(QWidget* parent = nullptr) : QWidget(parent) { setMinimumHeight(80); }
+
+  void setFrameTimes(std::vector<double> frame_times)
+  {
+    frame_times_ = std::move(frame_times);
+    update();
+  }
+
+protected:
+  void paintEvent(QPaintEvent* /*event*/) override
+  {
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+
+    // Scale to at least 33 ms so a steady 60 Hz is drawn at half height
+    double max_frame_time{ 1000.0 / 30.0 };
+    for (double frame_time : frame_times_)
+      max_frame_time = std::max(max_frame_time, frame_time);
+
+    const double bar_width = static_cast<double>(width()) / static_cast<double>(FRAME_COUNT);
+    const double offset = static_cast<double>(FRAME_COUNT - frame_times_.size()) * bar_width;
+    for (std::size_t i = 0; i < frame_times_.size(); ++i)
+    {
+      const double bar_height = (frame_times_[i] / max_frame_time) * height();
+      const QColor color = (frame_times_[i] > 1000.0 / 60.0) ? QColor(220, 80, 60) : QColor(80, 170, 90);
+      painter.fillRect(QRectF(offset + (static_cast<double>(i) * bar_width), height() - bar_height,
+                              std::max(bar_width - 1.0, 1.0), bar_height),
+                       color);
+    }
+
+    const double budget = height() - ((1000.0 / 60.0) / max_frame_time) * height();
+    painter.setPen(QPen(palette().text().color(), 1, Qt::DashLine));
+    painter.drawLine(QPointF(0, budget), QPointF(width(), budget));
+    painter.drawText(rect().adjusted(4, 2, -4, -2), Qt::AlignTop | Qt::AlignLeft,
+                     QString("Frame time (max %1 ms)").arg(max_frame_time, 0, 'f', 1));
+  }
+
+private:
+  std::vector<double> frame_times_;
+};
+}  // namespace
+
+struct TraceWidget::Implementation
+{
+  QCheckBox* enabled{ nullptr };
+  QTableWidget* table{ nullptr };
+  FrameTimeChart* chart{ nullptr };
+  QTimer timer;
+};
+
+TraceWidget::TraceWidget(QWidget* parent) : QWidget(parent), data_(std::make_unique<Implementation>())
+{
+  auto* layout = new QVBoxLayout(this);
+  layout->setContentsMargins(0, 0, 0, 0);
+
+  if (!Tracer::isAvailable())
+  {
+    auto* label = new QLabel("Tracing is not available, configure with TESSERACT_QT_ENABLE_TRACING=ON.", this);
+    label->setWordWrap(true);
+    layout->addWidget(label);
+  }
+
+  auto* tool_bar = new QHBoxLayout();
+  data_->enabled = new QCheckBox("Enable", this);
+  data_->enabled->setEnabled(Tracer::isAvailable());
+  data_->enabled->setChecked(Tracer::isEnabled());
+  auto* clear_button = new QPushButton("Clear", this);
+  auto* export_button = new QPushButton("Export", this);
+  export_button->setToolTip("Export the collected zones to a Chrome trace file");
+  tool_bar->addWidget(data_->enabled);
+  tool_bar->addStretch();
+  tool_bar->addWidget(clear_button);
+  tool_bar->addWidget(export_button);
+  layout->addLayout(tool_bar);
+
+  data_->chart = new FrameTimeChart(this);
+  layout->addWidget(data_->chart);
+
+  data_->table = new QTableWidget(0, 6, this);
+  data_->table->setHorizontalHeaderLabels({ "Zone", "Count", "Mean (ms)", "p50 (ms)", "p99 (ms)", "Max (ms)" });
+  data_->table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+  data_->table->verticalHeader()->setVisible(false);
+  data_->table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  data_->table->setSelectionBehavior(QAbstractItemView::SelectRows);
+  layout->addWidget(data_->table);
+
+  connect(data_->enabled, &QCheckBox::toggled, this, &TraceWidget::setTracingEnabled);
+  connect(clear_button, &QPushButton::clicked, this, &TraceWidget::clear);
+  connect(export_button, &QPushButton::clicked, this, &TraceWidget::exportChromeTrace);
+  connect(&data_->timer, &QTimer::timeout, this, &TraceWidget::refresh);
+  data_->timer.start(1000);
+}
+
+TraceWidget::~TraceWidget() = default;
+
+void TraceWidget::setTracingEnabled(bool enabled)
+{
+  Tracer::setEnabled(enabled);
+  if (data_->enabled->isChecked() != enabled)
+    data_->enabled->setChecked(enabled);
+}
+
+void TraceWidget::refresh()
+{
+  // Skip the work while hidden or when nothing is being recorded
+  if (!isVisible() || !Tracer::isEnabled())
+    return;
+
+  const std::vector<TraceRecord> records = Tracer::collect();
+
+  std::vector<double> frame_times;
+  for (auto it = records.rbegin(); it != records.rend() && frame_times.size() < FRAME_COUNT; ++it)
+  {
+    if (std::strcmp(it->name, FRAME_ZONE_NAME) == 0)
+      frame_times.push_back(static_cast<double>(it->duration) / 1.0e6);
+  }
+  std::reverse(frame_times.begin(), frame_times.end());
+  data_->chart->setFrameTimes(std::move(frame_times));
+
+  const std::vector<TraceStatistics> statistics = Tracer::computeStatistics(records);
+  data_->table->setRowCount(static_cast<int>(statistics.size()));
+  for (std::size_t i = 0; i < statistics.size(); ++i)
+  {
+    const TraceStatistics& s = statistics[i];
+    const auto row = static_cast<int>(i);
+    data_->table->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(s.name)));
+    data_->table->setItem(row, 1, new QTableWidgetItem(QString::number(s.count)));
+    data_->table->setItem(row, 2, new QTableWidgetItem(QString::number(s.mean, 'f', 3)));
+    data_->table->setItem(row, 3, new QTableWidgetItem(QString::number(s.p50, 'f', 3)));
+    data_->table->setItem(row, 4, new QTableWidgetItem(QString::number(s.p99, 'f', 3)));
+    data_->table->setItem(row, 5, new QTableWidgetItem(QString::number(s.max, 'f', 3)));
+  }
+}
+
+void TraceWidget::clear()
+{
+  Tracer::clear();
+  data_->table->setRowCount(0);
+  data_->chart->setFrameTimes({});
+}
+
+void TraceWidget::exportChromeTrace()
+{
+  QString file_path = QFileDialog::getSaveFileName(this, "Export Trace", "", "Chrome Trace (*.json)");
+  if (file_path.isEmpty())
+    return;
+
+  if (!file_path.endsWith(".json"))
+    file_path.append(".json");
+
+  if (!Tracer::saveChromeTrace(file_path.toStdString()))
+    QMessageBox::warning(this, "Export Trace", QString("Failed to write %1").arg(file_path));
+}
+}  // namespace tesseract::gui
@@ -48,13 +48,32 @@ public:
 
   const std::vector<std::shared_ptr<const tesseract::environment::Command>>& getCommands() const;
 
+  // Documentation inherited
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  // Documentation inherited
+  bool canFetchMore(const QModelIndex& parent) const override;
+
+  // Documentation inherited
+  void fetchMore(const QModelIndex& parent) override;
+
 private:
   std::shared_ptr<const ComponentInfo> component_info_;
 
   EnvironmentCommandsStandardItem* getRoot();
   const EnvironmentCommandsStandardItem* getRoot() const;
 
+  /**
+   * @brief Set the command history
+   * @details If the current history is a prefix of the new one only the new commands are appended
+   */
   void set(const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands);
+
+  /**
+   * @brief Append commands applied on top of the given revision
+   * @details Commands already in the model are skipped and a gap in the history resyncs it from the environment
+   */
+  void append(const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands, int start_revision);
   void appendCommand(const std::shared_ptr<const tesseract::environment::Command>& command);
   void clear();
 
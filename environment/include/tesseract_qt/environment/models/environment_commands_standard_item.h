@@ -30,19 +30,51 @@
 
 namespace tesseract::gui
 {
+/**
+ * @brief Item representing a single command whose detail items are created on demand through fetchMore()
+ * @details Commands like add link or add scene graph copy and expand their content when their item is created, so a
+ * long command history only creates the detail items of the commands which are expanded.
+ */
+class EnvironmentCommandEntryStandardItem : public QStandardItem
+{
+public:
+  EnvironmentCommandEntryStandardItem(const QString& text,
+                                      std::shared_ptr<const tesseract::environment::Command> command);
+  int type() const override;
+
+  /** @brief Check if the detail items have not been created yet */
+  bool canFetchMore() const;
+
+  /** @brief Create the detail items of the command */
+  void fetchMore();
+
+  std::shared_ptr<const tesseract::environment::Command> command;
+
+private:
+  bool fetched_{ false };
+};
+
 class EnvironmentCommandsStandardItem : public QStandardItem
 {
 public:
   EnvironmentCommandsStandardItem();
+  /**
+   * @param commands The command history
+   * @param lazy If true the detail items of each command are only created when fetched, which requires a model that
+   * calls EnvironmentCommandEntryStandardItem::fetchMore()
+   */
   explicit EnvironmentCommandsStandardItem(
-      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands);
+      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+      bool lazy = false);
   explicit EnvironmentCommandsStandardItem(
       const QString& text,
-      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands);
+      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+      bool lazy = false);
   explicit EnvironmentCommandsStandardItem(
       const QIcon& icon,
       const QString& text,
-      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands);
+      std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+      bool lazy = false);
   int type() const override;
 
   void appendCommand(const std::shared_ptr<const tesseract::environment::Command>& command);
@@ -50,6 +82,7 @@ public:
 
 private:
   std::vector<std::shared_ptr<const tesseract::environment::Command>> commands_;
+  bool lazy_{ false };
 
   void addCommand(const QString& text, const std::shared_ptr<const tesseract::environment::Command>& command);
   void ctor();
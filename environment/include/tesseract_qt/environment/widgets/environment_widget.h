@@ -52,11 +52,22 @@ public:
   void setComponentInfo(std::shared_ptr<const ComponentInfo> component_info);
   std::shared_ptr<const ComponentInfo> getComponentInfo() const;
 
+  /**
+   * @brief Suspend the model updates, for example while the widget is hidden
+   * @details The models of the tabs which are not current are also suspended. Suspended models only keep the latest
+   * data received and catch up once resumed.
+   * @param suspended True to suspend, false to resume
+   */
+  void setSuspended(bool suspended);
+  bool isSuspended() const;
+
 private:
   struct Implementation;
   std::unique_ptr<Ui::EnvironmentWidget> ui;
   std::unique_ptr<Implementation> data_;
 
+  void updateSuspended();
+
   //  void updateModels();
 };
 }  // namespace tesseract::gui
@@ -33,6 +33,8 @@
 
 #include <QApplication>
 
+#include <algorithm>
+
 namespace tesseract::gui
 {
 EnvironmentCommandsModel::EnvironmentCommandsModel(QObject* parent) : EnvironmentCommandsModel(nullptr, parent) {}
@@ -70,15 +72,49 @@ void EnvironmentCommandsModel::clear()
   QStandardItemModel::clear();
   setColumnCount(2);
   setHorizontalHeaderLabels({ "Name", "Values" });
-  appendRow(new EnvironmentCommandsStandardItem());
+  appendRow(new EnvironmentCommandsStandardItem({}, true));
 }
 
 void EnvironmentCommandsModel::set(const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands)
 {
+  // Most updates only add commands to the end of the history so keep the existing rows when possible
+  const auto& current = getRoot()->getCommands();
+  if (current.size() <= commands.size() && std::equal(current.begin(), current.end(), commands.begin()))
+  {
+    for (std::size_t i = current.size(); i < commands.size(); ++i)
+      appendCommand(commands[i]);
+
+    return;
+  }
+
   QStandardItemModel::clear();
   setColumnCount(2);
   setHorizontalHeaderLabels({ "Name", "Values" });
-  appendRow(new EnvironmentCommandsStandardItem(commands));
+  appendRow(new EnvironmentCommandsStandardItem(commands, true));
+}
+
+void EnvironmentCommandsModel::append(
+    const std::vector<std::shared_ptr<const tesseract::environment::Command>>& commands,
+    int start_revision)
+{
+  const auto current_revision = static_cast<int>(getRoot()->getCommands().size());
+  if (start_revision < 0)
+    start_revision = current_revision;
+
+  if (start_revision > current_revision)
+  {
+    // Commands were missed so get the full history
+    auto env_wrapper = EnvironmentManager::get(component_info_);
+    if (env_wrapper != nullptr && env_wrapper->getEnvironment()->isInitialized())
+      set(env_wrapper->getEnvironment()->getCommandHistory());
+
+    return;
+  }
+
+  // Skip the commands the model already has, for example from a set received after they were applied
+  const auto skip = static_cast<std::size_t>(current_revision - start_revision);
+  for (std::size_t i = skip; i < commands.size(); ++i)
+    appendCommand(commands[i]);
 }
 
 void EnvironmentCommandsModel::appendCommand(const std::shared_ptr<const tesseract::environment::Command>& command)
@@ -91,6 +127,32 @@ const std::vector<std::shared_ptr<const tesseract::environment::Command>>& Envir
   return getRoot()->getCommands();
 }
 
+bool EnvironmentCommandsModel::hasChildren(const QModelIndex& parent) const
+{
+  if (canFetchMore(parent))
+    return true;
+
+  return QStandardItemModel::hasChildren(parent);
+}
+
+bool EnvironmentCommandsModel::canFetchMore(const QModelIndex& parent) const
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::ENV_COMMAND_ENTRY))
+    return false;
+
+  return static_cast<EnvironmentCommandEntryStandardItem*>(item)->canFetchMore();
+}
+
+void EnvironmentCommandsModel::fetchMore(const QModelIndex& parent)
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::ENV_COMMAND_ENTRY))
+    return;
+
+  static_cast<EnvironmentCommandEntryStandardItem*>(item)->fetchMore();
+}
+
 EnvironmentCommandsStandardItem* EnvironmentCommandsModel::getRoot()
 {
   return dynamic_cast<EnvironmentCommandsStandardItem*>(item(0));
@@ -115,10 +177,7 @@ bool EnvironmentCommandsModel::eventFilter(QObject* obj, QEvent* event)
     assert(dynamic_cast<events::EnvironmentCommandsAppend*>(event) != nullptr);
     auto* e = static_cast<events::EnvironmentCommandsAppend*>(event);
     if (e->getComponentInfo() == component_info_)
-    {
-      for (const auto& command : e->getCommands())
-        appendCommand(command);
-    }
+      append(e->getCommands(), e->getStartRevision());
   }
 
   // Standard event processing
@@ -50,209 +50,277 @@
 
 namespace tesseract::gui
 {
-EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem() : QStandardItem(icons::getCubeIcon(), "Commands")
-{
-  ctor();
-}
-
-EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
-    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands)
-  : QStandardItem(icons::getCubeIcon(), "Commands"), commands_(std::move(commands))
-{
-  ctor();
-}
-
-EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
-    const QString& text,
-    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands)
-  : QStandardItem(icons::getCubeIcon(), text), commands_(std::move(commands))
-{
-  ctor();
-}
-
-EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
-    const QIcon& icon,
-    const QString& text,
-    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands)
-  : QStandardItem(icon, text), commands_(std::move(commands))
-{
-  ctor();
-}
-
-int EnvironmentCommandsStandardItem::type() const { return static_cast<int>(StandardItemType::ENV_COMMAND_COMMANDS); }
-
-void EnvironmentCommandsStandardItem::appendCommand(
-    const std::shared_ptr<const tesseract::environment::Command>& command)
-{
-  addCommand(QString("[%1]").arg(commands_.size()), command);
-  commands_.push_back(command);
-}
-
-const std::vector<std::shared_ptr<const tesseract::environment::Command>>&
-EnvironmentCommandsStandardItem::getCommands() const
+namespace
 {
-  return commands_;
-}
-
-void EnvironmentCommandsStandardItem::ctor()
+/** @brief Get the display name of the command type */
+QString getCommandTypeName(const std::shared_ptr<const tesseract::environment::Command>& command)
 {
-  for (std::size_t i = 0; i < commands_.size(); ++i)
-    addCommand(QString("[%1]").arg(i), commands_[i]);
+  switch (command->getType())
+  {
+    case tesseract::environment::CommandType::ADD_LINK:
+      return "Add Link";
+    case tesseract::environment::CommandType::MOVE_LINK:
+      return "Move Link";
+    case tesseract::environment::CommandType::MOVE_JOINT:
+      return "Move Joint";
+    case tesseract::environment::CommandType::REMOVE_LINK:
+      return "Remove Link";
+    case tesseract::environment::CommandType::REMOVE_JOINT:
+      return "Remove Joint";
+    case tesseract::environment::CommandType::REPLACE_JOINT:
+      return "Replace Joint";
+    case tesseract::environment::CommandType::CHANGE_LINK_ORIGIN:
+      return "Change Link Origin";
+    case tesseract::environment::CommandType::CHANGE_JOINT_ORIGIN:
+      return "Change Joint Origin";
+    case tesseract::environment::CommandType::CHANGE_LINK_COLLISION_ENABLED:
+      return "Change Link Collision Enabled";
+    case tesseract::environment::CommandType::CHANGE_LINK_VISIBILITY:
+      return "Change Link Visibility";
+    case tesseract::environment::CommandType::MODIFY_ALLOWED_COLLISIONS:
+      return "Modify Allowed Collisions";
+    case tesseract::environment::CommandType::REMOVE_ALLOWED_COLLISION_LINK:
+      return "Remove Allowed Collision Link";
+    case tesseract::environment::CommandType::ADD_SCENE_GRAPH:
+      return "Add Scene Graph";
+    case tesseract::environment::CommandType::CHANGE_JOINT_POSITION_LIMITS:
+      return "Change Joint Position Limits";
+    case tesseract::environment::CommandType::CHANGE_JOINT_VELOCITY_LIMITS:
+      return "Change Joint Velocity Limits";
+    case tesseract::environment::CommandType::CHANGE_JOINT_ACCELERATION_LIMITS:
+      return "Change Joint Acceleration Limits";
+    case tesseract::environment::CommandType::ADD_KINEMATICS_INFORMATION:
+      return "Add Kinematics Information";
+    case tesseract::environment::CommandType::CHANGE_COLLISION_MARGINS:
+      return "Change Collision Margins";
+    case tesseract::environment::CommandType::ADD_CONTACT_MANAGERS_PLUGIN_INFO:
+      return "Add Contact Manager Plugin Info";
+    case tesseract::environment::CommandType::SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER:
+      return "Set Active Continuous Contact Manager";
+    case tesseract::environment::CommandType::SET_ACTIVE_DISCRETE_CONTACT_MANAGER:
+      return "Set Active Discrete Contact Manager";
+    case tesseract::environment::CommandType::ADD_TRAJECTORY_LINK:
+      return "Add Trajectory Link";
+    default:
+      throw std::runtime_error("Unsupported command type!");
+  }
 }
 
-void EnvironmentCommandsStandardItem::addCommand(const QString& text,
-                                                 const std::shared_ptr<const tesseract::environment::Command>& command)
+/** @brief Create the item of a command including all of its detail items */
+QStandardItem* createCommandStandardItem(const QString& text,
+                                         const std::shared_ptr<const tesseract::environment::Command>& command)
 {
   switch (command->getType())
   {
     case tesseract::environment::CommandType::ADD_LINK:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::AddLinkCommand>(command);
-      appendRow({ new AddLinkCommandStandardItem(text, cmd), new QStandardItem("Add Link") });
-      break;
+      return new AddLinkCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::MOVE_LINK:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::MoveLinkCommand>(command);
-      appendRow({ new MoveLinkCommandStandardItem(text, cmd), new QStandardItem("Move Link") });
-      break;
+      return new MoveLinkCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::MOVE_JOINT:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::MoveJointCommand>(command);
-      appendRow({ new MoveJointCommandStandardItem(text, cmd), new QStandardItem("Move Joint") });
-      break;
+      return new MoveJointCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::REMOVE_LINK:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::RemoveLinkCommand>(command);
-      appendRow({ new RemoveLinkCommandStandardItem(text, cmd), new QStandardItem("Remove Link") });
-      break;
+      return new RemoveLinkCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::REMOVE_JOINT:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::RemoveJointCommand>(command);
-      appendRow({ new RemoveJointCommandStandardItem(text, cmd), new QStandardItem("Remove Joint") });
-      break;
+      return new RemoveJointCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::REPLACE_JOINT:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ReplaceJointCommand>(command);
-      appendRow({ new ReplaceJointCommandStandardItem(text, cmd), new QStandardItem("Replace Joint") });
-      break;
+      return new ReplaceJointCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_LINK_ORIGIN:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeLinkOriginCommand>(command);
-      appendRow({ new ChangeLinkOriginCommandStandardItem(text, cmd), new QStandardItem("Change Link Origin") });
-      break;
+      return new ChangeLinkOriginCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_JOINT_ORIGIN:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeJointOriginCommand>(command);
-      appendRow({ new ChangeJointOriginCommandStandardItem(text, cmd), new QStandardItem("Change Joint Origin") });
-      break;
+      return new ChangeJointOriginCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_LINK_COLLISION_ENABLED:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeLinkCollisionEnabledCommand>(command);
-      appendRow({ new ChangeLinkCollisionEnabledCommandStandardItem(text, cmd),
-                  new QStandardItem("Change Link Collision Enabled") });
-      break;
+      return new ChangeLinkCollisionEnabledCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_LINK_VISIBILITY:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeLinkVisibilityCommand>(command);
-      appendRow(
-          { new ChangeLinkVisibilityCommandStandardItem(text, cmd), new QStandardItem("Change Link Visibility") });
-      break;
+      return new ChangeLinkVisibilityCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::MODIFY_ALLOWED_COLLISIONS:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ModifyAllowedCollisionsCommand>(command);
-      appendRow({ new ModifyAllowedCollisionsCommandStandardItem(text, cmd),
-                  new QStandardItem("Modify Allowed Collisions") });
-      break;
+      return new ModifyAllowedCollisionsCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::REMOVE_ALLOWED_COLLISION_LINK:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::RemoveAllowedCollisionLinkCommand>(command);
-      appendRow({ new RemoveAllowedCollisionLinkCommandStandardItem(text, cmd),
-                  new QStandardItem("Remove Allowed Collision Link") });
-      break;
+      return new RemoveAllowedCollisionLinkCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::ADD_SCENE_GRAPH:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::AddSceneGraphCommand>(command);
-      appendRow({ new AddSceneGraphCommandStandardItem(text, cmd), new QStandardItem("Add Scene Graph") });
-      break;
+      return new AddSceneGraphCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_JOINT_POSITION_LIMITS:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeJointPositionLimitsCommand>(command);
-      appendRow({ new ChangeJointPositionLimitsCommandStandardItem(text, cmd),
-                  new QStandardItem("Change Joint Position Limits") });
-      break;
+      return new ChangeJointPositionLimitsCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_JOINT_VELOCITY_LIMITS:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeJointVelocityLimitsCommand>(command);
-      appendRow({ new ChangeJointVelocityLimitsCommandStandardItem(text, cmd),
-                  new QStandardItem("Change Joint Velocity Limits") });
-      break;
+      return new ChangeJointVelocityLimitsCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_JOINT_ACCELERATION_LIMITS:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeJointAccelerationLimitsCommand>(command);
-      appendRow({ new ChangeJointAccelerationLimitsCommandStandardItem(text, cmd),
-                  new QStandardItem("Change Joint Acceleration Limits") });
-      break;
+      return new ChangeJointAccelerationLimitsCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::ADD_KINEMATICS_INFORMATION:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::AddKinematicsInformationCommand>(command);
-      appendRow({ new AddKinematicsInformationCommandStandardItem(text, cmd),
-                  new QStandardItem("Add Kinematics Information") });
-      break;
+      return new AddKinematicsInformationCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::CHANGE_COLLISION_MARGINS:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::ChangeCollisionMarginsCommand>(command);
-      appendRow(
-          { new ChangeCollisionMarginsCommandStandardItem(text, cmd), new QStandardItem("Change Collision Margins") });
-      break;
+      return new ChangeCollisionMarginsCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::ADD_CONTACT_MANAGERS_PLUGIN_INFO:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::AddContactManagersPluginInfoCommand>(command);
-      appendRow({ new AddContactManagersPluginInfoCommandStandardItem(text, cmd),
-                  new QStandardItem("Add Contact Manager Plugin Info") });
-      break;
+      return new AddContactManagersPluginInfoCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER:
     {
       auto cmd =
           std::static_pointer_cast<const tesseract::environment::SetActiveContinuousContactManagerCommand>(command);
-      appendRow({ new SetActiveContinuousContactManagerCommandStandardItem(text, cmd),
-                  new QStandardItem("Set Active Continuous Contact Manager") });
-      break;
+      return new SetActiveContinuousContactManagerCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::SET_ACTIVE_DISCRETE_CONTACT_MANAGER:
     {
       auto cmd =
           std::static_pointer_cast<const tesseract::environment::SetActiveDiscreteContactManagerCommand>(command);
-      appendRow({ new SetActiveDiscreteContactManagerCommandStandardItem(text, cmd),
-                  new QStandardItem("Set Active Discrete Contact Manager") });
-      break;
+      return new SetActiveDiscreteContactManagerCommandStandardItem(text, cmd);
     }
     case tesseract::environment::CommandType::ADD_TRAJECTORY_LINK:
     {
       auto cmd = std::static_pointer_cast<const tesseract::environment::AddTrajectoryLinkCommand>(command);
-      appendRow({ new AddTrajectoryLinkCommandStandardItem(text, cmd), new QStandardItem("Add Trajectory Link") });
-      break;
+      return new AddTrajectoryLinkCommandStandardItem(text, cmd);
     }
     default:
       throw std::runtime_error("Unsupported command type!");
   }
 }
+}  // namespace
+
+EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem() : QStandardItem(icons::getCubeIcon(), "Commands")
+{
+  ctor();
+}
+
+EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
+    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+    bool lazy)
+  : QStandardItem(icons::getCubeIcon(), "Commands"), commands_(std::move(commands)), lazy_(lazy)
+{
+  ctor();
+}
+
+EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
+    const QString& text,
+    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+    bool lazy)
+  : QStandardItem(icons::getCubeIcon(), text), commands_(std::move(commands)), lazy_(lazy)
+{
+  ctor();
+}
+
+EnvironmentCommandsStandardItem::EnvironmentCommandsStandardItem(
+    const QIcon& icon,
+    const QString& text,
+    std::vector<std::shared_ptr<const tesseract::environment::Command>> commands,
+    bool lazy)
+  : QStandardItem(icon, text), commands_(std::move(commands)), lazy_(lazy)
+{
+  ctor();
+}
+
+int EnvironmentCommandsStandardItem::type() const { return static_cast<int>(StandardItemType::ENV_COMMAND_COMMANDS); }
+
+void EnvironmentCommandsStandardItem::appendCommand(
+    const std::shared_ptr<const tesseract::environment::Command>& command)
+{
+  addCommand(QString("[%1]").arg(commands_.size()), command);
+  commands_.push_back(command);
+}
+
+const std::vector<std::shared_ptr<const tesseract::environment::Command>>&
+EnvironmentCommandsStandardItem::getCommands() const
+{
+  return commands_;
+}
+
+void EnvironmentCommandsStandardItem::ctor()
+{
+  for (std::size_t i = 0; i < commands_.size(); ++i)
+    addCommand(QString("[%1]").arg(i), commands_[i]);
+}
+
+void EnvironmentCommandsStandardItem::addCommand(const QString& text,
+                                                 const std::shared_ptr<const tesseract::environment::Command>& command)
+{
+  QStandardItem* item{ nullptr };
+  if (lazy_)
+    item = new EnvironmentCommandEntryStandardItem(text, command);
+  else
+    item = createCommandStandardItem(text, command);
+
+  appendRow({ item, new QStandardItem(getCommandTypeName(command)) });
+}
+
+EnvironmentCommandEntryStandardItem::EnvironmentCommandEntryStandardItem(
+    const QString& text,
+    std::shared_ptr<const tesseract::environment::Command> command)
+  : QStandardItem(icons::getCommandEntryIcon(), text), command(std::move(command))
+{
+}
+
+int EnvironmentCommandEntryStandardItem::type() const { return static_cast<int>(StandardItemType::ENV_COMMAND_ENTRY); }
+
+bool EnvironmentCommandEntryStandardItem::canFetchMore() const { return !fetched_; }
+
+void EnvironmentCommandEntryStandardItem::fetchMore()
+{
+  if (fetched_)
+    return;
+
+  fetched_ = true;
+
+  // Build the detail item of the command and move its rows under this item
+  std::unique_ptr<QStandardItem> details(createCommandStandardItem(text(), command));
+  QList<QList<QStandardItem*>> rows;
+  rows.reserve(details->rowCount());
+  while (details->rowCount() > 0)
+    rows.append(details->takeRow(0));
+
+  for (auto& row : rows)
+    appendRow(row);
+}
 }  // namespace tesseract::gui
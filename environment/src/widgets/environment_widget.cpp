@@ -27,11 +27,17 @@
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/utils.h>
 
+#include <tesseract_qt/scene_graph/models/scene_state_model.h>
+#include <tesseract_qt/scene_graph/widgets/scene_state_widget.h>
+#include <tesseract_qt/collision/models/contact_results_model.h>
+#include <tesseract_qt/collision/widgets/contact_results_compute_widget.h>
+
 namespace tesseract::gui
 {
 struct EnvironmentWidget::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
+  bool suspended{ false };
 };
 
 EnvironmentWidget::EnvironmentWidget(QWidget* parent) : EnvironmentWidget(nullptr, parent) {}
@@ -42,6 +48,8 @@ EnvironmentWidget::EnvironmentWidget(std::shared_ptr<const ComponentInfo> compon
   ui->tab_widget->setCurrentIndex(0);
 
   setComponentInfo(std::move(component_info));
+
+  connect(ui->tab_widget, &QTabWidget::currentChanged, this, [this]() { updateSuspended(); });
 }
 
 EnvironmentWidget::~EnvironmentWidget() = default;
@@ -58,8 +66,28 @@ void EnvironmentWidget::setComponentInfo(std::shared_ptr<const ComponentInfo> co
   ui->group_tcps_widget->setComponentInfo(data_->component_info);
   ui->cmd_history_widget->setComponentInfo(data_->component_info);
   ui->contacts_widget->setComponentInfo(data_->component_info);
+
+  // The models are recreated so apply the suspended state again
+  updateSuspended();
 }
 
 std::shared_ptr<const ComponentInfo> EnvironmentWidget::getComponentInfo() const { return data_->component_info; }
 
+void EnvironmentWidget::setSuspended(bool suspended)
+{
+  data_->suspended = suspended;
+  updateSuspended();
+}
+
+bool EnvironmentWidget::isSuspended() const { return data_->suspended; }
+
+void EnvironmentWidget::updateSuspended()
+{
+  // The scene state and contact results receive the most frequent updates
+  QWidget* current_tab = ui->tab_widget->currentWidget();
+  ui->scene_state_widget->getModel()->setSuspended(data_->suspended ||
+                                                   !current_tab->isAncestorOf(ui->scene_state_widget));
+  ui->contacts_widget->getModel()->setSuspended(data_->suspended || !current_tab->isAncestorOf(ui->contacts_widget));
+}
+
 }  // namespace tesseract::gui
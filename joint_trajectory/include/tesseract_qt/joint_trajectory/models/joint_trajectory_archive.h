@@ -0,0 +1,200 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ARCHIVE_H
+#define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ARCHIVE_H
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+
+class QFile;
+
+namespace tesseract::common
+{
+class JointTrajectorySet;
+}
+
+namespace tesseract::gui
+{
+/**
+ * @brief Random access, memory mapped archive of joint trajectories
+ * @details The file (.jta) is laid out as
+ *   - header: magic, version, byte order mark and the offsets of the tables below
+ *   - data blocks: per trajectory the time column followed by the position, velocity and acceleration columns
+ *   - string table: namespaces, descriptions and joint names, each stored once
+ *   - joint list: string ids of the joint names of every trajectory
+ *   - index: namespace, description, joint list, state count, time range and data offset of every trajectory
+ *   - sets: namespace, description, initial state and trajectory range of every trajectory set
+ *
+ * Opening only reads the header, index and string table. The columns are returned as views into the mapped file so a
+ * trajectory is only paged in when it is played or plotted. The archive must outlive the views it returns.
+ * Trajectories which were not appended as part of a set, as in version 1 archives, form one set per namespace.
+ */
+class JointTrajectoryArchive
+{
+public:
+  using Ptr = std::shared_ptr<JointTrajectoryArchive>;
+  using ConstPtr = std::shared_ptr<const JointTrajectoryArchive>;
+  using ConstVectorMap = Eigen::Map<const Eigen::VectorXd>;
+  using ConstMatrixMap = Eigen::Map<const JointTrajectoryBuffer::Matrix>;
+
+  /** @brief The current version of the file format */
+  static const std::uint32_t VERSION;
+
+  /**
+   * @brief Open and map an archive
+   * @throws std::runtime_error if the file cannot be mapped or is not a valid archive
+   */
+  explicit JointTrajectoryArchive(const std::string& filename);
+  ~JointTrajectoryArchive();
+  JointTrajectoryArchive(const JointTrajectoryArchive&) = delete;
+  JointTrajectoryArchive& operator=(const JointTrajectoryArchive&) = delete;
+  JointTrajectoryArchive(JointTrajectoryArchive&&) = delete;
+  JointTrajectoryArchive& operator=(JointTrajectoryArchive&&) = delete;
+
+  /** @brief The number of trajectories */
+  std::size_t size() const;
+
+  const std::string& getNamespace(std::size_t i) const;
+  const std::string& getDescription(std::size_t i) const;
+  std::vector<std::string> getJointNames(std::size_t i) const;
+  std::size_t getStateCount(std::size_t i) const;
+  double getTimeBegin(std::size_t i) const;
+  double getTimeEnd(std::size_t i) const;
+
+  /** @brief View of the time column of trajectory i */
+  ConstVectorMap getTime(std::size_t i) const;
+
+  /** @brief View of the (states x dof) column-major values of trajectory i */
+  ConstMatrixMap getValues(std::size_t i, JointTrajectoryBuffer::Quantity quantity) const;
+
+  /** @brief The namespaces in the archive, in order of first appearance */
+  std::vector<std::string> getNamespaces() const;
+
+  /** @brief The indices of the trajectories in the namespace */
+  std::vector<std::size_t> find(const std::string& ns) const;
+
+  /** @brief The indices of the trajectories in the namespace with the description */
+  std::vector<std::size_t> find(const std::string& ns, const std::string& description) const;
+
+  /** @brief The number of trajectory sets */
+  std::size_t getSetCount() const;
+
+  const std::string& getSetNamespace(std::size_t s) const;
+  const std::string& getSetDescription(std::size_t s) const;
+  const std::unordered_map<std::string, double>& getSetInitialState(std::size_t s) const;
+
+  /** @brief The indices of the trajectories of set s, in order */
+  const std::vector<std::size_t>& getSetTrajectories(std::size_t s) const;
+
+  /** @brief Copy trajectory i into a buffer */
+  std::shared_ptr<const JointTrajectoryBuffer> getBuffer(std::size_t i) const;
+
+  /** @brief Copy trajectory i into a joint trajectory */
+  tesseract::common::JointTrajectory getJointTrajectory(std::size_t i) const;
+
+private:
+  struct Entry
+  {
+    std::uint32_t ns;
+    std::uint32_t description;
+    std::uint32_t joint_names;
+    std::uint32_t dof;
+    std::uint64_t state_count;
+    std::uint64_t data_offset;
+    double time_begin;
+    double time_end;
+  };
+
+  struct SetEntry
+  {
+    std::uint32_t ns{ 0 };
+    std::uint32_t description{ 0 };
+    std::vector<std::size_t> trajectories;
+    std::unordered_map<std::string, double> initial_state;
+  };
+
+  std::unique_ptr<QFile> file_;
+  const unsigned char* data_{ nullptr };
+  std::uint64_t data_size_{ 0 };
+
+  std::vector<std::string> strings_;
+  const std::uint32_t* joint_list_{ nullptr };
+  std::vector<Entry> entries_;
+  std::vector<SetEntry> sets_;
+  std::unordered_multimap<std::string, std::size_t> ns_index_;
+
+  const double* column(std::size_t i, std::size_t column) const;
+};
+
+/**
+ * @brief Writes a joint trajectory archive
+ * @details Trajectory data is written as it is appended, the string table and index are written by close().
+ */
+class JointTrajectoryArchiveWriter
+{
+public:
+  /** @throws std::runtime_error if the file cannot be created */
+  explicit JointTrajectoryArchiveWriter(const std::string& filename);
+  ~JointTrajectoryArchiveWriter();
+  JointTrajectoryArchiveWriter(const JointTrajectoryArchiveWriter&) = delete;
+  JointTrajectoryArchiveWriter& operator=(const JointTrajectoryArchiveWriter&) = delete;
+  JointTrajectoryArchiveWriter(JointTrajectoryArchiveWriter&&) = delete;
+  JointTrajectoryArchiveWriter& operator=(JointTrajectoryArchiveWriter&&) = delete;
+
+  /** @brief Append a trajectory */
+  void append(const std::string& ns, const std::string& description, const JointTrajectoryBuffer& trajectory);
+
+  /**
+   * @brief Append every trajectory of the set under the namespace of the set
+   * @details The description and initial state of the set are stored with it
+   * @throws std::runtime_error if the set has an environment or environment commands, which cannot be archived
+   */
+  void append(const tesseract::common::JointTrajectorySet& trajectory_set);
+
+  /**
+   * @brief Write the tables and close the file
+   * @throws std::runtime_error if writing fails
+   */
+  void close();
+
+private:
+  std::string filename_;
+  std::ofstream stream_;
+  std::vector<std::string> strings_;
+  std::unordered_map<std::string, std::uint32_t> string_ids_;
+  std::vector<std::uint32_t> joint_list_;
+  std::vector<unsigned char> index_;
+  std::vector<unsigned char> sets_;
+  std::uint64_t count_{ 0 };
+  std::uint64_t set_count_{ 0 };
+
+  std::uint32_t intern(const std::string& value);
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ARCHIVE_H
@@ -0,0 +1,130 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_BUFFER_H
+#define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_BUFFER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include <tesseract/common/fwd.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief Immutable, column-major copy of a joint trajectory
+ * @details Every quantity is stored as a (states x dof) matrix so each joint is one contiguous column which can be
+ * plotted, interpolated or displayed without further copies. The buffer is shared between the player, the plot
+ * dialog and the model through a const shared pointer.
+ */
+class JointTrajectoryBuffer
+{
+public:
+  using Ptr = std::shared_ptr<JointTrajectoryBuffer>;
+  using ConstPtr = std::shared_ptr<const JointTrajectoryBuffer>;
+  using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+  enum class Quantity
+  {
+    POSITION,
+    VELOCITY,
+    ACCELERATION
+  };
+
+  JointTrajectoryBuffer() = default;
+
+  /**
+   * @brief Create the buffer from a trajectory
+   * @details The joint names of the first state define the columns, states using a different joint order are
+   * remapped by name and missing values are set to NaN.
+   */
+  explicit JointTrajectoryBuffer(const tesseract::common::JointTrajectory& trajectory);
+
+  /**
+   * @brief Create the buffer by appending trajectories
+   * @details A trajectory whose time restarts is offset by the end time of the previous one so time stays sorted.
+   */
+  explicit JointTrajectoryBuffer(const std::vector<const tesseract::common::JointTrajectory*>& trajectories);
+
+  /**
+   * @brief Create the buffer from columns
+   * @details The matrices must have one row per time and one column per joint name
+   */
+  JointTrajectoryBuffer(std::string description,
+                        std::vector<std::string> joint_names,
+                        Eigen::VectorXd time,
+                        Matrix position,
+                        Matrix velocity,
+                        Matrix acceleration);
+
+  /** @brief The number of states */
+  std::size_t size() const;
+
+  /** @brief Check if the buffer has no states */
+  bool empty() const;
+
+  /** @brief The number of joints */
+  Eigen::Index dof() const;
+
+  const std::string& getDescription() const;
+  const std::vector<std::string>& getJointNames() const;
+
+  /** @brief The time from start of every state, sorted */
+  const Eigen::VectorXd& getTime() const;
+
+  const Matrix& getPosition() const;
+  const Matrix& getVelocity() const;
+  const Matrix& getAcceleration() const;
+  const Matrix& getValues(Quantity quantity) const;
+
+  double getTimeBegin() const;
+  double getTimeEnd() const;
+
+  /** @brief Index of the last state with time <= t, clamped to the valid range */
+  std::size_t getIndexFromTime(double t) const;
+
+  /** @brief Create the joint state stored at index i, joints missing from the original state are omitted */
+  tesseract::common::JointState getState(std::size_t i) const;
+
+  /**
+   * @brief Linearly interpolate the joint state at time t, clamped to the trajectory duration
+   * @details Joints missing from either of the bracketing states are omitted
+   */
+  tesseract::common::JointState interpolate(double t) const;
+
+  /** @brief The number of bytes held by the buffer */
+  std::size_t memoryUsage() const;
+
+private:
+  std::string description_;
+  std::vector<std::string> joint_names_;
+  Eigen::VectorXd time_;
+  Matrix position_;
+  Matrix velocity_;
+  Matrix acceleration_;
+
+  void append(const tesseract::common::JointTrajectory& trajectory, Eigen::Index& row, double& time_offset);
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_BUFFER_H
@@ -0,0 +1,104 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ENVIRONMENT_CACHE_H
+#define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ENVIRONMENT_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <tesseract/environment/fwd.h>
+
+namespace tesseract::common
+{
+class JointTrajectorySet;
+}
+
+namespace tesseract::gui
+{
+/**
+ * @brief Shares environments between joint trajectory sets which describe the same scene
+ * @details Environments are identified by a fingerprint of their command history, so sets loaded from different
+ * files or created by applying the same commands to the same base environment end up holding the same environment
+ * instance. Only weak references are kept, so an environment is released once the last set using it is removed.
+ *
+ * Shared environments must be treated as read-only apart from their joint state. They are cloned before they are
+ * published to the EnvironmentManager, where other components may change them (copy-on-write).
+ */
+class JointTrajectoryEnvironmentCache
+{
+public:
+  /**
+   * @brief Make the environment of the trajectory set a shared one
+   * @details If the set has an environment it is replaced by an identical cached one when available, otherwise it is
+   * added to the cache. If the set only has commands they are applied to a clone of the base environment, unless an
+   * environment with the same command history is already cached.
+   * @param trajectory_set The trajectory set to update
+   * @param base The environment commands are applied to when the set does not have one, may be a nullptr
+   * @throws If unable to apply the stored commands to the base environment
+   */
+  void share(tesseract::common::JointTrajectorySet& trajectory_set,
+             const std::shared_ptr<const tesseract::environment::Environment>& base);
+
+  /**
+   * @brief Get a cached environment equal to the provided one, inserting it if it is not cached
+   * @param env The environment to look up
+   * @return The cached environment
+   */
+  std::shared_ptr<tesseract::environment::Environment> intern(std::shared_ptr<tesseract::environment::Environment> env);
+
+  /** @brief The number of live environments in the cache */
+  std::size_t size() const;
+
+  /** @brief Drop every cached environment and fingerprint */
+  void clear();
+
+private:
+  struct Entry
+  {
+    /** @brief The length of the command history, checked on lookup to guard against hash collisions */
+    int revision{ 0 };
+    std::weak_ptr<tesseract::environment::Environment> environment;
+  };
+
+  /** @brief Cached environments by command history fingerprint */
+  std::unordered_map<std::uint64_t, Entry> environments_;
+
+  struct BaseEntry
+  {
+    int revision{ 0 };
+    std::uint64_t fingerprint{ 0 };
+    std::weak_ptr<const tesseract::environment::Environment> environment;
+  };
+
+  /** @brief Fingerprints of base environments by instance, so the live environment is only rehashed when it changes */
+  std::unordered_map<const tesseract::environment::Environment*, BaseEntry> base_fingerprints_;
+
+  std::uint64_t getBaseFingerprint(const std::shared_ptr<const tesseract::environment::Environment>& base);
+  std::shared_ptr<tesseract::environment::Environment> find(std::uint64_t fingerprint, int revision);
+  void prune();
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_ENVIRONMENT_CACHE_H
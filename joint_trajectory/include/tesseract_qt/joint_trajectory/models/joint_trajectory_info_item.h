@@ -23,6 +23,7 @@
 #ifndef TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_INFO_ITEM_H
 #define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_INFO_ITEM_H
 
+#include <memory>
 #include <QStandardItem>
 
 namespace tesseract::common
@@ -31,6 +32,14 @@ struct JointTrajectoryInfo;
 }
 namespace tesseract::gui
 {
+class JointTrajectoryBuffer;
+class JointTrajectorySetItem;
+
+/**
+ * @brief Item representing a joint trajectory
+ * @details The state items are created on demand in batches through fetchMore() so large trajectories do not create
+ * thousands of items when they are added to the model.
+ */
 class JointTrajectoryInfoItem : public QStandardItem
 {
 public:
@@ -41,10 +50,31 @@ public:
                           tesseract::common::JointTrajectoryInfo& trajectory_info);
   int type() const override;
 
+  /** @brief The number of state items created per fetchMore() call */
+  static const int FETCH_BATCH_SIZE;
+
+  /** @brief Check if there are states which do not have an item yet */
+  bool canFetchMore() const;
+
+  /**
+   * @brief Create the items of the next states, the states of an archived set are loaded first
+   * @param count The maximum number of state items to create
+   */
+  void fetchMore(int count = FETCH_BATCH_SIZE);
+
+  /**
+   * @brief Get the column-major copy of the trajectory, created on first use and shared afterwards
+   * @details For a trajectory of an archived set the buffer is read from the archive, leaving the states unloaded
+   */
+  std::shared_ptr<const JointTrajectoryBuffer> getBuffer() const;
+
   tesseract::common::JointTrajectoryInfo& trajectory_info;
 
 private:
-  void ctor();
+  mutable std::shared_ptr<const JointTrajectoryBuffer> buffer_;
+
+  /** @brief The parent set item if it was opened from an archive, otherwise nullptr */
+  JointTrajectorySetItem* getArchivedSetItem() const;
 };
 
 }  // namespace tesseract::gui
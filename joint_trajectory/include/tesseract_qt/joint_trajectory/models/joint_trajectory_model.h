@@ -44,6 +44,8 @@ class uuid;
 namespace tesseract::gui
 {
 class ComponentInfo;
+class JointTrajectoryBuffer;
+class JointTrajectoryArchive;
 class JointTrajectoryModel : public QStandardItemModel
 {
   Q_OBJECT
@@ -57,7 +59,29 @@ public:
 
   tesseract::common::JointState getJointState(const QModelIndex& row) const;
   tesseract::common::JointTrajectoryInfo getJointTrajectory(const QModelIndex& row) const;
-  tesseract::common::JointTrajectorySet getJointTrajectorySet(const QModelIndex& row) const;
+
+  /**
+   * @brief Get the trajectory set of the selected item
+   * @details The trajectories of a set opened from an archive are empty until they are loaded, see
+   * JointTrajectorySetItem::load()
+   */
+  const tesseract::common::JointTrajectorySet& getJointTrajectorySet(const QModelIndex& row) const;
+
+  /**
+   * @brief Get the shared column-major trajectory of the selected item
+   * @details For a trajectory set item all of its trajectories are appended, otherwise the trajectory owning the item
+   * is returned. The buffer is created once per item and shared by the player and plots.
+   */
+  std::shared_ptr<const JointTrajectoryBuffer> getJointTrajectoryBuffer(const QModelIndex& row) const;
+
+  // Documentation inherited
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  // Documentation inherited
+  bool canFetchMore(const QModelIndex& parent) const override;
+
+  // Documentation inherited
+  void fetchMore(const QModelIndex& parent) override;
 
 private:
   struct Implementation;
@@ -66,9 +90,18 @@ private:
   /**
    * @brief Add joint trajectory set
    * @param trajectory_set The trajectory set associated with the key
-   * @return The key associated with added trajectory for removal
+   * @param archive The archive the trajectories are read from when they are used, nullptr if they are in the set
+   * @param archive_set The index of the set in the archive
+   */
+  void addJointTrajectorySet(tesseract::common::JointTrajectorySet trajectory_set,
+                             std::shared_ptr<const JointTrajectoryArchive> archive = nullptr,
+                             std::size_t archive_set = 0);
+
+  /**
+   * @brief Add the trajectory sets of an archive, the archive is kept open by the set items
+   * @param archive The archive
    */
-  void addJointTrajectorySet(tesseract::common::JointTrajectorySet trajectory_set);
+  void addJointTrajectoryArchive(const std::shared_ptr<const JointTrajectoryArchive>& archive);
 
   /**
    * @brief Remove the joint trajectory set
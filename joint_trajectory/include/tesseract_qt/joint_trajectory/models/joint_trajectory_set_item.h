@@ -24,10 +24,14 @@
 #define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_SET_ITEM_H
 
 #include <tesseract_qt/common/joint_trajectory_set.h>
+#include <memory>
 #include <QStandardItem>
 
 namespace tesseract::gui
 {
+class JointTrajectoryBuffer;
+class JointTrajectoryArchive;
+
 class JointTrajectorySetItem : public QStandardItem
 {
 public:
@@ -36,11 +40,44 @@ public:
   JointTrajectorySetItem(const QIcon& icon,
                          const QString& text,
                          const tesseract::common::JointTrajectorySet& trajectory_set);
+
+  /**
+   * @brief Create the item of an archived trajectory set whose trajectories are read when they are used
+   * @param trajectory_set The set with the initial state and an empty trajectory per trajectory of the archived set
+   * @param archive The archive, which is kept open by the item
+   * @param archive_set The index of the set in the archive
+   */
+  JointTrajectorySetItem(const tesseract::common::JointTrajectorySet& trajectory_set,
+                         std::shared_ptr<const JointTrajectoryArchive> archive,
+                         std::size_t archive_set);
   int type() const override;
 
+  /**
+   * @brief Get the column-major copy of all trajectories appended, created on first use and shared afterwards
+   * @details The trajectories of an archived set are loaded first
+   */
+  std::shared_ptr<const JointTrajectoryBuffer> getBuffer();
+
+  /** @brief The archive the trajectories are read from, nullptr if the set was not opened from an archive */
+  const std::shared_ptr<const JointTrajectoryArchive>& getArchive() const;
+
+  /** @brief The archive index of trajectory i */
+  std::size_t getArchiveIndex(std::size_t i) const;
+
+  /**
+   * @brief Read the states of the trajectories from the archive if that was not done yet
+   * @details The trajectory infos are updated in place so the trajectory items stay valid
+   */
+  void load();
+
   tesseract::common::JointTrajectorySet trajectory_set;
 
 private:
+  std::shared_ptr<const JointTrajectoryBuffer> buffer_;
+  std::shared_ptr<const JointTrajectoryArchive> archive_;
+  std::size_t archive_set_{ 0 };
+  bool loaded_{ true };
+
   void ctor();
 };
 }  // namespace tesseract::gui
@@ -24,6 +24,7 @@
 #define TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_UTILS_H
 
 #include <memory>
+#include <string>
 
 class QString;
 class QWidget;
@@ -36,10 +37,51 @@ class JointTrajectorySet;
 namespace tesseract::gui
 {
 class ComponentInfo;
+class BackgroundLoader;
+class JointTrajectoryArchive;
+
+/**
+ * @brief Create trajectory set s of an archive
+ * @param archive The archive
+ * @param s The index of the set in the archive
+ * @param load_trajectories If false the trajectories only get their description, their states are left to be read
+ * from the archive when they are used
+ */
+tesseract::common::JointTrajectorySet
+loadJointTrajectorySet(const JointTrajectoryArchive& archive, std::size_t s, bool load_trajectories = true);
+
+/**
+ * @brief Decode a joint trajectory set file, this does not use the GUI so it may be called from any thread
+ * @param joint_trajectory_set The decoded trajectory set
+ * @param filename The file to decode
+ * @param suffix The file type (jtsx, jtsb, cpix or cpib)
+ * @return True if successful, otherwise false
+ */
+bool loadJointTrajectorySet(tesseract::common::JointTrajectorySet& joint_trajectory_set,
+                            const QString& filename,
+                            const QString& suffix);
+
+/**
+ * @brief Decode the file on the loader's worker thread and add the trajectory set once it is decoded
+ * @details For an archive (jta) only the index is read, the model keeps the archive and reads a trajectory when it is
+ * used
+ * @param loader The loader reporting progress and errors
+ */
+void openJointTrajectorySetAsync(BackgroundLoader& loader,
+                                 const std::shared_ptr<const ComponentInfo>& component_info,
+                                 const QString& filename,
+                                 const QString& suffix);
 
 bool openJointTrajectorySet(const std::shared_ptr<const ComponentInfo>& component_info,
                             const QString& filename,
                             const QString& suffix);
+
+/**
+ * @brief Save a trajectory set
+ * @details An archive (jta) cannot store the environment, so sets with an environment or environment commands are
+ * not saved as an archive and a warning is logged
+ * @return True if successful, otherwise false
+ */
 bool saveJointTrajectorySet(const tesseract::common::JointTrajectorySet& jts, QString filename, const QString& suffix);
 }  // namespace tesseract::gui
 
@@ -28,6 +28,8 @@
 #include <tesseract/common/fwd.h>
 #include <QDialog>
 #include <tesseract_qt/plot/plot_data.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+#include <tesseract_qt/common/contact_results_types.h>
 #endif
 
 namespace Ui
@@ -35,11 +37,6 @@ namespace Ui
 class JointTrajectoryPlotDialog;
 }
 
-namespace tesseract::common
-{
-struct JointTrajectoryInfo;
-}  // namespace tesseract::common
-
 namespace tesseract::gui
 {
 class PlotSubplots;
@@ -49,20 +46,33 @@ class JointTrajectoryPlotDialog : public QDialog
   Q_OBJECT
 
 public:
-  explicit JointTrajectoryPlotDialog(tesseract::common::JointTrajectoryInfo current_trajectory,
+  explicit JointTrajectoryPlotDialog(std::shared_ptr<const JointTrajectoryBuffer> trajectory,
                                      QWidget* parent = nullptr);
   ~JointTrajectoryPlotDialog();
 
+  /**
+   * @brief Add a tab plotting the minimum contact distance of a trajectory contact scan over time
+   * @param contact_results The scan results of the plotted trajectory
+   * @param no_contact_distance The distance plotted for states without contacts, usually the contact threshold
+   */
+  void setContactResults(const ContactResultTimeline& contact_results, double no_contact_distance);
+
 private Q_SLOTS:
   void onSliderMoved(int value);
   void onTabIndexChanged(int value);
 
 private:
   std::unique_ptr<Ui::JointTrajectoryPlotDialog> ui_;
+  std::shared_ptr<const JointTrajectoryBuffer> trajectory_;
   tesseract::gui::PlotDataMapRef plot_data_map_;
   tesseract::gui::PlotSubplots* position_subplots_;
   tesseract::gui::PlotSubplots* velocity_subplots_;
   tesseract::gui::PlotSubplots* acceleration_subplots_;
+  tesseract::gui::PlotSubplots* contact_subplots_{ nullptr };
+
+  PlotSubplots* createSubplots(JointTrajectoryBuffer::Quantity quantity,
+                               const std::string& suffix,
+                               const QString& y_axis_title);
 };
 }  // namespace tesseract::gui
 #endif  // TESSERACT_QT_JOINT_TRAJECTORY_JOINT_TRAJECTORY_PLOT_DIALOG_H
@@ -28,6 +28,7 @@
 #include <tesseract/visualization/fwd.h>
 #include <tesseract/common/fwd.h>
 #include <tesseract/environment/fwd.h>
+#include <tesseract/collision/fwd.h>
 #include <QWidget>
 #endif
 
@@ -84,6 +85,26 @@ private:
   std::unique_ptr<Ui::JointTrajectoryWidget> ui_;
   std::unique_ptr<Implementation> data_;
 
+  /**
+   * @brief Make env the environment of the player, publishing it only when it differs from the current one
+   * @details A copy is published because other components may change it, env is shared with other trajectory sets
+   */
+  void setCurrentEnvironment(const std::shared_ptr<tesseract::environment::Environment>& env);
+
+  /** @brief Check the current trajectory for contacts on the loader thread, streaming results to the contact model */
+  void scanContacts(const tesseract::collision::ContactManagerConfig& contact_manager_config,
+                    const tesseract::collision::CollisionCheckConfig& collision_check_config,
+                    const std::string& ns);
+
+  /** @brief Compute the ghost of the current trajectory on the loader thread if it is enabled, otherwise remove it */
+  void updateGhost();
+
+  /** @brief Remove the shown trajectory ghost */
+  void clearGhost();
+
+  /** @brief Pause the player and move it to the provided time of the current trajectory */
+  void seek(double time);
+
   // Documentation inherited
   bool eventFilter(QObject* obj, QEvent* event) override;
 };
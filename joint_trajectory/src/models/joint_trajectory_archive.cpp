@@ -0,0 +1,545 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
+#include <tesseract_qt/common/joint_trajectory_set.h>
+
+#include <tesseract/common/joint_state.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <QFile>
+
+namespace tesseract::gui
+{
+namespace
+{
+const char ARCHIVE_MAGIC[8] = { 'T', 'Q', 'T', 'J', 'T', 'A', '\0', '\0' };
+const std::uint32_t ARCHIVE_BYTE_ORDER = 0x01020304;
+
+struct ArchiveHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint64_t trajectory_count;
+  std::uint64_t index_offset;
+  std::uint64_t string_count;
+  std::uint64_t string_offsets_offset;
+  std::uint64_t string_data_offset;
+  std::uint64_t joint_list_count;
+  std::uint64_t joint_list_offset;
+  std::uint64_t set_count;
+  std::uint64_t set_offset;
+};
+static_assert(sizeof(ArchiveHeader) == 88, "Unexpected archive header size");
+
+/** @brief The size of the header of version 1 archives, which do not have a set table */
+const std::size_t ARCHIVE_HEADER_SIZE_V1 = 72;
+
+struct ArchiveIndexRecord
+{
+  std::uint32_t ns;
+  std::uint32_t description;
+  std::uint32_t joint_names;
+  std::uint32_t dof;
+  std::uint64_t state_count;
+  std::uint64_t data_offset;
+  double time_begin;
+  double time_end;
+};
+static_assert(sizeof(ArchiveIndexRecord) == 48, "Unexpected archive index record size");
+
+struct ArchiveSetRecord
+{
+  std::uint32_t ns;
+  std::uint32_t description;
+  std::uint32_t joint_names;
+  std::uint32_t dof;
+  std::uint64_t initial_state_offset;
+  std::uint64_t trajectory_begin;
+  std::uint64_t trajectory_count;
+};
+static_assert(sizeof(ArchiveSetRecord) == 40, "Unexpected archive set record size");
+
+/** @brief The number of columns stored per joint, position, velocity and acceleration */
+const std::uint64_t ARCHIVE_QUANTITIES = 3;
+
+template <typename T>
+void write(std::ofstream& stream, const T* values, std::size_t count)
+{
+  stream.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+/** @brief Pad the stream so the next block is aligned to 8 bytes */
+void align(std::ofstream& stream)
+{
+  const char zeros[8] = {};
+  const auto pos = static_cast<std::uint64_t>(stream.tellp());
+  if (pos % 8 != 0)
+    stream.write(zeros, static_cast<std::streamsize>(8 - (pos % 8)));
+}
+
+bool inRange(std::uint64_t offset, std::uint64_t size, std::uint64_t file_size)
+{
+  return (offset <= file_size && size <= file_size - offset);
+}
+}  // namespace
+
+const std::uint32_t JointTrajectoryArchive::VERSION = 2;
+
+JointTrajectoryArchive::JointTrajectoryArchive(const std::string& filename)
+  : file_(std::make_unique<QFile>(QString::fromStdString(filename)))
+{
+  if (!file_->open(QIODevice::ReadOnly))
+    throw std::runtime_error("JointTrajectoryArchive, failed to open '" + filename + "'");
+
+  data_size_ = static_cast<std::uint64_t>(file_->size());
+  if (data_size_ < ARCHIVE_HEADER_SIZE_V1)
+    throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' is not a joint trajectory archive");
+
+  data_ = file_->map(0, file_->size());
+  if (data_ == nullptr)
+    throw std::runtime_error("JointTrajectoryArchive, failed to map '" + filename + "'");
+
+  ArchiveHeader header{};
+  std::memcpy(&header, data_, ARCHIVE_HEADER_SIZE_V1);
+  if (std::memcmp(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0)
+    throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' is not a joint trajectory archive");
+
+  if (header.byte_order != ARCHIVE_BYTE_ORDER)
+    throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' was written with a different byte order");
+
+  if (header.version > VERSION)
+    throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' has unsupported version " +
+                             std::to_string(header.version));
+
+  if (header.version >= 2)
+  {
+    if (data_size_ < sizeof(ArchiveHeader))
+      throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' is truncated");
+
+    std::memcpy(&header, data_, sizeof(ArchiveHeader));
+  }
+
+  const std::uint64_t n = header.trajectory_count;
+  if (!inRange(header.index_offset, n * sizeof(ArchiveIndexRecord), data_size_) ||
+      !inRange(header.string_offsets_offset, (header.string_count + 1) * sizeof(std::uint64_t), data_size_) ||
+      !inRange(header.joint_list_offset, header.joint_list_count * sizeof(std::uint32_t), data_size_) ||
+      !inRange(header.set_offset, header.set_count * sizeof(ArchiveSetRecord), data_size_))
+    throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' is truncated");
+
+  // String table
+  std::vector<std::uint64_t> string_offsets(header.string_count + 1);
+  std::memcpy(string_offsets.data(),
+              data_ + header.string_offsets_offset,
+              string_offsets.size() * sizeof(std::uint64_t));
+  strings_.reserve(header.string_count);
+  for (std::size_t k = 0; k < header.string_count; ++k)
+  {
+    const std::uint64_t begin = string_offsets[k];
+    const std::uint64_t end = string_offsets[k + 1];
+    if (end < begin || !inRange(header.string_data_offset + begin, end - begin, data_size_))
+      throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' has a corrupt string table");
+
+    strings_.emplace_back(reinterpret_cast<const char*>(data_ + header.string_data_offset + begin), end - begin);
+  }
+
+  // Joint name lists, stored 4 byte aligned
+  joint_list_ = reinterpret_cast<const std::uint32_t*>(data_ + header.joint_list_offset);
+  for (std::size_t k = 0; k < header.joint_list_count; ++k)
+  {
+    if (joint_list_[k] >= strings_.size())
+      throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' has a corrupt joint list");
+  }
+
+  // Index
+  entries_.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    ArchiveIndexRecord record{};
+    std::memcpy(&record, data_ + header.index_offset + (i * sizeof(ArchiveIndexRecord)), sizeof(ArchiveIndexRecord));
+
+    const std::uint64_t values = record.state_count * (1 + (ARCHIVE_QUANTITIES * record.dof));
+    if (record.ns >= strings_.size() || record.description >= strings_.size() ||
+        std::uint64_t(record.joint_names) + record.dof > header.joint_list_count ||
+        !inRange(record.data_offset, values * sizeof(double), data_size_) || record.data_offset % 8 != 0)
+      throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' has a corrupt index");
+
+    entries_[i] = { record.ns,          record.description, record.joint_names, record.dof,
+                    record.state_count, record.data_offset, record.time_begin,  record.time_end };
+    ns_index_.emplace(strings_[record.ns], i);
+  }
+
+  // Sets
+  std::vector<bool> in_set(n, false);
+  sets_.reserve(header.set_count);
+  for (std::size_t s = 0; s < header.set_count; ++s)
+  {
+    ArchiveSetRecord record{};
+    std::memcpy(&record, data_ + header.set_offset + (s * sizeof(ArchiveSetRecord)), sizeof(ArchiveSetRecord));
+
+    if (record.ns >= strings_.size() || record.description >= strings_.size() ||
+        std::uint64_t(record.joint_names) + record.dof > header.joint_list_count ||
+        !inRange(record.initial_state_offset, record.dof * sizeof(double), data_size_) ||
+        record.initial_state_offset % 8 != 0 || record.trajectory_begin > n ||
+        record.trajectory_count > n - record.trajectory_begin)
+      throw std::runtime_error("JointTrajectoryArchive, '" + filename + "' has a corrupt set table");
+
+    SetEntry set;
+    set.ns = record.ns;
+    set.description = record.description;
+    const auto* initial_state = reinterpret_cast<const double*>(data_ + record.initial_state_offset);
+    for (std::uint32_t k = 0; k < record.dof; ++k)
+      set.initial_state[strings_[joint_list_[record.joint_names + k]]] = initial_state[k];
+
+    for (std::uint64_t i = record.trajectory_begin; i < record.trajectory_begin + record.trajectory_count; ++i)
+    {
+      set.trajectories.push_back(i);
+      in_set[i] = true;
+    }
+    sets_.push_back(std::move(set));
+  }
+
+  // Trajectories appended without a set form one set per namespace, described by the namespace and starting from
+  // the first state of the first trajectory
+  for (const auto& ns : getNamespaces())
+  {
+    SetEntry set;
+    for (std::size_t i : find(ns))
+    {
+      if (!in_set[i])
+        set.trajectories.push_back(i);
+    }
+
+    if (set.trajectories.empty())
+      continue;
+
+    const std::size_t first = set.trajectories.front();
+    set.ns = entries_[first].ns;
+    set.description = entries_[first].ns;
+    if (entries_[first].state_count > 0)
+    {
+      const std::vector<std::string> joint_names = getJointNames(first);
+      const ConstMatrixMap position = getValues(first, JointTrajectoryBuffer::Quantity::POSITION);
+      for (std::size_t k = 0; k < joint_names.size(); ++k)
+        set.initial_state[joint_names[k]] = position(0, static_cast<Eigen::Index>(k));
+    }
+    sets_.push_back(std::move(set));
+  }
+}
+
+JointTrajectoryArchive::~JointTrajectoryArchive()
+{
+  if (data_ != nullptr)
+    file_->unmap(const_cast<unsigned char*>(data_));
+}
+
+std::size_t JointTrajectoryArchive::size() const { return entries_.size(); }
+
+const std::string& JointTrajectoryArchive::getNamespace(std::size_t i) const { return strings_[entries_.at(i).ns]; }
+
+const std::string& JointTrajectoryArchive::getDescription(std::size_t i) const
+{
+  return strings_[entries_.at(i).description];
+}
+
+std::vector<std::string> JointTrajectoryArchive::getJointNames(std::size_t i) const
+{
+  const Entry& entry = entries_.at(i);
+  std::vector<std::string> joint_names;
+  joint_names.reserve(entry.dof);
+  for (std::uint32_t k = 0; k < entry.dof; ++k)
+    joint_names.push_back(strings_[joint_list_[entry.joint_names + k]]);
+
+  return joint_names;
+}
+
+std::size_t JointTrajectoryArchive::getStateCount(std::size_t i) const { return entries_.at(i).state_count; }
+
+double JointTrajectoryArchive::getTimeBegin(std::size_t i) const { return entries_.at(i).time_begin; }
+
+double JointTrajectoryArchive::getTimeEnd(std::size_t i) const { return entries_.at(i).time_end; }
+
+const double* JointTrajectoryArchive::column(std::size_t i, std::size_t column) const
+{
+  const Entry& entry = entries_.at(i);
+  const auto* values = reinterpret_cast<const double*>(data_ + entry.data_offset);
+  return values + (column * entry.state_count);
+}
+
+JointTrajectoryArchive::ConstVectorMap JointTrajectoryArchive::getTime(std::size_t i) const
+{
+  return { column(i, 0), static_cast<Eigen::Index>(entries_.at(i).state_count) };
+}
+
+JointTrajectoryArchive::ConstMatrixMap JointTrajectoryArchive::getValues(std::size_t i,
+                                                                        JointTrajectoryBuffer::Quantity quantity) const
+{
+  const Entry& entry = entries_.at(i);
+  const std::size_t first = 1 + (static_cast<std::size_t>(quantity) * entry.dof);
+  return { column(i, first), static_cast<Eigen::Index>(entry.state_count), static_cast<Eigen::Index>(entry.dof) };
+}
+
+std::vector<std::string> JointTrajectoryArchive::getNamespaces() const
+{
+  std::vector<std::string> namespaces;
+  for (const auto& entry : entries_)
+  {
+    const std::string& ns = strings_[entry.ns];
+    if (std::find(namespaces.begin(), namespaces.end(), ns) == namespaces.end())
+      namespaces.push_back(ns);
+  }
+  return namespaces;
+}
+
+std::vector<std::size_t> JointTrajectoryArchive::find(const std::string& ns) const
+{
+  std::vector<std::size_t> indices;
+  auto range = ns_index_.equal_range(ns);
+  for (auto it = range.first; it != range.second; ++it)
+    indices.push_back(it->second);
+
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+std::vector<std::size_t> JointTrajectoryArchive::find(const std::string& ns, const std::string& description) const
+{
+  std::vector<std::size_t> indices = find(ns);
+  indices.erase(std::remove_if(indices.begin(),
+                               indices.end(),
+                               [this, &description](std::size_t i) { return getDescription(i) != description; }),
+                indices.end());
+  return indices;
+}
+
+std::size_t JointTrajectoryArchive::getSetCount() const { return sets_.size(); }
+
+const std::string& JointTrajectoryArchive::getSetNamespace(std::size_t s) const { return strings_[sets_.at(s).ns]; }
+
+const std::string& JointTrajectoryArchive::getSetDescription(std::size_t s) const
+{
+  return strings_[sets_.at(s).description];
+}
+
+const std::unordered_map<std::string, double>& JointTrajectoryArchive::getSetInitialState(std::size_t s) const
+{
+  return sets_.at(s).initial_state;
+}
+
+const std::vector<std::size_t>& JointTrajectoryArchive::getSetTrajectories(std::size_t s) const
+{
+  return sets_.at(s).trajectories;
+}
+
+std::shared_ptr<const JointTrajectoryBuffer> JointTrajectoryArchive::getBuffer(std::size_t i) const
+{
+  return std::make_shared<const JointTrajectoryBuffer>(getDescription(i),
+                                                       getJointNames(i),
+                                                       getTime(i),
+                                                       getValues(i, JointTrajectoryBuffer::Quantity::POSITION),
+                                                       getValues(i, JointTrajectoryBuffer::Quantity::VELOCITY),
+                                                       getValues(i, JointTrajectoryBuffer::Quantity::ACCELERATION));
+}
+
+tesseract::common::JointTrajectory JointTrajectoryArchive::getJointTrajectory(std::size_t i) const
+{
+  const std::vector<std::string> joint_names = getJointNames(i);
+  const ConstVectorMap time = getTime(i);
+  const ConstMatrixMap position = getValues(i, JointTrajectoryBuffer::Quantity::POSITION);
+  const ConstMatrixMap velocity = getValues(i, JointTrajectoryBuffer::Quantity::VELOCITY);
+  const ConstMatrixMap acceleration = getValues(i, JointTrajectoryBuffer::Quantity::ACCELERATION);
+
+  tesseract::common::JointTrajectory trajectory;
+  trajectory.description = getDescription(i);
+  trajectory.states.reserve(getStateCount(i));
+  for (Eigen::Index row = 0; row < time.size(); ++row)
+  {
+    tesseract::common::JointState state;
+    state.joint_names = joint_names;
+    state.position = position.row(row).transpose();
+    state.velocity = velocity.row(row).transpose();
+    state.acceleration = acceleration.row(row).transpose();
+    state.time = time[row];
+    trajectory.states.push_back(std::move(state));
+  }
+  return trajectory;
+}
+
+JointTrajectoryArchiveWriter::JointTrajectoryArchiveWriter(const std::string& filename)
+  : filename_(filename), stream_(filename, std::ios::binary | std::ios::trunc)
+{
+  if (!stream_)
+    throw std::runtime_error("JointTrajectoryArchiveWriter, failed to create '" + filename + "'");
+
+  // The header is rewritten by close() once the table offsets are known
+  ArchiveHeader header{};
+  write(stream_, &header, 1);
+}
+
+JointTrajectoryArchiveWriter::~JointTrajectoryArchiveWriter()
+{
+  try
+  {
+    if (stream_.is_open())
+      close();
+  }
+  catch (...)  // NOLINT
+  {
+  }
+}
+
+std::uint32_t JointTrajectoryArchiveWriter::intern(const std::string& value)
+{
+  auto it = string_ids_.find(value);
+  if (it != string_ids_.end())
+    return it->second;
+
+  const auto id = static_cast<std::uint32_t>(strings_.size());
+  strings_.push_back(value);
+  string_ids_[value] = id;
+  return id;
+}
+
+void JointTrajectoryArchiveWriter::append(const std::string& ns,
+                                          const std::string& description,
+                                          const JointTrajectoryBuffer& trajectory)
+{
+  if (!stream_.is_open())
+    throw std::runtime_error("JointTrajectoryArchiveWriter, cannot append to closed archive '" + filename_ + "'");
+
+  ArchiveIndexRecord record{};
+  record.ns = intern(ns);
+  record.description = intern(description);
+  record.joint_names = static_cast<std::uint32_t>(joint_list_.size());
+  record.dof = static_cast<std::uint32_t>(trajectory.dof());
+  record.state_count = trajectory.size();
+  record.time_begin = trajectory.getTimeBegin();
+  record.time_end = trajectory.getTimeEnd();
+
+  for (const auto& joint_name : trajectory.getJointNames())
+    joint_list_.push_back(intern(joint_name));
+
+  align(stream_);
+  record.data_offset = static_cast<std::uint64_t>(stream_.tellp());
+
+  // Columns are contiguous in the column-major buffer so each quantity is a single write
+  write(stream_, trajectory.getTime().data(), trajectory.size());
+  write(stream_, trajectory.getPosition().data(), static_cast<std::size_t>(trajectory.getPosition().size()));
+  write(stream_, trajectory.getVelocity().data(), static_cast<std::size_t>(trajectory.getVelocity().size()));
+  write(stream_, trajectory.getAcceleration().data(), static_cast<std::size_t>(trajectory.getAcceleration().size()));
+
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&record);
+  index_.insert(index_.end(), bytes, bytes + sizeof(ArchiveIndexRecord));
+  ++count_;
+
+  if (!stream_)
+    throw std::runtime_error("JointTrajectoryArchiveWriter, failed to write '" + filename_ + "'");
+}
+
+void JointTrajectoryArchiveWriter::append(const tesseract::common::JointTrajectorySet& trajectory_set)
+{
+  if (trajectory_set.getEnvironment() != nullptr || !trajectory_set.getEnvironmentCommands().empty())
+    throw std::runtime_error("JointTrajectoryArchiveWriter, cannot store the environment of trajectory set '" +
+                             trajectory_set.getDescription() + "' in '" + filename_ + "'");
+
+  if (!stream_.is_open())
+    throw std::runtime_error("JointTrajectoryArchiveWriter, cannot append to closed archive '" + filename_ + "'");
+
+  const tesseract::common::JointState& initial_state = trajectory_set.getInitialState();
+
+  ArchiveSetRecord record{};
+  record.ns = intern(trajectory_set.getNamespace());
+  record.description = intern(trajectory_set.getDescription());
+  record.joint_names = static_cast<std::uint32_t>(joint_list_.size());
+  record.dof = static_cast<std::uint32_t>(initial_state.joint_names.size());
+  for (const auto& joint_name : initial_state.joint_names)
+    joint_list_.push_back(intern(joint_name));
+
+  align(stream_);
+  record.initial_state_offset = static_cast<std::uint64_t>(stream_.tellp());
+  write(stream_, initial_state.position.data(), static_cast<std::size_t>(initial_state.position.size()));
+
+  record.trajectory_begin = count_;
+  for (const auto& info : trajectory_set.getJointTrajectories())
+    append(trajectory_set.getNamespace(),
+           info.joint_trajectory.description,
+           JointTrajectoryBuffer(info.joint_trajectory));
+  record.trajectory_count = count_ - record.trajectory_begin;
+
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&record);
+  sets_.insert(sets_.end(), bytes, bytes + sizeof(ArchiveSetRecord));
+  ++set_count_;
+}
+
+void JointTrajectoryArchiveWriter::close()
+{
+  if (!stream_.is_open())
+    return;
+
+  ArchiveHeader header{};
+  std::memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+  header.version = JointTrajectoryArchive::VERSION;
+  header.byte_order = ARCHIVE_BYTE_ORDER;
+  header.trajectory_count = count_;
+
+  // String table, the offsets are relative to the start of the string data
+  std::vector<std::uint64_t> string_offsets;
+  string_offsets.reserve(strings_.size() + 1);
+  string_offsets.push_back(0);
+  for (const auto& value : strings_)
+    string_offsets.push_back(string_offsets.back() + value.size());
+
+  align(stream_);
+  header.string_count = strings_.size();
+  header.string_offsets_offset = static_cast<std::uint64_t>(stream_.tellp());
+  write(stream_, string_offsets.data(), string_offsets.size());
+
+  header.string_data_offset = static_cast<std::uint64_t>(stream_.tellp());
+  for (const auto& value : strings_)
+    stream_.write(value.data(), static_cast<std::streamsize>(value.size()));
+
+  align(stream_);
+  header.joint_list_count = joint_list_.size();
+  header.joint_list_offset = static_cast<std::uint64_t>(stream_.tellp());
+  write(stream_, joint_list_.data(), joint_list_.size());
+
+  align(stream_);
+  header.index_offset = static_cast<std::uint64_t>(stream_.tellp());
+  write(stream_, index_.data(), index_.size());
+
+  header.set_count = set_count_;
+  header.set_offset = static_cast<std::uint64_t>(stream_.tellp());
+  write(stream_, sets_.data(), sets_.size());
+
+  stream_.seekp(0);
+  write(stream_, &header, 1);
+  stream_.close();
+
+  if (!stream_)
+    throw std::runtime_error("JointTrajectoryArchiveWriter, failed to write '" + filename_ + "'");
+}
+}  // namespace tesseract::gui
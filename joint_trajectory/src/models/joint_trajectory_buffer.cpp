@@ -0,0 +1,259 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+
+#include <tesseract/common/joint_state.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace tesseract::gui
+{
+namespace
+{
+void assign(JointTrajectoryBuffer::Matrix& matrix,
+            Eigen::Index row,
+            const Eigen::VectorXd& values,
+            const std::vector<Eigen::Index>& columns)
+{
+  for (std::size_t k = 0; k < columns.size(); ++k)
+  {
+    if (columns[k] >= 0 && static_cast<Eigen::Index>(k) < values.size())
+      matrix(row, columns[k]) = values[static_cast<Eigen::Index>(k)];
+  }
+}
+
+/**
+ * @brief Remove the joints which are not part of the state, they are stored as NaN
+ * @details Trajectories without velocity or acceleration store them as NaN as well, these are reported as zero
+ */
+void removeMissingJoints(tesseract::common::JointState& state)
+{
+  if (!state.position.allFinite())
+  {
+    Eigen::Index cnt{ 0 };
+    std::vector<std::string> joint_names;
+    joint_names.reserve(state.joint_names.size());
+    for (Eigen::Index k = 0; k < state.position.size(); ++k)
+    {
+      if (!std::isfinite(state.position[k]))
+        continue;
+
+      joint_names.push_back(state.joint_names[static_cast<std::size_t>(k)]);
+      state.position[cnt] = state.position[k];
+      state.velocity[cnt] = state.velocity[k];
+      state.acceleration[cnt] = state.acceleration[k];
+      ++cnt;
+    }
+
+    state.joint_names = std::move(joint_names);
+    state.position.conservativeResize(cnt);
+    state.velocity.conservativeResize(cnt);
+    state.acceleration.conservativeResize(cnt);
+  }
+
+  const auto finite_or_zero = [](double value) { return std::isfinite(value) ? value : 0.0; };
+  state.velocity = state.velocity.unaryExpr(finite_or_zero);
+  state.acceleration = state.acceleration.unaryExpr(finite_or_zero);
+}
+}  // namespace
+
+JointTrajectoryBuffer::JointTrajectoryBuffer(const tesseract::common::JointTrajectory& trajectory)
+  : JointTrajectoryBuffer(std::vector<const tesseract::common::JointTrajectory*>{ &trajectory })
+{
+}
+
+JointTrajectoryBuffer::JointTrajectoryBuffer(const std::vector<const tesseract::common::JointTrajectory*>& trajectories)
+{
+  Eigen::Index rows{ 0 };
+  for (const auto* trajectory : trajectories)
+  {
+    rows += static_cast<Eigen::Index>(trajectory->size());
+    if (joint_names_.empty() && !trajectory->empty())
+      joint_names_ = trajectory->front().joint_names;
+  }
+
+  if (trajectories.size() == 1)
+    description_ = trajectories.front()->description;
+
+  const auto cols = static_cast<Eigen::Index>(joint_names_.size());
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  time_.resize(rows);
+  position_.setConstant(rows, cols, nan);
+  velocity_.setConstant(rows, cols, nan);
+  acceleration_.setConstant(rows, cols, nan);
+
+  Eigen::Index row{ 0 };
+  double time_offset{ 0 };
+  for (const auto* trajectory : trajectories)
+    append(*trajectory, row, time_offset);
+}
+
+JointTrajectoryBuffer::JointTrajectoryBuffer(std::string description,
+                                             std::vector<std::string> joint_names,
+                                             Eigen::VectorXd time,
+                                             Matrix position,
+                                             Matrix velocity,
+                                             Matrix acceleration)
+  : description_(std::move(description))
+  , joint_names_(std::move(joint_names))
+  , time_(std::move(time))
+  , position_(std::move(position))
+  , velocity_(std::move(velocity))
+  , acceleration_(std::move(acceleration))
+{
+  const auto cols = static_cast<Eigen::Index>(joint_names_.size());
+  for (const Matrix* values : { &position_, &velocity_, &acceleration_ })
+  {
+    if (values->rows() != time_.size() || values->cols() != cols)
+      throw std::runtime_error("JointTrajectoryBuffer, column sizes do not match");
+  }
+}
+
+void JointTrajectoryBuffer::append(const tesseract::common::JointTrajectory& trajectory,
+                                   Eigen::Index& row,
+                                   double& time_offset)
+{
+  if (trajectory.empty())
+    return;
+
+  // Keep time sorted when appending a trajectory which starts over
+  if (row > 0 && trajectory.front().time + time_offset < time_[row - 1])
+    time_offset = time_[row - 1] - trajectory.front().time;
+
+  // Column of each joint of the state, only recomputed when the joint names change
+  const std::vector<std::string>* mapped_names{ nullptr };
+  std::vector<Eigen::Index> columns;
+
+  for (const auto& state : trajectory)
+  {
+    if (mapped_names == nullptr || *mapped_names != state.joint_names)
+    {
+      mapped_names = &state.joint_names;
+      columns.resize(state.joint_names.size());
+      for (std::size_t k = 0; k < state.joint_names.size(); ++k)
+      {
+        auto it = std::find(joint_names_.begin(), joint_names_.end(), state.joint_names[k]);
+        columns[k] = (it == joint_names_.end()) ? -1 : std::distance(joint_names_.begin(), it);
+      }
+    }
+
+    time_[row] = state.time + time_offset;
+    assign(position_, row, state.position, columns);
+    assign(velocity_, row, state.velocity, columns);
+    assign(acceleration_, row, state.acceleration, columns);
+    ++row;
+  }
+}
+
+std::size_t JointTrajectoryBuffer::size() const { return static_cast<std::size_t>(time_.size()); }
+
+bool JointTrajectoryBuffer::empty() const { return (time_.size() == 0); }
+
+Eigen::Index JointTrajectoryBuffer::dof() const { return static_cast<Eigen::Index>(joint_names_.size()); }
+
+const std::string& JointTrajectoryBuffer::getDescription() const { return description_; }
+
+const std::vector<std::string>& JointTrajectoryBuffer::getJointNames() const { return joint_names_; }
+
+const Eigen::VectorXd& JointTrajectoryBuffer::getTime() const { return time_; }
+
+const JointTrajectoryBuffer::Matrix& JointTrajectoryBuffer::getPosition() const { return position_; }
+
+const JointTrajectoryBuffer::Matrix& JointTrajectoryBuffer::getVelocity() const { return velocity_; }
+
+const JointTrajectoryBuffer::Matrix& JointTrajectoryBuffer::getAcceleration() const { return acceleration_; }
+
+const JointTrajectoryBuffer::Matrix& JointTrajectoryBuffer::getValues(Quantity quantity) const
+{
+  switch (quantity)
+  {
+    case Quantity::VELOCITY:
+      return velocity_;
+    case Quantity::ACCELERATION:
+      return acceleration_;
+    default:
+      return position_;
+  }
+}
+
+double JointTrajectoryBuffer::getTimeBegin() const { return empty() ? 0 : time_[0]; }
+
+double JointTrajectoryBuffer::getTimeEnd() const { return empty() ? 0 : time_[time_.size() - 1]; }
+
+std::size_t JointTrajectoryBuffer::getIndexFromTime(double t) const
+{
+  if (empty())
+    throw std::runtime_error("JointTrajectoryBuffer, cannot get index of an empty trajectory");
+
+  const double* begin = time_.data();
+  const double* end = begin + time_.size();
+  const double* it = std::upper_bound(begin, end, t);
+  if (it == begin)
+    return 0;
+
+  return static_cast<std::size_t>(std::distance(begin, it) - 1);
+}
+
+tesseract::common::JointState JointTrajectoryBuffer::getState(std::size_t i) const
+{
+  const auto row = static_cast<Eigen::Index>(i);
+  tesseract::common::JointState state;
+  state.joint_names = joint_names_;
+  state.position = position_.row(row).transpose();
+  state.velocity = velocity_.row(row).transpose();
+  state.acceleration = acceleration_.row(row).transpose();
+  state.time = time_[row];
+  removeMissingJoints(state);
+  return state;
+}
+
+tesseract::common::JointState JointTrajectoryBuffer::interpolate(double t) const
+{
+  const std::size_t i = getIndexFromTime(t);
+  if (t <= time_[0] || i + 1 >= size())
+    return getState(i);
+
+  const auto row = static_cast<Eigen::Index>(i);
+  const double dt = time_[row + 1] - time_[row];
+  const double s = (dt > 0) ? (t - time_[row]) / dt : 0.0;
+
+  tesseract::common::JointState state;
+  state.joint_names = joint_names_;
+  state.position = ((1.0 - s) * position_.row(row) + s * position_.row(row + 1)).transpose();
+  state.velocity = ((1.0 - s) * velocity_.row(row) + s * velocity_.row(row + 1)).transpose();
+  state.acceleration = ((1.0 - s) * acceleration_.row(row) + s * acceleration_.row(row + 1)).transpose();
+  state.time = t;
+  removeMissingJoints(state);
+  return state;
+}
+
+std::size_t JointTrajectoryBuffer::memoryUsage() const
+{
+  const Eigen::Index values = time_.size() + position_.size() + velocity_.size() + acceleration_.size();
+  return static_cast<std::size_t>(values) * sizeof(double);
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,128 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_environment_cache.h>
+
+#include <tesseract_qt/common/joint_trajectory_set.h>
+#include <tesseract_qt/common/utils.h>
+
+#include <tesseract/environment/environment.h>
+
+#include <stdexcept>
+
+namespace tesseract::gui
+{
+void JointTrajectoryEnvironmentCache::share(tesseract::common::JointTrajectorySet& trajectory_set,
+                                            const std::shared_ptr<const tesseract::environment::Environment>& base)
+{
+  if (trajectory_set.getEnvironment() != nullptr)
+  {
+    trajectory_set.setEnvironment(intern(trajectory_set.getEnvironment()));
+    return;
+  }
+
+  if (base == nullptr || !base->isInitialized())
+    return;
+
+  const auto& commands = trajectory_set.getEnvironmentCommands();
+  const std::uint64_t key = getCommandsFingerprint(commands, getBaseFingerprint(base));
+  const int revision = base->getRevision() + static_cast<int>(commands.size());
+  std::shared_ptr<tesseract::environment::Environment> env = find(key, revision);
+  if (env == nullptr)
+  {
+    env = base->clone();
+    if (!env->applyCommands(commands))
+      throw std::runtime_error("JointTrajectoryEnvironmentCache: Failed to apply commands to base environment");
+
+    prune();
+    environments_[key] = Entry{ revision, env };
+  }
+
+  trajectory_set.setEnvironment(std::move(env));
+}
+
+std::shared_ptr<tesseract::environment::Environment>
+JointTrajectoryEnvironmentCache::intern(std::shared_ptr<tesseract::environment::Environment> env)
+{
+  if (env == nullptr || !env->isInitialized())
+    return env;
+
+  const std::uint64_t key = getBaseFingerprint(env);
+  if (auto cached = find(key, env->getRevision()))
+    return cached;
+
+  prune();
+  environments_[key] = Entry{ env->getRevision(), env };
+  return env;
+}
+
+std::size_t JointTrajectoryEnvironmentCache::size() const
+{
+  std::size_t count{ 0 };
+  for (const auto& entry : environments_)
+    count += (entry.second.environment.expired()) ? 0 : 1;
+
+  return count;
+}
+
+void JointTrajectoryEnvironmentCache::clear()
+{
+  environments_.clear();
+  base_fingerprints_.clear();
+}
+
+std::uint64_t JointTrajectoryEnvironmentCache::getBaseFingerprint(
+    const std::shared_ptr<const tesseract::environment::Environment>& base)
+{
+  auto& entry = base_fingerprints_[base.get()];
+
+  // The address may have been reused by a new environment once the previous one was released
+  if (entry.environment.lock() != base || entry.revision != base->getRevision())
+  {
+    entry.environment = base;
+    entry.revision = base->getRevision();
+    entry.fingerprint = getCommandsFingerprint(base->getCommandHistory());
+  }
+
+  return entry.fingerprint;
+}
+
+std::shared_ptr<tesseract::environment::Environment> JointTrajectoryEnvironmentCache::find(std::uint64_t fingerprint,
+                                                                                           int revision)
+{
+  auto it = environments_.find(fingerprint);
+  if (it == environments_.end() || it->second.revision != revision)
+    return nullptr;
+
+  return it->second.environment.lock();
+}
+
+void JointTrajectoryEnvironmentCache::prune()
+{
+  for (auto it = environments_.begin(); it != environments_.end();)
+    it = (it->second.environment.expired()) ? environments_.erase(it) : std::next(it);
+
+  for (auto it = base_fingerprints_.begin(); it != base_fingerprints_.end();)
+    it = (it->second.environment.expired()) ? base_fingerprints_.erase(it) : std::next(it);
+}
+}  // namespace tesseract::gui
@@ -22,26 +22,29 @@
  */
 
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_info_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_set_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_state_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/models/standard_item_utils.h>
 #include <tesseract_qt/common/icon_utils.h>
 
 #include <tesseract_qt/common/joint_trajectory_set.h>
 
+#include <algorithm>
+
 namespace tesseract::gui
 {
 JointTrajectoryInfoItem::JointTrajectoryInfoItem(tesseract::common::JointTrajectoryInfo& trajectory_info)
   : trajectory_info(trajectory_info)
 {
-  ctor();
 }
 
 JointTrajectoryInfoItem::JointTrajectoryInfoItem(const QString& text,
                                                  tesseract::common::JointTrajectoryInfo& trajectory_info)
   : QStandardItem(icons::getTrajectoryIcon(), text), trajectory_info(trajectory_info)
 {
-  ctor();
 }
 
 JointTrajectoryInfoItem::JointTrajectoryInfoItem(const QIcon& icon,
@@ -49,7 +52,6 @@ JointTrajectoryInfoItem::JointTrajectoryInfoItem(const QIcon& icon,
                                                  tesseract::common::JointTrajectoryInfo& trajectory_info)
   : QStandardItem(icon, text), trajectory_info(trajectory_info)
 {
-  ctor();
 }
 
 int JointTrajectoryInfoItem::type() const
@@ -57,13 +59,56 @@ int JointTrajectoryInfoItem::type() const
   return static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET_TRAJECTORY);
 }
 
-void JointTrajectoryInfoItem::ctor()
+const int JointTrajectoryInfoItem::FETCH_BATCH_SIZE = 256;
+
+JointTrajectorySetItem* JointTrajectoryInfoItem::getArchivedSetItem() const
 {
-  for (std::size_t j = 0; j < trajectory_info.joint_trajectory.size(); ++j)
+  auto* set_item = dynamic_cast<JointTrajectorySetItem*>(parent());
+  if (set_item == nullptr || set_item->getArchive() == nullptr)
+    return nullptr;
+
+  return set_item;
+}
+
+bool JointTrajectoryInfoItem::canFetchMore() const
+{
+  // The states of an archived trajectory are not read until its items are shown
+  if (const JointTrajectorySetItem* set_item = getArchivedSetItem())
+    return (static_cast<std::size_t>(rowCount()) <
+            set_item->getArchive()->getStateCount(set_item->getArchiveIndex(static_cast<std::size_t>(row()))));
+
+  return (static_cast<std::size_t>(rowCount()) < trajectory_info.joint_trajectory.size());
+}
+
+void JointTrajectoryInfoItem::fetchMore(int count)
+{
+  if (JointTrajectorySetItem* set_item = getArchivedSetItem())
+    set_item->load();
+
+  const auto begin = static_cast<std::size_t>(rowCount());
+  const std::size_t end = std::min(begin + static_cast<std::size_t>(count), trajectory_info.joint_trajectory.size());
+  if (begin >= end)
+    return;
+
+  QList<QStandardItem*> items;
+  items.reserve(static_cast<int>(end - begin));
+  for (std::size_t j = begin; j < end; ++j)
+    items.append(new JointTrajectoryStateItem(QString("state[%1]").arg(j), trajectory_info.joint_trajectory[j]));
+
+  insertRows(rowCount(), items);
+}
+
+std::shared_ptr<const JointTrajectoryBuffer> JointTrajectoryInfoItem::getBuffer() const
+{
+  if (buffer_ == nullptr)
   {
-    QStandardItem* trajectory_state =
-        new JointTrajectoryStateItem(QString("state[%1]").arg(j), trajectory_info.joint_trajectory[j]);
-    appendRow(trajectory_state);
+    // An archived trajectory is copied straight from the mapped columns without creating its states
+    if (const JointTrajectorySetItem* set_item = getArchivedSetItem())
+      buffer_ = set_item->getArchive()->getBuffer(set_item->getArchiveIndex(static_cast<std::size_t>(row())));
+    else
+      buffer_ = std::make_shared<const JointTrajectoryBuffer>(trajectory_info.joint_trajectory);
   }
+
+  return buffer_;
 }
 }  // namespace tesseract::gui
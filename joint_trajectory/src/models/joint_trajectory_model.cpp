@@ -24,6 +24,10 @@
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_set_item.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_info_item.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_state_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_utils.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_environment_cache.h>
 
 #include <tesseract_qt/common/events/joint_trajectory_events.h>
 #include <tesseract_qt/common/models/namespace_standard_item.h>
@@ -50,6 +54,7 @@ struct JointTrajectoryModel::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
   std::map<boost::uuids::uuid, QStandardItem*> trajectory_sets;
+  JointTrajectoryEnvironmentCache environment_cache;
 };
 
 JointTrajectoryModel::JointTrajectoryModel(QObject* parent) : JointTrajectoryModel(nullptr, parent) {}
@@ -96,39 +101,39 @@ void JointTrajectoryModel::clearNamespace(const std::string& ns)
   }
 }
 
-void JointTrajectoryModel::addJointTrajectorySet(tesseract::common::JointTrajectorySet trajectory_set)
+void JointTrajectoryModel::addJointTrajectorySet(tesseract::common::JointTrajectorySet trajectory_set,
+                                                 std::shared_ptr<const JointTrajectoryArchive> archive,
+                                                 std::size_t archive_set)
 {
+  // Sets describing the same scene share a single environment so switching between them does not rebuild the scene
+  std::shared_ptr<const tesseract::environment::Environment> base_env;
   if (trajectory_set.getEnvironment() == nullptr)
   {
     auto env_wrapper = EnvironmentManager::find(data_->component_info);
+    if (env_wrapper == nullptr)
+      env_wrapper = EnvironmentManager::getDefault();
+
     if (env_wrapper != nullptr)
-    {
-      auto env = env_wrapper->getEnvironment();
-      if (env != nullptr && env->isInitialized())
-        trajectory_set.applyEnvironment(env->clone());
-    }
-    else
-    {
-      auto env_wrapper = EnvironmentManager::getDefault();
-      if (env_wrapper != nullptr)
-      {
-        auto env = env_wrapper->getEnvironment();
-        if (env != nullptr && env->isInitialized())
-          trajectory_set.applyEnvironment(env->clone());
-      }
-    }
+      base_env = env_wrapper->getEnvironment();
   }
+  data_->environment_cache.share(trajectory_set, base_env);
 
   boost::uuids::uuid uuid = trajectory_set.getUUID();
   std::string ns = (trajectory_set.getNamespace().empty()) ? "general" : trajectory_set.getNamespace();
   NamespaceStandardItem* item = createNamespaceItem(*invisibleRootItem(), ns);
 
-  auto* trajectory_container_item = new JointTrajectorySetItem(trajectory_set);
+  auto* trajectory_container_item = new JointTrajectorySetItem(trajectory_set, std::move(archive), archive_set);
   auto* trajectory_description_item = new QStandardItem(QString::fromStdString(trajectory_set.getDescription()));
   item->appendRow({ trajectory_container_item, trajectory_description_item });
   data_->trajectory_sets[uuid] = trajectory_container_item;
 }
 
+void JointTrajectoryModel::addJointTrajectoryArchive(const std::shared_ptr<const JointTrajectoryArchive>& archive)
+{
+  for (std::size_t s = 0; s < archive->getSetCount(); ++s)
+    addJointTrajectorySet(loadJointTrajectorySet(*archive, s, false), archive, s);
+}
+
 void JointTrajectoryModel::removeJointTrajectorySet(const boost::uuids::uuid& uuid)
 {
   auto it = data_->trajectory_sets.find(uuid);
@@ -184,6 +189,14 @@ JointTrajectoryInfoItem* findJointTrajectoryInfoItem(QStandardItem* item)
   return findJointTrajectoryInfoItem(item->parent());
 }
 
+JointTrajectorySetItem* findJointTrajectorySetItem(QStandardItem* item)
+{
+  if (item->type() == static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET))
+    return dynamic_cast<JointTrajectorySetItem*>(item);
+
+  return findJointTrajectorySetItem(item->parent());
+}
+
 tesseract::common::JointTrajectoryInfo JointTrajectoryModel::getJointTrajectory(const QModelIndex& row) const
 {
   QStandardItem* item = itemFromIndex(row);
@@ -191,21 +204,52 @@ tesseract::common::JointTrajectoryInfo JointTrajectoryModel::getJointTrajectory(
   if (item->type() == static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET))
     throw std::runtime_error("Cannot get joint trajectory from selected trajectory set standard item");
 
-  return findJointTrajectoryInfoItem(item)->trajectory_info;
+  JointTrajectoryInfoItem* info_item = findJointTrajectoryInfoItem(item);
+  findJointTrajectorySetItem(info_item)->load();
+  return info_item->trajectory_info;
 }
 
-JointTrajectorySetItem* findJointTrajectorySetItem(QStandardItem* item)
+const tesseract::common::JointTrajectorySet& JointTrajectoryModel::getJointTrajectorySet(const QModelIndex& row) const
 {
+  QStandardItem* item = itemFromIndex(row);
+  return findJointTrajectorySetItem(item)->trajectory_set;
+}
+
+std::shared_ptr<const JointTrajectoryBuffer>
+JointTrajectoryModel::getJointTrajectoryBuffer(const QModelIndex& row) const
+{
+  QStandardItem* item = itemFromIndex(row);
+
   if (item->type() == static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET))
-    return dynamic_cast<JointTrajectorySetItem*>(item);
+    return static_cast<JointTrajectorySetItem*>(item)->getBuffer();
 
-  return findJointTrajectorySetItem(item->parent());
+  return findJointTrajectoryInfoItem(item)->getBuffer();
 }
 
-tesseract::common::JointTrajectorySet JointTrajectoryModel::getJointTrajectorySet(const QModelIndex& row) const
+bool JointTrajectoryModel::hasChildren(const QModelIndex& parent) const
 {
-  QStandardItem* item = itemFromIndex(row);
-  return findJointTrajectorySetItem(item)->trajectory_set;
+  if (canFetchMore(parent))
+    return true;
+
+  return QStandardItemModel::hasChildren(parent);
+}
+
+bool JointTrajectoryModel::canFetchMore(const QModelIndex& parent) const
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET_TRAJECTORY))
+    return false;
+
+  return static_cast<JointTrajectoryInfoItem*>(item)->canFetchMore();
+}
+
+void JointTrajectoryModel::fetchMore(const QModelIndex& parent)
+{
+  QStandardItem* item = itemFromIndex(parent);
+  if (item == nullptr || item->type() != static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET_TRAJECTORY))
+    return;
+
+  static_cast<JointTrajectoryInfoItem*>(item)->fetchMore();
 }
 
 bool JointTrajectoryModel::eventFilter(QObject* obj, QEvent* event)
@@ -231,6 +275,13 @@ bool JointTrajectoryModel::eventFilter(QObject* obj, QEvent* event)
       addJointTrajectorySet(e->getJointTrajectory());
     }
   }
+  else if (event->type() == events::EventType::JOINT_TRAJECTORY_ARCHIVE_ADD)
+  {
+    assert(dynamic_cast<events::JointTrajectoryArchiveAdd*>(event) != nullptr);
+    auto* e = static_cast<events::JointTrajectoryArchiveAdd*>(event);
+    if (e->getComponentInfo() == data_->component_info)
+      addJointTrajectoryArchive(e->getArchive());
+  }
   else if (event->type() == events::EventType::JOINT_TRAJECTORY_REMOVE)
   {
     assert(dynamic_cast<events::JointTrajectoryRemove*>(event) != nullptr);
@@ -23,6 +23,9 @@
 
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_set_item.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_info_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_utils.h>
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/models/standard_item_utils.h>
 #include <tesseract_qt/common/icon_utils.h>
@@ -52,6 +55,20 @@ JointTrajectorySetItem::JointTrajectorySetItem(const QIcon& icon,
   ctor();
 }
 
+JointTrajectorySetItem::JointTrajectorySetItem(const tesseract::common::JointTrajectorySet& trajectory_set,
+                                               std::shared_ptr<const JointTrajectoryArchive> archive,
+                                               std::size_t archive_set)
+  : QStandardItem(icons::getSetIcon(),
+                  trajectory_set.getDescription().empty() ? "Trajectory Set" :
+                                                            QString::fromStdString(trajectory_set.getDescription()))
+  , trajectory_set(trajectory_set)
+  , archive_(std::move(archive))
+  , archive_set_(archive_set)
+  , loaded_(archive_ == nullptr)
+{
+  ctor();
+}
+
 int JointTrajectorySetItem::type() const { return static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET); }
 
 void JointTrajectorySetItem::ctor()
@@ -66,4 +83,40 @@ void JointTrajectorySetItem::ctor()
     appendRow(trajectory_item);
   }
 }
+
+std::shared_ptr<const JointTrajectoryBuffer> JointTrajectorySetItem::getBuffer()
+{
+  if (buffer_ == nullptr)
+  {
+    load();
+
+    std::vector<const tesseract::common::JointTrajectory*> trajectories;
+    trajectories.reserve(trajectory_set.size());
+    for (const auto& t : trajectory_set.getJointTrajectories())
+      trajectories.push_back(&t.joint_trajectory);
+
+    buffer_ = std::make_shared<const JointTrajectoryBuffer>(trajectories);
+  }
+
+  return buffer_;
+}
+
+const std::shared_ptr<const JointTrajectoryArchive>& JointTrajectorySetItem::getArchive() const { return archive_; }
+
+std::size_t JointTrajectorySetItem::getArchiveIndex(std::size_t i) const
+{
+  return archive_->getSetTrajectories(archive_set_).at(i);
+}
+
+void JointTrajectorySetItem::load()
+{
+  if (loaded_)
+    return;
+
+  const tesseract::common::JointTrajectorySet loaded = loadJointTrajectorySet(*archive_, archive_set_);
+  for (std::size_t i = 0; i < trajectory_set.size(); ++i)
+    trajectory_set[i] = loaded[i];
+
+  loaded_ = true;
+}
 }  // namespace tesseract::gui
@@ -22,9 +22,12 @@
  */
 
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_utils.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_archive.h>
 
 #include <tesseract_qt/common/events/joint_trajectory_events.h>
+#include <tesseract_qt/common/events/status_log_events.h>
 #include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/background_loader.h>
 #include <tesseract_qt/common/joint_trajectory_set.h>
 #include <tesseract_qt/common/cereal_serialization.h>
 
@@ -43,72 +46,151 @@
 
 namespace tesseract::gui
 {
-bool openJointTrajectorySet(const std::shared_ptr<const ComponentInfo>& component_info,
+namespace
+{
+tesseract::common::JointTrajectorySet
+toJointTrajectorySet(const tesseract::command_language::InstructionPoly& instruction)
+{
+  const auto& cpi = instruction.as<tesseract::command_language::CompositeInstruction>();
+  tesseract::common::JointTrajectory jt = tesseract::command_language::toJointTrajectory(cpi);
+  if (jt.empty())
+    return {};
+
+  std::unordered_map<std::string, double> initial_state;
+  for (std::size_t i = 0; i < jt.states.front().joint_names.size(); ++i)
+    initial_state[jt.states.front().joint_names[i]] = jt.states.front().position[i];
+
+  tesseract::common::JointTrajectorySet jts(initial_state, jt.description);
+  jts.appendJointTrajectory(jt);
+  return jts;
+}
+}  // namespace
+
+tesseract::common::JointTrajectorySet
+loadJointTrajectorySet(const JointTrajectoryArchive& archive, std::size_t s, bool load_trajectories)
+{
+  tesseract::common::JointTrajectorySet jts(archive.getSetInitialState(s), archive.getSetDescription(s));
+  jts.setNamespace(archive.getSetNamespace(s));
+  for (std::size_t i : archive.getSetTrajectories(s))
+  {
+    if (load_trajectories)
+    {
+      jts.appendJointTrajectory(archive.getJointTrajectory(i));
+    }
+    else
+    {
+      tesseract::common::JointTrajectory jt;
+      jt.description = archive.getDescription(i);
+      jts.appendJointTrajectory(jt);
+    }
+  }
+
+  return jts;
+}
+
+bool loadJointTrajectorySet(tesseract::common::JointTrajectorySet& joint_trajectory_set,
                             const QString& filename,
                             const QString& suffix)
 {
   QFileInfo file_info(filename);
-  tesseract::common::JointTrajectorySet joint_trajectory_set;
-  if (suffix == "jtsx" && file_info.suffix() == "jtsx")
+  if (suffix != file_info.suffix())
+    return false;
+
+  if (suffix == "jtsx")
   {
-    auto jts = tesseract::common::Serialization::fromArchiveFileXML<tesseract::common::JointTrajectorySet>(
+    joint_trajectory_set = tesseract::common::Serialization::fromArchiveFileXML<tesseract::common::JointTrajectorySet>(
         filename.toStdString());
-
-    events::JointTrajectoryAdd event(component_info, std::move(jts));
-    QApplication::sendEvent(qApp, &event);
     return true;
   }
 
-  if (suffix == "jtsb" && file_info.suffix() == "jtsb")
+  if (suffix == "jtsb")
   {
-    auto jts = tesseract::common::Serialization::fromArchiveFileBinary<tesseract::common::JointTrajectorySet>(
-        filename.toStdString());
-    events::JointTrajectoryAdd event(component_info, std::move(jts));
-    QApplication::sendEvent(qApp, &event);
+    joint_trajectory_set =
+        tesseract::common::Serialization::fromArchiveFileBinary<tesseract::common::JointTrajectorySet>(
+            filename.toStdString());
     return true;
   }
 
-  if (suffix == "cpix" && file_info.suffix() == "cpix")
+  if (suffix == "cpix")
   {
-    auto cpi = tesseract::common::Serialization::fromArchiveFileXML<tesseract::command_language::InstructionPoly>(
-                   filename.toStdString())
-                   .as<tesseract::command_language::CompositeInstruction>();
-    tesseract::common::JointTrajectory jt = tesseract::command_language::toJointTrajectory(cpi);
-    if (jt.empty())
-      return false;
+    joint_trajectory_set = toJointTrajectorySet(
+        tesseract::common::Serialization::fromArchiveFileXML<tesseract::command_language::InstructionPoly>(
+            filename.toStdString()));
+    return (joint_trajectory_set.size() > 0);
+  }
 
-    std::unordered_map<std::string, double> initial_state;
-    for (std::size_t i = 0; i < jt.states.front().joint_names.size(); ++i)
-      initial_state[jt.states.front().joint_names[i]] = jt.states.front().position[i];
+  if (suffix == "cpib")
+  {
+    joint_trajectory_set = toJointTrajectorySet(
+        tesseract::common::Serialization::fromArchiveFileBinary<tesseract::command_language::InstructionPoly>(
+            filename.toStdString()));
+    return (joint_trajectory_set.size() > 0);
+  }
 
-    tesseract::common::JointTrajectorySet jts(initial_state, jt.description);
-    jts.appendJointTrajectory(jt);
+  return false;
+}
 
-    events::JointTrajectoryAdd event(component_info, std::move(jts));
-    QApplication::sendEvent(qApp, &event);
-    return true;
-  }
+void openJointTrajectorySetAsync(BackgroundLoader& loader,
+                                 const std::shared_ptr<const ComponentInfo>& component_info,
+                                 const QString& filename,
+                                 const QString& suffix)
+{
+  auto job = [component_info, filename, suffix](BackgroundLoader::Context& context) {
+    // Only the index of an archive is read, the model keeps it open and reads trajectories when they are used
+    if (suffix == "jta" && QFileInfo(filename).suffix() == "jta")
+    {
+      context.setProgress(-1, "Reading index");
+      auto archive = std::make_shared<const JointTrajectoryArchive>(filename.toStdString());
+      if (context.isCanceled())
+        return false;
+
+      context.deliver([component_info, archive]() {
+        events::JointTrajectoryArchiveAdd event(component_info, archive);
+        QApplication::sendEvent(qApp, &event);
+      });
+      context.setProgress(100);
+      return true;
+    }
+
+    context.setProgress(-1, "Decoding");
+    auto jts = std::make_shared<tesseract::common::JointTrajectorySet>();
+    if (!loadJointTrajectorySet(*jts, filename, suffix))
+      return false;
 
-  if (suffix == "cpib" && file_info.suffix() == "cpib")
-  {
-    auto cpi = tesseract::common::Serialization::fromArchiveFileBinary<tesseract::command_language::InstructionPoly>(
-                   filename.toStdString())
-                   .as<tesseract::command_language::CompositeInstruction>();
-    tesseract::common::JointTrajectory jt = tesseract::command_language::toJointTrajectory(cpi);
-    if (jt.empty())
+    if (context.isCanceled())
       return false;
 
-    std::unordered_map<std::string, double> initial_state;
-    for (std::size_t i = 0; i < jt.states.front().joint_names.size(); ++i)
-      initial_state[jt.states.front().joint_names[i]] = jt.states.front().position[i];
+    context.setProgress(90, "Adding trajectory set");
+    context.deliver([component_info, jts]() {
+      events::JointTrajectoryAdd event(component_info, std::move(*jts));
+      QApplication::sendEvent(qApp, &event);
+    });
+    context.setProgress(100);
+    return true;
+  };
+
+  loader.load(QFileInfo(filename).fileName(), std::move(job));
+}
 
-    tesseract::common::JointTrajectorySet jts(initial_state, jt.description);
-    events::JointTrajectoryAdd event(component_info, std::move(jts));
+bool openJointTrajectorySet(const std::shared_ptr<const ComponentInfo>& component_info,
+                            const QString& filename,
+                            const QString& suffix)
+{
+  if (suffix == "jta" && QFileInfo(filename).suffix() == "jta")
+  {
+    auto archive = std::make_shared<const JointTrajectoryArchive>(filename.toStdString());
+    events::JointTrajectoryArchiveAdd event(component_info, archive);
     QApplication::sendEvent(qApp, &event);
     return true;
   }
 
-  return false;
+  tesseract::common::JointTrajectorySet jts;
+  if (!loadJointTrajectorySet(jts, filename, suffix))
+    return false;
+
+  events::JointTrajectoryAdd event(component_info, std::move(jts));
+  QApplication::sendEvent(qApp, &event);
+  return true;
 }
 
 bool saveJointTrajectorySet(const tesseract::common::JointTrajectorySet& jts, QString filename, const QString& suffix)
@@ -124,6 +206,26 @@ bool saveJointTrajectorySet(const tesseract::common::JointTrajectorySet& jts, QS
     return true;
   }
 
+  if (suffix == "jta")
+  {
+    // The archive only stores trajectories, refuse instead of silently dropping the environment
+    if (jts.getEnvironment() != nullptr || !jts.getEnvironmentCommands().empty())
+    {
+      events::StatusLogWarn event("Joint trajectory archives (jta) cannot store the environment of trajectory set '" +
+                                  QString::fromStdString(jts.getDescription()) + "', use jtsx or jtsb instead");
+      QApplication::sendEvent(qApp, &event);
+      return false;
+    }
+
+    if (file_info.suffix() != "jta")
+      filename = file_info.absolutePath() + QDir::separator() + file_info.baseName() + ".jta";
+
+    JointTrajectoryArchiveWriter writer(filename.toStdString());
+    writer.append(jts);
+    writer.close();
+    return true;
+  }
+
   if (suffix == "jtsb")
   {
     if (file_info.suffix() != "jtsb")
@@ -23,72 +23,60 @@
 #include "ui_joint_trajectory_plot_dialog.h"
 #include <tesseract_qt/joint_trajectory/widgets/joint_trajectory_plot_dialog.h>
 #include <tesseract_qt/plot/plot_subplots.h>
-#include <tesseract_qt/common/joint_trajectory_set.h>
+#include <tesseract_qt/plot/plot_widget.h>
+
+#include <cmath>
 
 const double SLIDER_RESOLUTION = 0.001;
 
 namespace tesseract::gui
 {
-JointTrajectoryPlotDialog::JointTrajectoryPlotDialog(tesseract::common::JointTrajectoryInfo current_trajectory,
+JointTrajectoryPlotDialog::JointTrajectoryPlotDialog(std::shared_ptr<const JointTrajectoryBuffer> trajectory,
                                                      QWidget* parent)
-  : QDialog(parent), ui_(std::make_unique<Ui::JointTrajectoryPlotDialog>())
+  : QDialog(parent), ui_(std::make_unique<Ui::JointTrajectoryPlotDialog>()), trajectory_(std::move(trajectory))
 {
   ui_->setupUi(this);
 
-  ui_->jtpHorizontalSlider->setMinimum(current_trajectory.joint_trajectory.front().time / SLIDER_RESOLUTION);
-  ui_->jtpHorizontalSlider->setMaximum(current_trajectory.joint_trajectory.back().time / SLIDER_RESOLUTION);
+  ui_->jtpHorizontalSlider->setMinimum(trajectory_->getTimeBegin() / SLIDER_RESOLUTION);
+  ui_->jtpHorizontalSlider->setMaximum(trajectory_->getTimeEnd() / SLIDER_RESOLUTION);
   ui_->jtpHorizontalSlider->setSliderPosition(0);
 
   plot_data_map_.clear();
 
-  const std::vector<std::string> joint_names = current_trajectory.joint_trajectory[0].joint_names;
-
-  for (std::size_t i = 0; i < joint_names.size(); ++i)
-  {
-    tesseract::gui::PlotData& position = plot_data_map_.getOrCreateNumeric(joint_names[i] + "::position");
-    tesseract::gui::PlotData& velocity = plot_data_map_.getOrCreateNumeric(joint_names[i] + "::velocity");
-    tesseract::gui::PlotData& acceleration = plot_data_map_.getOrCreateNumeric(joint_names[i] + "::acceleration");
-    double ct{ 0 };
-    for (const auto& state : current_trajectory.joint_trajectory)
-    {
-      position.pushBack(tesseract::gui::PlotDataXY::Point(state.time, state.position(i)));
-      velocity.pushBack(tesseract::gui::PlotDataXY::Point(state.time, state.velocity(i)));
-      acceleration.pushBack(tesseract::gui::PlotDataXY::Point(state.time, state.acceleration(i)));
-    }
-  }
-
-  position_subplots_ = new tesseract::gui::PlotSubplots(plot_data_map_, joint_names.size(), 1);
-  for (std::size_t i = 0; i < joint_names.size(); ++i)
-  {
-    tesseract::gui::PlotWidget* widget = position_subplots_->getSubplot(i, 0);
-    widget->addCurve(joint_names[i] + "::position");
-    if (i == joint_names.size() - 1)
-      widget->setXAxisTitle("Time (seconds)");
-    widget->setYAxisTitle("Units (rad)");
-    widget->enableTracker(true);
-    widget->zoomOut(true);
-    widget->replot();
+  position_subplots_ = createSubplots(JointTrajectoryBuffer::Quantity::POSITION, "position", "Units (rad)");
+  ui_->jtpTabWidget->addTab(position_subplots_, tr("Position"));
 
-    QObject::connect(widget, &tesseract::gui::PlotWidget::trackerMoved, [this](QPointF pos) {
-      onSliderMoved(pos.x() / SLIDER_RESOLUTION);
-      this->ui_->jtpHorizontalSlider->blockSignals(true);
-      this->ui_->jtpHorizontalSlider->setValue(pos.x() / SLIDER_RESOLUTION);
-      this->ui_->jtpHorizontalSlider->blockSignals(false);
-    });
-  }
+  velocity_subplots_ = createSubplots(JointTrajectoryBuffer::Quantity::VELOCITY, "velocity", "Units (rad/sec)");
+  ui_->jtpTabWidget->addTab(velocity_subplots_, tr("Velocity"));
 
-  ui_->jtpTabWidget->addTab(position_subplots_, tr("Position"));
+  acceleration_subplots_ =
+      createSubplots(JointTrajectoryBuffer::Quantity::ACCELERATION, "acceleration", "Units (rad/sec^2)");
+  ui_->jtpTabWidget->addTab(acceleration_subplots_, tr("Acceleration"));
 
   connect(ui_->jtpTabWidget, SIGNAL(currentChanged(int)), this, SLOT(onTabIndexChanged(int)));
+  connect(ui_->jtpHorizontalSlider, SIGNAL(sliderMoved(int)), this, SLOT(onSliderMoved(int)));
+}
 
-  velocity_subplots_ = new tesseract::gui::PlotSubplots(plot_data_map_, joint_names.size(), 1);
+PlotSubplots* JointTrajectoryPlotDialog::createSubplots(JointTrajectoryBuffer::Quantity quantity,
+                                                        const std::string& suffix,
+                                                        const QString& y_axis_title)
+{
+  const std::vector<std::string>& joint_names = trajectory_->getJointNames();
+  const JointTrajectoryBuffer::Matrix& values = trajectory_->getValues(quantity);
+  const double* time = trajectory_->getTime().data();
+
+  auto* subplots = new tesseract::gui::PlotSubplots(plot_data_map_, static_cast<int>(joint_names.size()), 1);
   for (std::size_t i = 0; i < joint_names.size(); ++i)
   {
-    tesseract::gui::PlotWidget* widget = velocity_subplots_->getSubplot(i, 0);
-    widget->addCurve(joint_names[i] + "::velocity");
+    // The curve reads the joint column of the shared buffer directly, the buffer is kept alive by the series
+    const double* column = values.col(static_cast<Eigen::Index>(i)).data();
+    auto* series = new ColumnTimeseries(joint_names[i] + "::" + suffix, time, column, trajectory_->size(), trajectory_);
+
+    tesseract::gui::PlotWidget* widget = subplots->getSubplot(static_cast<int>(i), 0);
+    widget->addCurve(joint_names[i] + "::" + suffix, series);
     if (i == joint_names.size() - 1)
       widget->setXAxisTitle("Time (seconds)");
-    widget->setYAxisTitle("Units (rad/sec)");
+    widget->setYAxisTitle(y_axis_title);
     widget->enableTracker(true);
     widget->zoomOut(true);
     widget->replot();
@@ -101,37 +89,58 @@ JointTrajectoryPlotDialog::JointTrajectoryPlotDialog(tesseract::common::JointTra
     });
   }
 
-  ui_->jtpTabWidget->addTab(velocity_subplots_, tr("Velocity"));
-  connect(ui_->jtpTabWidget, SIGNAL(currentChanged(int)), this, SLOT(onTabIndexChanged(int)));
+  return subplots;
+}
 
-  acceleration_subplots_ = new tesseract::gui::PlotSubplots(plot_data_map_, joint_names.size(), 1);
-  for (std::size_t i = 0; i < joint_names.size(); ++i)
-  {
-    tesseract::gui::PlotWidget* widget = acceleration_subplots_->getSubplot(i, 0);
-    widget->addCurve(joint_names[i] + "::acceleration");
-    if (i == joint_names.size() - 1)
-      widget->setXAxisTitle("Time (seconds)");
-    widget->setYAxisTitle("Units (rad/sec^2)");
-    widget->enableTracker(true);
-    widget->zoomOut(true);
-    widget->replot();
+JointTrajectoryPlotDialog::~JointTrajectoryPlotDialog() = default;
 
-    QObject::connect(widget, &tesseract::gui::PlotWidget::trackerMoved, [this](QPointF pos) {
-      onSliderMoved(pos.x() / SLIDER_RESOLUTION);
-      this->ui_->jtpHorizontalSlider->blockSignals(true);
-      this->ui_->jtpHorizontalSlider->setValue(pos.x() / SLIDER_RESOLUTION);
-      this->ui_->jtpHorizontalSlider->blockSignals(false);
-    });
+void JointTrajectoryPlotDialog::setContactResults(const ContactResultTimeline& contact_results,
+                                                  double no_contact_distance)
+{
+  struct DistanceSeries
+  {
+    std::vector<double> time;
+    std::vector<double> distance;
+  };
+
+  auto series_data = std::make_shared<DistanceSeries>();
+  series_data->time.reserve(contact_results.size());
+  series_data->distance.reserve(contact_results.size());
+  for (const auto& entry : contact_results)
+  {
+    series_data->time.push_back(entry.time);
+    series_data->distance.push_back(std::isfinite(entry.min_distance) ? entry.min_distance : no_contact_distance);
   }
 
-  ui_->jtpTabWidget->addTab(acceleration_subplots_, tr("Acceleration"));
-  connect(ui_->jtpTabWidget, SIGNAL(currentChanged(int)), this, SLOT(onTabIndexChanged(int)));
+  if (contact_subplots_ != nullptr)
+  {
+    ui_->jtpTabWidget->removeTab(ui_->jtpTabWidget->indexOf(contact_subplots_));
+    delete contact_subplots_;
+  }
 
-  connect(ui_->jtpHorizontalSlider, SIGNAL(sliderMoved(int)), this, SLOT(onSliderMoved(int)));
+  const std::string name = "contact::min_distance";
+  auto* series = new ColumnTimeseries(
+      name, series_data->time.data(), series_data->distance.data(), series_data->time.size(), series_data);
+
+  contact_subplots_ = new tesseract::gui::PlotSubplots(plot_data_map_, 1, 1);
+  tesseract::gui::PlotWidget* widget = contact_subplots_->getSubplot(0, 0);
+  widget->addCurve(name, series);
+  widget->setXAxisTitle("Time (seconds)");
+  widget->setYAxisTitle("Minimum Distance (m)");
+  widget->enableTracker(true);
+  widget->zoomOut(true);
+  widget->replot();
+
+  QObject::connect(widget, &tesseract::gui::PlotWidget::trackerMoved, [this](QPointF pos) {
+    onSliderMoved(pos.x() / SLIDER_RESOLUTION);
+    this->ui_->jtpHorizontalSlider->blockSignals(true);
+    this->ui_->jtpHorizontalSlider->setValue(pos.x() / SLIDER_RESOLUTION);
+    this->ui_->jtpHorizontalSlider->blockSignals(false);
+  });
+
+  ui_->jtpTabWidget->addTab(contact_subplots_, tr("Contacts"));
 }
 
-JointTrajectoryPlotDialog::~JointTrajectoryPlotDialog() = default;
-
 void JointTrajectoryPlotDialog::onSliderMoved(int value)
 {
   const double t = SLIDER_RESOLUTION * value;
@@ -165,6 +174,13 @@ void JointTrajectoryPlotDialog::onSliderMoved(int value)
       w->replot();
     }
   }
+
+  if (contact_subplots_ != nullptr)
+  {
+    auto* w = contact_subplots_->getSubplot(0, 0);
+    w->setTrackerPosition(t);
+    w->replot();
+  }
 }
 
 void JointTrajectoryPlotDialog::onTabIndexChanged(int value)
@@ -175,5 +191,7 @@ void JointTrajectoryPlotDialog::onTabIndexChanged(int value)
     velocity_subplots_->replot();
   else if (value == 2)
     acceleration_subplots_->replot();
+  else if (value == 3 && contact_subplots_ != nullptr)
+    contact_subplots_->replot();
 }
 }  // namespace tesseract::gui
@@ -27,6 +27,7 @@
 #include <tesseract_qt/common/component_info.h>
 #include <QApplication>
 #include <QMessageBox>
+#include <QSpinBox>
 
 namespace tesseract::gui
 {
@@ -39,6 +40,8 @@ struct JointTrajectoryToolBar::Implementation
   QAction* open_action{ nullptr };
   QAction* save_action{ nullptr };
   QAction* plot_action{ nullptr };
+  QAction* ghost_action{ nullptr };
+  QSpinBox* ghost_sample_count{ nullptr };
 
   QAction* component_info_action{ nullptr };
 };
@@ -72,6 +75,25 @@ JointTrajectoryToolBar::JointTrajectoryToolBar(std::shared_ptr<const ComponentIn
     QApplication::sendEvent(qApp, &event);
   });
   addSeparator();
+  data_->ghost_action = addAction(icons::getTrajectoryIcon(), "Show Trajectory Ghost", [this](bool checked) {
+    events::JointTrajectoryGhost event(data_->component_info,
+                                       checked ? static_cast<std::size_t>(data_->ghost_sample_count->value()) : 0);
+    QApplication::sendEvent(qApp, &event);
+  });
+  data_->ghost_action->setCheckable(true);
+  data_->ghost_sample_count = new QSpinBox(this);
+  data_->ghost_sample_count->setRange(2, 100);
+  data_->ghost_sample_count->setValue(10);
+  data_->ghost_sample_count->setToolTip("Trajectory Ghost Samples");
+  connect(data_->ghost_sample_count, QOverload<int>::of(&QSpinBox::valueChanged), this, [this](int value) {
+    if (!data_->ghost_action->isChecked())
+      return;
+
+    events::JointTrajectoryGhost event(data_->component_info, static_cast<std::size_t>(value));
+    QApplication::sendEvent(qApp, &event);
+  });
+  addWidget(data_->ghost_sample_count);
+  addSeparator();
   data_->component_info_action = addAction(QIcon::fromTheme("dialog-information"), "Component Info", [this]() {
     if (data_->component_info != nullptr)
       QMessageBox::information(
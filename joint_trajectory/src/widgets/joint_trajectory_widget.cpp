@@ -24,6 +24,7 @@
 #include <tesseract_qt/joint_trajectory/widgets/joint_trajectory_plot_dialog.h>
 #include <tesseract_qt/joint_trajectory/widgets/joint_trajectory_widget.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_set_item.h>
+#include <tesseract_qt/joint_trajectory/models/joint_trajectory_buffer.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_model.h>
 #include <tesseract_qt/joint_trajectory/models/joint_trajectory_utils.h>
 
@@ -36,6 +37,7 @@
 
 #include <tesseract_qt/common/events/status_log_events.h>
 #include <tesseract_qt/common/events/joint_trajectory_events.h>
+#include <tesseract_qt/common/events/contact_results_events.h>
 #include <tesseract_qt/common/events/scene_graph_events.h>
 #include <tesseract_qt/common/environment_manager.h>
 #include <tesseract_qt/common/environment_wrapper.h>
@@ -43,10 +45,16 @@
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/icon_utils.h>
 #include <tesseract_qt/common/joint_trajectory_set.h>
+#include <tesseract_qt/common/background_loader.h>
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+#include <tesseract_qt/common/trajectory_contact_scan.h>
+#include <tesseract_qt/common/trajectory_ghost.h>
 
 #include <tesseract/common/joint_state.h>
 #include <tesseract/environment/environment.h>
-#include <tesseract/visualization/trajectory_player.h>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <set>
 
 #include <QTimer>
@@ -60,8 +68,8 @@ namespace tesseract::gui
 struct JointTrajectoryWidget::Implementation
 {
   std::shared_ptr<JointTrajectoryModel> model;
-  std::unique_ptr<tesseract::visualization::TrajectoryPlayer> player;
   std::unique_ptr<QTimer> player_timer;
+  std::chrono::steady_clock::time_point player_start;
   std::unique_ptr<JointTrajectoryPlotDialog> plot_dialog;
 
   QString default_directory;
@@ -72,11 +80,39 @@ struct JointTrajectoryWidget::Implementation
 
   std::unique_ptr<QFileDialog> save_dialog;
   QStringList save_dialog_filters;
+  QStringList save_dialog_ext;
+
+  /** @brief Decodes opened files on a worker thread */
+  std::unique_ptr<BackgroundLoader> loader;
+  std::unique_ptr<LoaderProgressDialog> loader_dialog;
 
   double current_duration{ 0 };
-  tesseract::common::JointTrajectoryInfo current_trajectory;
+
+  /** @brief The trajectory being played, shared with the model and the plot dialog */
+  std::shared_ptr<const JointTrajectoryBuffer> current_trajectory;
+
+  /** @brief The environment of the selected trajectory set, shared with the other sets of the same scene */
+  tesseract::environment::Environment::Ptr current_shared_environment;
+
+  /** @brief The environment driven by the player, a copy of the shared one when it is published */
   tesseract::environment::Environment::Ptr current_environment;
 
+  /** @brief The results of the last contact scan, the trajectory they belong to and the distance used for no contact */
+  std::shared_ptr<const ContactResultTimeline> contact_results;
+  std::shared_ptr<const JointTrajectoryBuffer> contact_results_trajectory;
+  double contact_results_no_contact_distance{ 0 };
+
+  /** @brief Computes the trajectory ghost, separate so a stale ghost can be canceled without canceling file loads */
+  std::unique_ptr<BackgroundLoader> ghost_loader;
+  std::unique_ptr<LoaderProgressDialog> ghost_loader_dialog;
+
+  /** @brief The number of states shown by the trajectory ghost, zero when it is hidden */
+  std::size_t ghost_sample_count{ 0 };
+
+  /** @brief The trajectory and sample count of the ghost shown or being computed */
+  std::shared_ptr<const JointTrajectoryBuffer> ghost_trajectory;
+  std::size_t ghost_trajectory_sample_count{ 0 };
+
   // Store the selected item
   QStandardItem* selected_item{ nullptr };
 };
@@ -97,7 +133,6 @@ JointTrajectoryWidget::JointTrajectoryWidget(std::shared_ptr<const ComponentInfo
       ms.value("default_directory", QStandardPaths::standardLocations(QStandardPaths::DocumentsLocation)[0]).toString();
   ms.endGroup();
 
-  data_->player = std::make_unique<tesseract::visualization::TrajectoryPlayer>();
   data_->player_timer = std::make_unique<QTimer>(this);
   data_->player_timer->start(10);
 
@@ -118,11 +153,13 @@ JointTrajectoryWidget::JointTrajectoryWidget(std::shared_ptr<const ComponentInfo
     data_->open_dialog_filters.append("Joint Trajectory Set Binary (*.jtsb)");
     data_->open_dialog_filters.append("Composite Instruction XML (*.cpix)");
     data_->open_dialog_filters.append("Composite Instruction Binary (*.cpib)");
+    data_->open_dialog_filters.append("Joint Trajectory Archive (*.jta)");
 
     data_->open_dialog_ext.append("jtsx");
     data_->open_dialog_ext.append("jtsb");
     data_->open_dialog_ext.append("cpix");
     data_->open_dialog_ext.append("cpib");
+    data_->open_dialog_ext.append("jta");
 
     data_->open_dialog = std::make_unique<QFileDialog>(nullptr, "Open Joint Trajectory Set", data_->default_directory);
     data_->open_dialog->setWindowModality(Qt::ApplicationModal);  // Required, see RenderWidget::onFrameSwapped()
@@ -136,6 +173,11 @@ JointTrajectoryWidget::JointTrajectoryWidget(std::shared_ptr<const ComponentInfo
   {  // Setup save dialog
     data_->save_dialog_filters.append("Joint Trajectory Set XML (*.jtsx)");
     data_->save_dialog_filters.append("Joint Trajectory Set Binary (*.jtsb)");
+    data_->save_dialog_filters.append("Joint Trajectory Archive (*.jta)");
+
+    data_->save_dialog_ext.append("jtsx");
+    data_->save_dialog_ext.append("jtsb");
+    data_->save_dialog_ext.append("jta");
 
     data_->save_dialog = std::make_unique<QFileDialog>(nullptr, "Save Joint Trajectory Set", data_->default_directory);
     data_->save_dialog->setWindowModality(Qt::ApplicationModal);  // Required, see RenderWidget::onFrameSwapped()
@@ -146,6 +188,13 @@ JointTrajectoryWidget::JointTrajectoryWidget(std::shared_ptr<const ComponentInfo
     connect(data_->save_dialog.get(), SIGNAL(finished(int)), this, SLOT(onSaveFinished(int)));
   }
 
+  {  // Setup background loading
+    data_->loader = std::make_unique<BackgroundLoader>();
+    data_->loader_dialog = std::make_unique<LoaderProgressDialog>(data_->loader.get(), this);
+    data_->ghost_loader = std::make_unique<BackgroundLoader>();
+    data_->ghost_loader_dialog = std::make_unique<LoaderProgressDialog>(data_->ghost_loader.get(), this);
+  }
+
   // Install event filter for interactive view controller
   qGuiApp->installEventFilter(this);
 }
@@ -204,13 +253,12 @@ void JointTrajectoryWidget::onSaveFinished(int results)
 {
   if (results == 1)
   {
-    tesseract::common::JointTrajectorySet jts =
-        dynamic_cast<JointTrajectorySetItem*>(data_->selected_item)->trajectory_set;
+    auto* jts_item = dynamic_cast<JointTrajectorySetItem*>(data_->selected_item);
+    jts_item->load();
+    tesseract::common::JointTrajectorySet jts = jts_item->trajectory_set;
+    int idx = data_->save_dialog_filters.indexOf(data_->save_dialog->selectedNameFilter());
     data_->default_directory = QFileInfo(data_->save_dialog->selectedFiles()[0]).absoluteDir().path();
-    saveJointTrajectorySet(jts,
-                           data_->save_dialog->selectedFiles()[0],
-                           (data_->save_dialog->selectedNameFilter() == data_->save_dialog_filters[0]) ? "jtsx" :
-                                                                                                         "jtsb");
+    saveJointTrajectorySet(jts, data_->save_dialog->selectedFiles()[0], data_->save_dialog_ext[idx]);
   }
 
   setEnabled(true);
@@ -222,8 +270,10 @@ void JointTrajectoryWidget::onOpenFinished(int results)
   {
     int idx = data_->open_dialog_filters.indexOf(data_->open_dialog->selectedNameFilter());
     data_->default_directory = QFileInfo(data_->open_dialog->selectedFiles()[0]).absoluteDir().path();
-    openJointTrajectorySet(
-        data_->model->getComponentInfo(), data_->open_dialog->selectedFiles()[0], data_->open_dialog_ext[idx]);
+    openJointTrajectorySetAsync(*data_->loader,
+                                data_->model->getComponentInfo(),
+                                data_->open_dialog->selectedFiles()[0],
+                                data_->open_dialog_ext[idx]);
   }
 }
 
@@ -237,17 +287,20 @@ void JointTrajectoryWidget::onRemove()
     QApplication::sendEvent(qApp, &event);
     data_->selected_item = nullptr;
     onDisablePlayer();
+    clearGhost();
   }
 }
 
 void JointTrajectoryWidget::onPlot()
 {
-  if (data_->current_trajectory.joint_trajectory.empty())
+  if (data_->current_trajectory == nullptr || data_->current_trajectory->empty())
     return;
 
   data_->plot_dialog = nullptr;
   data_->plot_dialog = std::make_unique<JointTrajectoryPlotDialog>(data_->current_trajectory);
   data_->plot_dialog->setWindowFlags(Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint);
+  if (data_->contact_results != nullptr && data_->contact_results_trajectory == data_->current_trajectory)
+    data_->plot_dialog->setContactResults(*data_->contact_results, data_->contact_results_no_contact_distance);
   data_->plot_dialog->show();
 }
 
@@ -276,33 +329,16 @@ void JointTrajectoryWidget::onCurrentRowChanged(const QModelIndex& current, cons
       event.plot_enabled = true;
       QApplication::sendEvent(qApp, &event);
 
-      data_->current_trajectory = data_->model->getJointTrajectory(current_index);
+      data_->current_trajectory = data_->model->getJointTrajectoryBuffer(current_index);
 
-      auto jts = data_->model->getJointTrajectorySet(current_index);
+      const auto& jts = data_->model->getJointTrajectorySet(current_index);
 
-      if (jts.getEnvironment() != nullptr && data_->current_environment != jts.getEnvironment() &&
-          jts.getEnvironment()->isInitialized())
-      {
-        data_->current_environment = jts.getEnvironment();
+      setCurrentEnvironment(jts.getEnvironment());
 
-        // If no parent then it using the top most so no need to overwrite existing environment
-        if (data_->model->getComponentInfo()->hasParent())
-        {
-          // Defer the EnvironmentManager::set() call to avoid blocking the UI
-          // Use a longer delay (100ms) to allow the UI to process other events first
-          constexpr int kDelayTimeMs = 100;
-          QTimer::singleShot(kDelayTimeMs, this, [this, jts, component_info = data_->model->getComponentInfo()]() {
-            auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(component_info, jts.getEnvironment());
-            EnvironmentManager::set(env_wrapper);
-          });
-        }
-      }
-
-      data_->player->setTrajectory(data_->current_trajectory.joint_trajectory);
-
-      if (!data_->current_trajectory.joint_trajectory.empty())
+      if (!data_->current_trajectory->empty())
         onEnablePlayer();
 
+      updateGhost();
       break;
     }
     case static_cast<int>(StandardItemType::JOINT_TRAJECTORY_SET):
@@ -313,37 +349,16 @@ void JointTrajectoryWidget::onCurrentRowChanged(const QModelIndex& current, cons
       event.plot_enabled = true;
       QApplication::sendEvent(qApp, &event);
 
-      auto jts = data_->model->getJointTrajectorySet(current_index);
-
-      if (jts.getEnvironment() != nullptr && data_->current_environment != jts.getEnvironment() &&
-          jts.getEnvironment()->isInitialized())
-      {
-        data_->current_environment = jts.getEnvironment();
-
-        // If no parent then it using the top most so no need to overwrite existing environment
-        if (data_->model->getComponentInfo()->hasParent())
-        {
-          // Defer the EnvironmentManager::set() call to avoid blocking the UI
-          // Use a longer delay (100ms) to allow the UI to process other events first
-          constexpr int kDelayTimeMs = 100;
-          QTimer::singleShot(kDelayTimeMs, this, [this, jts, component_info = data_->model->getComponentInfo()]() {
-            auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(component_info, jts.getEnvironment());
-            EnvironmentManager::set(env_wrapper);
-          });
-        }
-      }
+      const auto& jts = data_->model->getJointTrajectorySet(current_index);
 
-      data_->current_trajectory = tesseract::common::JointTrajectoryInfo();
-      data_->current_trajectory.joint_state = jts.getInitialState();
-      for (const auto& t : jts.getJointTrajectories())
-        data_->current_trajectory.joint_trajectory.insert(
-            data_->current_trajectory.joint_trajectory.end(), t.joint_trajectory.begin(), t.joint_trajectory.end());
+      setCurrentEnvironment(jts.getEnvironment());
 
-      data_->player->setTrajectory(data_->current_trajectory.joint_trajectory);
+      data_->current_trajectory = data_->model->getJointTrajectoryBuffer(current_index);
 
-      if (!data_->current_trajectory.joint_trajectory.empty())
+      if (!data_->current_trajectory->empty())
         onEnablePlayer();
 
+      updateGhost();
       break;
     }
     default:
@@ -357,23 +372,13 @@ void JointTrajectoryWidget::onCurrentRowChanged(const QModelIndex& current, cons
         QApplication::sendEvent(qApp, &event);
 
         const tesseract::common::JointState& state = data_->model->getJointState(current_index);
-        auto jts = data_->model->getJointTrajectorySet(current_index);
+        const auto& jts = data_->model->getJointTrajectorySet(current_index);
 
         if (jts.getEnvironment() != nullptr && jts.getEnvironment()->isInitialized())
         {
-          auto env = jts.getEnvironment();
-          if (data_->model->getComponentInfo()->hasParent() && data_->current_environment != env)
-          {
-            // Defer the EnvironmentManager::set() call
-            // Use a longer delay (100ms) to allow the UI to process other events first
-            constexpr int kDelayTimeMs = 100;
-            QTimer::singleShot(kDelayTimeMs, this, [this, env, component_info = data_->model->getComponentInfo()]() {
-              auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(component_info, env);
-              EnvironmentManager::set(env_wrapper);
-            });
-          }
-
-          data_->current_environment = env;
+          setCurrentEnvironment(jts.getEnvironment());
+          auto env = data_->current_environment;
+
           // Defer setState() as well since it triggers currentStateChanged() which broadcasts events
           // Capture state by value to avoid issues with local variable lifetime
           constexpr int kDelayTimeMs = 100;
@@ -398,6 +403,41 @@ void JointTrajectoryWidget::onCurrentRowChanged(const QModelIndex& current, cons
   }
 }
 
+void JointTrajectoryWidget::setCurrentEnvironment(const std::shared_ptr<tesseract::environment::Environment>& env)
+{
+  // Trajectory sets of the same scene share one environment, so switching between them keeps the scene as is
+  if (env == nullptr || data_->current_shared_environment == env || !env->isInitialized())
+    return;
+
+  data_->current_shared_environment = env;
+
+  // If no parent then it using the top most so no need to overwrite existing environment
+  if (!data_->model->getComponentInfo()->hasParent())
+  {
+    data_->current_environment = env;
+    return;
+  }
+
+  // Other components may change the published environment, so publish a copy instead of the shared environment
+  std::shared_ptr<tesseract::environment::Environment> published = env->clone();
+  data_->current_environment = published;
+
+  // Defer the EnvironmentManager::set() call to avoid blocking the UI
+  // Use a longer delay (100ms) to allow the UI to process other events first
+  constexpr int kDelayTimeMs = 100;
+  QTimer::singleShot(kDelayTimeMs, this, [this, published, component_info = data_->model->getComponentInfo()]() {
+    // A later selection may have switched environments while this was pending
+    if (data_->current_environment != published)
+      return;
+
+    auto env_wrapper = EnvironmentManager::get(component_info);
+    if (env_wrapper != nullptr && env_wrapper->getEnvironment() == published)
+      return;
+
+    EnvironmentManager::set(std::make_shared<DefaultEnvironmentWrapper>(component_info, published));
+  });
+}
+
 void JointTrajectoryWidget::onPauseButtonClicked()
 {
   ui_->trajectoryPlayButton->setEnabled(true);
@@ -409,16 +449,21 @@ void JointTrajectoryWidget::onPlayButtonClicked()
   ui_->trajectoryPlayButton->setEnabled(false);
   ui_->trajectorySlider->setEnabled(false);
   ui_->trajectoryPauseButton->setEnabled(true);
-  data_->player->setCurrentDuration(data_->current_duration);
+  // Playback continues from the current slider position
+  const std::chrono::duration<double> elapsed(data_->current_duration - data_->current_trajectory->getTimeBegin());
+  data_->player_start =
+      std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed);
 }
 
 void JointTrajectoryWidget::onPlayerTimerTimeout()
 {
   if (ui_->trajectoryPlayerFrame->isEnabled() && ui_->trajectoryPauseButton->isEnabled())
   {
-    data_->player->getNext();
-    ui_->trajectorySlider->setSliderPosition(data_->player->currentDuration() / SLIDER_RESOLUTION);
-    if (data_->player->isFinished())
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - data_->player_start;
+    const double end = data_->current_trajectory->getTimeEnd();
+    const double t = std::min(data_->current_trajectory->getTimeBegin() + elapsed.count(), end);
+    ui_->trajectorySlider->setSliderPosition(t / SLIDER_RESOLUTION);
+    if (t >= end)
       onPauseButtonClicked();
   }
 }
@@ -426,26 +471,192 @@ void JointTrajectoryWidget::onPlayerTimerTimeout()
 void JointTrajectoryWidget::onSliderValueChanged(int value)
 {
   data_->current_duration = value * SLIDER_RESOLUTION;
-  tesseract::common::JointState state = data_->player->setCurrentDuration(data_->current_duration);
   ui_->trajectoryCurrentDurationLabel->setText(QString().sprintf("%0.3f", data_->current_duration));
+  if (data_->current_trajectory == nullptr || data_->current_trajectory->empty() ||
+      data_->current_environment == nullptr)
+    return;
+
+  tesseract::common::JointState state = data_->current_trajectory->interpolate(data_->current_duration);
   data_->current_environment->setState(state.joint_names, state.position);
 }
 
 void JointTrajectoryWidget::onEnablePlayer()
 {
-  data_->current_duration = data_->player->currentDuration();
+  data_->current_duration = data_->current_trajectory->getTimeBegin();
   ui_->trajectoryPlayerFrame->setEnabled(true);
   ui_->trajectoryPlayButton->setEnabled(true);
   ui_->trajectoryPauseButton->setEnabled(false);
-  ui_->trajectorySlider->setMinimum(data_->player->trajectoryDurationBegin() / SLIDER_RESOLUTION);
-  ui_->trajectorySlider->setMaximum(data_->player->trajectoryDurationEnd() / SLIDER_RESOLUTION);
+  ui_->trajectorySlider->setMinimum(data_->current_trajectory->getTimeBegin() / SLIDER_RESOLUTION);
+  ui_->trajectorySlider->setMaximum(data_->current_trajectory->getTimeEnd() / SLIDER_RESOLUTION);
   ui_->trajectorySlider->setSliderPosition(data_->current_duration);
   ui_->trajectoryCurrentDurationLabel->setText(QString().sprintf("%0.3f", data_->current_duration));
-  ui_->trajectoryDurationLabel->setText(QString().sprintf("%0.3f", data_->player->trajectoryDurationEnd()));
+  ui_->trajectoryDurationLabel->setText(QString().sprintf("%0.3f", data_->current_trajectory->getTimeEnd()));
 }
 
 void JointTrajectoryWidget::onDisablePlayer() { ui_->trajectoryPlayerFrame->setEnabled(false); }
 
+void JointTrajectoryWidget::scanContacts(const tesseract::collision::ContactManagerConfig& contact_manager_config,
+                                         const tesseract::collision::CollisionCheckConfig& collision_check_config,
+                                         const std::string& ns)
+{
+  if (data_->current_trajectory == nullptr || data_->current_trajectory->empty() ||
+      data_->current_environment == nullptr)
+  {
+    events::StatusLogWarn event("Select a joint trajectory before scanning it for contacts");
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  TrajectoryContactScanConfig config;
+  config.contact_manager_config = contact_manager_config;
+  config.collision_check_config = collision_check_config;
+  const double no_contact_distance = contact_manager_config.default_margin.value_or(0.0);
+
+  // The environment is only read while the scan clones its contact managers, which is guarded by its own lock
+  std::shared_ptr<const tesseract::environment::Environment> env = data_->current_environment;
+  auto trajectory = data_->current_trajectory;
+  auto component_info = data_->model->getComponentInfo();
+  const QString name = QString("Contact scan of %1").arg(QString::fromStdString(trajectory->getDescription()));
+
+  data_->loader->load(name, [this, env, trajectory, component_info, ns, config, no_contact_distance](
+                                BackgroundLoader::Context& context) {
+    context.deliver([component_info, ns]() {
+      events::ContactResultsClear event(component_info, ns);
+      QApplication::sendEvent(qApp, &event);
+    });
+
+    int last_percent{ -1 };
+    auto callback = [&](const ContactResultTimeline& batch, std::size_t checked, std::size_t total) {
+      if (context.isCanceled())
+        return false;
+
+      // Only entries with contacts are shown in the contact results model
+      ContactResultTimeline contacts;
+      std::copy_if(batch.begin(), batch.end(), std::back_inserter(contacts), [](const ContactResultTimelineEntry& e) {
+        return !e.contacts.empty();
+      });
+
+      if (!contacts.empty())
+      {
+        context.deliver([component_info, ns, contacts = std::move(contacts)]() {
+          events::ContactResultsAppend event(component_info, contacts, ns);
+          QApplication::sendEvent(qApp, &event);
+        });
+      }
+
+      const int percent = static_cast<int>((100 * checked) / total);
+      if (percent != last_percent)
+      {
+        context.setProgress(percent, QString("Checked %1 of %2").arg(checked).arg(total));
+        last_percent = percent;
+      }
+      return true;
+    };
+
+    auto results = std::make_shared<const ContactResultTimeline>(scanTrajectoryContacts(
+        *env, trajectory->getJointNames(), trajectory->getTime(), trajectory->getPosition(), config, callback));
+
+    if (context.isCanceled())
+      return false;
+
+    context.deliver([this, trajectory, results, no_contact_distance]() {
+      data_->contact_results = results;
+      data_->contact_results_trajectory = trajectory;
+      data_->contact_results_no_contact_distance = no_contact_distance;
+      if (data_->plot_dialog != nullptr && data_->plot_dialog->isVisible() && trajectory == data_->current_trajectory)
+        data_->plot_dialog->setContactResults(*results, no_contact_distance);
+    });
+    return true;
+  });
+}
+
+void JointTrajectoryWidget::updateGhost()
+{
+  if (data_->ghost_sample_count == 0 || data_->current_trajectory == nullptr || data_->current_trajectory->empty() ||
+      data_->current_environment == nullptr)
+  {
+    clearGhost();
+    return;
+  }
+
+  if (data_->ghost_trajectory == data_->current_trajectory &&
+      data_->ghost_trajectory_sample_count == data_->ghost_sample_count)
+    return;
+
+  data_->ghost_trajectory = data_->current_trajectory;
+  data_->ghost_trajectory_sample_count = data_->ghost_sample_count;
+
+  TrajectoryGhostConfig config;
+  config.sample_count = data_->ghost_sample_count;
+
+  // The player only changes the environment state, the ghost reads the scene graph and clones the state solver
+  std::shared_ptr<const tesseract::environment::Environment> env = data_->current_environment;
+  auto trajectory = data_->current_trajectory;
+  auto component_info = data_->model->getComponentInfo();
+  const QString name = QString("Trajectory ghost of %1").arg(QString::fromStdString(trajectory->getDescription()));
+
+  // Only the latest ghost is of interest
+  data_->ghost_loader->cancel();
+  data_->ghost_loader->load(name, [this, env, trajectory, component_info, config](BackgroundLoader::Context& context) {
+    int last_percent{ -1 };
+    auto callback = [&](std::size_t computed, std::size_t total) {
+      if (context.isCanceled())
+        return false;
+
+      const int percent = static_cast<int>((100 * computed) / total);
+      if (percent != last_percent)
+      {
+        context.setProgress(percent, QString("Computed %1 of %2").arg(computed).arg(total));
+        last_percent = percent;
+      }
+      return true;
+    };
+
+    auto ghost = std::make_shared<const TrajectoryGhost>(computeTrajectoryGhost(
+        *env, trajectory->getJointNames(), trajectory->getTime(), trajectory->getPosition(), config, callback));
+
+    if (context.isCanceled())
+      return false;
+
+    context.deliver([this, trajectory, component_info, ghost, sample_count = config.sample_count]() {
+      // Drop the ghost if another trajectory or sample count was requested while it was computed
+      if (data_->ghost_trajectory != trajectory || data_->ghost_trajectory_sample_count != sample_count)
+        return;
+
+      events::JointTrajectoryGhostSet event(component_info, ghost);
+      QApplication::sendEvent(qApp, &event);
+    });
+    return true;
+  });
+}
+
+void JointTrajectoryWidget::clearGhost()
+{
+  if (data_->ghost_trajectory == nullptr)
+    return;
+
+  data_->ghost_loader->cancel();
+
+  data_->ghost_trajectory = nullptr;
+  data_->ghost_trajectory_sample_count = 0;
+
+  events::JointTrajectoryGhostClear event(data_->model->getComponentInfo());
+  QApplication::sendEvent(qApp, &event);
+}
+
+void JointTrajectoryWidget::seek(double time)
+{
+  if (data_->current_trajectory == nullptr || data_->current_trajectory->empty() ||
+      !ui_->trajectoryPlayerFrame->isEnabled())
+    return;
+
+  if (ui_->trajectoryPauseButton->isEnabled())
+    onPauseButtonClicked();
+
+  const double t = std::clamp(time, data_->current_trajectory->getTimeBegin(), data_->current_trajectory->getTimeEnd());
+  ui_->trajectorySlider->setSliderPosition(t / SLIDER_RESOLUTION);
+}
+
 // Documentation inherited
 bool JointTrajectoryWidget::eventFilter(QObject* obj, QEvent* event)
 {
@@ -490,6 +701,38 @@ bool JointTrajectoryWidget::eventFilter(QObject* obj, QEvent* event)
     if (e->getComponentInfo() == data_->model->getComponentInfo())
       onRemove();
   }
+  else if (event->type() == events::EventType::JOINT_TRAJECTORY_REMOVE_ALL)
+  {
+    assert(dynamic_cast<events::JointTrajectoryRemoveAll*>(event) != nullptr);
+    auto* e = static_cast<events::JointTrajectoryRemoveAll*>(event);
+    if (e->getComponentInfo() == data_->model->getComponentInfo())
+      clearGhost();
+  }
+  else if (event->type() == events::EventType::JOINT_TRAJECTORY_PLAYER_SEEK)
+  {
+    assert(dynamic_cast<events::JointTrajectoryPlayerSeek*>(event) != nullptr);
+    auto* e = static_cast<events::JointTrajectoryPlayerSeek*>(event);
+    if (e->getComponentInfo() == data_->model->getComponentInfo())
+      seek(e->getTime());
+  }
+  else if (event->type() == events::EventType::JOINT_TRAJECTORY_GHOST)
+  {
+    assert(dynamic_cast<events::JointTrajectoryGhost*>(event) != nullptr);
+    auto* e = static_cast<events::JointTrajectoryGhost*>(event);
+    if (e->getComponentInfo() == data_->model->getComponentInfo())
+    {
+      data_->ghost_sample_count = e->getSampleCount();
+      updateGhost();
+    }
+  }
+  else if (event->type() == events::EventType::CONTACT_RESULTS_COMPUTE)
+  {
+    assert(dynamic_cast<events::ContactResultsCompute*>(event) != nullptr);
+    auto* e = static_cast<events::ContactResultsCompute*>(event);
+    if (e->getComponentInfo() == data_->model->getComponentInfo() &&
+        e->getStateType() == events::ContactResultsCompute::StateType::TRAJECTORY)
+      scanContacts(e->getContactManagerConfig(), e->getCollisionCheckConfig(), e->getNamespace());
+  }
 
   // Standard event processing
   return QObject::eventFilter(obj, event);
@@ -0,0 +1,84 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_MANIPULATION_REACHABILITY_MAP_WIDGET_H
+#define TESSERACT_QT_MANIPULATION_REACHABILITY_MAP_WIDGET_H
+
+#ifndef Q_MOC_RUN
+#include <memory>
+#include <vector>
+#include <QWidget>
+#endif
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+class ReachabilityMap;
+struct ReachabilityVoxelKey;
+
+/**
+ * @brief Computes and shows the reachability map of a kinematic group
+ * @details The map is computed in the background and cached on disk, keyed by the settings and the environment
+ * revision. With auto refine enabled, voxels the render manager reports as large in the view are split into their
+ * children up to the max refine level.
+ */
+class ReachabilityMapWidget : public QWidget
+{
+  Q_OBJECT
+public:
+  explicit ReachabilityMapWidget(QWidget* parent = nullptr);
+  explicit ReachabilityMapWidget(std::shared_ptr<const ComponentInfo> component_info, QWidget* parent = nullptr);
+  ~ReachabilityMapWidget();
+
+  void setComponentInfo(std::shared_ptr<const ComponentInfo> component_info);
+  std::shared_ptr<const ComponentInfo> getComponentInfo() const;
+
+  /** @brief Get the shown reachability map, nullptr if none is shown */
+  std::shared_ptr<const ReachabilityMap> getReachabilityMap() const;
+
+public Q_SLOTS:
+  /** @brief Reload the kinematic groups of the environment */
+  void onReload();
+
+  /** @brief Compute the map for the current settings, using the cache where possible */
+  void onCompute();
+
+  /** @brief Remove the shown map, the cache is kept */
+  void onClear();
+
+private Q_SLOTS:
+  void onGroupNameChanged();
+  void onAutoRefineChanged();
+  void onLoaderFinished(const QString& name, bool success);
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+
+  void refine(const std::vector<ReachabilityVoxelKey>& keys);
+
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_MANIPULATION_REACHABILITY_MAP_WIDGET_H
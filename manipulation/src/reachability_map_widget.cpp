@@ -0,0 +1,522 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/manipulation/reachability_map_widget.h>
+#include <tesseract_qt/common/reachability_map.h>
+#include <tesseract_qt/common/background_loader.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/events/reachability_map_events.h>
+#include <tesseract_qt/common/events/status_log_events.h>
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/kinematics/kinematic_group.h>
+
+#include <QApplication>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDir>
+#include <QDoubleSpinBox>
+#include <QFormLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QStandardPaths>
+#include <QStringListModel>
+#include <QVBoxLayout>
+
+#include <array>
+#include <unordered_set>
+
+namespace tesseract::gui
+{
+namespace
+{
+QDoubleSpinBox* createSpinBox(double value, double min, double max, double step)
+{
+  auto* spin_box = new QDoubleSpinBox();
+  spin_box->setDecimals(3);
+  spin_box->setRange(min, max);
+  spin_box->setSingleStep(step);
+  spin_box->setValue(value);
+  return spin_box;
+}
+
+ReachabilityVoxelKey getRoot(ReachabilityVoxelKey key)
+{
+  while (key.level > 0)
+    key = key.getParent();
+  return key;
+}
+
+/** @brief Get a copy of the map with only the voxels within the level zero voxels of the bounds */
+ReachabilityMap::ConstPtr filterReachabilityMap(const ReachabilityMap& map, const Eigen::AlignedBox3d& bounds)
+{
+  const std::vector<ReachabilityVoxelKey> keys = map.getVoxelKeys(bounds);
+  const std::unordered_set<ReachabilityVoxelKey, ReachabilityVoxelKeyHash> roots(keys.begin(), keys.end());
+
+  auto filtered = std::make_shared<ReachabilityMap>(map.getKey(), map.getWorkingFrame(), map.getResolution());
+  for (const auto& voxel : map.getVoxels())
+  {
+    if (roots.count(getRoot(voxel.first)) > 0)
+      filtered->setVoxel(voxel.first, voxel.second);
+  }
+  return filtered;
+}
+}  // namespace
+
+struct ReachabilityMapWidget::Implementation
+{
+  std::shared_ptr<const ComponentInfo> component_info;
+
+  QComboBox* group_combo_box{ nullptr };
+  QComboBox* working_frame_combo_box{ nullptr };
+  QComboBox* tip_link_combo_box{ nullptr };
+  std::array<QDoubleSpinBox*, 3> min_spin_boxes{};
+  std::array<QDoubleSpinBox*, 3> max_spin_boxes{};
+  QDoubleSpinBox* resolution_spin_box{ nullptr };
+  QSpinBox* approach_spin_box{ nullptr };
+  QSpinBox* roll_spin_box{ nullptr };
+  QCheckBox* auto_refine_check_box{ nullptr };
+  QSpinBox* max_level_spin_box{ nullptr };
+
+  QStringListModel group_names_model;
+  QStringListModel working_frames_model;
+  QStringListModel tip_links_model;
+
+  std::unique_ptr<BackgroundLoader> loader;
+  std::unique_ptr<LoaderProgressDialog> loader_dialog;
+
+  /** @brief The settings and bounds of the shown map */
+  ReachabilityMapConfig config;
+  Eigen::AlignedBox3d bounds;
+
+  /** @brief All computed voxels for the settings, including the ones outside the bounds loaded from the cache */
+  ReachabilityMap::ConstPtr reachability_map;
+
+  /** @brief The voxels within the bounds, this is the shown map */
+  ReachabilityMap::ConstPtr shown_reachability_map;
+
+  /** @brief Voxels requested to be refined while a job was running */
+  std::vector<ReachabilityVoxelKey> pending_refine;
+
+  /** @brief The children computed by the last refine job, reported back to the render manager if it fails */
+  std::vector<ReachabilityVoxelKey> running_refine;
+
+  /** @brief Let the render manager request the parents of the children again */
+  void refineFailed(const std::vector<ReachabilityVoxelKey>& children)
+  {
+    if (children.empty())
+      return;
+
+    std::unordered_set<ReachabilityVoxelKey, ReachabilityVoxelKeyHash> parents;
+    for (const auto& child : children)
+      parents.insert(child.getParent());
+
+    events::ReachabilityMapRefineFailed event(component_info,
+                                              std::vector<ReachabilityVoxelKey>(parents.begin(), parents.end()));
+    QApplication::sendEvent(qApp, &event);
+  }
+
+  tesseract::environment::Environment::Ptr getEnvironment() const
+  {
+    std::shared_ptr<EnvironmentWrapper> env_wrapper = EnvironmentManager::find(component_info);
+    if (env_wrapper == nullptr)
+      env_wrapper = EnvironmentManager::getDefault();
+
+    if (env_wrapper == nullptr)
+      return nullptr;
+
+    auto env = env_wrapper->getEnvironment();
+    if (env == nullptr || !env->isInitialized())
+      return nullptr;
+
+    return env;
+  }
+
+  static std::string getCacheDirectory()
+  {
+    const QString path = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/reachability";
+    QDir().mkpath(path);
+    return path.toStdString();
+  }
+
+  /**
+   * @brief Queue computing voxels of a map
+   * @param config The settings
+   * @param bounds The bounds of the shown map
+   * @param keys The voxels to compute, all level zero voxels of the bounds if empty
+   * @param base The map to extend, it is only used if its key matches the current environment
+   */
+  void run(ReachabilityMapWidget& widget,
+           const ReachabilityMapConfig& config,
+           const Eigen::AlignedBox3d& bounds,
+           std::vector<ReachabilityVoxelKey> keys,
+           ReachabilityMap::ConstPtr base)
+  {
+    running_refine = keys;
+
+    std::shared_ptr<const tesseract::environment::Environment> env = getEnvironment();
+    if (env == nullptr)
+    {
+      events::StatusLogWarn event("Reachability map, the environment is not initialized");
+      QApplication::sendEvent(qApp, &event);
+      refineFailed(running_refine);
+      running_refine.clear();
+      return;
+    }
+
+    const bool refine = !keys.empty();
+    const std::string cache_directory = getCacheDirectory();
+    const QString name = QString("Reachability map of %1").arg(QString::fromStdString(config.group_name));
+    loader->load(name, [&widget, env, config, bounds, keys = std::move(keys), base, refine, cache_directory](
+                           BackgroundLoader::Context& context) {
+      // Published maps are never modified, work on a copy
+      context.setProgress(-1, "Loading cache");
+      const std::string key = getReachabilityMapKey(*env, config);
+      const std::string cache_file_path = cache_directory + "/" + getReachabilityMapCacheFileName(key);
+      ReachabilityMap::Ptr map;
+      if (base != nullptr && base->getKey() == key)
+        map = std::make_shared<ReachabilityMap>(*base);
+      else if (refine)
+        throw std::runtime_error("The environment changed, compute the reachability map again");
+      else
+        map = loadReachabilityMap(cache_file_path, key);
+
+      if (map == nullptr)
+        map = std::make_shared<ReachabilityMap>(key, config.working_frame, config.resolution);
+
+      const std::vector<ReachabilityVoxelKey> todo = (refine) ? keys : map->getVoxelKeys(bounds);
+      int last_percent{ -1 };
+      auto callback = [&](const std::vector<std::pair<ReachabilityVoxelKey, float>>& /*batch*/,
+                          std::size_t computed,
+                          std::size_t total) {
+        if (context.isCanceled())
+          return false;
+
+        const int percent = static_cast<int>((100 * computed) / total);
+        if (percent != last_percent)
+        {
+          context.setProgress(percent, QString("Computed %1 of %2 voxels").arg(computed).arg(total));
+          last_percent = percent;
+        }
+        return true;
+      };
+
+      const std::size_t count = map->getVoxels().size();
+      if (!computeReachability(*env, config, todo, *map, callback))
+        return false;
+
+      if (map->getVoxels().size() != count && !saveReachabilityMap(cache_file_path, *map))
+      {
+        context.deliver([cache_file_path]() {
+          events::StatusLogWarn event("Reachability map, failed to write cache file: " + cache_file_path);
+          QApplication::sendEvent(qApp, &event);
+        });
+      }
+
+      ReachabilityMap::ConstPtr shown = filterReachabilityMap(*map, bounds);
+      context.deliver([&widget, config, bounds, map, shown]() {
+        widget.data_->config = config;
+        widget.data_->bounds = bounds;
+        widget.data_->reachability_map = map;
+        widget.data_->shown_reachability_map = shown;
+        events::ReachabilityMapSet event(widget.data_->component_info, shown);
+        QApplication::sendEvent(qApp, &event);
+      });
+      return true;
+    });
+  }
+};
+
+ReachabilityMapWidget::ReachabilityMapWidget(QWidget* parent) : ReachabilityMapWidget(nullptr, parent) {}
+
+ReachabilityMapWidget::ReachabilityMapWidget(std::shared_ptr<const ComponentInfo> component_info, QWidget* parent)
+  : QWidget(parent), data_(std::make_unique<Implementation>())
+{
+  data_->component_info = std::move(component_info);
+
+  data_->group_combo_box = new QComboBox();
+  data_->group_combo_box->setModel(&data_->group_names_model);
+  data_->working_frame_combo_box = new QComboBox();
+  data_->working_frame_combo_box->setModel(&data_->working_frames_model);
+  data_->tip_link_combo_box = new QComboBox();
+  data_->tip_link_combo_box->setModel(&data_->tip_links_model);
+
+  const std::array<double, 3> default_min{ -1, -1, 0 };
+  const std::array<double, 3> default_max{ 1, 1, 1.5 };
+  auto* min_layout = new QHBoxLayout();
+  auto* max_layout = new QHBoxLayout();
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    data_->min_spin_boxes[i] = createSpinBox(default_min[i], -100, 100, 0.1);
+    data_->max_spin_boxes[i] = createSpinBox(default_max[i], -100, 100, 0.1);
+    min_layout->addWidget(data_->min_spin_boxes[i]);
+    max_layout->addWidget(data_->max_spin_boxes[i]);
+  }
+
+  data_->resolution_spin_box = createSpinBox(0.1, 0.005, 10, 0.01);
+  data_->approach_spin_box = new QSpinBox();
+  data_->approach_spin_box->setRange(1, 200);
+  data_->approach_spin_box->setValue(6);
+  data_->approach_spin_box->setToolTip("The number of tool z axis directions tried at every voxel");
+  data_->roll_spin_box = new QSpinBox();
+  data_->roll_spin_box->setRange(1, 36);
+  data_->roll_spin_box->setValue(4);
+  data_->roll_spin_box->setToolTip("The number of rotations about every tool z axis direction");
+  data_->auto_refine_check_box = new QCheckBox();
+  data_->auto_refine_check_box->setChecked(true);
+  data_->auto_refine_check_box->setToolTip("Split the voxels close to the camera into finer voxels");
+  data_->max_level_spin_box = new QSpinBox();
+  data_->max_level_spin_box->setRange(0, 6);
+  data_->max_level_spin_box->setValue(2);
+  data_->max_level_spin_box->setToolTip("Each level halves the voxel size");
+
+  auto* form_layout = new QFormLayout();
+  form_layout->addRow("Group:", data_->group_combo_box);
+  form_layout->addRow("Working Frame:", data_->working_frame_combo_box);
+  form_layout->addRow("Tip Link:", data_->tip_link_combo_box);
+  form_layout->addRow("Min (x, y, z):", min_layout);
+  form_layout->addRow("Max (x, y, z):", max_layout);
+  form_layout->addRow("Resolution:", data_->resolution_spin_box);
+  form_layout->addRow("Approach Directions:", data_->approach_spin_box);
+  form_layout->addRow("Roll Steps:", data_->roll_spin_box);
+  form_layout->addRow("Auto Refine:", data_->auto_refine_check_box);
+  form_layout->addRow("Max Refine Level:", data_->max_level_spin_box);
+
+  auto* reload_push_button = new QPushButton("Reload");
+  auto* compute_push_button = new QPushButton("Compute");
+  auto* clear_push_button = new QPushButton("Clear");
+  auto* button_layout = new QHBoxLayout();
+  button_layout->addWidget(reload_push_button);
+  button_layout->addStretch();
+  button_layout->addWidget(clear_push_button);
+  button_layout->addWidget(compute_push_button);
+
+  auto* layout = new QVBoxLayout();
+  layout->addLayout(form_layout);
+  layout->addStretch();
+  layout->addLayout(button_layout);
+  setLayout(layout);
+
+  data_->loader = std::make_unique<BackgroundLoader>();
+  data_->loader_dialog = std::make_unique<LoaderProgressDialog>(data_->loader.get(), this);
+
+  connect(data_->group_combo_box, SIGNAL(currentTextChanged(QString)), this, SLOT(onGroupNameChanged()));
+  connect(data_->auto_refine_check_box, SIGNAL(toggled(bool)), this, SLOT(onAutoRefineChanged()));
+  connect(reload_push_button, SIGNAL(clicked()), this, SLOT(onReload()));
+  connect(compute_push_button, SIGNAL(clicked()), this, SLOT(onCompute()));
+  connect(clear_push_button, SIGNAL(clicked()), this, SLOT(onClear()));
+  connect(data_->loader.get(), SIGNAL(finished(QString, bool, QString)), this, SLOT(onLoaderFinished(QString, bool)));
+
+  qApp->installEventFilter(this);
+
+  onReload();
+}
+
+ReachabilityMapWidget::~ReachabilityMapWidget() = default;
+
+void ReachabilityMapWidget::setComponentInfo(std::shared_ptr<const ComponentInfo> component_info)
+{
+  onClear();
+  data_->component_info = std::move(component_info);
+  onReload();
+}
+
+std::shared_ptr<const ComponentInfo> ReachabilityMapWidget::getComponentInfo() const { return data_->component_info; }
+
+std::shared_ptr<const ReachabilityMap> ReachabilityMapWidget::getReachabilityMap() const
+{
+  return data_->shown_reachability_map;
+}
+
+void ReachabilityMapWidget::onReload()
+{
+  QStringList group_names;
+  if (auto env = data_->getEnvironment())
+  {
+    for (const auto& group_name : env->getGroupNames())
+      group_names.append(QString::fromStdString(group_name));
+    group_names.sort();
+  }
+
+  const QString current_group_name = data_->group_combo_box->currentText();
+  data_->group_combo_box->blockSignals(true);
+  data_->group_names_model.setStringList(group_names);
+  if (group_names.contains(current_group_name))
+    data_->group_combo_box->setCurrentText(current_group_name);
+  else if (!group_names.empty())
+    data_->group_combo_box->setCurrentIndex(0);
+  data_->group_combo_box->blockSignals(false);
+
+  onGroupNameChanged();
+}
+
+void ReachabilityMapWidget::onGroupNameChanged()
+{
+  QStringList working_frames;
+  QStringList tip_links;
+  auto env = data_->getEnvironment();
+  const std::string group_name = data_->group_combo_box->currentText().toStdString();
+  if (env != nullptr && !group_name.empty())
+  {
+    if (auto kin_group = env->getKinematicGroup(group_name))
+    {
+      for (const auto& working_frame : kin_group->getAllValidWorkingFrames())
+        working_frames.append(QString::fromStdString(working_frame));
+
+      for (const auto& tip_link : kin_group->getAllPossibleTipLinkNames())
+        tip_links.append(QString::fromStdString(tip_link));
+    }
+  }
+  working_frames.sort();
+  tip_links.sort();
+
+  data_->working_frames_model.setStringList(working_frames);
+  data_->tip_links_model.setStringList(tip_links);
+  if (!working_frames.empty())
+    data_->working_frame_combo_box->setCurrentIndex(0);
+  if (!tip_links.empty())
+    data_->tip_link_combo_box->setCurrentIndex(0);
+}
+
+void ReachabilityMapWidget::onCompute()
+{
+  ReachabilityMapConfig config;
+  config.group_name = data_->group_combo_box->currentText().toStdString();
+  config.working_frame = data_->working_frame_combo_box->currentText().toStdString();
+  config.tip_link = data_->tip_link_combo_box->currentText().toStdString();
+  config.resolution = data_->resolution_spin_box->value();
+  config.orientations = createReachabilityOrientations(static_cast<std::size_t>(data_->approach_spin_box->value()),
+                                                       static_cast<std::size_t>(data_->roll_spin_box->value()));
+
+  if (config.group_name.empty() || config.working_frame.empty() || config.tip_link.empty())
+  {
+    events::StatusLogWarn event("Select a kinematic group, working frame and tip link to compute a reachability map");
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  Eigen::AlignedBox3d bounds;
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    bounds.min()(static_cast<Eigen::Index>(i)) = data_->min_spin_boxes[i]->value();
+    bounds.max()(static_cast<Eigen::Index>(i)) = data_->max_spin_boxes[i]->value();
+  }
+
+  if (bounds.isEmpty())
+  {
+    events::StatusLogWarn event("Reachability map, the min bounds must be less than the max bounds");
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  // A new computation replaces any running one
+  data_->pending_refine.clear();
+  data_->loader->cancel();
+  data_->run(*this, config, bounds, {}, data_->reachability_map);
+}
+
+void ReachabilityMapWidget::onClear()
+{
+  data_->pending_refine.clear();
+  data_->loader->cancel();
+  data_->reachability_map = nullptr;
+  data_->shown_reachability_map = nullptr;
+
+  events::ReachabilityMapClear event(data_->component_info);
+  QApplication::sendEvent(qApp, &event);
+}
+
+void ReachabilityMapWidget::onAutoRefineChanged()
+{
+  // Showing the map again lets the render manager request the voxels it skipped while auto refine was off
+  if (data_->auto_refine_check_box->isChecked() && data_->shown_reachability_map != nullptr)
+  {
+    events::ReachabilityMapSet event(data_->component_info, data_->shown_reachability_map);
+    QApplication::sendEvent(qApp, &event);
+  }
+}
+
+void ReachabilityMapWidget::onLoaderFinished(const QString& /*name*/, bool success)
+{
+  // The voxels of a failed job stay requested in the render manager unless it is told
+  if (!success)
+    data_->refineFailed(data_->running_refine);
+  data_->running_refine.clear();
+
+  if (data_->pending_refine.empty() || data_->loader->isBusy())
+    return;
+
+  std::vector<ReachabilityVoxelKey> keys;
+  keys.swap(data_->pending_refine);
+  data_->run(*this, data_->config, data_->bounds, std::move(keys), data_->reachability_map);
+}
+
+void ReachabilityMapWidget::refine(const std::vector<ReachabilityVoxelKey>& keys)
+{
+  if (data_->reachability_map == nullptr || !data_->auto_refine_check_box->isChecked())
+    return;
+
+  const int max_level = data_->max_level_spin_box->value();
+  const auto& voxels = data_->reachability_map->getVoxels();
+  std::vector<ReachabilityVoxelKey> children;
+  for (const auto& key : keys)
+  {
+    if (key.level >= max_level || voxels.count(key) == 0 || !data_->reachability_map->isLeaf(key))
+      continue;
+
+    for (const auto& child : key.getChildren())
+      children.push_back(child);
+  }
+
+  if (children.empty())
+    return;
+
+  // Only one job runs at a time, requests arriving meanwhile are computed together once it is done
+  if (data_->loader->isBusy())
+  {
+    data_->pending_refine.insert(data_->pending_refine.end(), children.begin(), children.end());
+    return;
+  }
+
+  data_->run(*this, data_->config, data_->bounds, std::move(children), data_->reachability_map);
+}
+
+bool ReachabilityMapWidget::eventFilter(QObject* obj, QEvent* event)
+{
+  if (event->type() == events::EventType::REACHABILITY_MAP_REFINE)
+  {
+    assert(dynamic_cast<events::ReachabilityMapRefine*>(event) != nullptr);
+    auto* e = static_cast<events::ReachabilityMapRefine*>(event);
+    if (e->getComponentInfo() == data_->component_info)
+      refine(e->getKeys());
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+
+}  // namespace tesseract::gui
@@ -26,12 +26,14 @@
 #include <tesseract_qt/plot/plot_database.h>
 #include <tesseract_qt/plot/timeseries.h>
 #include <tesseract_qt/plot/stringseries.h>
+#include <tesseract_qt/plot/plot_data_buffer.h>
 
 namespace tesseract::gui
 {
 using PlotDataXY = PlotDataBase<double, double>;
 using PlotData = TimeseriesBase<double>;
 using PlotDataAny = TimeseriesBase<std::any>;
+using PlotDataIngestBuffer = SPSCRingBuffer<PlotData::Point>;
 
 /**
  * @brief The PlotDataMapRef is the main data structure used to store all the
@@ -41,6 +43,7 @@ using PlotDataAny = TimeseriesBase<std::any>;
 using PlotDataMap = std::unordered_map<std::string, PlotData>;
 using AnySeriesMap = std::unordered_map<std::string, PlotDataAny>;
 using StringSeriesMap = std::unordered_map<std::string, StringSeries>;
+using IngestBufferMap = std::unordered_map<std::string, PlotDataIngestBuffer::Ptr>;
 
 struct PlotDataMapRef
 {
@@ -60,6 +63,9 @@ struct PlotDataMapRef
    */
   std::unordered_map<std::string, PlotGroup::Ptr> groups;
 
+  /// Lock free buffers feeding numeric timeseries from other threads
+  IngestBufferMap ingest_buffers;
+
   PlotDataMap::iterator addNumeric(const std::string& name, PlotGroup::Ptr group = {});
 
   AnySeriesMap::iterator addUserDefined(const std::string& name, PlotGroup::Ptr group = {});
@@ -74,6 +80,25 @@ struct PlotDataMapRef
 
   PlotGroup::Ptr getOrCreateGroup(const std::string& name);
 
+  /**
+   * @brief Get or create a buffer to feed a numeric timeseries from another thread without locks
+   * @details This must be called from the thread owning the map, typically the GUI thread, and creates the numeric
+   * series if it does not exist. A single producer thread may push samples to the buffer while it holds the returned
+   * pointer, even if the series is erased. Samples are moved into the series by drainIngestBuffers.
+   * @param name The numeric series name
+   * @param capacity The buffer capacity which is rounded up to a power of two, ignored if the buffer exists
+   */
+  PlotDataIngestBuffer::Ptr getOrCreateIngestBuffer(const std::string& name,
+                                                    std::size_t capacity = PlotData::ASYNC_BUFFER_CAPACITY,
+                                                    PlotGroup::Ptr group = {});
+
+  /**
+   * @brief Move the samples of all ingest buffers into their numeric series
+   * @details This must be called from the thread owning the map. PlotWidget::updateCurves calls this once per update.
+   * @return The number of samples moved
+   */
+  std::size_t drainIngestBuffers();
+
   std::unordered_set<std::string> getAllNames() const;
 
   void clear();
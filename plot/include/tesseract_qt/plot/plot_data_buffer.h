@@ -0,0 +1,146 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_PLOT_PLOT_DATA_BUFFER_H
+#define TESSERACT_QT_PLOT_PLOT_DATA_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace tesseract::gui
+{
+/**
+ * @brief A bounded lock free single producer single consumer ring buffer
+ * @details One thread may push while another thread drains without locks. If the buffer is full the sample is dropped
+ * and counted. The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SPSCRingBuffer
+{
+public:
+  using Ptr = std::shared_ptr<SPSCRingBuffer<T>>;
+  using ConstPtr = std::shared_ptr<const SPSCRingBuffer<T>>;
+
+  explicit SPSCRingBuffer(std::size_t capacity)
+  {
+    std::size_t size{ 2 };
+    while (size < capacity)
+      size <<= 1;
+
+    buffer_.resize(size);
+    mask_ = size - 1;
+  }
+
+  SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+  SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+  SPSCRingBuffer(SPSCRingBuffer&&) = delete;
+  SPSCRingBuffer& operator=(SPSCRingBuffer&&) = delete;
+
+  /**
+   * @brief Push a value, must only be called from the producer thread
+   * @return False if the buffer is full and the value was dropped
+   */
+  bool push(const T& value)
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t size = head - cached_tail_;
+    if (size > mask_)
+    {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      size = head - cached_tail_;
+      if (size > mask_)
+      {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+
+    buffer_[head & mask_] = value;
+    head_.store(head + 1, std::memory_order_release);
+
+    // Only the producer writes the high water mark so a relaxed load and store is sufficient
+    if (size + 1 > high_water_.load(std::memory_order_relaxed))
+      high_water_.store(size + 1, std::memory_order_relaxed);
+
+    return true;
+  }
+
+  /**
+   * @brief Pop all available values, must only be called from the consumer thread
+   * @param fn Called as fn(value) for each value in the order pushed
+   * @return The number of values popped
+   */
+  template <typename Fn>
+  std::size_t drain(Fn&& fn)
+  {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    for (std::size_t i = tail; i != head; ++i)
+      fn(buffer_[i & mask_]);
+
+    tail_.store(head, std::memory_order_release);
+    return head - tail;
+  }
+
+  /** @brief The number of values in the buffer, this is approximate while the producer is pushing */
+  std::size_t size() const
+  {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  }
+
+  /** @brief The maximum number of values in the buffer */
+  std::size_t capacity() const { return buffer_.size(); }
+
+  /** @brief The number of values dropped because the buffer was full */
+  std::size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+  /** @brief The maximum number of values which have been in the buffer */
+  std::size_t highWater() const { return high_water_.load(std::memory_order_relaxed); }
+
+  /** @brief Reset the dropped and high water counters, this races with a concurrent push */
+  void resetCounters()
+  {
+    dropped_.store(0, std::memory_order_relaxed);
+    high_water_.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  // Keep the producer and consumer indices on separate cache lines to avoid false sharing
+  static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+  std::vector<T> buffer_;
+  std::size_t mask_{ 0 };
+
+  /** @brief The producer index and the producer's copy of the consumer index */
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head_{ 0 };
+  std::size_t cached_tail_{ 0 };
+  std::atomic<std::size_t> dropped_{ 0 };
+  std::atomic<std::size_t> high_water_{ 0 };
+
+  /** @brief The consumer index */
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail_{ 0 };
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_PLOT_PLOT_DATA_BUFFER_H
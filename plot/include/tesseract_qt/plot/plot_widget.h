@@ -79,6 +79,8 @@ public:
 
   CurveInfo* addCurve(const std::string& name, QColor color = Qt::transparent);
 
+  using PlotWidgetBase::addCurve;
+
   void setCustomAxisLimits(Range range);
 
   Range customAxisLimit() const;
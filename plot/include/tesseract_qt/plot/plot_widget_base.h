@@ -65,6 +65,12 @@ public:
 
   virtual CurveInfo* addCurve(const std::string& name, PlotData& src_data, QColor color = Qt::transparent);
 
+  /**
+   * @brief Add a curve drawing a series which does not live in a PlotDataMapRef (e.g. ColumnTimeseries)
+   * @details The curve takes ownership of the series, it is deleted if a curve with the same name exists.
+   */
+  CurveInfo* addCurve(const std::string& name, QwtSeriesWrapper* series, QColor color = Qt::transparent);
+
   virtual void removeCurve(const QString& title);
 
   const std::list<CurveInfo>& curveList() const;
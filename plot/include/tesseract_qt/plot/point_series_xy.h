@@ -24,19 +24,28 @@
 #define TESSERACT_QT_PLOT_POINT_SERIES_H
 
 #include <tesseract_qt/plot/timeseries_qwt.h>
+#include <deque>
+#include <vector>
 
 namespace tesseract::gui
 {
+/**
+ * @brief A curve joining the values of two time series with a shared time axis
+ * @details The join is incremental, so only samples newer than the last joined sample are processed on update and
+ * samples trimmed from the front of the sources are removed from the cache. Samples are aligned with a merge join on
+ * time where samples without a match in the other series are skipped. Samples inserted out of order before the last
+ * joined sample are only picked up when the cache is reset.
+ *
+ * Optionally the curve can be decimated on a screen space grid, where only the first and last sample of each run of
+ * consecutive samples in the same cell are drawn. A curve returning to a cell it visited before is still drawn along
+ * its path, while dense runs within a pixel collapse to two points.
+ */
 class PointSeriesXY : public QwtSeriesWrapper
 {
 public:
   PointSeriesXY(const PlotData* x_axis, const PlotData* y_axis);
 
-  virtual QPointF sample(size_t i) const override
-  {
-    const auto& p = _cached_curve.at(i);
-    return QPointF(p.x, p.y);
-  }
+  QPointF sample(size_t i) const override;
 
   size_t size() const override;
 
@@ -51,10 +60,64 @@ public:
   const PlotData* dataX() const { return _x_axis; }
   const PlotData* dataY() const { return _y_axis; }
 
+  /**
+   * @brief Set the screen space grid used to decimate the curve
+   * @details Samples outside the area are only kept if a neighbor is inside so line segments crossing the border are
+   * drawn. The grid is only rebuilt if the parameters change.
+   * @param area The visible area in plot coordinates
+   * @param columns The number of grid columns, typically the canvas width in pixels. Zero disables decimation.
+   * @param rows The number of grid rows, typically the canvas height in pixels. Zero disables decimation.
+   */
+  void setDecimation(const QRectF& area, int columns, int rows);
+
+  /** @brief The number of joined samples prior to decimation */
+  size_t cachedSize() const { return _cached_curve.size(); }
+
 protected:
   const PlotData* _x_axis;
   const PlotData* _y_axis;
   PlotDataXY _cached_curve;
+
+  /** @brief The time of each sample in the cache */
+  std::deque<double> _cached_time;
+
+  /** @brief The absolute index of the first sample in the cache, which increases as samples are trimmed */
+  size_t _front_index{ 0 };
+
+  QRectF _decimation_area;
+  int _decimation_columns{ 0 };
+  int _decimation_rows{ 0 };
+
+  /** @brief The absolute indices of the samples kept, the last sample is always drawn and is not included */
+  std::deque<size_t> _decimated;
+
+  /** @brief The absolute index of the next sample to classify */
+  size_t _decimation_next{ 0 };
+
+  /** @brief The cell of the current run, cells include a border of one cell for samples outside the area */
+  size_t _decimation_run_cell{ 0 };
+
+  /** @brief The absolute index of the last sample of the current run, which is kept once the run ends */
+  size_t _decimation_run_last{ 0 };
+
+  /** @brief True if there is a current run */
+  bool _decimation_run_active{ false };
+
+  bool isDecimated() const { return _decimation_columns > 0 && _decimation_rows > 0; }
+
+  void clearCache();
+  void popFront();
+  void resetDecimation();
+  void updateDecimation();
+  void endDecimationRun();
+
+  /**
+   * @brief Get the grid cell of a sample
+   * @param index The index of the sample in the cache
+   * @param cell The cell index in the grid
+   * @return True if the sample is inside the area
+   */
+  bool getDecimationCell(size_t index, size_t& cell) const;
 };
 }  // namespace tesseract::gui
 
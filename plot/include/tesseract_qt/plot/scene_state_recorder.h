@@ -0,0 +1,141 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_PLOT_SCENE_STATE_RECORDER_H
+#define TESSERACT_QT_PLOT_SCENE_STATE_RECORDER_H
+
+#ifndef Q_MOC_RUN
+#include <tesseract_qt/plot/columnar_timeseries.h>
+#include <memory>
+#include <string>
+#endif
+
+#include <QObject>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+struct PlotDataMapRef;
+
+/**
+ * @brief Records the scene state broadcast for a component for live plotting
+ * @details This subscribes to the scene state changed events of a component and records the joint positions and the
+ * selected link pose components into a columnar store of the whole history. The latest samples are also appended to
+ * numeric timeseries in the plot data map which are bounded by a rolling maximum range so they stay cheap to draw.
+ *
+ * Joint position series are named <joint>::position and link pose series <link>::x, <link>::y, <link>::z,
+ * <link>::roll, <link>::pitch and <link>::yaw, prefixed by <prefix>:: if a prefix is set. Time is in seconds since the
+ * recorder was created or cleared.
+ */
+class SceneStateRecorder : public QObject
+{
+  Q_OBJECT
+public:
+  using Ptr = std::shared_ptr<SceneStateRecorder>;
+  using ConstPtr = std::shared_ptr<const SceneStateRecorder>;
+
+  /** @brief The link pose components, which can be combined */
+  enum PoseComponent
+  {
+    X = 1,
+    Y = 2,
+    Z = 4,
+    ROLL = 8,
+    PITCH = 16,
+    YAW = 32,
+    POSITION = X | Y | Z,
+    ORIENTATION = ROLL | PITCH | YAW,
+    ALL = POSITION | ORIENTATION
+  };
+
+  /**
+   * @brief Constructor
+   * @param component_info The component to record the scene state of
+   * @param plot_data_map The plot data map to append the latest samples to which must outlive the recorder
+   * @param parent The parent object
+   */
+  SceneStateRecorder(std::shared_ptr<const ComponentInfo> component_info,
+                     PlotDataMapRef& plot_data_map,
+                     QObject* parent = nullptr);
+  ~SceneStateRecorder() override;
+
+  /** @brief Get the component info */
+  std::shared_ptr<const ComponentInfo> getComponentInfo() const;
+
+  /** @brief Set the prefix of the series names, this only applies to channels created after it is changed */
+  void setPrefix(const std::string& prefix);
+  const std::string& getPrefix() const;
+
+  /** @brief Enable recording the joint positions, default is true */
+  void setJointPositionsEnabled(bool enabled);
+  bool jointPositionsEnabled() const;
+
+  /**
+   * @brief Record the pose of a link
+   * @param link_name The link name
+   * @param components The pose components to record
+   */
+  void addLinkPose(const std::string& link_name, int components = PoseComponent::ALL);
+  void removeLinkPose(const std::string& link_name);
+
+  /** @brief Set the rolling time range of the timeseries in the plot data map in seconds, default is 30 */
+  void setMaximumRangeX(double range);
+  double getMaximumRangeX() const;
+
+  /** @brief Set the maximum duration of the recording in seconds, zero or negative is unbounded which is the default */
+  void setMaximumDuration(double duration);
+  double getMaximumDuration() const;
+
+  /** @brief Enable recording, default is true */
+  void setRecording(bool recording);
+  bool isRecording() const;
+
+  /** @brief Get the recording */
+  const ColumnarTimeseries& getRecording() const;
+
+  /** @brief Clear the recording, the series in the plot data map and restart the clock */
+  void clear();
+
+  /**
+   * @brief Copy the whole recording into timeseries of a plot data map
+   * @details This is useful to review a recording beyond the rolling range. The series are cleared prior to copying.
+   * @param plot_data_map The plot data map to copy into
+   */
+  void copyTo(PlotDataMapRef& plot_data_map) const;
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted after a sample has been recorded
+   * @param time The time of the sample in seconds
+   */
+  void recorded(double time);
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_PLOT_SCENE_STATE_RECORDER_H
@@ -23,6 +23,7 @@
 #ifndef TESSERACT_QT_PLOT_TIMESERIES_QWT_H
 #define TESSERACT_QT_PLOT_TIMESERIES_QWT_H
 
+#include <memory>
 #include <qwt/qwt_series_data.h>
 #include <tesseract_qt/plot/plot_data.h>
 #include <tesseract_qt/plot/transform_function.h>
@@ -32,7 +33,7 @@ namespace tesseract::gui
 // wrapper to Timeseries including a time offset
 class QwtSeriesWrapper : public QwtSeriesData<QPointF>
 {
-private:
+protected:
   const PlotDataXY* _data;
   double _time_offset;
 
@@ -97,6 +98,43 @@ protected:
   TransformFunction_SISO::Ptr _transform;
 };
 
+//------------------------------------
+
+/**
+ * @brief Read only view of externally owned x/y columns, the samples are never copied
+ * @details The x column must be sorted. Only a two point envelope of the data is stored as plotData() so ranges,
+ * attributes and color hints behave like any other series. The owner handle keeps the columns alive.
+ */
+class ColumnTimeseries : public QwtSeriesWrapper
+{
+public:
+  ColumnTimeseries(const std::string& name,
+                   const double* x,
+                   const double* y,
+                   std::size_t size,
+                   std::shared_ptr<const void> owner = nullptr);
+
+  QPointF sample(size_t i) const override;
+
+  size_t size() const override;
+
+  bool updateCache(bool reset_old_data) override;
+
+  RangeOpt getVisualizationRangeY(Range range_X) override;
+
+  std::optional<QPointF> sampleFromTime(double t) override;
+
+protected:
+  PlotData _envelope;
+  const double* _x;
+  const double* _y;
+  std::size_t _size;
+  std::shared_ptr<const void> _owner;
+
+  /** @brief Index of the last sample with x <= t, or -1 if t is outside of the data */
+  int getIndexFromX(double t) const;
+};
+
 //---------------------------------------------------------
 }  // namespace tesseract::gui
 #endif  // TESSERACT_QT_PLOT_TIMESERIES_QWT_H
@@ -0,0 +1,174 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/plot/columnar_timeseries.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace tesseract::gui
+{
+std::size_t ColumnarTimeseries::addChannel(const std::string& name)
+{
+  auto it = channel_index_.find(name);
+  if (it != channel_index_.end())
+    return it->second;
+
+  const std::size_t index = channel_names_.size();
+  channel_names_.push_back(name);
+  channel_index_[name] = index;
+
+  // Fill the rows already recorded with NaN
+  std::deque<std::vector<float>> column;
+  for (const auto& time_chunk : times_)
+  {
+    column.emplace_back();
+    column.back().reserve(CHUNK_SIZE);
+    column.back().resize(time_chunk.size(), std::numeric_limits<float>::quiet_NaN());
+  }
+  values_.push_back(std::move(column));
+  return index;
+}
+
+long ColumnarTimeseries::getChannelIndex(const std::string& name) const
+{
+  auto it = channel_index_.find(name);
+  if (it == channel_index_.end())
+    return -1;
+
+  return static_cast<long>(it->second);
+}
+
+const std::vector<std::string>& ColumnarTimeseries::getChannelNames() const { return channel_names_; }
+
+std::size_t ColumnarTimeseries::channelCount() const { return channel_names_.size(); }
+
+void ColumnarTimeseries::appendRow(double time)
+{
+  if (!times_.empty() && time < times_.back().back())
+    throw std::runtime_error("ColumnarTimeseries, rows must be appended in time order");
+
+  if (times_.empty() || times_.back().size() == CHUNK_SIZE)
+  {
+    trim();
+    times_.emplace_back();
+    times_.back().reserve(CHUNK_SIZE);
+    for (auto& column : values_)
+    {
+      column.emplace_back();
+      column.back().reserve(CHUNK_SIZE);
+    }
+  }
+
+  times_.back().push_back(time);
+  for (auto& column : values_)
+    column.back().push_back(std::numeric_limits<float>::quiet_NaN());
+}
+
+void ColumnarTimeseries::setValue(std::size_t channel, double value)
+{
+  values_.at(channel).back().back() = static_cast<float>(value);
+}
+
+std::size_t ColumnarTimeseries::size() const
+{
+  if (times_.empty())
+    return 0;
+
+  return ((times_.size() - 1) * CHUNK_SIZE) + times_.back().size();
+}
+
+bool ColumnarTimeseries::empty() const { return times_.empty(); }
+
+double ColumnarTimeseries::getTime(std::size_t row) const { return times_[row / CHUNK_SIZE][row % CHUNK_SIZE]; }
+
+float ColumnarTimeseries::getValue(std::size_t channel, std::size_t row) const
+{
+  return values_[channel][row / CHUNK_SIZE][row % CHUNK_SIZE];
+}
+
+std::size_t ColumnarTimeseries::getRowFromTime(double time) const
+{
+  // Find the chunk by its last time then search within the chunk
+  auto chunk = std::lower_bound(
+      times_.begin(), times_.end(), time, [](const std::vector<double>& c, double t) { return c.back() < t; });
+  if (chunk == times_.end())
+    return size();
+
+  auto it = std::lower_bound(chunk->begin(), chunk->end(), time);
+  return (static_cast<std::size_t>(std::distance(times_.begin(), chunk)) * CHUNK_SIZE) +
+         static_cast<std::size_t>(std::distance(chunk->begin(), it));
+}
+
+void ColumnarTimeseries::setMaximumDuration(double duration) { maximum_duration_ = duration; }
+
+double ColumnarTimeseries::getMaximumDuration() const { return maximum_duration_; }
+
+void ColumnarTimeseries::copyTo(std::size_t channel, PlotData& plot_data, double start, double end) const
+{
+  const std::size_t row_count = size();
+  for (std::size_t row = getRowFromTime(start); row < row_count; ++row)
+  {
+    const double time = getTime(row);
+    if (time > end)
+      break;
+
+    const float value = getValue(channel, row);
+    if (!std::isnan(value))
+      plot_data.pushBack({ time, static_cast<double>(value) });
+  }
+}
+
+std::size_t ColumnarTimeseries::memoryUsage() const
+{
+  std::size_t bytes = times_.size() * CHUNK_SIZE * sizeof(double);
+  for (const auto& column : values_)
+    bytes += column.size() * CHUNK_SIZE * sizeof(float);
+
+  return bytes;
+}
+
+void ColumnarTimeseries::clear()
+{
+  times_.clear();
+  for (auto& column : values_)
+    column.clear();
+}
+
+void ColumnarTimeseries::trim()
+{
+  if (maximum_duration_ <= 0 || times_.empty())
+    return;
+
+  // Only drop a chunk if the remaining chunks still cover the maximum duration
+  const double latest = times_.back().back();
+  while (times_.size() > 1 && (latest - times_[1].front()) >= maximum_duration_)
+  {
+    times_.pop_front();
+    for (auto& column : values_)
+      column.pop_front();
+  }
+}
+}  // namespace tesseract::gui
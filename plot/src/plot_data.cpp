@@ -99,6 +99,36 @@ PlotGroup::Ptr PlotDataMapRef::getOrCreateGroup(const std::string& name)
   return group;
 }
 
+PlotDataIngestBuffer::Ptr PlotDataMapRef::getOrCreateIngestBuffer(const std::string& name,
+                                                                  std::size_t capacity,
+                                                                  PlotGroup::Ptr group)
+{
+  getOrCreateNumeric(name, group);
+
+  auto& buffer = ingest_buffers[name];
+  if (!buffer)
+  {
+    buffer = std::make_shared<PlotDataIngestBuffer>(capacity);
+  }
+  return buffer;
+}
+
+std::size_t PlotDataMapRef::drainIngestBuffers()
+{
+  std::size_t count = 0;
+  for (auto& it : ingest_buffers)
+  {
+    if (it.second->size() == 0)
+    {
+      continue;
+    }
+
+    PlotData& series = getOrCreateNumeric(it.first);
+    count += it.second->drain([&series](const PlotData::Point& p) { series.pushBack(p); });
+  }
+  return count;
+}
+
 std::unordered_set<std::string> PlotDataMapRef::getAllNames() const
 {
   std::unordered_set<std::string> out;
@@ -119,6 +149,7 @@ std::unordered_set<std::string> PlotDataMapRef::getAllNames() const
 
 void PlotDataMapRef::clear()
 {
+  ingest_buffers.clear();
   numeric.clear();
   strings.clear();
   user_defined.clear();
@@ -150,6 +181,8 @@ bool PlotDataMapRef::erase(const std::string& name)
     erased = true;
   }
 
+  ingest_buffers.erase(name);
+
   auto str_it = strings.find(name);
   if (str_it != strings.end())
   {
@@ -949,6 +949,9 @@ Range PlotWidget::getVisualizationRangeY(Range range_X) const
 
 void PlotWidget::updateCurves(bool reset_older_data)
 {
+  // Move samples pushed from other threads into their series, widgets sharing the map find the buffers empty
+  _mapped_data.drainIngestBuffers();
+
   for (auto& it : curveList())
   {
     auto series = dynamic_cast<QwtSeriesWrapper*>(it.curve->data());
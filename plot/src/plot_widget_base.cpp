@@ -22,10 +22,13 @@
  */
 #include <tesseract_qt/plot/plot_widget_base.h>
 #include <tesseract_qt/plot/timeseries_qwt.h>
+#include <tesseract_qt/plot/point_series_xy.h>
 #include <tesseract_qt/plot/plot_magnifier.h>
 #include <tesseract_qt/plot/plot_zoomer.h>
 #include <tesseract_qt/plot/plot_legend.h>
 
+#include <tesseract_qt/common/tracing.h>
+
 #include <qwt/qwt_legend.h>
 #include <qwt/qwt_plot.h>
 #include <qwt/qwt_plot_curve.h>
@@ -45,6 +48,7 @@
 #include <qwt/qwt_symbol.h>
 #include <qwt/qwt_text.h>
 
+#include <cmath>
 #include <QBoxLayout>
 #include <QMessageBox>
 #include <QSettings>
@@ -145,6 +149,25 @@ public:
     resized_callback(canvasBoundingRect());
   }
 
+  virtual void drawItems(QPainter* painter, const QRectF& canvasRect, const QwtScaleMap maps[axisCnt]) const override
+  {
+    // Decimate XY curves on a grid of canvas pixels. Only the first and last sample of each run of consecutive samples
+    // in the same pixel are kept, so the points drawn scale with the runs along the curve, not with its sample count.
+    // A curve revisiting the same pixels is not bounded by the canvas size.
+    const QwtScaleMap& x_map = maps[QwtPlot::xBottom];
+    const QwtScaleMap& y_map = maps[QwtPlot::yLeft];
+    const QRectF area(x_map.s1(), y_map.s1(), x_map.sDist(), y_map.sDist());
+    const int columns = static_cast<int>(std::ceil(canvasRect.width()));
+    const int rows = static_cast<int>(std::ceil(canvasRect.height()));
+    for (const auto& it : curve_list)
+    {
+      if (auto* curve_xy = dynamic_cast<PointSeriesXY*>(it.curve->data()))
+        curve_xy->setDecimation(area, columns, rows);
+    }
+
+    QwtPlot::drawItems(painter, canvasRect, maps);
+  }
+
   std::list<PlotWidgetBase::CurveInfo> curve_list;
 
   PlotWidgetBase::CurveStyle curve_style = PlotWidgetBase::LINES;
@@ -352,24 +375,16 @@ PlotWidgetBase::~PlotWidgetBase()
 
 PlotWidgetBase::CurveInfo* PlotWidgetBase::addCurve(const std::string& name, PlotData& data, QColor color)
 {
-  const auto qname = QString::fromStdString(name);
-
   // title is the same of src_name, unless a transform was applied
-  auto curve_it = curveFromTitle(qname);
-  if (curve_it)
+  if (curveFromTitle(QString::fromStdString(name)))
   {
     return nullptr;  // TODO FIXME
   }
 
-  auto curve = new QwtPlotCurve(qname);
+  QwtSeriesWrapper* plot_qwt{ nullptr };
   try
   {
-    auto plot_qwt = createTimeSeries("", &data);
-
-    curve->setPaintAttribute(QwtPlotCurve::ClipPolygons, true);
-    curve->setPaintAttribute(QwtPlotCurve::FilterPoints, true);
-    //    curve->setPaintAttribute(QwtPlotCurve::FilterPointsAggressive, true);
-    curve->setData(plot_qwt);
+    plot_qwt = createTimeSeries("", &data);
   }
   catch (std::exception& ex)
   {
@@ -382,6 +397,30 @@ PlotWidgetBase::CurveInfo* PlotWidgetBase::addCurve(const std::string& name, Plo
     color = getColorHint(&data);
   }
 
+  return addCurve(name, plot_qwt, color);
+}
+
+PlotWidgetBase::CurveInfo* PlotWidgetBase::addCurve(const std::string& name, QwtSeriesWrapper* series, QColor color)
+{
+  const auto qname = QString::fromStdString(name);
+
+  if (curveFromTitle(qname))
+  {
+    delete series;
+    return nullptr;
+  }
+
+  auto curve = new QwtPlotCurve(qname);
+  curve->setPaintAttribute(QwtPlotCurve::ClipPolygons, true);
+  curve->setPaintAttribute(QwtPlotCurve::FilterPoints, true);
+  //    curve->setPaintAttribute(QwtPlotCurve::FilterPointsAggressive, true);
+  curve->setData(series);
+
+  if (color == Qt::transparent)
+  {
+    color = getColorHint(nullptr);
+  }
+
   curve->setPen(color);
   setStyle(curve, p->curve_style);
 
@@ -697,6 +736,7 @@ bool PlotWidgetBase::isZoomEnabled() const { return p->zoom_enabled; }
 
 void PlotWidgetBase::replot()
 {
+  TESSERACT_QT_TRACE_ZONE("PlotWidgetBase::replot");
   if (p->zoomer)
   {
     p->zoomer->setZoomBase(false);
@@ -109,6 +109,10 @@ void DialogTransformEditor::on_listCurves_itemSelectionChanged()
 
   auto curve_it = _plotwidget->curveFromTitle(curve_name);
   auto ts = dynamic_cast<TransformedTimeseries*>(curve_it->curve->data());
+  if (!ts)
+  {
+    return;
+  }
 
   int transform_row = 0;
   if (ts->transform())
@@ -162,6 +166,10 @@ void DialogTransformEditor::on_listTransforms_itemSelectionChanged()
   auto curve_info = _plotwidget->curveFromTitle(curve_name);
   auto qwt_curve = curve_info->curve;
   auto ts = dynamic_cast<TransformedTimeseries*>(curve_info->curve->data());
+  if (!ts)
+  {
+    return;
+  }
 
   QSignalBlocker block(ui->lineEditAlias);
 
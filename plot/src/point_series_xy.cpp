@@ -21,8 +21,11 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 #include <tesseract_qt/plot/point_series_xy.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <stdexcept>
 
 namespace tesseract::gui
 {
@@ -32,7 +35,25 @@ PointSeriesXY::PointSeriesXY(const PlotData* x_axis, const PlotData* y_axis)
   updateCache(true);
 }
 
-size_t PointSeriesXY::size() const { return _cached_curve.size(); }
+QPointF PointSeriesXY::sample(size_t i) const
+{
+  if (isDecimated())
+  {
+    // The last sample is always drawn after the decimated samples
+    i = (i < _decimated.size()) ? _decimated[i] - _front_index : _cached_curve.size() - 1;
+  }
+
+  const auto& p = _cached_curve.at(i);
+  return QPointF(p.x, p.y);
+}
+
+size_t PointSeriesXY::size() const
+{
+  if (isDecimated() && _cached_curve.size() > 0)
+    return _decimated.size() + 1;
+
+  return _cached_curve.size();
+}
 
 std::optional<QPointF> PointSeriesXY::sampleFromTime(double t)
 {
@@ -41,12 +62,18 @@ std::optional<QPointF> PointSeriesXY::sampleFromTime(double t)
     return {};
   }
 
-  int index = _y_axis->getIndexFromX(t);
-  if (index < 0)
+  auto lower = std::lower_bound(_cached_time.begin(), _cached_time.end(), t);
+  auto index = static_cast<size_t>(std::distance(_cached_time.begin(), lower));
+  if (index >= _cached_time.size())
   {
-    return {};
+    index = _cached_time.size() - 1;
+  }
+  else if (index > 0 && (std::abs(_cached_time[index - 1] - t) < std::abs(_cached_time[index] - t)))
+  {
+    index = index - 1;
   }
-  const auto& p = _cached_curve.at(size_t(index));
+
+  const auto& p = _cached_curve.at(index);
   return QPointF(p.x, p.y);
 }
 
@@ -54,36 +81,192 @@ RangeOpt PointSeriesXY::getVisualizationRangeY(Range) { return _cached_curve.ran
 
 bool PointSeriesXY::updateCache(bool reset_old_data)
 {
-  // TODO use reset_old_data
-
-  _cached_curve.clear();
-
   if (_x_axis == nullptr)
   {
     throw std::runtime_error("the X axis is null");
   }
 
-  const size_t data_size = std::min(_x_axis->size(), _y_axis->size());
-
-  if (data_size == 0)
+  if (_x_axis->size() == 0 || _y_axis->size() == 0)
   {
+    clearCache();
     return true;
   }
 
   const double EPS = std::numeric_limits<double>::epsilon();
 
-  for (size_t i = 0; i < data_size; i++)
+  // The sources were cleared and refilled if they end before the last joined sample
+  if (!_cached_time.empty() &&
+      (_x_axis->back().x < _cached_time.back() - EPS || _y_axis->back().x < _cached_time.back() - EPS))
+  {
+    reset_old_data = true;
+  }
+
+  if (reset_old_data)
+  {
+    clearCache();
+  }
+
+  // Remove the samples trimmed from the front of either source
+  const double front_time = std::max(_x_axis->front().x, _y_axis->front().x);
+  while (!_cached_time.empty() && _cached_time.front() < front_time - EPS)
+  {
+    popFront();
+  }
+
+  // Merge join the samples after the last joined sample
+  auto time_compare = [](double t, const PlotData::Point& p) { return t < p.x; };
+  auto x_it = _x_axis->begin();
+  auto y_it = _y_axis->begin();
+  if (!_cached_time.empty())
+  {
+    const double last_time = _cached_time.back() + EPS;
+    x_it = std::upper_bound(_x_axis->begin(), _x_axis->end(), last_time, time_compare);
+    y_it = std::upper_bound(_y_axis->begin(), _y_axis->end(), last_time, time_compare);
+  }
+
+  while (x_it != _x_axis->end() && y_it != _y_axis->end())
   {
-    if (std::abs(_x_axis->at(i).x - _y_axis->at(i).x) > EPS)
+    if (std::abs(x_it->x - y_it->x) <= EPS)
     {
-      throw std::runtime_error("X and Y axis don't share the same time axis");
+      _cached_curve.pushBack({ x_it->y, y_it->y });
+      _cached_time.push_back(x_it->x);
+      ++x_it;
+      ++y_it;
+    }
+    else if (x_it->x < y_it->x)
+    {
+      ++x_it;
+    }
+    else
+    {
+      ++y_it;
     }
-
-    const QPointF p(_x_axis->at(i).y, _y_axis->at(i).y);
-    _cached_curve.pushBack({ p.x(), p.y() });
   }
+
+  updateDecimation();
   return true;
 }
 
 RangeOpt PointSeriesXY::getVisualizationRangeX() { return _cached_curve.rangeX(); }
+
+void PointSeriesXY::setDecimation(const QRectF& area, int columns, int rows)
+{
+  if (area == _decimation_area && columns == _decimation_columns && rows == _decimation_rows)
+    return;
+
+  _decimation_area = area;
+  _decimation_columns = std::max(columns, 0);
+  _decimation_rows = std::max(rows, 0);
+  if (area.width() == 0 || area.height() == 0)
+  {
+    _decimation_columns = 0;
+    _decimation_rows = 0;
+  }
+
+  resetDecimation();
+  updateDecimation();
+}
+
+void PointSeriesXY::clearCache()
+{
+  _front_index += _cached_curve.size();
+  _cached_curve.clear();
+  _cached_time.clear();
+  resetDecimation();
+}
+
+void PointSeriesXY::popFront()
+{
+  _cached_curve.popFront();
+  _cached_time.pop_front();
+  ++_front_index;
+
+  if (_decimation_next < _front_index)
+    _decimation_next = _front_index;
+
+  if (!_decimated.empty() && _decimated.front() < _front_index)
+    _decimated.pop_front();
+}
+
+void PointSeriesXY::resetDecimation()
+{
+  _decimated.clear();
+  _decimation_next = _front_index;
+  _decimation_run_active = false;
+}
+
+void PointSeriesXY::endDecimationRun()
+{
+  // The first sample of the run is already kept, the last one may have been trimmed meanwhile
+  if (_decimation_run_active && _decimation_run_last >= _front_index &&
+      (_decimated.empty() || _decimated.back() < _decimation_run_last))
+    _decimated.push_back(_decimation_run_last);
+
+  _decimation_run_active = false;
+}
+
+void PointSeriesXY::updateDecimation()
+{
+  if (!isDecimated())
+    return;
+
+  // The last sample is not classified until its successor is known
+  const size_t size = _cached_curve.size();
+  size_t cell{ 0 };
+  size_t previous_cell{ 0 };
+  size_t next_cell{ 0 };
+  for (size_t i = _decimation_next - _front_index; i + 1 < size; ++i)
+  {
+    const bool inside = getDecimationCell(i, cell);
+    if (!inside)
+    {
+      // Samples outside are only required for the line segments crossing the border
+      const bool previous_inside = (i == 0) || getDecimationCell(i - 1, previous_cell);
+      const bool next_inside = getDecimationCell(i + 1, next_cell);
+      if (!previous_inside && !next_inside)
+      {
+        endDecimationRun();
+        continue;
+      }
+    }
+
+    // Keep the first and last sample of each run of consecutive samples in the same cell
+    if (_decimation_run_active && cell == _decimation_run_cell)
+    {
+      _decimation_run_last = _front_index + i;
+      continue;
+    }
+
+    endDecimationRun();
+    _decimated.push_back(_front_index + i);
+    _decimation_run_cell = cell;
+    _decimation_run_last = _front_index + i;
+    _decimation_run_active = true;
+  }
+
+  if (size > 0)
+    _decimation_next = _front_index + size - 1;
+}
+
+bool PointSeriesXY::getDecimationCell(size_t index, size_t& cell) const
+{
+  const auto& p = _cached_curve.at(index);
+  const double nx = (p.x - _decimation_area.left()) / _decimation_area.width();
+  const double ny = (p.y - _decimation_area.top()) / _decimation_area.height();
+  const bool inside = (nx >= 0 && nx < 1 && ny >= 0 && ny < 1);
+  if (!inside)
+  {
+    // Samples outside are clamped to the border cells
+    const int column = (nx < 0) ? -1 : ((nx < 1) ? static_cast<int>(nx * _decimation_columns) : _decimation_columns);
+    const int row = (ny < 0) ? -1 : ((ny < 1) ? static_cast<int>(ny * _decimation_rows) : _decimation_rows);
+    cell = static_cast<size_t>(row + 1) * static_cast<size_t>(_decimation_columns + 2) +
+           static_cast<size_t>(column + 1);
+    return false;
+  }
+
+  const auto column = static_cast<size_t>(nx * _decimation_columns);
+  const auto row = static_cast<size_t>(ny * _decimation_rows);
+  cell = (row + 1) * static_cast<size_t>(_decimation_columns + 2) + (column + 1);
+  return true;
+}
 }  // namespace tesseract::gui
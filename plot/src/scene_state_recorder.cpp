@@ -0,0 +1,268 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/plot/scene_state_recorder.h>
+#include <tesseract_qt/plot/plot_data.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+namespace
+{
+const std::array<std::pair<SceneStateRecorder::PoseComponent, const char*>, 6> POSE_COMPONENTS{
+  { { SceneStateRecorder::X, "x" },
+    { SceneStateRecorder::Y, "y" },
+    { SceneStateRecorder::Z, "z" },
+    { SceneStateRecorder::ROLL, "roll" },
+    { SceneStateRecorder::PITCH, "pitch" },
+    { SceneStateRecorder::YAW, "yaw" } }
+};
+
+/** @brief Get the pose components in the same order as POSE_COMPONENTS using the fixed axis xyz convention */
+std::array<double, 6> getPoseComponents(const Eigen::Isometry3d& pose)
+{
+  const Eigen::Matrix3d& r = pose.linear();
+  const Eigen::Vector3d& t = pose.translation();
+  return { t.x(),
+           t.y(),
+           t.z(),
+           std::atan2(r(2, 1), r(2, 2)),
+           std::asin(std::clamp(-r(2, 0), -1.0, 1.0)),
+           std::atan2(r(1, 0), r(0, 0)) };
+}
+}  // namespace
+
+struct SceneStateRecorder::Implementation
+{
+  std::shared_ptr<const ComponentInfo> component_info;
+  PlotDataMapRef* plot_data_map{ nullptr };
+  std::string prefix;
+  bool joint_positions{ true };
+  std::unordered_map<std::string, int> link_poses;
+  double maximum_range_x{ 30 };
+  bool recording{ true };
+  ColumnarTimeseries store;
+  std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+
+  /** @brief The channel of each joint */
+  std::unordered_map<std::string, std::size_t> joint_channels;
+
+  /** @brief The channel of each link pose component, -1 if not recorded */
+  std::unordered_map<std::string, std::array<long, 6>> link_channels;
+
+  std::string getSeriesName(const std::string& name, const std::string& suffix) const
+  {
+    if (prefix.empty())
+      return name + "::" + suffix;
+
+    return prefix + "::" + name + "::" + suffix;
+  }
+
+  std::size_t getJointChannel(const std::string& joint_name)
+  {
+    auto it = joint_channels.find(joint_name);
+    if (it != joint_channels.end())
+      return it->second;
+
+    const std::size_t channel = store.addChannel(getSeriesName(joint_name, "position"));
+    joint_channels[joint_name] = channel;
+    return channel;
+  }
+
+  const std::array<long, 6>& getLinkChannels(const std::string& link_name, int components)
+  {
+    auto it = link_channels.find(link_name);
+    if (it != link_channels.end())
+      return it->second;
+
+    std::array<long, 6> channels{ -1, -1, -1, -1, -1, -1 };
+    for (std::size_t i = 0; i < POSE_COMPONENTS.size(); ++i)
+    {
+      if ((components & POSE_COMPONENTS[i].first) != 0)
+        channels[i] = static_cast<long>(store.addChannel(getSeriesName(link_name, POSE_COMPONENTS[i].second)));
+    }
+    return link_channels.emplace(link_name, channels).first->second;
+  }
+
+  PlotData& getSeries(const std::string& name)
+  {
+    auto it = plot_data_map->numeric.find(name);
+    if (it != plot_data_map->numeric.end())
+      return it->second;
+
+    PlotData& series = plot_data_map->getOrCreateNumeric(name);
+    series.setMaximumRangeX(maximum_range_x);
+    return series;
+  }
+
+  void record(std::size_t channel, double time, double value)
+  {
+    store.setValue(channel, value);
+    getSeries(store.getChannelNames()[channel]).pushBack({ time, value });
+  }
+
+  double record(const tesseract::scene_graph::SceneState& state)
+  {
+    const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    store.appendRow(time);
+
+    if (joint_positions)
+    {
+      for (const auto& joint : state.joints)
+        record(getJointChannel(joint.first), time, joint.second);
+    }
+
+    for (const auto& link_pose : link_poses)
+    {
+      auto it = state.link_transforms.find(link_pose.first);
+      if (it == state.link_transforms.end())
+        continue;
+
+      const std::array<long, 6>& channels = getLinkChannels(link_pose.first, link_pose.second);
+      const std::array<double, 6> values = getPoseComponents(it->second);
+      for (std::size_t i = 0; i < channels.size(); ++i)
+      {
+        if (channels[i] >= 0)
+          record(static_cast<std::size_t>(channels[i]), time, values[i]);
+      }
+    }
+
+    return time;
+  }
+};
+
+SceneStateRecorder::SceneStateRecorder(std::shared_ptr<const ComponentInfo> component_info,
+                                       PlotDataMapRef& plot_data_map,
+                                       QObject* parent)
+  : QObject(parent), data_(std::make_unique<Implementation>())
+{
+  data_->component_info = std::move(component_info);
+  data_->plot_data_map = &plot_data_map;
+
+  qApp->installEventFilter(this);
+}
+
+SceneStateRecorder::~SceneStateRecorder() = default;
+
+std::shared_ptr<const ComponentInfo> SceneStateRecorder::getComponentInfo() const { return data_->component_info; }
+
+void SceneStateRecorder::setPrefix(const std::string& prefix) { data_->prefix = prefix; }
+const std::string& SceneStateRecorder::getPrefix() const { return data_->prefix; }
+
+void SceneStateRecorder::setJointPositionsEnabled(bool enabled) { data_->joint_positions = enabled; }
+bool SceneStateRecorder::jointPositionsEnabled() const { return data_->joint_positions; }
+
+void SceneStateRecorder::addLinkPose(const std::string& link_name, int components)
+{
+  data_->link_poses[link_name] = components;
+
+  // Channels are created on the next sample, existing channels of removed components are kept with NaN values
+  data_->link_channels.erase(link_name);
+}
+
+void SceneStateRecorder::removeLinkPose(const std::string& link_name)
+{
+  data_->link_poses.erase(link_name);
+  data_->link_channels.erase(link_name);
+}
+
+void SceneStateRecorder::setMaximumRangeX(double range)
+{
+  data_->maximum_range_x = range;
+  for (const auto& name : data_->store.getChannelNames())
+  {
+    auto it = data_->plot_data_map->numeric.find(name);
+    if (it != data_->plot_data_map->numeric.end())
+      it->second.setMaximumRangeX(range);
+  }
+}
+
+double SceneStateRecorder::getMaximumRangeX() const { return data_->maximum_range_x; }
+
+void SceneStateRecorder::setMaximumDuration(double duration) { data_->store.setMaximumDuration(duration); }
+double SceneStateRecorder::getMaximumDuration() const { return data_->store.getMaximumDuration(); }
+
+void SceneStateRecorder::setRecording(bool recording) { data_->recording = recording; }
+bool SceneStateRecorder::isRecording() const { return data_->recording; }
+
+const ColumnarTimeseries& SceneStateRecorder::getRecording() const { return data_->store; }
+
+void SceneStateRecorder::clear()
+{
+  for (const auto& name : data_->store.getChannelNames())
+  {
+    auto it = data_->plot_data_map->numeric.find(name);
+    if (it != data_->plot_data_map->numeric.end())
+      it->second.clear();
+  }
+
+  data_->store.clear();
+  data_->start = std::chrono::steady_clock::now();
+}
+
+void SceneStateRecorder::copyTo(PlotDataMapRef& plot_data_map) const
+{
+  const ColumnarTimeseries& store = data_->store;
+  if (store.empty())
+    return;
+
+  const double start = store.getTime(0);
+  const double end = store.getTime(store.size() - 1);
+  for (std::size_t channel = 0; channel < store.channelCount(); ++channel)
+  {
+    PlotData& series = plot_data_map.getOrCreateNumeric(store.getChannelNames()[channel]);
+    series.clear();
+    store.copyTo(channel, series, start, end);
+  }
+}
+
+bool SceneStateRecorder::eventFilter(QObject* obj, QEvent* event)
+{
+  if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+  {
+    assert(dynamic_cast<events::SceneStateChanged*>(event) != nullptr);
+    auto* e = static_cast<events::SceneStateChanged*>(event);
+    if (data_->recording && (e->getComponentInfo() == data_->component_info ||
+                             e->getComponentInfo()->isParent(data_->component_info)))
+    {
+      Q_EMIT recorded(data_->record(e->getState()));
+    }
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+
+}  // namespace tesseract::gui
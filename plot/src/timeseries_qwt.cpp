@@ -21,6 +21,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 #include <tesseract_qt/plot/timeseries_qwt.h>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <stdexcept>
 #include <QMessageBox>
@@ -164,4 +166,83 @@ RangeOpt QwtSeriesWrapper::getVisualizationRangeX()
 }
 
 const PlotDataBase<double, double>* QwtSeriesWrapper::plotData() const { return _data; }
+
+ColumnTimeseries::ColumnTimeseries(const std::string& name,
+                                   const double* x,
+                                   const double* y,
+                                   std::size_t size,
+                                   std::shared_ptr<const void> owner)
+  : QwtSeriesWrapper(&_envelope), _envelope(name, {}), _x(x), _y(y), _size(size), _owner(std::move(owner))
+{
+  if (_size == 0)
+    return;
+
+  double min_y = std::numeric_limits<double>::max();
+  double max_y = -std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < _size; ++i)
+  {
+    if (std::isfinite(_y[i]))
+    {
+      min_y = std::min(min_y, _y[i]);
+      max_y = std::max(max_y, _y[i]);
+    }
+  }
+
+  if (min_y > max_y)
+    min_y = max_y = 0;
+
+  _envelope.pushBack(PlotData::Point(_x[0], min_y));
+  _envelope.pushBack(PlotData::Point(_x[_size - 1], max_y));
+}
+
+QPointF ColumnTimeseries::sample(size_t i) const { return QPointF(_x[i] - _time_offset, _y[i]); }
+
+size_t ColumnTimeseries::size() const { return _size; }
+
+bool ColumnTimeseries::updateCache(bool /*reset_old_data*/) { return true; }
+
+int ColumnTimeseries::getIndexFromX(double t) const
+{
+  if (_size == 0 || t < _x[0] || t > _x[_size - 1])
+    return -1;
+
+  const double* it = std::upper_bound(_x, _x + _size, t);
+  return static_cast<int>(std::distance(_x, it)) - 1;
+}
+
+RangeOpt ColumnTimeseries::getVisualizationRangeY(Range range_X)
+{
+  if (_size == 0)
+    return {};
+
+  const double* first = std::lower_bound(_x, _x + _size, range_X.min);
+  const double* last = std::upper_bound(first, _x + _size, range_X.max);
+  if (first == last)
+    return {};
+
+  double min_y = std::numeric_limits<double>::max();
+  double max_y = -std::numeric_limits<double>::max();
+  for (auto i = std::distance(_x, first); i < std::distance(_x, last); ++i)
+  {
+    if (std::isfinite(_y[i]))
+    {
+      min_y = std::min(min_y, _y[i]);
+      max_y = std::max(max_y, _y[i]);
+    }
+  }
+
+  if (min_y > max_y)
+    return {};
+
+  return Range{ min_y, max_y };
+}
+
+std::optional<QPointF> ColumnTimeseries::sampleFromTime(double t)
+{
+  int index = getIndexFromX(t);
+  if (index < 0)
+    return {};
+
+  return QPointF(_x[index], _y[index]);
+}
 }  // namespace tesseract::gui
@@ -0,0 +1,94 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QApplication>
+#include <QDebug>
+
+#include <tesseract_qt/rendering/offscreen_renderer.h>
+#include <tesseract_qt/rendering/render_widget.h>
+#include <tesseract_qt/rendering/ign_scene_graph_render_manager.h>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/component_info_manager.h>
+#include <tesseract_qt/common/entity_manager.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/common/resource_locator.h>
+#include <tesseract/common/joint_state.h>
+
+tesseract::common::JointTrajectory getJointTrajectory()
+{
+  tesseract::common::JointTrajectory trajectory("description");
+  for (int j = 0; j < 5; ++j)
+  {
+    tesseract::common::JointState state;
+    state.joint_names = { "joint_a1", "joint_a2", "joint_a3", "joint_a4", "joint_a5", "joint_a6", "joint_a7" };
+    state.position = Eigen::VectorXd::Constant(7, 0.25 * j);
+    state.time = j;
+    trajectory.push_back(state);
+  }
+
+  return trajectory;
+}
+
+int main(int argc, char** argv)
+{
+  // Allow running without a display
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication app(argc, argv);
+
+  Q_INIT_RESOURCE(tesseract_qt_resources);
+
+  const QString output_directory = (argc > 1) ? QString(argv[1]) : QString("offscreen_render_frames");
+
+  auto locator = std::make_shared<tesseract::common::GeneralResourceLocator>();
+  std::filesystem::path urdf_path(
+      locator->locateResource("package://tesseract/support/urdf/lbr_iiwa_14_r820.urdf")->getFilePath());
+  std::filesystem::path srdf_path(
+      locator->locateResource("package://tesseract/support/urdf/lbr_iiwa_14_r820.srdf")->getFilePath());
+
+  auto env = std::make_shared<tesseract::environment::Environment>();
+  env->init(urdf_path, srdf_path, locator);
+
+  auto component_info = tesseract::gui::ComponentInfoManager::create(env->getName());
+  auto entity_manager = std::make_shared<tesseract::gui::EntityManager>();
+
+  tesseract::gui::IgnSceneGraphRenderManager scene_graph_manager(component_info, entity_manager);
+
+  tesseract::gui::OffscreenRenderer renderer(component_info->getSceneName());
+  renderer.getRenderer().setSkyEnabled(false);
+  if (!renderer.initialize(1280, 720))
+    return 1;
+
+  tesseract::gui::EnvironmentManager::set(
+      std::make_shared<tesseract::gui::DefaultEnvironmentWrapper>(component_info, env));
+
+  std::size_t frame_count = renderer.writeTrajectory(component_info, *env, getJointTrajectory(), 30, output_directory);
+  qInfo() << "Wrote" << frame_count << "frames to" << output_directory;
+
+  return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_IGN_JOINT_TRAJECTORY_GHOST_RENDER_MANAGER_H
+#define TESSERACT_QT_RENDERING_IGN_JOINT_TRAJECTORY_GHOST_RENDER_MANAGER_H
+
+#include <tesseract_qt/common/events/joint_trajectory_ghost_render_manager.h>
+
+namespace tesseract::gui
+{
+class EntityManager;
+class ComponentInfo;
+
+/**
+ * @brief Renders sampled states of a joint trajectory as translucent copies of the moving links and the tcp path
+ * @details The link visuals are loaded once and cloned for every sample, so all copies share the same meshes. The
+ * copies fade in from the start to the end of the trajectory.
+ */
+class IgnJointTrajectoryGhostRenderManager : public JointTrajectoryGhostRenderManager
+{
+public:
+  IgnJointTrajectoryGhostRenderManager(std::shared_ptr<const ComponentInfo> component_info,
+                                       std::shared_ptr<EntityManager> entity_manager);
+  ~IgnJointTrajectoryGhostRenderManager();
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+
+  void render() override;
+};
+}  // namespace tesseract::gui
+#endif  // TESSERACT_QT_RENDERING_IGN_JOINT_TRAJECTORY_GHOST_RENDER_MANAGER_H
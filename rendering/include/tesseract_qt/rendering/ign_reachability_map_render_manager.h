@@ -0,0 +1,49 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_IGN_REACHABILITY_MAP_RENDER_MANAGER_H
+#define TESSERACT_QT_RENDERING_IGN_REACHABILITY_MAP_RENDER_MANAGER_H
+
+#include <tesseract_qt/common/events/reachability_map_render_manager.h>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+
+/**
+ * @brief Renders a reachability map as colored voxels, from red (few orientations reachable) to green (all reachable)
+ * @details While the camera moves, leaf voxels which appear large in the view are requested to be refined
+ */
+class IgnReachabilityMapRenderManager : public ReachabilityMapRenderManager
+{
+public:
+  IgnReachabilityMapRenderManager(std::shared_ptr<const ComponentInfo> component_info);
+  ~IgnReachabilityMapRenderManager();
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+
+  void render() override;
+};
+}  // namespace tesseract::gui
+#endif  // TESSERACT_QT_RENDERING_IGN_REACHABILITY_MAP_RENDER_MANAGER_H
@@ -0,0 +1,78 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_IGN_SHARED_SCENE_H
+#define TESSERACT_QT_RENDERING_IGN_SHARED_SCENE_H
+
+#include <memory>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+class EntityManager;
+class ScenePicker;
+
+/**
+ * @brief The render managers of a component info's scene, shared by every render widget showing it
+ * @details Render widgets with the same scene name render the same scene each with their own camera. Holding the
+ * render managers through this class means the scene graph, tool paths and contact results are loaded once and each
+ * update is applied once per frame no matter how many widgets show the scene. The managers are destroyed, clearing
+ * the scene, when the last holder releases it.
+ */
+class IgnSharedScene
+{
+public:
+  using Ptr = std::shared_ptr<IgnSharedScene>;
+  using ConstPtr = std::shared_ptr<const IgnSharedScene>;
+
+  ~IgnSharedScene();
+  IgnSharedScene(const IgnSharedScene&) = delete;
+  IgnSharedScene& operator=(const IgnSharedScene&) = delete;
+  IgnSharedScene(IgnSharedScene&&) = delete;
+  IgnSharedScene& operator=(IgnSharedScene&&) = delete;
+
+  /**
+   * @brief Get the shared scene of a component info, creating it if no one holds it
+   * @note This must be called on the main thread
+   * @param component_info The component info
+   * @return The shared scene
+   */
+  static Ptr get(std::shared_ptr<const ComponentInfo> component_info);
+
+  /** @brief Get the component info */
+  std::shared_ptr<const ComponentInfo> getComponentInfo() const;
+
+  /** @brief Get the entity manager used by the render managers */
+  std::shared_ptr<EntityManager> getEntityManager() const;
+
+  /** @brief Get the scene picker of the scene, the link it picks is highlighted on hover and selected on click */
+  std::shared_ptr<ScenePicker> getScenePicker() const;
+
+private:
+  explicit IgnSharedScene(std::shared_ptr<const ComponentInfo> component_info);
+
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_IGN_SHARED_SCENE_H
@@ -61,8 +61,16 @@ public:
   using Ptr = std::shared_ptr<InteractiveViewControl>;
   using ConstPtr = std::shared_ptr<const InteractiveViewControl>;
 
-  /** @brief Constructor */
-  InteractiveViewControl(const std::string& scene_name, ViewControlType type = ViewControlType::ORBIT);
+  /**
+   * @brief Constructor
+   * @param scene_name The scene to control
+   * @param type The view controller type
+   * @param camera_name The camera to control and whose input events to handle. If empty the first user camera of the
+   * scene is controlled.
+   */
+  InteractiveViewControl(const std::string& scene_name,
+                         ViewControlType type = ViewControlType::ORBIT,
+                         std::string camera_name = "");
 
   /** @brief Destructor */
   virtual ~InteractiveViewControl();
@@ -0,0 +1,135 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_LINK_VISIBILITY_TABLE_H
+#define TESSERACT_QT_RENDERING_LINK_VISIBILITY_TABLE_H
+
+#include <tesseract_qt/common/link_visibility.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gz/rendering/config.hh>
+
+namespace gz::rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE
+{
+class Scene;
+class Visual;
+}  // namespace GZ_RENDERING_VERSION_NAMESPACE
+}  // namespace gz::rendering
+
+namespace tesseract::gui
+{
+class EntityContainer;
+
+/**
+ * @brief Dense visibility state of the links loaded by the scene graph render manager
+ * @details Each link stores the user visibility of its components as LinkVisibilityFlags bits along with the scene
+ * nodes of the components, so a visibility change is resolved with bit operations and only the nodes whose
+ * visibility actually changed are updated. The visuals and collisions are only shown if the link is visible, the
+ * axis and wire box are independent of the link. A highlighted link shows its wire box regardless of the user
+ * visibility, which is left untouched.
+ */
+class LinkVisibilityTable
+{
+public:
+  /**
+   * @brief Add a link loaded with loadLink, replacing it if it already exists
+   * @param scene The scene containing the link
+   * @param entity_container The entity container the link was loaded into
+   * @param link_name The name of the link
+   */
+  void addLink(gz::rendering::Scene& scene, const EntityContainer& entity_container, const std::string& link_name);
+
+  /** @brief Remove a link */
+  void removeLink(const std::string& link_name);
+
+  /** @brief Check if the link exists */
+  bool hasLink(const std::string& link_name) const;
+
+  /**
+   * @brief Set the visibility of the components of the provided links
+   * @param link_names The links to modify, unknown links are ignored
+   * @param flags The components to modify, LinkVisibilityFlags::ALL modifies every component
+   * @param visible The visibility
+   */
+  void setVisibility(const std::vector<std::string>& link_names, LinkVisibilityFlags flags, bool visible);
+
+  /**
+   * @brief Set the visibility of the components of all links
+   * @details Showing the visuals or collisions also shows the link
+   * @param flags The components to modify
+   * @param visible The visibility
+   */
+  void setVisibilityAll(LinkVisibilityFlags flags, bool visible);
+
+  /**
+   * @brief Set if the provided links are highlighted
+   * @param link_names The links to modify, unknown links are ignored
+   * @param highlight Show the wire box of the links in addition to their user visibility
+   */
+  void setHighlight(const std::vector<std::string>& link_names, bool highlight);
+
+  /** @brief Get the user visibility of a link component */
+  bool isVisible(const std::string& link_name, LinkVisibilityFlags component) const;
+
+  std::size_t size() const;
+  void clear();
+
+private:
+  static constexpr std::size_t COMPONENT_COUNT{ 5 };
+
+  struct Link
+  {
+    std::string name;
+
+    /** @brief The user visibility of the components */
+    std::uint8_t user{ 0 };
+
+    /** @brief Show the wire box in addition to the user visibility */
+    bool highlight{ false };
+
+    /** @brief The components which have a scene node */
+    std::uint8_t present{ 0 };
+
+    /** @brief The visibility last applied to the scene nodes */
+    std::uint8_t applied{ 0 };
+
+    /** @brief The scene nodes indexed by the bit position of the component */
+    std::array<std::shared_ptr<gz::rendering::Visual>, COMPONENT_COUNT> nodes;
+  };
+
+  std::vector<Link> links_;
+  std::unordered_map<std::string, std::size_t> link_index_;
+
+  static std::uint8_t effectiveVisibility(const Link& link);
+  static void apply(Link& link);
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_LINK_VISIBILITY_TABLE_H
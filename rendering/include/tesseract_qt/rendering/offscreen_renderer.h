@@ -0,0 +1,170 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_OFFSCREEN_RENDERER_H
+#define TESSERACT_QT_RENDERING_OFFSCREEN_RENDERER_H
+
+#ifndef Q_MOC_RUN
+#include <functional>
+#include <memory>
+#include <string>
+#include <QImage>
+#include <QSize>
+#include <QString>
+#include <tesseract/common/fwd.h>
+#include <tesseract/environment/fwd.h>
+#endif
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+class Renderer;
+
+/**
+ * @brief A headless renderer which owns its own offscreen OpenGL context
+ * @details This does not require a visible window and can be used with the offscreen QPA platform, for example
+ * on CPU-only machines using Mesa/llvmpipe. Frames are read back asynchronously using a ring of pixel buffer
+ * objects so the readback of frame N overlaps with the rendering of frame N + 1.
+ *
+ * A QGuiApplication must exist and all calls must be made from the thread which created it.
+ */
+class OffscreenRenderer
+{
+public:
+  /**
+   * @brief Callback called for every frame read back from the GPU
+   * @param frame The frame index
+   * @param time The trajectory time of the frame, zero if not rendering a trajectory
+   * @param image The frame image
+   */
+  using FrameCallback = std::function<void(std::size_t frame, double time, const QImage& image)>;
+
+  /**
+   * @brief Constructor
+   * @param scene_name The name of the scene to render
+   * @param engine_name The render engine name
+   */
+  explicit OffscreenRenderer(const std::string& scene_name, const std::string& engine_name = "ogre2");
+  ~OffscreenRenderer();
+  OffscreenRenderer(const OffscreenRenderer&) = delete;
+  OffscreenRenderer& operator=(const OffscreenRenderer&) = delete;
+  OffscreenRenderer(OffscreenRenderer&&) = delete;
+  OffscreenRenderer& operator=(OffscreenRenderer&&) = delete;
+
+  /**
+   * @brief Create the offscreen context and initialize the render engine
+   * @details The renderer settings (camera pose, background, etc.) should be applied prior to calling this.
+   * @param width The image width in pixels
+   * @param height The image height in pixels
+   * @return True if successful, otherwise false
+   */
+  bool initialize(int width, int height);
+
+  /** @brief Check if initialized */
+  bool isInitialized() const;
+
+  /**
+   * @brief Resize the rendered image
+   * @details Any pending frames are discarded
+   * @param width The image width in pixels
+   * @param height The image height in pixels
+   */
+  void resize(int width, int height);
+
+  /** @brief Get the image size */
+  QSize getSize() const;
+
+  /**
+   * @brief Set the number of pixel buffer objects used for asynchronous readback, default is 2
+   * @details Must be called prior to initialize. A larger number increases latency but allows more frames in flight.
+   */
+  void setReadbackBufferCount(int count);
+  int getReadbackBufferCount() const;
+
+  /** @brief Access the underlying renderer to configure camera, lighting, grid, etc. */
+  Renderer& getRenderer();
+  const Renderer& getRenderer() const;
+
+  /**
+   * @brief Render a frame and queue an asynchronous readback
+   * @details When all readback buffers are in use the oldest frame is finished and passed to the callback
+   * @param callback The callback called for each completed frame
+   * @param time The time associated with the frame, which is passed back through the callback
+   */
+  void render(const FrameCallback& callback, double time = 0);
+
+  /**
+   * @brief Finish all pending readbacks
+   * @param callback The callback called for each completed frame
+   */
+  void flush(const FrameCallback& callback);
+
+  /**
+   * @brief Render a single frame and wait for the result
+   * @return The rendered image, which is null if not initialized
+   */
+  QImage grabFrame();
+
+  /**
+   * @brief Step through a joint trajectory rendering a frame at a fixed rate
+   * @details For every frame the environment state is computed and a scene state changed event is sent for the
+   * component info, so the render managers listening on the component info update prior to rendering.
+   * @param component_info The component info associated with the environment being rendered
+   * @param env The environment used to compute the scene state
+   * @param trajectory The joint trajectory to step through
+   * @param frame_rate The number of frames per second of trajectory time
+   * @param callback The callback called for each completed frame
+   * @return The number of frames rendered
+   */
+  std::size_t renderTrajectory(const std::shared_ptr<const ComponentInfo>& component_info,
+                               const tesseract::environment::Environment& env,
+                               const tesseract::common::JointTrajectory& trajectory,
+                               double frame_rate,
+                               const FrameCallback& callback);
+
+  /**
+   * @brief Step through a joint trajectory writing a frame at a fixed rate to the provided directory
+   * @details Frames are named using the prefix and a zero padded frame index (ex. frame_000000.png)
+   * @param component_info The component info associated with the environment being rendered
+   * @param env The environment used to compute the scene state
+   * @param trajectory The joint trajectory to step through
+   * @param frame_rate The number of frames per second of trajectory time
+   * @param directory The output directory which is created if it does not exist
+   * @param prefix The frame file name prefix
+   * @param format The image format passed to QImage::save
+   * @return The number of frames written
+   */
+  std::size_t writeTrajectory(const std::shared_ptr<const ComponentInfo>& component_info,
+                              const tesseract::environment::Environment& env,
+                              const tesseract::common::JointTrajectory& trajectory,
+                              double frame_rate,
+                              const QString& directory,
+                              const QString& prefix = "frame_",
+                              const char* format = "png");
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_OFFSCREEN_RENDERER_H
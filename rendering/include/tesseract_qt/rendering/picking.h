@@ -0,0 +1,359 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_PICKING_H
+#define TESSERACT_QT_RENDERING_PICKING_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+#include <boost/uuid/uuid.hpp>
+#include <tesseract/common/types.h>
+#include <tesseract/scene_graph/fwd.h>
+
+namespace tesseract::gui
+{
+/**
+ * @brief A bounding volume hierarchy over axis aligned boxes
+ * @details The tree is stored as a flat array where the children of an internal node are adjacent and always have a
+ * larger index than their parent, which allows refitting the boxes in a single reverse pass without rebuilding.
+ */
+class PickingBVH
+{
+public:
+  struct Node
+  {
+    Eigen::AlignedBox3d box;
+
+    /** @brief The index of the first child for internal nodes, otherwise the index of the first item */
+    int index{ 0 };
+
+    /** @brief The number of items in a leaf node, zero for internal nodes */
+    int count{ 0 };
+  };
+
+  /**
+   * @brief Build the hierarchy
+   * @param boxes The item bounding boxes
+   * @param leaf_size The maximum number of items in a leaf
+   */
+  void build(const std::vector<Eigen::AlignedBox3d>& boxes, int leaf_size = 4);
+
+  /**
+   * @brief Update the node boxes keeping the topology
+   * @param boxes The item bounding boxes which must be the same size as provided to build
+   */
+  void refit(const std::vector<Eigen::AlignedBox3d>& boxes);
+
+  void clear();
+  bool empty() const;
+
+  /** @brief The bounds of all items */
+  Eigen::AlignedBox3d getBounds() const;
+
+  /**
+   * @brief Traverse the leaves hit by a ray front to back
+   * @param origin The ray origin
+   * @param direction The normalized ray direction
+   * @param distance The maximum distance which the item function reduces when it finds a closer hit
+   * @param item_fn Called as item_fn(item, distance) for every item in a leaf hit by the ray
+   */
+  template <typename ItemFn>
+  void raycast(const Eigen::Vector3d& origin,
+               const Eigen::Vector3d& direction,
+               double& distance,
+               ItemFn&& item_fn) const
+  {
+    if (nodes_.empty())
+      return;
+
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    double t{ 0 };
+    if (!intersect(nodes_[0].box, origin, inv_direction, distance, t))
+      return;
+
+    // The midpoint split does not bound the depth, so fall back to the heap for deep trees of clustered items
+    std::array<int, 64> local_stack;
+    std::vector<int> heap_stack;
+    int* stack = local_stack.data();
+    if (static_cast<std::size_t>(depth_) + 2 > local_stack.size())
+    {
+      heap_stack.resize(static_cast<std::size_t>(depth_) + 2);
+      stack = heap_stack.data();
+    }
+
+    int size{ 0 };
+    stack[size++] = 0;
+    while (size > 0)
+    {
+      const Node& node = nodes_[static_cast<std::size_t>(stack[--size])];
+      if (node.count > 0)
+      {
+        for (int i = node.index; i < node.index + node.count; ++i)
+          item_fn(items_[static_cast<std::size_t>(i)], distance);
+
+        continue;
+      }
+
+      double t0{ 0 };
+      double t1{ 0 };
+      const Node& child0 = nodes_[static_cast<std::size_t>(node.index)];
+      const Node& child1 = nodes_[static_cast<std::size_t>(node.index + 1)];
+      const bool hit0 = intersect(child0.box, origin, inv_direction, distance, t0);
+      const bool hit1 = intersect(child1.box, origin, inv_direction, distance, t1);
+
+      // Push the farther child first so the nearer child is visited first
+      if (hit0 && hit1)
+      {
+        stack[size++] = (t0 < t1) ? node.index + 1 : node.index;
+        stack[size++] = (t0 < t1) ? node.index : node.index + 1;
+      }
+      else if (hit0)
+      {
+        stack[size++] = node.index;
+      }
+      else if (hit1)
+      {
+        stack[size++] = node.index + 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Ray box intersection using the slab method
+   * @param t The entry distance if hit
+   * @return True if the ray hits the box within the max distance
+   */
+  static bool intersect(const Eigen::AlignedBox3d& box,
+                        const Eigen::Vector3d& origin,
+                        const Eigen::Vector3d& inv_direction,
+                        double max_distance,
+                        double& t);
+
+private:
+  std::vector<Node> nodes_;
+  std::vector<int> items_;
+
+  /** @brief The depth of the deepest node, traversal never holds more than depth + 1 nodes on its stack */
+  int depth_{ 0 };
+};
+
+/**
+ * @brief A pickable mesh of triangles and analytic shapes expressed in a single frame
+ * @details This is immutable once built so it can be shared between scene snapshots and threads
+ */
+class PickingMesh
+{
+public:
+  using Ptr = std::shared_ptr<PickingMesh>;
+  using ConstPtr = std::shared_ptr<const PickingMesh>;
+
+  enum class ShapeType
+  {
+    /** @brief Dimensions are the box size */
+    BOX,
+    /** @brief Dimensions are the radius */
+    SPHERE,
+    /** @brief Dimensions are the radius and length along z */
+    CYLINDER,
+    /** @brief Dimensions are the radius and length of the cylinder along z */
+    CAPSULE
+  };
+
+  void addTriangle(const Eigen::Vector3d& v0, const Eigen::Vector3d& v1, const Eigen::Vector3d& v2, int owner);
+  void addShape(ShapeType type, const Eigen::Isometry3d& pose, const Eigen::Vector3d& dimensions, int owner);
+
+  /** @brief Build the hierarchy, must be called after adding primitives and prior to raycast */
+  void build();
+
+  bool empty() const;
+  std::size_t getTriangleCount() const;
+  std::size_t getShapeCount() const;
+
+  /** @brief The bounds of the mesh in its frame */
+  Eigen::AlignedBox3d getBounds() const;
+
+  /**
+   * @brief Find the closest primitive hit by a ray
+   * @param origin The ray origin in the mesh frame
+   * @param direction The normalized ray direction in the mesh frame
+   * @param distance The maximum distance, updated if a closer hit is found
+   * @param owner The owner of the primitive hit, only updated if a closer hit is found
+   * @return True if a closer hit was found
+   */
+  bool raycast(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, double& distance, int& owner) const;
+
+private:
+  struct Triangle
+  {
+    Eigen::Vector3d v0;
+    Eigen::Vector3d e1;
+    Eigen::Vector3d e2;
+    int owner{ -1 };
+  };
+
+  struct Shape
+  {
+    ShapeType type{ ShapeType::BOX };
+    Eigen::Isometry3d inv_pose{ Eigen::Isometry3d::Identity() };
+    Eigen::Vector3d dimensions{ Eigen::Vector3d::Zero() };
+    Eigen::AlignedBox3d box;
+    int owner{ -1 };
+  };
+
+  std::vector<Triangle> triangles_;
+  tesseract::common::AlignedVector<Shape> shapes_;
+  PickingBVH bvh_;
+
+  bool raycast(const Triangle& triangle,
+               const Eigen::Vector3d& origin,
+               const Eigen::Vector3d& direction,
+               double& distance) const;
+  bool raycast(const Shape& shape, const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, double& distance)
+      const;
+};
+
+/**
+ * @brief Create a pickable mesh from the visuals of a link in the link frame
+ * @details The owner of each primitive is the index of the visual it was created from
+ * @return The mesh, which is empty if the link has no supported visual geometry
+ */
+PickingMesh::Ptr createPickingMesh(const tesseract::scene_graph::Link& link);
+
+/** @brief The result of a pick */
+struct PickResult
+{
+  enum class Type
+  {
+    NONE,
+    LINK,
+    TOOL_PATH_POSE
+  };
+
+  Type type{ Type::NONE };
+
+  /** @brief The link name for link hits */
+  std::string link_name;
+
+  /** @brief The visual name for link hits */
+  std::string visual_name;
+
+  /** @brief The visual index for link hits */
+  int visual_index{ -1 };
+
+  /** @brief The tool path uuid for tool path pose hits */
+  boost::uuids::uuid tool_path_uuid{};
+
+  /** @brief The tool path segment uuid for tool path pose hits */
+  boost::uuids::uuid segment_uuid{};
+
+  /** @brief The tool path pose uuid for tool path pose hits */
+  boost::uuids::uuid pose_uuid{};
+
+  /** @brief The hit point in world coordinates */
+  Eigen::Vector3d point{ Eigen::Vector3d::Zero() };
+
+  /** @brief The distance along the ray */
+  double distance{ 0 };
+};
+
+/**
+ * @brief A set of posed pickable meshes with a top level hierarchy
+ * @details Copies are cheap since the meshes are shared, which allows publishing immutable snapshots to a worker
+ * thread. Pose updates only refit the top level hierarchy, adding or removing instances rebuilds it.
+ */
+class PickingScene
+{
+public:
+  using Ptr = std::shared_ptr<PickingScene>;
+  using ConstPtr = std::shared_ptr<const PickingScene>;
+
+  /** @brief The static data of an instance */
+  struct InstanceInfo
+  {
+    PickResult::Type type{ PickResult::Type::LINK };
+    PickingMesh::ConstPtr mesh;
+
+    /** @brief The link name for link instances */
+    std::string link_name;
+
+    /** @brief The owner names for link instances */
+    std::vector<std::string> visual_names;
+
+    /** @brief The tool path uuid for tool path instances */
+    boost::uuids::uuid tool_path_uuid{};
+
+    /** @brief The segment and pose uuids of each owner for tool path instances */
+    std::vector<std::pair<boost::uuids::uuid, boost::uuids::uuid>> pose_uuids;
+  };
+
+  /**
+   * @brief Add or replace an instance
+   * @param key The unique key of the instance
+   */
+  void setInstance(const std::string& key, std::shared_ptr<const InstanceInfo> info, const Eigen::Isometry3d& pose);
+  void removeInstance(const std::string& key);
+  bool hasInstance(const std::string& key) const;
+  void clear();
+
+  /**
+   * @brief Update the pose of instances
+   * @param poses The instance poses keyed by instance key, unknown keys are ignored
+   */
+  void setPoses(const tesseract::common::TransformMap& poses);
+
+  /** @brief Set the visibility of an instance, hidden instances are not pickable */
+  void setVisible(const std::string& key, bool visible);
+
+  /** @brief Rebuild or refit the top level hierarchy if required */
+  void update();
+
+  /** @brief The number of instances */
+  std::size_t size() const;
+
+  /**
+   * @brief Find the closest instance hit by a ray
+   * @param origin The ray origin in world coordinates
+   * @param direction The normalized ray direction in world coordinates
+   * @param max_distance The maximum distance along the ray
+   */
+  PickResult pick(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, double max_distance = 1000) const;
+
+private:
+  std::vector<std::shared_ptr<const InstanceInfo>> infos_;
+  tesseract::common::VectorIsometry3d poses_;
+  tesseract::common::VectorIsometry3d inv_poses_;
+  std::vector<bool> visible_;
+  std::unordered_map<std::string, std::size_t> index_;
+  PickingBVH bvh_;
+  bool rebuild_{ false };
+  bool refit_{ false };
+
+  Eigen::AlignedBox3d getWorldBounds(std::size_t index) const;
+};
+
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_PICKING_H
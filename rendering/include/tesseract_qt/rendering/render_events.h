@@ -22,6 +22,7 @@
 #include <memory>
 #include <tesseract_qt/common/events/event_type.h>
 #include <tesseract_qt/common/events/render_events.h>
+#include <tesseract_qt/rendering/picking.h>
 
 #include <gz/math/Vector2.hh>
 #include <gz/math/Vector3.hh>
@@ -493,6 +494,42 @@ private:
   std::unique_ptr<Implementation> data_;
 };
 
+/**
+ * @brief Event which is called to broadcast the result of a pick on the scene
+ * @details This is sent by the render widget when a scene picker is assigned, see ScenePicker
+ */
+class PickOnScene : public RenderEvent
+{
+public:
+  /** @brief The input which triggered the pick */
+  enum class PickType
+  {
+    HOVER,
+    LEFT_CLICK,
+    RIGHT_CLICK
+  };
+
+  /**
+   * @brief Constructor
+   * @param result The pick result
+   * @param pick_type The input which triggered the pick
+   * @param scene_name The scene name
+   */
+  PickOnScene(tesseract::gui::PickResult result, PickType pick_type, std::string scene_name);
+  ~PickOnScene() override;
+
+  /** @brief Return the pick result */
+  const tesseract::gui::PickResult& getResult() const;
+
+  /** @brief Return the input which triggered the pick */
+  PickType getPickType() const;
+
+private:
+  /** @brief Private data pointer */
+  class Implementation;
+  std::unique_ptr<Implementation> data_;
+};
+
 //  /// \brief Event which is called to share WorldControl information.
 //  class WorldControl : public QEvent
 //  {
@@ -29,6 +29,8 @@ class Color;
 
 namespace tesseract::gui
 {
+class ScenePicker;
+
 /**
  *  @brief Tesseract Simple renderer.
  *  @details All rendering calls should be performed inside this class as it makes
@@ -42,6 +44,7 @@ class Renderer
 public:
   /** @brief Constructor */
   Renderer();
+  ~Renderer();
 
   /**
    * @brief Render scene
@@ -110,6 +113,12 @@ public:
   void setSceneName(const std::string& name);
   const std::string& getSceneName() const;
 
+  /**
+   * @brief Get the unique name of the camera created inside the scene
+   * @details Renderers with the same scene name share the scene and each render their own camera
+   */
+  const std::string& getCameraName() const;
+
   /**
    * @brief Set background color of render window
    * @param color olor of render window background
@@ -164,6 +173,17 @@ public:
   void setHoverEventEnabled(bool enabled);
   bool hoverEventEnabled() const;
 
+  /**
+   * @brief Get the world ray through a screen position
+   * @param screen_pos 2D coordinates on the screen, in pixels
+   * @param origin The ray origin on the near clipping plane
+   * @param direction The normalized ray direction
+   * @return False if the renderer is not initialized
+   */
+  bool getCameraRay(const gz::math::Vector2i& screen_pos,
+                    gz::math::Vector3d& origin,
+                    gz::math::Vector3d& direction) const;
+
   /** @brief Render texture size */
   const QSize& getTextureSize() const;
 
@@ -214,6 +234,41 @@ private:
   std::unique_ptr<Implementation> data_;
 };
 
+/** @brief The render modes available */
+enum class RenderMode
+{
+  /** @brief Render at the update frequency regardless of scene changes */
+  CONTINUOUS,
+  /** @brief Only render after scene events, view control input, resizes or setting changes */
+  ON_DEMAND
+};
+
+/**
+ * @brief Convert render mode to string
+ * @param mode The mode to convert to string
+ * @return The string represenation of the render mode
+ */
+inline std::string toString(RenderMode mode) { return ((mode == RenderMode::CONTINUOUS) ? "continuous" : "on_demand"); }
+
+/** @brief Frame time statistics, all times are in milliseconds */
+struct RenderStatistics
+{
+  /** @brief The number of frames rendered */
+  std::size_t frame_count{ 0 };
+
+  /** @brief The time to render the last frame */
+  double last_frame_time{ 0 };
+
+  /** @brief The exponential moving average of the frame time */
+  double average_frame_time{ 0 };
+
+  /** @brief The maximum frame time */
+  double max_frame_time{ 0 };
+
+  /** @brief The number of frames rendered over the last second */
+  double frame_rate{ 0 };
+};
+
 class RenderWidget : public QOpenGLWidget, protected QOpenGLFunctions
 {
   Q_OBJECT
@@ -257,6 +312,13 @@ public:
   void setSceneName(const std::string& name);
   const std::string& getSceneName() const;
 
+  /**
+   * @brief Get the name of the camera the widget renders
+   * @details Render widgets with the same scene name share the scene and each render their own camera. Use
+   * IgnSharedScene for the render managers so the scene is only loaded and updated once.
+   */
+  const std::string& getCameraName() const;
+
   /**
    * @brief Set the initial pose the render window camera
    * @param pose Initial camera pose
@@ -307,10 +369,47 @@ public:
   void setShadowsEnabled(bool enabled);
   bool shadowsEnabled() const;
 
-  /** @brief The desired update frequency for rendering, default is 60hz */
+  /**
+   * @brief The desired update frequency for rendering, default is 60hz
+   * @details In on-demand mode this is the maximum frame rate. Values below 1hz are clamped to 1hz.
+   */
   void setUpdateFrequency(double hz);
   double getUpdateFrequency() const;
 
+  /**
+   * @brief Set the render mode, default is on-demand
+   * @details In on-demand mode the widget only renders after events associated with its scene, view control input,
+   * resizes or setting changes so an idle scene does not consume any resources.
+   * @param mode The render mode
+   */
+  void setRenderMode(RenderMode mode);
+  RenderMode getRenderMode() const;
+
+  /**
+   * @brief Suspend rendering, for example while the widget is hidden
+   * @details While suspended no frames are rendered and the update timer is stopped. When resumed a single frame is
+   * rendered in on-demand mode to catch up with the changes made meanwhile.
+   * @param suspended True to suspend, false to resume
+   */
+  void setSuspended(bool suspended);
+  bool isSuspended() const;
+
+  /** @brief Get the frame time statistics */
+  RenderStatistics getRenderStatistics() const;
+
+  /** @brief Reset the frame time statistics */
+  void resetRenderStatistics();
+
+  /**
+   * @brief Set the scene picker used for hover and click picking
+   * @details When set, mouse tracking is enabled and hover picks are answered by the picker on its worker thread and
+   * broadcast as PickOnScene and HoverToScene events without rendering a frame, so hover can stay enabled. Clicks are
+   * picked immediately and broadcast as PickOnScene events. Set to nullptr to disable.
+   * @param picker The scene picker
+   */
+  void setScenePicker(std::shared_ptr<ScenePicker> picker);
+  std::shared_ptr<ScenePicker> getScenePicker() const;
+
   /**
    * @brief Called when the mouse hovers to a new position.
    * @param mouse_x The hovered mouse x position on the render window.
@@ -338,10 +437,36 @@ public:
    */
   void handleKeyRelease(const gz::common::KeyEvent& event);
 
+public Q_SLOTS:
+  /**
+   * @brief Request a frame to be rendered
+   * @details This is only required in on-demand mode when the scene is modified without sending an event
+   */
+  void requestRender();
+
 private Q_SLOTS:
   void onFrameSwapped();
 
 private:
+  /**
+   * @brief Request frames to be rendered
+   * @param frames The number of frames required to reflect the change
+   */
+  void requestRender(int frames);
+
+  /** @brief Start the timer for the next frame respecting the update frequency */
+  void scheduleFrame();
+
+  /**
+   * @brief Pick on the scene using the scene picker and broadcast the result
+   * @param screen_pos 2D coordinates on the screen, in pixels
+   * @param button The button released or Qt::NoButton for hover
+   */
+  void pickOnScene(const gz::math::Vector2i& screen_pos, Qt::MouseButton button);
+
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+
   // Documentation inherited
   void mousePressEvent(QMouseEvent* event) override;
 
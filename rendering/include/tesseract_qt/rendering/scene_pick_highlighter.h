@@ -0,0 +1,64 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_SCENE_PICK_HIGHLIGHTER_H
+#define TESSERACT_QT_RENDERING_SCENE_PICK_HIGHLIGHTER_H
+
+#include <memory>
+#include <string>
+
+#include <QObject>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+
+/**
+ * @brief Highlights the link under the mouse and the link selected by a left click using the link wire box
+ * @details This consumes the pick events of the component's scene. Clicking where no link is picked clears the
+ * selection. The highlight is separate from the user visibility, so the wire box setting of a link is kept.
+ */
+class ScenePickHighlighter : public QObject
+{
+public:
+  explicit ScenePickHighlighter(std::shared_ptr<const ComponentInfo> component_info, QObject* parent = nullptr);
+  ~ScenePickHighlighter() override;
+
+  /** @brief Get the link under the mouse, empty if none */
+  const std::string& getHoveredLink() const;
+
+  /** @brief Get the selected link, empty if none */
+  const std::string& getSelectedLink() const;
+
+private:
+  std::shared_ptr<const ComponentInfo> component_info_;
+  std::string hovered_link_;
+  std::string selected_link_;
+
+  void setHighlight(const std::string& link_name);
+
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_SCENE_PICK_HIGHLIGHTER_H
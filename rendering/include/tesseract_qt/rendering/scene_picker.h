@@ -0,0 +1,100 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef TESSERACT_QT_RENDERING_SCENE_PICKER_H
+#define TESSERACT_QT_RENDERING_SCENE_PICKER_H
+
+#ifndef Q_MOC_RUN
+#include <tesseract_qt/rendering/picking.h>
+#include <functional>
+#include <memory>
+#endif
+
+#include <QObject>
+
+namespace tesseract::gui
+{
+class ComponentInfo;
+
+/**
+ * @brief Answers pick queries against the scene graph and tool paths of a component on the CPU
+ * @details This tracks the scene graph, scene state and tool path events of the component and maintains a two level
+ * bounding volume hierarchy, so picking does not require a render or a ray query against the render engine. Scene
+ * state changes only refit the top level hierarchy. Queries are answered on a worker thread against an immutable
+ * snapshot of the scene, where pending queries are coalesced so only the latest one is answered.
+ */
+class ScenePicker : public QObject
+{
+  Q_OBJECT
+public:
+  using Ptr = std::shared_ptr<ScenePicker>;
+  using ConstPtr = std::shared_ptr<const ScenePicker>;
+
+  /**
+   * @brief The pick callback
+   * @details This is called on the worker thread so use QApplication::postEvent or a queued connection to get back on
+   * the main thread.
+   */
+  using Callback = std::function<void(const PickResult&)>;
+
+  explicit ScenePicker(std::shared_ptr<const ComponentInfo> component_info, QObject* parent = nullptr);
+  ~ScenePicker() override;
+
+  /** @brief Get the component info */
+  std::shared_ptr<const ComponentInfo> getComponentInfo() const;
+
+  /**
+   * @brief Set the radius of the sphere used to pick tool path poses, default is 0.01
+   * @details This only applies to tool paths added after it is changed
+   */
+  void setToolPathPoseRadius(double radius);
+  double getToolPathPoseRadius() const;
+
+  /**
+   * @brief Pick on the worker thread
+   * @details If a previous query has not been started it is replaced by this one
+   * @param origin The ray origin in world coordinates
+   * @param direction The normalized ray direction in world coordinates
+   * @param callback The callback to receive the result
+   */
+  void pick(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, Callback callback);
+
+  /**
+   * @brief Pick on the calling thread
+   * @param origin The ray origin in world coordinates
+   * @param direction The normalized ray direction in world coordinates
+   */
+  PickResult pickNow(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction);
+
+  /** @brief Get a snapshot of the current picking scene */
+  PickingScene::ConstPtr getScene();
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> data_;
+
+  // Documentation inherited
+  bool eventFilter(QObject* obj, QEvent* event) override;
+};
+}  // namespace tesseract::gui
+
+#endif  // TESSERACT_QT_RENDERING_SCENE_PICKER_H
@@ -144,17 +144,8 @@ void setSceneState(gz::rendering::Scene& scene,
 //////////////////////////////////////////////////
 void clearScene(gz::rendering::Scene& scene, EntityContainer& entity_container)
 {
-  for (const auto& ns : entity_container.getTrackedEntities())
-  {
-    for (const auto& entity : ns.second)
-      scene.DestroyNodeById(entity.second.id);
-  }
-
-  for (const auto& ns : entity_container.getUntrackedEntities())
-  {
-    for (const auto& entity : ns.second)
-      scene.DestroyNodeById(entity.id);
-  }
+  for (int id : entity_container.getEntityIds())
+    scene.DestroyNodeById(id);
 }
 
 //////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <map>
 #include <variant>
 
 #include <QApplication>
@@ -53,17 +54,8 @@ struct IgnContactResultsRenderManager::Implementation
 
   void clear(gz::rendering::Scene& scene, EntityContainer& container)
   {
-    for (const auto& ns : container.getTrackedEntities())
-    {
-      for (const auto& entity : ns.second)
-        scene.DestroyNodeById(entity.second.id);
-    }
-
-    for (const auto& ns : container.getUntrackedEntities())
-    {
-      for (const auto& entity : ns.second)
-        scene.DestroyNodeById(entity.id);
-    }
+    for (int id : container.getEntityIds())
+      scene.DestroyNodeById(id);
 
     container.clear();
   }
@@ -190,6 +182,86 @@ struct IgnContactResultsRenderManager::Implementation
 
     return ign_contact_result;
   }
+
+  /** @brief Create the visuals of a contact result vector in its own entity container keyed by its uuid */
+  void addContactResults(gz::rendering::Scene& scene, EntityManager& entity_manager, const ContactResultVector& crv)
+  {
+    const std::string parent_key = boost::uuids::to_string(crv.getUUID());
+    EntityContainer::Ptr entity_container = entity_manager.getEntityContainer(parent_key);
+    auto entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, parent_key);
+    gz::rendering::VisualPtr ign_contact_results = scene.CreateVisual(entity.id, entity.unique_name);
+    ign_contact_results->SetUserData(USER_VISIBILITY, false);
+
+    for (const auto& crt : crv())
+    {
+      const std::string arrow_key_name = boost::uuids::to_string(crt.getUUID());
+      auto arrow_entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, arrow_key_name);
+      ign_contact_results->AddChild(createArrow(crt(), scene, arrow_entity));
+    }
+
+    scene.RootVisual()->AddChild(ign_contact_results);
+  }
+
+  /**
+   * @brief Rebuild the visuals of a contact result vector keeping its entity container
+   * @details The visibility of the vector and of the arrows whose uuid is kept is restored
+   */
+  void updateContactResults(gz::rendering::Scene& scene, EntityManager& entity_manager, const ContactResultVector& crv)
+  {
+    const std::string parent_key = boost::uuids::to_string(crv.getUUID());
+    if (!entity_manager.hasEntityContainer(parent_key))
+    {
+      addContactResults(scene, entity_manager, crv);
+      return;
+    }
+
+    bool parent_visibility{ false };
+    std::map<std::string, bool> arrow_visibility;
+    {
+      auto entity_container = entity_manager.getEntityContainer(parent_key);
+      for (const auto& entity : entity_container->getTrackedEntities(EntityContainer::VISUAL_NS))
+      {
+        auto visual = scene.VisualById(entity.second.id);
+        if (visual == nullptr)
+          continue;
+
+        if (entity.first == parent_key)
+          parent_visibility = std::get<bool>(visual->UserData(USER_VISIBILITY));
+        else
+          arrow_visibility[entity.first] = std::get<bool>(visual->UserData(USER_VISIBILITY));
+      }
+    }
+
+    removeContactResults(scene, entity_manager, crv);
+    addContactResults(scene, entity_manager, crv);
+
+    auto entity_container = entity_manager.getEntityContainer(parent_key);
+    for (const auto& entity : entity_container->getTrackedEntities(EntityContainer::VISUAL_NS))
+    {
+      auto visual = scene.VisualById(entity.second.id);
+      if (entity.first == parent_key)
+      {
+        visual->SetUserData(USER_VISIBILITY, parent_visibility);
+        continue;
+      }
+
+      auto it = arrow_visibility.find(entity.first);
+      const bool user_visible = (it != arrow_visibility.end()) ? it->second : true;
+      visual->SetUserData(USER_VISIBILITY, user_visible);
+      visual->SetVisible(parent_visibility && user_visible);
+    }
+  }
+
+  void removeContactResults(gz::rendering::Scene& scene, EntityManager& entity_manager, const ContactResultVector& crv)
+  {
+    const std::string parent_key = boost::uuids::to_string(crv.getUUID());
+    if (!entity_manager.hasEntityContainer(parent_key))
+      return;
+
+    auto entity_container = entity_manager.getEntityContainer(parent_key);
+    clear(scene, *entity_container);
+    entity_manager.removeEntityContainer(parent_key);
+  }
 };
 
 IgnContactResultsRenderManager::IgnContactResultsRenderManager(std::shared_ptr<const ComponentInfo> component_info)
@@ -249,53 +321,30 @@ void IgnContactResultsRenderManager::render()
       EntityManager::Ptr entity_manager = getEntityManager(e.getComponentInfo());
       data_->clear(*scene, *entity_manager);
 
-      auto contacts = e.getContactResults();
+      const auto& contacts = e.getContactResults();
       if (contacts.index() == 0)
       {
-        const ContactResultVector& crv = std::get<ContactResultVector>(contacts);
-        const std::string parent_key = boost::uuids::to_string(crv.getUUID());
-
-        EntityContainer::Ptr entity_container = entity_manager->getEntityContainer(parent_key);
-        auto entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, parent_key);
-        gz::rendering::VisualPtr ign_contact_results = scene->CreateVisual(entity.id, entity.unique_name);
-        ign_contact_results->SetUserData(USER_VISIBILITY, false);
-
-        for (const auto& crt : crv())
-        {
-          const auto& cr = crt();
-
-          const std::string arrow_key_name = boost::uuids::to_string(crt.getUUID());
-          auto arrow_entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, arrow_key_name);
-
-          ign_contact_results->AddChild(data_->createArrow(cr, *scene, arrow_entity));
-        }
-
-        scene->RootVisual()->AddChild(ign_contact_results);
+        data_->addContactResults(*scene, *entity_manager, std::get<ContactResultVector>(contacts));
       }
       else
       {
-        const ContactResultMap& crm = std::get<ContactResultMap>(contacts);
-        for (const auto& pair : crm)
-        {
-          const std::string parent_key = boost::uuids::to_string(pair.second.getUUID());
-          EntityContainer::Ptr entity_container = entity_manager->getEntityContainer(parent_key);
-          auto entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, parent_key);
-          gz::rendering::VisualPtr ign_contact_results = scene->CreateVisual(entity.id, entity.unique_name);
-          ign_contact_results->SetUserData(USER_VISIBILITY, false);
-
-          for (const auto& crt : pair.second())
-          {
-            const auto& cr = crt();
-
-            std::string arrow_key_name = boost::uuids::to_string(crt.getUUID());
-            auto arrow_entity = entity_container->addTrackedEntity(EntityContainer::VISUAL_NS, arrow_key_name);
+        for (const auto& pair : std::get<ContactResultMap>(contacts))
+          data_->addContactResults(*scene, *entity_manager, pair.second);
+      }
+    }
+    else if (event->type() == events::EventType::CONTACT_RESULTS_UPDATE)
+    {
+      // Only the changed link pairs are rebuilt, unchanged ones keep their visuals and changed ones their visibility
+      auto& e = static_cast<events::ContactResultsUpdate&>(*event);
+      EntityManager::Ptr entity_manager = getEntityManager(e.getComponentInfo());
+      for (const auto& pair : e.getRemoved())
+        data_->removeContactResults(*scene, *entity_manager, pair.second);
 
-            ign_contact_results->AddChild(data_->createArrow(cr, *scene, arrow_entity));
-          }
+      for (const auto& pair : e.getChanged())
+        data_->updateContactResults(*scene, *entity_manager, pair.second);
 
-          scene->RootVisual()->AddChild(ign_contact_results);
-        }
-      }
+      for (const auto& pair : e.getAdded())
+        data_->addContactResults(*scene, *entity_manager, pair.second);
     }
     else if (event->type() == events::EventType::CONTACT_RESULTS_VISIBILITY)
     {
@@ -0,0 +1,201 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/ign_joint_trajectory_ghost_render_manager.h>
+#include <tesseract_qt/rendering/gazebo_utils.h>
+
+#include <tesseract_qt/common/events/joint_trajectory_events.h>
+#include <tesseract_qt/common/trajectory_ghost.h>
+#include <tesseract_qt/common/entity_manager.h>
+#include <tesseract_qt/common/entity_container.h>
+#include <tesseract_qt/common/component_info.h>
+
+#include <gz/rendering/Scene.hh>
+#include <gz/rendering/Marker.hh>
+#include <gz/rendering/Material.hh>
+#include <gz/math/eigen3/Conversions.hh>
+
+#include <tesseract/scene_graph/link.h>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief The opacity of the first and last sample, the samples in between are interpolated */
+const double FIRST_SAMPLE_OPACITY{ 0.15 };
+const double LAST_SAMPLE_OPACITY{ 0.6 };
+
+const std::string ENTITY_CONTAINER_NAME{ "JointTrajectoryGhost" };
+
+gz::rendering::MaterialPtr getSampleMaterial(gz::rendering::Scene& scene, std::size_t sample, std::size_t count)
+{
+  const std::string name = "TesseractJointTrajectoryGhost" + std::to_string(sample) + "/" + std::to_string(count);
+  auto ign_material = scene.Material(name);
+  if (ign_material == nullptr)
+  {
+    const double t = (count > 1) ? static_cast<double>(sample) / static_cast<double>(count - 1) : 1.0;
+    const double opacity = FIRST_SAMPLE_OPACITY + (t * (LAST_SAMPLE_OPACITY - FIRST_SAMPLE_OPACITY));
+    ign_material = scene.CreateMaterial(name);
+    ign_material->SetAmbient(0.3, 0.6, 1.0, opacity);
+    ign_material->SetDiffuse(0.3, 0.6, 1.0, opacity);
+    ign_material->SetSpecular(0.3, 0.6, 1.0, opacity);
+    ign_material->SetTransparency(1.0 - opacity);
+    ign_material->SetDepthWriteEnabled(false);
+    ign_material->SetCastShadows(false);
+  }
+  return ign_material;
+}
+
+gz::rendering::MaterialPtr getPathMaterial(gz::rendering::Scene& scene)
+{
+  const std::string name = "TesseractJointTrajectoryGhostPath";
+  auto ign_material = scene.Material(name);
+  if (ign_material == nullptr)
+  {
+    ign_material = scene.CreateMaterial(name);
+    ign_material->SetAmbient(1.0, 0.6, 0.0, 1);
+    ign_material->SetDiffuse(1.0, 0.6, 0.0, 1);
+    ign_material->SetEmissive(1.0, 0.6, 0.0, 1);
+    ign_material->SetCastShadows(false);
+  }
+  return ign_material;
+}
+}  // namespace
+
+struct IgnJointTrajectoryGhostRenderManager::Implementation
+{
+  std::string scene_name;
+  EntityManager::Ptr entity_manager;
+  EntityContainer::Ptr entity_container;
+  gz::rendering::VisualPtr visual;
+
+  void clear()
+  {
+    gz::rendering::ScenePtr scene = sceneFromFirstRenderEngine(scene_name);
+    if (scene != nullptr)
+    {
+      // Destroys the clones of every sample
+      if (visual != nullptr)
+        scene->DestroyVisual(visual, true);
+
+      // Destroys the link visuals the clones were made from, which are not part of the scene tree
+      if (entity_container != nullptr)
+      {
+        for (int id : entity_container->getEntityIds())
+        {
+          if (scene->HasNodeId(id))
+            scene->DestroyNodeById(id);
+        }
+      }
+    }
+
+    if (entity_container != nullptr)
+      entity_container->clear();
+
+    visual = nullptr;
+  }
+
+  void build(gz::rendering::Scene& scene, const TrajectoryGhost& ghost)
+  {
+    if (entity_container == nullptr)
+      entity_container = entity_manager->getEntityContainer(ENTITY_CONTAINER_NAME);
+
+    visual = scene.CreateVisual();
+
+    // Load every link once, the samples are clones sharing its meshes
+    std::vector<gz::rendering::VisualPtr> link_visuals;
+    link_visuals.reserve(ghost.links.size());
+    for (const auto& link : ghost.links)
+      link_visuals.push_back(loadLinkVisuals(scene, *entity_container, *link));
+
+    const std::size_t sample_count = ghost.link_transforms.size();
+    for (std::size_t i = 0; i < sample_count; ++i)
+    {
+      const std::string sample_name = visual->Name() + "::" + std::to_string(i);
+      gz::rendering::VisualPtr sample_visual = scene.CreateVisual(sample_name);
+      for (std::size_t j = 0; j < link_visuals.size(); ++j)
+      {
+        gz::rendering::VisualPtr clone = link_visuals[j]->Clone(sample_name + "::" + ghost.links[j]->getName(),
+                                                                sample_visual);
+        clone->SetLocalPose(gz::math::eigen3::convert(ghost.link_transforms[i][j]));
+      }
+
+      // Not unique so every clone of a sample shares one material
+      sample_visual->SetMaterial(getSampleMaterial(scene, i, sample_count), false);
+      visual->AddChild(sample_visual);
+    }
+
+    if (ghost.tcp_path.size() > 1)
+    {
+      gz::rendering::MarkerPtr marker = scene.CreateMarker();
+      marker->SetType(gz::rendering::MarkerType::MT_LINE_STRIP);
+      marker->SetMaterial(getPathMaterial(scene), false);
+      for (const auto& point : ghost.tcp_path)
+        marker->AddPoint(gz::math::eigen3::convert(point), gz::math::Color(1.0F, 0.6F, 0.0F));
+
+      visual->AddGeometry(marker);
+    }
+
+    scene.RootVisual()->AddChild(visual);
+  }
+};
+
+IgnJointTrajectoryGhostRenderManager::IgnJointTrajectoryGhostRenderManager(
+    std::shared_ptr<const ComponentInfo> component_info,
+    std::shared_ptr<EntityManager> entity_manager)
+  : JointTrajectoryGhostRenderManager(std::move(component_info)), data_(std::make_unique<Implementation>())
+{
+  data_->scene_name = component_info_->getSceneName();
+  data_->entity_manager = std::move(entity_manager);
+}
+
+IgnJointTrajectoryGhostRenderManager::~IgnJointTrajectoryGhostRenderManager() { data_->clear(); }
+
+void IgnJointTrajectoryGhostRenderManager::render()
+{
+  if (events_.empty())
+    return;
+
+  gz::rendering::ScenePtr scene = sceneFromFirstRenderEngine(data_->scene_name);
+  if (scene == nullptr)
+    return;
+
+  for (const auto& event : events_)
+  {
+    if (event->type() == events::EventType::JOINT_TRAJECTORY_GHOST_CLEAR)
+    {
+      data_->clear();
+    }
+    else if (event->type() == events::EventType::JOINT_TRAJECTORY_GHOST_SET)
+    {
+      auto& e = static_cast<events::JointTrajectoryGhostSet&>(*event);
+      data_->clear();
+      if (e.getTrajectoryGhost() != nullptr)
+        data_->build(*scene, *e.getTrajectoryGhost());
+    }
+  }
+
+  events_.clear();
+}
+
+}  // namespace tesseract::gui
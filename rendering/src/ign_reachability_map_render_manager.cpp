@@ -0,0 +1,326 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/ign_reachability_map_render_manager.h>
+#include <tesseract_qt/rendering/gazebo_utils.h>
+
+#include <tesseract_qt/common/events/reachability_map_events.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/common/reachability_map.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+
+#include <gz/rendering/Scene.hh>
+#include <gz/rendering/Camera.hh>
+#include <gz/rendering/Marker.hh>
+#include <gz/rendering/Material.hh>
+#include <gz/math/eigen3/Conversions.hh>
+
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/environment/environment.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_set>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief The number of colors the scores are binned into, each bin is drawn as one marker */
+const int COLOR_BIN_COUNT{ 8 };
+
+/** @brief The ratio of voxel size to camera distance above which a voxel is refined */
+const double REFINE_VIEW_RATIO{ 0.1 };
+
+/** @brief The finest level requested, the widget may stop earlier */
+const int REFINE_MAX_LEVEL{ 6 };
+
+/** @brief The maximum number of voxels requested at a time, the closest ones are requested first */
+const std::size_t REFINE_BATCH_SIZE{ 512 };
+
+/** @brief The drawn size of a voxel relative to its size so the voxels behind remain visible */
+const double VOXEL_FILL{ 0.8 };
+
+void addBox(gz::rendering::Marker& marker, const Eigen::Vector3d& center, double half)
+{
+  static const std::array<std::array<int, 4>, 6> faces{ {
+      { 0, 2, 3, 1 },  // -x
+      { 4, 5, 7, 6 },  // +x
+      { 0, 1, 5, 4 },  // -y
+      { 2, 6, 7, 3 },  // +y
+      { 0, 4, 6, 2 },  // -z
+      { 1, 3, 7, 5 },  // +z
+  } };
+
+  std::array<gz::math::Vector3d, 8> corners;
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    corners[i] = gz::math::Vector3d(center.x() + (((i & 4U) != 0) ? half : -half),
+                                    center.y() + (((i & 2U) != 0) ? half : -half),
+                                    center.z() + (((i & 1U) != 0) ? half : -half));
+  }
+
+  for (const auto& face : faces)
+  {
+    for (int index : { face[0], face[1], face[2], face[0], face[2], face[3] })
+      marker.AddPoint(corners[static_cast<std::size_t>(index)], gz::math::Color::White);
+  }
+}
+
+gz::rendering::MaterialPtr getBinMaterial(gz::rendering::Scene& scene, int bin)
+{
+  const std::string name = "TesseractReachabilityMapColor" + std::to_string(bin);
+  auto ign_material = scene.Material(name);
+  if (ign_material == nullptr)
+  {
+    // Red for the least reachable voxels over yellow to green for the best
+    const double t = (bin + 0.5) / COLOR_BIN_COUNT;
+    const double r = std::min(1.0, 2.0 * (1.0 - t));
+    const double g = std::min(1.0, 2.0 * t);
+    ign_material = scene.CreateMaterial(name);
+    ign_material->SetAmbient(r, g, 0, 1);
+    ign_material->SetDiffuse(r, g, 0, 1);
+    ign_material->SetSpecular(r, g, 0, 1);
+  }
+  return ign_material;
+}
+
+gz::rendering::CameraPtr getUserCamera(gz::rendering::Scene& scene)
+{
+  for (unsigned int i = 0; i < scene.SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<gz::rendering::Camera>(scene.SensorByIndex(i));
+    if (camera != nullptr && camera->HasUserData("user-camera"))
+      return camera;
+  }
+  return nullptr;
+}
+}  // namespace
+
+struct IgnReachabilityMapRenderManager::Implementation
+{
+  std::string scene_name;
+  ReachabilityMap::ConstPtr reachability_map;
+  gz::rendering::VisualPtr visual;
+
+  /** @brief The shown leaf voxels, the candidates for refinement */
+  std::vector<ReachabilityVoxelKey> leaves;
+
+  /** @brief The voxels already requested to be refined for the current map */
+  std::unordered_set<ReachabilityVoxelKey, ReachabilityVoxelKeyHash> requested;
+
+  /** @brief The camera position of the last refinement check, in the working frame */
+  Eigen::Vector3d camera_position{ Eigen::Vector3d::Constant(std::numeric_limits<double>::quiet_NaN()) };
+
+  /** @brief The link transforms of the latest scene state, the working frame is looked up in them */
+  tesseract::common::TransformMap link_transforms;
+  Eigen::Isometry3d working_frame_transform{ Eigen::Isometry3d::Identity() };
+
+  void clear()
+  {
+    if (visual != nullptr)
+    {
+      gz::rendering::ScenePtr scene = sceneFromFirstRenderEngine(scene_name);
+      if (scene != nullptr)
+        scene->DestroyVisual(visual, true);
+    }
+    visual = nullptr;
+    reachability_map = nullptr;
+    leaves.clear();
+    requested.clear();
+    camera_position.setConstant(std::numeric_limits<double>::quiet_NaN());
+  }
+
+  void build(gz::rendering::Scene& scene)
+  {
+    std::array<gz::rendering::MarkerPtr, COLOR_BIN_COUNT> markers;
+    visual = scene.CreateVisual();
+    for (const auto& voxel : reachability_map->getVoxels())
+    {
+      // Unreachable voxels are not drawn, but may still be refined since their children can be reachable
+      if (!reachability_map->isLeaf(voxel.first))
+        continue;
+
+      leaves.push_back(voxel.first);
+      if (voxel.second <= 0)
+        continue;
+
+      const int bin = std::min(static_cast<int>(voxel.second * COLOR_BIN_COUNT), COLOR_BIN_COUNT - 1);
+      auto& marker = markers[static_cast<std::size_t>(bin)];
+      if (marker == nullptr)
+      {
+        marker = scene.CreateMarker();
+        marker->SetType(gz::rendering::MarkerType::MT_TRIANGLE_LIST);
+        marker->SetMaterial(getBinMaterial(scene, bin), false);
+      }
+
+      const double half = 0.5 * VOXEL_FILL * reachability_map->getVoxelSize(voxel.first.level);
+      addBox(*marker, reachability_map->getVoxelCenter(voxel.first), half);
+    }
+
+    for (const auto& marker : markers)
+    {
+      if (marker != nullptr)
+        visual->AddGeometry(marker);
+    }
+
+    visual->SetLocalPose(gz::math::eigen3::convert(working_frame_transform));
+    scene.RootVisual()->AddChild(visual);
+  }
+
+  /** @brief Get the link transforms from the environment until the first scene state is received */
+  void initLinkTransforms(const std::shared_ptr<const ComponentInfo>& component_info)
+  {
+    if (!link_transforms.empty())
+      return;
+
+    auto env_wrapper = EnvironmentManager::get(component_info);
+    if (env_wrapper == nullptr || !env_wrapper->getEnvironment()->isInitialized())
+      return;
+
+    link_transforms = env_wrapper->getEnvironment()->getState().link_transforms;
+  }
+
+  void updateWorkingFrameTransform()
+  {
+    if (reachability_map == nullptr)
+      return;
+
+    auto it = link_transforms.find(reachability_map->getWorkingFrame());
+    if (it != link_transforms.end() && !it->second.isApprox(working_frame_transform))
+    {
+      working_frame_transform = it->second;
+      if (visual != nullptr)
+        visual->SetLocalPose(gz::math::eigen3::convert(working_frame_transform));
+    }
+  }
+
+  void requestRefinement(gz::rendering::Scene& scene, const std::shared_ptr<const ComponentInfo>& component_info)
+  {
+    gz::rendering::CameraPtr camera = getUserCamera(scene);
+    if (camera == nullptr)
+      return;
+
+    // Only check again once the camera moved noticeably
+    const Eigen::Vector3d position = gz::math::eigen3::convert(camera->WorldPosition());
+    const Eigen::Vector3d local_position = working_frame_transform.inverse() * position;
+    const double finest_size = reachability_map->getVoxelSize(REFINE_MAX_LEVEL);
+    if (!camera_position.hasNaN() && (local_position - camera_position).norm() < finest_size)
+      return;
+
+    camera_position = local_position;
+
+    std::vector<std::pair<double, ReachabilityVoxelKey>> candidates;
+    for (const auto& key : leaves)
+    {
+      if (key.level >= REFINE_MAX_LEVEL || requested.count(key) > 0)
+        continue;
+
+      const double distance = (reachability_map->getVoxelCenter(key) - local_position).norm();
+      if (reachability_map->getVoxelSize(key.level) > REFINE_VIEW_RATIO * distance)
+        candidates.emplace_back(distance, key);
+    }
+
+    if (candidates.empty())
+      return;
+
+    const std::size_t count = std::min(candidates.size(), REFINE_BATCH_SIZE);
+    std::partial_sort(candidates.begin(),
+                      candidates.begin() + static_cast<long>(count),
+                      candidates.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<ReachabilityVoxelKey> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      keys.push_back(candidates[i].second);
+      requested.insert(candidates[i].second);
+    }
+
+    // Posted since the event filter of this manager holds its lock while rendering
+    QApplication::postEvent(qApp, new events::ReachabilityMapRefine(component_info, std::move(keys)));
+  }
+};
+
+IgnReachabilityMapRenderManager::IgnReachabilityMapRenderManager(std::shared_ptr<const ComponentInfo> component_info)
+  : ReachabilityMapRenderManager(std::move(component_info)), data_(std::make_unique<Implementation>())
+{
+  data_->scene_name = component_info_->getSceneName();
+}
+
+IgnReachabilityMapRenderManager::~IgnReachabilityMapRenderManager() { data_->clear(); }
+
+void IgnReachabilityMapRenderManager::render()
+{
+  gz::rendering::ScenePtr scene = sceneFromFirstRenderEngine(data_->scene_name);
+  if (scene == nullptr)
+    return;
+
+  for (const auto& event : events_)
+  {
+    if (event->type() == events::EventType::REACHABILITY_MAP_CLEAR)
+    {
+      data_->clear();
+    }
+    else if (event->type() == events::EventType::REACHABILITY_MAP_SET)
+    {
+      auto& e = static_cast<events::ReachabilityMapSet&>(*event);
+      data_->clear();
+      data_->reachability_map = e.getReachabilityMap();
+      if (data_->reachability_map != nullptr)
+      {
+        data_->initLinkTransforms(component_info_);
+        data_->updateWorkingFrameTransform();
+        data_->build(*scene);
+      }
+    }
+    else if (event->type() == events::EventType::REACHABILITY_MAP_REFINE_FAILED)
+    {
+      // Allow requesting the voxels again once the camera moves
+      auto& e = static_cast<events::ReachabilityMapRefineFailed&>(*event);
+      for (const auto& key : e.getKeys())
+        data_->requested.erase(key);
+    }
+    else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+    {
+      auto& e = static_cast<events::SceneStateChanged&>(*event);
+      data_->link_transforms = e.getState().link_transforms;
+      data_->updateWorkingFrameTransform();
+    }
+  }
+
+  events_.clear();
+
+  if (data_->reachability_map == nullptr)
+    return;
+
+  data_->requestRefinement(*scene, component_info_);
+}
+
+}  // namespace tesseract::gui
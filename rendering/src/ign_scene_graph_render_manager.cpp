@@ -24,16 +24,14 @@
 #include <tesseract_qt/rendering/ign_scene_graph_render_manager.h>
 #include <tesseract_qt/rendering/gazebo_utils.h>
 #include <tesseract_qt/rendering/conversions.h>
+#include <tesseract_qt/rendering/link_visibility_table.h>
 
-#include <tesseract_qt/common/utils.h>
 #include <tesseract_qt/common/entity_manager.h>
 #include <tesseract_qt/common/entity_container.h>
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/events/scene_graph_events.h>
 #include <tesseract_qt/common/events/allowed_collision_matrix_events.h>
 
-#include <tesseract_qt/common/link_visibility.h>
-
 #include <QApplication>
 
 #include <gz/math/eigen3/Conversions.hh>
@@ -45,9 +43,6 @@
 
 #include <boost/uuid/uuid_io.hpp>
 
-const std::string USER_VISIBILITY = "user_visibility";
-const std::string USER_PARENT_VISIBILITY = "user_parent_visibility";
-
 namespace tesseract::gui
 {
 struct IgnSceneGraphRenderManager::Implementation
@@ -55,6 +50,7 @@ struct IgnSceneGraphRenderManager::Implementation
   std::string scene_name;
   EntityManager::Ptr entity_manager;
   std::map<std::shared_ptr<const ComponentInfo>, EntityContainer::Ptr> entity_containers;
+  std::map<std::shared_ptr<const ComponentInfo>, LinkVisibilityTable> link_visibility;
 
   void clear()
   {
@@ -67,6 +63,7 @@ struct IgnSceneGraphRenderManager::Implementation
     }
 
     entity_containers.clear();
+    link_visibility.clear();
   }
 
   void clear(const std::shared_ptr<const ComponentInfo>& ci)
@@ -82,6 +79,8 @@ struct IgnSceneGraphRenderManager::Implementation
       entity_containers.erase(it);
       entity_manager->removeEntityContainer(boost::uuids::to_string(ci->getNamespace()));
     }
+
+    link_visibility.erase(ci);
   }
 };
 
@@ -125,13 +124,16 @@ void IgnSceneGraphRenderManager::render()
       auto& e = static_cast<events::SceneGraphSet&>(*event);
       data_->clear(e.getComponentInfo());
       EntityContainer::Ptr entity_container = getEntityContainer(e.getComponentInfo());
-      loadSceneGraph(*scene, *entity_container, *e.getSceneGraph(), "");
+      LinkVisibilityTable& link_visibility = data_->link_visibility[e.getComponentInfo()];
+      for (const auto& link_name : loadSceneGraph(*scene, *entity_container, *e.getSceneGraph(), ""))
+        link_visibility.addLink(*scene, *entity_container, link_name);
     }
     else if (event->type() == events::EventType::SCENE_GRAPH_ADD_LINK)
     {
       auto& e = static_cast<events::SceneGraphAddLink&>(*event);
       EntityContainer::Ptr entity_container = getEntityContainer(e.getComponentInfo());
       scene->RootVisual()->AddChild(loadLink(*scene, *entity_container, *e.getLink()));
+      data_->link_visibility[e.getComponentInfo()].addLink(*scene, *entity_container, e.getLink()->getName());
     }
     else if (event->type() == events::EventType::SCENE_GRAPH_REMOVE_LINK)
     {
@@ -142,136 +144,28 @@ void IgnSceneGraphRenderManager::render()
         auto entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, e.getLinkName());
         scene->DestroyNodeById(entity.id);
       }
+      data_->link_visibility[e.getComponentInfo()].removeLink(e.getLinkName());
     }
     else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY)
     {
       auto& e = static_cast<events::SceneGraphModifyLinkVisibility&>(*event);
-      EntityContainer::Ptr entity_container = getEntityContainer(e.getComponentInfo());
-      for (const auto& link_name : e.getLinkNames())
-      {
-        if (entity_container->hasTrackedEntity(EntityContainer::VISUAL_NS, link_name))
-        {
-          auto link_entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, link_name);
-          auto link_visual_node = scene->VisualById(link_entity.id);
-
-          if (e.getVisibilityFlags() & LinkVisibilityFlags::LINK || e.getVisibilityFlags() & LinkVisibilityFlags::ALL)
-            link_visual_node->SetUserData(USER_VISIBILITY, e.visible());
-
-          bool link_visible = std::get<bool>(link_visual_node->UserData(USER_VISIBILITY));
-
-          std::string visual_key = link_name + "::Visuals";
-          if (entity_container->hasTrackedEntity(EntityContainer::VISUAL_NS, visual_key))
-          {
-            auto entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, visual_key);
-            auto node = scene->VisualById(entity.id);
-            if (e.getVisibilityFlags() & LinkVisibilityFlags::VISUAL ||
-                e.getVisibilityFlags() & LinkVisibilityFlags::ALL)
-              node->SetUserData(USER_VISIBILITY, e.visible());
-
-            bool visible = std::get<bool>(node->UserData(USER_VISIBILITY));
-            node->SetVisible(link_visible & visible);
-          }
-
-          visual_key = link_name + "::Collisions";
-          if (entity_container->hasTrackedEntity(EntityContainer::VISUAL_NS, visual_key))
-          {
-            auto entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, visual_key);
-            auto node = scene->VisualById(entity.id);
-            if (e.getVisibilityFlags() & LinkVisibilityFlags::COLLISION ||
-                e.getVisibilityFlags() & LinkVisibilityFlags::ALL)
-              node->SetUserData(USER_VISIBILITY, e.visible());
-
-            bool visible = std::get<bool>(node->UserData(USER_VISIBILITY));
-            node->SetVisible(link_visible & visible);
-          }
-
-          visual_key = link_name + "::WireBox";
-          if (entity_container->hasTrackedEntity(EntityContainer::VISUAL_NS, visual_key))
-          {
-            auto entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, visual_key);
-            auto node = scene->VisualById(entity.id);
-            if (e.getVisibilityFlags() & LinkVisibilityFlags::WIREBOX ||
-                e.getVisibilityFlags() & LinkVisibilityFlags::ALL)
-              node->SetUserData(USER_VISIBILITY, e.visible());
-
-            bool visible = std::get<bool>(node->UserData(USER_VISIBILITY));
-            node->SetVisible(visible);
-          }
-
-          visual_key = link_name + "::Axis";
-          if (entity_container->hasTrackedEntity(EntityContainer::VISUAL_NS, visual_key))
-          {
-            auto entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, visual_key);
-            auto node = scene->VisualById(entity.id);
-            if (e.getVisibilityFlags() & LinkVisibilityFlags::AXIS || e.getVisibilityFlags() & LinkVisibilityFlags::ALL)
-              node->SetUserData(USER_VISIBILITY, e.visible());
-
-            bool visible = std::get<bool>(node->UserData(USER_VISIBILITY));
-            node->SetVisible(visible);
-          }
-        }
-      }
+      auto it = data_->link_visibility.find(e.getComponentInfo());
+      if (it != data_->link_visibility.end())
+        it->second.setVisibility(e.getLinkNames(), e.getVisibilityFlags(), e.visible());
     }
     else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL)
     {
       auto& e = static_cast<events::SceneGraphModifyLinkVisibilityALL&>(*event);
-      EntityContainer::Ptr entity_container = getEntityContainer(e.getComponentInfo());
-      for (const auto& ns : entity_container->getTrackedEntities(EntityContainer::VISUAL_NS))
-      {
-        std::vector<std::string> sub_ns = getNamespaces(ns.first);
-        if (sub_ns.size() == 2)
-        {
-          if (sub_ns[1] == "Visuals" || sub_ns[1] == "Collisions")
-          {
-            auto link_entity = entity_container->getTrackedEntity(EntityContainer::VISUAL_NS, sub_ns[0]);
-            auto link_visual_node = scene->VisualById(link_entity.id);
-
-            if (e.getVisibilityFlags() & LinkVisibilityFlags::LINK)
-            {
-              link_visual_node->SetUserData(USER_VISIBILITY, e.visible());
-              bool link_visible = std::get<bool>(link_visual_node->UserData(USER_VISIBILITY));
-
-              auto node = scene->VisualById(ns.second.id);
-              bool visible = std::get<bool>(node->UserData(USER_VISIBILITY));
-              node->SetVisible(link_visible & visible);
-            }
-
-            if (sub_ns[1] == "Visuals" && e.getVisibilityFlags() & LinkVisibilityFlags::VISUAL)
-            {
-              if (e.visible())
-                link_visual_node->SetUserData(USER_VISIBILITY, e.visible());
-
-              bool link_visible = std::get<bool>(link_visual_node->UserData(USER_VISIBILITY));
-              auto node = scene->VisualById(ns.second.id);
-              node->SetUserData(USER_VISIBILITY, e.visible());
-              node->SetVisible(link_visible & e.visible());
-            }
-
-            if (sub_ns[1] == "Collisions" && e.getVisibilityFlags() & LinkVisibilityFlags::COLLISION)
-            {
-              if (e.visible())
-                link_visual_node->SetUserData(USER_VISIBILITY, e.visible());
-
-              bool link_visible = std::get<bool>(link_visual_node->UserData(USER_VISIBILITY));
-              auto node = scene->VisualById(ns.second.id);
-              node->SetUserData(USER_VISIBILITY, e.visible());
-              node->SetVisible(link_visible & e.visible());
-            }
-          }
-          else if (sub_ns[1] == "Axis" && e.getVisibilityFlags() & LinkVisibilityFlags::AXIS)
-          {
-            auto node = scene->VisualById(ns.second.id);
-            node->SetUserData(USER_VISIBILITY, e.visible());
-            node->SetVisible(e.visible());
-          }
-          else if (sub_ns[1] == "WireBox" && e.getVisibilityFlags() & LinkVisibilityFlags::WIREBOX)
-          {
-            auto node = scene->VisualById(ns.second.id);
-            node->SetUserData(USER_VISIBILITY, e.visible());
-            node->SetVisible(e.visible());
-          }
-        }
-      }
+      auto it = data_->link_visibility.find(e.getComponentInfo());
+      if (it != data_->link_visibility.end())
+        it->second.setVisibilityAll(e.getVisibilityFlags(), e.visible());
+    }
+    else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_HIGHLIGHT)
+    {
+      auto& e = static_cast<events::SceneGraphModifyLinkHighlight&>(*event);
+      auto it = data_->link_visibility.find(e.getComponentInfo());
+      if (it != data_->link_visibility.end())
+        it->second.setHighlight(e.getLinkNames(), e.highlight());
     }
     else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
     {
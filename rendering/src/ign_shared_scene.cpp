@@ -0,0 +1,115 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/ign_shared_scene.h>
+#include <tesseract_qt/rendering/ign_scene_graph_render_manager.h>
+#include <tesseract_qt/rendering/ign_tool_path_render_manager.h>
+#include <tesseract_qt/rendering/ign_contact_results_render_manager.h>
+#include <tesseract_qt/rendering/ign_reachability_map_render_manager.h>
+#include <tesseract_qt/rendering/ign_joint_trajectory_ghost_render_manager.h>
+#include <tesseract_qt/rendering/scene_picker.h>
+#include <tesseract_qt/rendering/scene_pick_highlighter.h>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/entity_manager.h>
+
+#include <map>
+#include <mutex>
+
+namespace tesseract::gui
+{
+namespace
+{
+std::mutex& getSharedScenesMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::map<std::shared_ptr<const ComponentInfo>, std::weak_ptr<IgnSharedScene>>& getSharedScenes()
+{
+  static std::map<std::shared_ptr<const ComponentInfo>, std::weak_ptr<IgnSharedScene>> shared_scenes;
+  return shared_scenes;
+}
+}  // namespace
+
+struct IgnSharedScene::Implementation
+{
+  std::shared_ptr<const ComponentInfo> component_info;
+  EntityManager::Ptr entity_manager;
+  std::unique_ptr<IgnSceneGraphRenderManager> scene_graph_manager;
+  std::unique_ptr<IgnToolPathRenderManager> tool_path_manager;
+  std::unique_ptr<IgnContactResultsRenderManager> contact_results_manager;
+  std::unique_ptr<IgnReachabilityMapRenderManager> reachability_map_manager;
+  std::unique_ptr<IgnJointTrajectoryGhostRenderManager> joint_trajectory_ghost_manager;
+  std::shared_ptr<ScenePicker> scene_picker;
+  std::unique_ptr<ScenePickHighlighter> scene_pick_highlighter;
+};
+
+IgnSharedScene::IgnSharedScene(std::shared_ptr<const ComponentInfo> component_info)
+  : data_(std::make_unique<Implementation>())
+{
+  data_->component_info = std::move(component_info);
+  data_->entity_manager = std::make_shared<EntityManager>();
+  data_->scene_graph_manager =
+      std::make_unique<IgnSceneGraphRenderManager>(data_->component_info, data_->entity_manager);
+  data_->tool_path_manager = std::make_unique<IgnToolPathRenderManager>(data_->component_info, data_->entity_manager);
+  data_->contact_results_manager = std::make_unique<IgnContactResultsRenderManager>(data_->component_info);
+  data_->reachability_map_manager = std::make_unique<IgnReachabilityMapRenderManager>(data_->component_info);
+  data_->joint_trajectory_ghost_manager =
+      std::make_unique<IgnJointTrajectoryGhostRenderManager>(data_->component_info, data_->entity_manager);
+  data_->scene_picker = std::make_shared<ScenePicker>(data_->component_info);
+  data_->scene_pick_highlighter = std::make_unique<ScenePickHighlighter>(data_->component_info);
+}
+
+IgnSharedScene::~IgnSharedScene() = default;
+
+IgnSharedScene::Ptr IgnSharedScene::get(std::shared_ptr<const ComponentInfo> component_info)
+{
+  std::scoped_lock lock(getSharedScenesMutex());
+  auto& shared_scenes = getSharedScenes();
+
+  // Remove the scenes which are no longer held
+  for (auto it = shared_scenes.begin(); it != shared_scenes.end();)
+  {
+    if (it->second.expired())
+      it = shared_scenes.erase(it);
+    else
+      ++it;
+  }
+
+  auto it = shared_scenes.find(component_info);
+  if (it != shared_scenes.end())
+    return it->second.lock();
+
+  Ptr shared_scene(new IgnSharedScene(component_info));
+  shared_scenes[component_info] = shared_scene;
+  return shared_scene;
+}
+
+std::shared_ptr<const ComponentInfo> IgnSharedScene::getComponentInfo() const { return data_->component_info; }
+
+std::shared_ptr<EntityManager> IgnSharedScene::getEntityManager() const { return data_->entity_manager; }
+
+std::shared_ptr<ScenePicker> IgnSharedScene::getScenePicker() const { return data_->scene_picker; }
+}  // namespace tesseract::gui
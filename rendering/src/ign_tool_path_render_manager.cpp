@@ -59,17 +59,8 @@ struct IgnToolPathRenderManager::Implementation
 
   void clear(gz::rendering::Scene& scene, EntityContainer& container)
   {
-    for (const auto& ns : container.getTrackedEntities())
-    {
-      for (const auto& entity : ns.second)
-        scene.DestroyNodeById(entity.second.id);
-    }
-
-    for (const auto& ns : container.getUntrackedEntities())
-    {
-      for (const auto& entity : ns.second)
-        scene.DestroyNodeById(entity.id);
-    }
+    for (int id : container.getEntityIds())
+      scene.DestroyNodeById(id);
 
     container.clear();
   }
@@ -214,9 +205,20 @@ void IgnToolPathRenderManager::render()
           data_->entity_manager->getEntityContainer(boost::uuids::to_string(e.getToolPath().getUUID()));
       data_->entity_containers[e.getToolPath().getUUID()] = tool_path_container;
 
-      std::string tool_path_name = boost::uuids::to_string(e.getToolPath().getUUID());
-      auto tool_path_entity =
-          tool_path_container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, tool_path_name);
+      // Create the entities of the tool path, segments and poses in one call, in the order they are visited below
+      std::vector<std::string> entity_names;
+      entity_names.push_back(boost::uuids::to_string(e.getToolPath().getUUID()));
+      for (const auto& segment : e.getToolPath())
+      {
+        entity_names.push_back(boost::uuids::to_string(segment.getUUID()));
+        for (const auto& pose : segment)
+          entity_names.push_back(boost::uuids::to_string(pose.getUUID()));
+      }
+      EntityVector entities =
+          tool_path_container->addTrackedEntities(tesseract::gui::EntityContainer::VISUAL_NS, entity_names);
+      auto entity_it = entities.begin();
+
+      const Entity& tool_path_entity = *entity_it++;
       gz::rendering::VisualPtr ign_tool_path = scene->CreateVisual(tool_path_entity.id, tool_path_entity.unique_name);
       ign_tool_path->SetUserData(USER_VISIBILITY, true);
       ign_tool_path->SetUserData(USER_PARENT_VISIBILITY, true);
@@ -226,17 +228,13 @@ void IgnToolPathRenderManager::render()
 
       for (const auto& segment : e.getToolPath())
       {
-        std::string segment_name = boost::uuids::to_string(segment.getUUID());
-        auto segment_entity =
-            tool_path_container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, segment_name);
+        const Entity& segment_entity = *entity_it++;
         gz::rendering::VisualPtr ign_segment = scene->CreateVisual(segment_entity.id, segment_entity.unique_name);
         ign_segment->SetUserData(USER_VISIBILITY, true);
         ign_segment->SetUserData(USER_PARENT_VISIBILITY, true);
         for (const auto& pose : segment)
         {
-          std::string pose_name = boost::uuids::to_string(pose.getUUID());
-          auto pose_entity =
-              tool_path_container->addTrackedEntity(tesseract::gui::EntityContainer::VISUAL_NS, pose_name);
+          const Entity& pose_entity = *entity_it++;
           gz::rendering::AxisVisualPtr axis = scene->CreateAxisVisual(pose_entity.id, pose_entity.unique_name);
           axis->SetLocalPose(gz::math::eigen3::convert(pose.getTransform()));
           axis->SetInheritScale(false);
@@ -48,6 +48,18 @@ public:
   /** @brief The scene key the control is associated with */
   std::string scene_name;
 
+  /** @brief The camera the control is associated with, empty for the first user camera */
+  std::string camera_name;
+
+  /** @brief Check if an event is for the scene and camera of this control */
+  bool isTarget(const events::RenderEvent& event) const
+  {
+    if (event.getSceneName() != scene_name)
+      return false;
+
+    return (camera_name.empty() || event.getCameraName().empty() || event.getCameraName() == camera_name);
+  }
+
   /** @brief Flag to indicate if mouse event is dirty */
   bool mouse_dirty = false;
 
@@ -111,7 +123,10 @@ void InteractiveViewControlPrivate::onRender()
     if (!scene)
       return;
 
-    for (unsigned int i = 0; i < scene->NodeCount(); ++i)
+    if (!camera_name.empty())
+      camera = std::dynamic_pointer_cast<gz::rendering::Camera>(scene->SensorByName(camera_name));
+
+    for (unsigned int i = 0; !camera && camera_name.empty() && i < scene->NodeCount(); ++i)
     {
       auto cam = std::dynamic_pointer_cast<gz::rendering::Camera>(scene->NodeByIndex(i));
       if (cam)
@@ -264,10 +279,13 @@ void InteractiveViewControlPrivate::updateReferenceVisual()
 }
 
 /////////////////////////////////////////////////
-InteractiveViewControl::InteractiveViewControl(const std::string& scene_name, ViewControlType type)
+InteractiveViewControl::InteractiveViewControl(const std::string& scene_name,
+                                               ViewControlType type,
+                                               std::string camera_name)
   : data_(std::make_unique<InteractiveViewControlPrivate>())
 {
   data_->scene_name = scene_name;
+  data_->camera_name = std::move(camera_name);
   data_->view_control_type = type;
 
   // Install event filter for interactive view controller
@@ -291,7 +309,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::Render*>(event) != nullptr);
     auto* e = static_cast<events::Render*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->onRender();
     }
@@ -300,7 +318,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::LeftClickOnScene*>(event) != nullptr);
     auto* e = static_cast<events::LeftClickOnScene*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->mouse_dirty = true;
       data_->drag = gz::math::Vector2d::Zero;
@@ -311,7 +329,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::MousePressOnScene*>(event) != nullptr);
     auto* e = static_cast<events::MousePressOnScene*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->mouse_dirty = true;
       data_->mouse_press_dirty = true;
@@ -326,7 +344,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
 
     assert(dynamic_cast<events::DragOnScene*>(event) != nullptr);
     auto* e = reinterpret_cast<events::DragOnScene*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->mouse_dirty = true;
 
@@ -343,7 +361,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::ScrollOnScene*>(event) != nullptr);
     auto* e = static_cast<events::ScrollOnScene*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->mouse_dirty = true;
       data_->drag += gz::math::Vector2d(e->getMouse().Scroll().X(), e->getMouse().Scroll().Y());
@@ -354,7 +372,7 @@ bool InteractiveViewControl::eventFilter(QObject* obj, QEvent* event)
   {
     assert(dynamic_cast<events::BlockOrbit*>(event) != nullptr);
     auto* e = static_cast<events::BlockOrbit*>(event);
-    if (e->getSceneName() == data_->scene_name)
+    if (data_->isTarget(*e))
     {
       data_->block_orbit = e->getBlock();
     }
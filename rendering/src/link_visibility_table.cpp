@@ -0,0 +1,206 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/link_visibility_table.h>
+#include <tesseract_qt/common/entity_container.h>
+#include <tesseract_qt/common/entity_manager.h>
+
+#include <gz/rendering/Scene.hh>
+#include <gz/rendering/Visual.hh>
+
+namespace tesseract::gui
+{
+namespace
+{
+constexpr std::uint8_t LINK_BIT = static_cast<std::uint8_t>(LinkVisibilityFlags::LINK);
+constexpr std::uint8_t COLLISION_BIT = static_cast<std::uint8_t>(LinkVisibilityFlags::COLLISION);
+constexpr std::uint8_t VISUAL_BIT = static_cast<std::uint8_t>(LinkVisibilityFlags::VISUAL);
+constexpr std::uint8_t AXIS_BIT = static_cast<std::uint8_t>(LinkVisibilityFlags::AXIS);
+constexpr std::uint8_t WIREBOX_BIT = static_cast<std::uint8_t>(LinkVisibilityFlags::WIREBOX);
+constexpr std::uint8_t COMPONENT_BITS = LINK_BIT | COLLISION_BIT | VISUAL_BIT | AXIS_BIT | WIREBOX_BIT;
+
+/** @brief The visibility of the components after loadLink */
+constexpr std::uint8_t DEFAULT_VISIBILITY = LINK_BIT | VISUAL_BIT;
+
+/** @brief The suffix of the tracked entity name of each component, indexed by bit position */
+const std::array<std::string, 5> COMPONENT_SUFFIXES{ "", "::Collisions", "::Visuals", "::Axis", "::WireBox" };
+
+std::uint8_t toMask(LinkVisibilityFlags flags)
+{
+  if (flags & LinkVisibilityFlags::ALL)
+    return COMPONENT_BITS;
+
+  return static_cast<std::uint8_t>(static_cast<int>(flags) & COMPONENT_BITS);
+}
+}  // namespace
+
+void LinkVisibilityTable::addLink(gz::rendering::Scene& scene,
+                                  const EntityContainer& entity_container,
+                                  const std::string& link_name)
+{
+  Link link;
+  link.name = link_name;
+  link.user = DEFAULT_VISIBILITY;
+  for (std::size_t i = 0; i < COMPONENT_COUNT; ++i)
+  {
+    EntityHandle handle =
+        entity_container.getTrackedEntityHandle(EntityContainer::VISUAL_NS, link_name + COMPONENT_SUFFIXES[i]);
+    if (handle.isNull())
+      continue;
+
+    link.nodes[i] = scene.VisualById(static_cast<unsigned>(entity_container.getEntityManager().getEntity(handle).id));
+    if (link.nodes[i] != nullptr)
+      link.present |= static_cast<std::uint8_t>(1U << i);
+  }
+  link.applied = effectiveVisibility(link);
+
+  auto it = link_index_.find(link_name);
+  if (it != link_index_.end())
+  {
+    links_[it->second] = std::move(link);
+    return;
+  }
+
+  link_index_[link_name] = links_.size();
+  links_.push_back(std::move(link));
+}
+
+void LinkVisibilityTable::removeLink(const std::string& link_name)
+{
+  auto it = link_index_.find(link_name);
+  if (it == link_index_.end())
+    return;
+
+  // Move the last link into the slot to keep the table dense
+  const std::size_t index = it->second;
+  link_index_.erase(it);
+  if (index != links_.size() - 1)
+  {
+    links_[index] = std::move(links_.back());
+    link_index_[links_[index].name] = index;
+  }
+  links_.pop_back();
+}
+
+bool LinkVisibilityTable::hasLink(const std::string& link_name) const
+{
+  return (link_index_.find(link_name) != link_index_.end());
+}
+
+void LinkVisibilityTable::setVisibility(const std::vector<std::string>& link_names,
+                                        LinkVisibilityFlags flags,
+                                        bool visible)
+{
+  const std::uint8_t mask = toMask(flags);
+  for (const auto& link_name : link_names)
+  {
+    auto it = link_index_.find(link_name);
+    if (it == link_index_.end())
+      continue;
+
+    Link& link = links_[it->second];
+    link.user = static_cast<std::uint8_t>(visible ? (link.user | mask) : (link.user & ~mask));
+    apply(link);
+  }
+}
+
+void LinkVisibilityTable::setVisibilityAll(LinkVisibilityFlags flags, bool visible)
+{
+  const std::uint8_t mask = static_cast<std::uint8_t>(static_cast<int>(flags) & COMPONENT_BITS);
+  if (mask == 0)
+    return;
+
+  // Showing the visuals or collisions of every link implies showing the links
+  std::uint8_t set_mask = visible ? mask : 0;
+  if (visible && (mask & (VISUAL_BIT | COLLISION_BIT)))
+    set_mask = static_cast<std::uint8_t>(set_mask | LINK_BIT);
+
+  const std::uint8_t clear_mask = visible ? 0 : mask;
+  for (auto& link : links_)
+  {
+    link.user = static_cast<std::uint8_t>((link.user | set_mask) & ~clear_mask);
+    apply(link);
+  }
+}
+
+void LinkVisibilityTable::setHighlight(const std::vector<std::string>& link_names, bool highlight)
+{
+  for (const auto& link_name : link_names)
+  {
+    auto it = link_index_.find(link_name);
+    if (it == link_index_.end())
+      continue;
+
+    Link& link = links_[it->second];
+    link.highlight = highlight;
+    apply(link);
+  }
+}
+
+bool LinkVisibilityTable::isVisible(const std::string& link_name, LinkVisibilityFlags component) const
+{
+  auto it = link_index_.find(link_name);
+  if (it == link_index_.end())
+    return false;
+
+  return ((links_[it->second].user & toMask(component)) != 0);
+}
+
+std::size_t LinkVisibilityTable::size() const { return links_.size(); }
+
+void LinkVisibilityTable::clear()
+{
+  links_.clear();
+  link_index_.clear();
+}
+
+std::uint8_t LinkVisibilityTable::effectiveVisibility(const Link& link)
+{
+  std::uint8_t visible = link.user & (AXIS_BIT | WIREBOX_BIT);
+  if (link.user & LINK_BIT)
+    visible = static_cast<std::uint8_t>(visible | (link.user & (VISUAL_BIT | COLLISION_BIT)));
+
+  if (link.highlight)
+    visible = static_cast<std::uint8_t>(visible | WIREBOX_BIT);
+
+  return visible;
+}
+
+void LinkVisibilityTable::apply(Link& link)
+{
+  // The link node itself is never hidden, hiding it would hide the axis and wire box
+  const std::uint8_t visible = effectiveVisibility(link);
+  const std::uint8_t changed = static_cast<std::uint8_t>((visible ^ link.applied) & link.present & ~LINK_BIT);
+  if (changed == 0)
+    return;
+
+  for (std::size_t i = 1; i < COMPONENT_COUNT; ++i)
+  {
+    const auto bit = static_cast<std::uint8_t>(1U << i);
+    if (changed & bit)
+      link.nodes[i]->SetVisible((visible & bit) != 0);
+  }
+
+  link.applied = static_cast<std::uint8_t>((link.applied & ~changed) | (visible & changed));
+}
+}  // namespace tesseract::gui
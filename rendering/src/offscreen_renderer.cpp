@@ -0,0 +1,421 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/offscreen_renderer.h>
+#include <tesseract_qt/rendering/render_widget.h>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/visualization/trajectory_player.h>
+
+#include <gz/common/Console.hh>
+
+#include <QApplication>
+#include <QDir>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLExtraFunctions>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace tesseract::gui
+{
+namespace
+{
+/** @brief A pixel buffer object and the state of the readback queued into it */
+struct ReadbackBuffer
+{
+  GLuint pbo{ 0 };
+  GLsync fence{ nullptr };
+  bool pending{ false };
+  std::size_t frame{ 0 };
+  double time{ 0 };
+};
+}  // namespace
+
+struct OffscreenRenderer::Implementation
+{
+  Renderer renderer;
+
+  std::unique_ptr<QOpenGLContext> context;
+  std::unique_ptr<QOffscreenSurface> surface;
+  QOpenGLExtraFunctions* gl{ nullptr };
+
+  /** @brief The image size */
+  QSize size{ 1920, 1200 };
+
+  /** @brief The number of pixel buffer objects used for readback */
+  int buffer_count{ 2 };
+
+  /** @brief The framebuffer the render texture is attached to for readback */
+  GLuint fbo{ 0 };
+
+  /** @brief The render texture currently attached to the framebuffer */
+  GLuint fbo_texture{ 0 };
+
+  /** @brief The ring of readback buffers */
+  std::vector<ReadbackBuffer> buffers;
+
+  /** @brief The index of the next buffer to read into, which is also the oldest pending buffer */
+  std::size_t next{ 0 };
+
+  /** @brief The number of frames rendered */
+  std::size_t frame_count{ 0 };
+
+  int byteCount() const { return size.width() * size.height() * 4; }
+
+  void allocateBuffers()
+  {
+    for (auto& buffer : buffers)
+    {
+      if (buffer.pbo == 0)
+        gl->glGenBuffers(1, &buffer.pbo);
+
+      gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.pbo);
+      gl->glBufferData(GL_PIXEL_PACK_BUFFER, byteCount(), nullptr, GL_STREAM_READ);
+    }
+    gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  void discardBuffers()
+  {
+    for (auto& buffer : buffers)
+    {
+      if (buffer.fence != nullptr)
+        gl->glDeleteSync(buffer.fence);
+
+      buffer.fence = nullptr;
+      buffer.pending = false;
+    }
+  }
+
+  void releaseBuffers()
+  {
+    discardBuffers();
+    for (auto& buffer : buffers)
+    {
+      if (buffer.pbo != 0)
+        gl->glDeleteBuffers(1, &buffer.pbo);
+
+      buffer.pbo = 0;
+    }
+
+    if (fbo != 0)
+      gl->glDeleteFramebuffers(1, &fbo);
+
+    fbo = 0;
+    fbo_texture = 0;
+  }
+
+  /** @brief Copy the current render texture into the next readback buffer without waiting on the GPU */
+  void queueReadback(std::size_t frame, double time)
+  {
+    // The render texture is recreated when the camera is resized
+    auto texture_id = static_cast<GLuint>(renderer.getTextureId());
+    if (fbo == 0)
+      gl->glGenFramebuffers(1, &fbo);
+
+    gl->glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+    if (fbo_texture != texture_id)
+    {
+      gl->glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_id, 0);
+      fbo_texture = texture_id;
+    }
+
+    ReadbackBuffer& buffer = buffers[next];
+    gl->glReadBuffer(GL_COLOR_ATTACHMENT0);
+    gl->glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.pbo);
+    gl->glReadPixels(0, 0, size.width(), size.height(), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    gl->glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    buffer.fence = gl->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    buffer.pending = true;
+    buffer.frame = frame;
+    buffer.time = time;
+    gl->glFlush();
+
+    next = (next + 1) % buffers.size();
+  }
+
+  /** @brief Wait on a pending readback, map it and pass the image to the callback */
+  void finishReadback(ReadbackBuffer& buffer, const FrameCallback& callback)
+  {
+    if (!buffer.pending)
+      return;
+
+    // Wait in one second increments since glClientWaitSync does not accept GL_TIMEOUT_IGNORED
+    GLenum status = GL_TIMEOUT_EXPIRED;
+    while (status == GL_TIMEOUT_EXPIRED)
+      status = gl->glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+
+    gl->glDeleteSync(buffer.fence);
+    buffer.fence = nullptr;
+    buffer.pending = false;
+
+    gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.pbo);
+    const void* pixels = gl->glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, byteCount(), GL_MAP_READ_BIT);
+    if (pixels == nullptr)
+    {
+      ignerr << "OffscreenRenderer, failed to map pixel buffer for frame " << buffer.frame << std::endl;
+      gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      return;
+    }
+
+    // The render texture uses a top left origin, see RenderWidget::paintGL, so no vertical flip is required
+    QImage image(size, QImage::Format_RGBA8888);
+    std::memcpy(image.bits(), pixels, static_cast<std::size_t>(byteCount()));
+    gl->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (callback)
+      callback(buffer.frame, buffer.time, image);
+  }
+
+  void flush(const FrameCallback& callback)
+  {
+    // Starting at next visits the pending buffers from oldest to newest
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+      finishReadback(buffers[(next + i) % buffers.size()], callback);
+  }
+};
+
+OffscreenRenderer::OffscreenRenderer(const std::string& scene_name, const std::string& engine_name)
+  : data_(std::make_unique<Implementation>())
+{
+  data_->renderer.setEngineName(engine_name);
+  data_->renderer.setSceneName(scene_name);
+}
+
+OffscreenRenderer::~OffscreenRenderer()
+{
+  if (data_->context == nullptr)
+    return;
+
+  data_->context->makeCurrent(data_->surface.get());
+  if (data_->gl != nullptr)
+    data_->releaseBuffers();
+
+  data_->renderer.destroy();
+  data_->context->doneCurrent();
+}
+
+bool OffscreenRenderer::initialize(int width, int height)
+{
+  if (data_->renderer.isInitialized())
+    return true;
+
+  if (qApp == nullptr)
+    throw std::runtime_error("OffscreenRenderer, a QGuiApplication must be created prior to initialization!");
+
+  data_->context = std::make_unique<QOpenGLContext>();
+  data_->context->setFormat(QSurfaceFormat::defaultFormat());
+  if (!data_->context->create())
+  {
+    ignerr << "OffscreenRenderer, unable to create OpenGL context" << std::endl;
+    return false;
+  }
+
+  data_->surface = std::make_unique<QOffscreenSurface>();
+  data_->surface->setFormat(data_->context->format());
+  data_->surface->create();
+
+  if (!data_->context->makeCurrent(data_->surface.get()))
+  {
+    ignerr << "OffscreenRenderer, unable to make OpenGL context current" << std::endl;
+    return false;
+  }
+
+  // Pixel buffer objects and fences require OpenGL 3
+  if (data_->context->format().majorVersion() < 3)
+  {
+    ignerr << "OffscreenRenderer, OpenGL 3 or newer is required for asynchronous readback" << std::endl;
+    data_->context->doneCurrent();
+    return false;
+  }
+
+  data_->gl = data_->context->extraFunctions();
+  data_->size = QSize(width, height);
+  data_->renderer.resize(width, height);
+  data_->renderer.initialize();
+  if (!data_->renderer.isInitialized())
+  {
+    ignerr << "OffscreenRenderer, unable to initialize renderer" << std::endl;
+    data_->context->doneCurrent();
+    return false;
+  }
+
+  data_->buffers.resize(static_cast<std::size_t>(data_->buffer_count));
+  data_->allocateBuffers();
+  data_->context->doneCurrent();
+  return true;
+}
+
+bool OffscreenRenderer::isInitialized() const { return data_->renderer.isInitialized(); }
+
+void OffscreenRenderer::resize(int width, int height)
+{
+  if (data_->size == QSize(width, height))
+    return;
+
+  data_->size = QSize(width, height);
+  data_->renderer.resize(width, height);
+
+  if (!data_->renderer.isInitialized())
+    return;
+
+  data_->context->makeCurrent(data_->surface.get());
+  data_->discardBuffers();
+  data_->allocateBuffers();
+  data_->context->doneCurrent();
+}
+
+QSize OffscreenRenderer::getSize() const { return data_->size; }
+
+void OffscreenRenderer::setReadbackBufferCount(int count)
+{
+  if (data_->renderer.isInitialized())
+    throw std::runtime_error("OffscreenRenderer, can not change readback buffer count after initialization!");
+
+  data_->buffer_count = std::max(count, 1);
+}
+
+int OffscreenRenderer::getReadbackBufferCount() const { return data_->buffer_count; }
+
+Renderer& OffscreenRenderer::getRenderer() { return data_->renderer; }
+const Renderer& OffscreenRenderer::getRenderer() const { return data_->renderer; }
+
+void OffscreenRenderer::render(const FrameCallback& callback, double time)
+{
+  if (!data_->renderer.isInitialized())
+    return;
+
+  data_->context->makeCurrent(data_->surface.get());
+
+  // Free the buffer before rendering so the oldest readback overlaps with the render below
+  data_->finishReadback(data_->buffers[data_->next], callback);
+  data_->renderer.render();
+  data_->queueReadback(data_->frame_count++, time);
+
+  data_->context->doneCurrent();
+}
+
+void OffscreenRenderer::flush(const FrameCallback& callback)
+{
+  if (!data_->renderer.isInitialized())
+    return;
+
+  data_->context->makeCurrent(data_->surface.get());
+  data_->flush(callback);
+  data_->context->doneCurrent();
+}
+
+QImage OffscreenRenderer::grabFrame()
+{
+  QImage image;
+  auto callback = [&image](std::size_t /*frame*/, double /*time*/, const QImage& frame_image) {
+    image = frame_image;
+  };
+
+  // Frames are delivered oldest first so the last one delivered is the frame rendered here
+  render(callback);
+  flush(callback);
+  return image;
+}
+
+std::size_t OffscreenRenderer::renderTrajectory(const std::shared_ptr<const ComponentInfo>& component_info,
+                                                const tesseract::environment::Environment& env,
+                                                const tesseract::common::JointTrajectory& trajectory,
+                                                double frame_rate,
+                                                const FrameCallback& callback)
+{
+  if (!data_->renderer.isInitialized() || trajectory.empty() || frame_rate <= 0)
+    return 0;
+
+  // Frames still pending from previous calls are discarded and the frame index is relative to this trajectory
+  const std::size_t first_frame = data_->frame_count;
+  auto trajectory_callback = [first_frame, &callback](std::size_t frame, double time, const QImage& image) {
+    if (frame >= first_frame && callback)
+      callback(frame - first_frame, time, image);
+  };
+
+  tesseract::visualization::TrajectoryPlayer player;
+  player.setTrajectory(trajectory);
+
+  const double begin = player.trajectoryDurationBegin();
+  const double end = player.trajectoryDurationEnd();
+  const double period = 1.0 / frame_rate;
+  const auto frame_count = static_cast<std::size_t>(std::floor((end - begin) / period)) + 1;
+  for (std::size_t i = 0; i < frame_count; ++i)
+  {
+    const double time = begin + (static_cast<double>(i) * period);
+    tesseract::common::JointState state = player.setCurrentDuration(time);
+
+    // The render managers queue this and apply it when the renderer sends the pre-render event
+    events::SceneStateChanged event(component_info, env.getState(state.joint_names, state.position));
+    QApplication::sendEvent(qApp, &event);
+
+    render(trajectory_callback, time);
+  }
+
+  flush(trajectory_callback);
+  return frame_count;
+}
+
+std::size_t OffscreenRenderer::writeTrajectory(const std::shared_ptr<const ComponentInfo>& component_info,
+                                               const tesseract::environment::Environment& env,
+                                               const tesseract::common::JointTrajectory& trajectory,
+                                               double frame_rate,
+                                               const QString& directory,
+                                               const QString& prefix,
+                                               const char* format)
+{
+  if (!QDir().mkpath(directory))
+  {
+    ignerr << "OffscreenRenderer, unable to create directory: " << directory.toStdString() << std::endl;
+    return 0;
+  }
+
+  const QDir dir(directory);
+  const QString suffix = QString(format).toLower();
+  std::size_t written{ 0 };
+  auto callback = [&](std::size_t frame, double /*time*/, const QImage& image) {
+    const QString file_name = QString("%1%2.%3").arg(prefix).arg(frame, 6, 10, QChar('0')).arg(suffix);
+    if (image.save(dir.filePath(file_name), format))
+      ++written;
+    else
+      ignerr << "OffscreenRenderer, failed to write frame: " << dir.filePath(file_name).toStdString() << std::endl;
+  };
+
+  renderTrajectory(component_info, env, trajectory, frame_rate, callback);
+  return written;
+}
+
+}  // namespace tesseract::gui
@@ -0,0 +1,679 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/picking.h>
+
+#include <tesseract/geometry/geometries.h>
+#include <tesseract/scene_graph/link.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace tesseract::gui
+{
+namespace
+{
+/**
+ * @brief Recursively split the items in [first, last) appending the children of the node
+ * @param depth The depth of the node
+ * @param max_depth Updated with the depth of the deepest node
+ */
+void buildNode(std::vector<PickingBVH::Node>& nodes,
+               std::vector<int>& items,
+               const std::vector<Eigen::AlignedBox3d>& boxes,
+               std::size_t node_index,
+               int first,
+               int last,
+               int leaf_size,
+               int depth,
+               int& max_depth)
+{
+  max_depth = std::max(max_depth, depth);
+
+  Eigen::AlignedBox3d box;
+  Eigen::AlignedBox3d centroids;
+  for (int i = first; i < last; ++i)
+  {
+    const Eigen::AlignedBox3d& item_box = boxes[static_cast<std::size_t>(items[static_cast<std::size_t>(i)])];
+    box.extend(item_box);
+    centroids.extend(item_box.center());
+  }
+
+  nodes[node_index].box = box;
+  if (last - first <= leaf_size)
+  {
+    nodes[node_index].index = first;
+    nodes[node_index].count = last - first;
+    return;
+  }
+
+  // Split at the centroid midpoint of the largest axis, falling back to the median when all items land on one side
+  Eigen::Index axis{ 0 };
+  const Eigen::Vector3d extent = centroids.sizes();
+  extent.maxCoeff(&axis);
+  const double split = centroids.center()[axis];
+  auto begin = items.begin() + first;
+  auto end = items.begin() + last;
+  auto mid = std::partition(begin, end, [&](int item) {
+    return boxes[static_cast<std::size_t>(item)].center()[axis] < split;
+  });
+
+  if (mid == begin || mid == end)
+  {
+    mid = begin + ((last - first) / 2);
+    std::nth_element(begin, mid, end, [&](int a, int b) {
+      return boxes[static_cast<std::size_t>(a)].center()[axis] < boxes[static_cast<std::size_t>(b)].center()[axis];
+    });
+  }
+
+  const auto child_index = nodes.size();
+  nodes[node_index].index = static_cast<int>(child_index);
+  nodes[node_index].count = 0;
+  nodes.emplace_back();
+  nodes.emplace_back();
+
+  const int middle = static_cast<int>(mid - items.begin());
+  buildNode(nodes, items, boxes, child_index, first, middle, leaf_size, depth + 1, max_depth);
+  buildNode(nodes, items, boxes, child_index + 1, middle, last, leaf_size, depth + 1, max_depth);
+}
+
+bool intersectSphere(const Eigen::Vector3d& origin,
+                     const Eigen::Vector3d& direction,
+                     const Eigen::Vector3d& center,
+                     double radius,
+                     double& t)
+{
+  const Eigen::Vector3d oc = origin - center;
+  const double b = oc.dot(direction);
+  const double c = oc.squaredNorm() - (radius * radius);
+  const double discriminant = (b * b) - c;
+  if (discriminant < 0)
+    return false;
+
+  const double sqrt_discriminant = std::sqrt(discriminant);
+  t = -b - sqrt_discriminant;
+  if (t < 0)
+    t = -b + sqrt_discriminant;
+
+  return (t >= 0);
+}
+
+/** @brief Intersect the side of a cylinder along z centered at the origin */
+bool intersectCylinderSide(const Eigen::Vector3d& origin,
+                           const Eigen::Vector3d& direction,
+                           double radius,
+                           double half_length,
+                           double& t)
+{
+  const double a = (direction.x() * direction.x()) + (direction.y() * direction.y());
+  if (a < std::numeric_limits<double>::epsilon())
+    return false;
+
+  const double b = (origin.x() * direction.x()) + (origin.y() * direction.y());
+  const double c = (origin.x() * origin.x()) + (origin.y() * origin.y()) - (radius * radius);
+  const double discriminant = (b * b) - (a * c);
+  if (discriminant < 0)
+    return false;
+
+  const double sqrt_discriminant = std::sqrt(discriminant);
+  for (double candidate : { (-b - sqrt_discriminant) / a, (-b + sqrt_discriminant) / a })
+  {
+    if (candidate >= 0 && std::abs(origin.z() + (candidate * direction.z())) <= half_length)
+    {
+      t = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+void addPolygonMesh(PickingMesh& mesh,
+                    const tesseract::geometry::PolygonMesh& polygon_mesh,
+                    const Eigen::Isometry3d& pose,
+                    int owner)
+{
+  const auto& vertices = *polygon_mesh.getVertices();
+  const auto& faces = *polygon_mesh.getFaces();
+  const Eigen::Vector3d scale = polygon_mesh.getScale();
+  auto vertex = [&](int index) -> Eigen::Vector3d {
+    return pose * vertices[static_cast<std::size_t>(index)].cwiseProduct(scale);
+  };
+
+  // Faces are stored as the vertex count followed by the vertex indices, polygons are triangulated as fans
+  for (Eigen::Index f = 0; f < faces.size();)
+  {
+    const int count = faces[f];
+    for (int k = 2; k < count; ++k)
+      mesh.addTriangle(vertex(faces[f + 1]), vertex(faces[f + k]), vertex(faces[f + k + 1]), owner);
+
+    f += count + 1;
+  }
+}
+}  // namespace
+
+/////////////////////////////////////////////////
+void PickingBVH::build(const std::vector<Eigen::AlignedBox3d>& boxes, int leaf_size)
+{
+  clear();
+  if (boxes.empty())
+    return;
+
+  items_.resize(boxes.size());
+  std::iota(items_.begin(), items_.end(), 0);
+  nodes_.reserve(2 * boxes.size());
+  nodes_.emplace_back();
+  buildNode(nodes_, items_, boxes, 0, 0, static_cast<int>(boxes.size()), std::max(leaf_size, 1), 0, depth_);
+}
+
+void PickingBVH::refit(const std::vector<Eigen::AlignedBox3d>& boxes)
+{
+  assert(boxes.size() == items_.size());
+  for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it)
+  {
+    Eigen::AlignedBox3d box;
+    if (it->count > 0)
+    {
+      for (int i = it->index; i < it->index + it->count; ++i)
+        box.extend(boxes[static_cast<std::size_t>(items_[static_cast<std::size_t>(i)])]);
+    }
+    else
+    {
+      box = nodes_[static_cast<std::size_t>(it->index)].box.merged(nodes_[static_cast<std::size_t>(it->index + 1)].box);
+    }
+    it->box = box;
+  }
+}
+
+void PickingBVH::clear()
+{
+  nodes_.clear();
+  items_.clear();
+  depth_ = 0;
+}
+
+bool PickingBVH::empty() const { return nodes_.empty(); }
+
+Eigen::AlignedBox3d PickingBVH::getBounds() const
+{
+  if (nodes_.empty())
+    return {};
+
+  return nodes_.front().box;
+}
+
+bool PickingBVH::intersect(const Eigen::AlignedBox3d& box,
+                           const Eigen::Vector3d& origin,
+                           const Eigen::Vector3d& inv_direction,
+                           double max_distance,
+                           double& t)
+{
+  if (box.isEmpty())
+    return false;
+
+  const Eigen::Vector3d t0 = (box.min() - origin).cwiseProduct(inv_direction);
+  const Eigen::Vector3d t1 = (box.max() - origin).cwiseProduct(inv_direction);
+  const double t_near = t0.cwiseMin(t1).maxCoeff();
+  const double t_far = t0.cwiseMax(t1).minCoeff();
+  t = std::max(t_near, 0.0);
+  return (t_near <= t_far && t_far >= 0 && t_near <= max_distance);
+}
+
+/////////////////////////////////////////////////
+void PickingMesh::addTriangle(const Eigen::Vector3d& v0,
+                              const Eigen::Vector3d& v1,
+                              const Eigen::Vector3d& v2,
+                              int owner)
+{
+  triangles_.push_back(Triangle{ v0, v1 - v0, v2 - v0, owner });
+}
+
+void PickingMesh::addShape(ShapeType type, const Eigen::Isometry3d& pose, const Eigen::Vector3d& dimensions, int owner)
+{
+  Shape shape;
+  shape.type = type;
+  shape.inv_pose = pose.inverse();
+  shape.dimensions = dimensions;
+  shape.owner = owner;
+
+  Eigen::Vector3d half_extents;
+  switch (type)
+  {
+    case ShapeType::BOX:
+      half_extents = 0.5 * dimensions;
+      break;
+    case ShapeType::SPHERE:
+      half_extents = Eigen::Vector3d::Constant(dimensions.x());
+      break;
+    case ShapeType::CYLINDER:
+      half_extents = Eigen::Vector3d(dimensions.x(), dimensions.x(), 0.5 * dimensions.y());
+      break;
+    case ShapeType::CAPSULE:
+      half_extents = Eigen::Vector3d(dimensions.x(), dimensions.x(), dimensions.x() + (0.5 * dimensions.y()));
+      break;
+  }
+
+  // Bounds of the oriented box
+  const Eigen::Vector3d extents = pose.linear().cwiseAbs() * half_extents;
+  shape.box = Eigen::AlignedBox3d(pose.translation() - extents, pose.translation() + extents);
+  shapes_.push_back(shape);
+}
+
+void PickingMesh::build()
+{
+  std::vector<Eigen::AlignedBox3d> boxes;
+  boxes.reserve(triangles_.size() + shapes_.size());
+  for (const auto& triangle : triangles_)
+  {
+    Eigen::AlignedBox3d box(triangle.v0);
+    box.extend(triangle.v0 + triangle.e1);
+    box.extend(triangle.v0 + triangle.e2);
+    boxes.push_back(box);
+  }
+
+  for (const auto& shape : shapes_)
+    boxes.push_back(shape.box);
+
+  bvh_.build(boxes);
+}
+
+bool PickingMesh::empty() const { return triangles_.empty() && shapes_.empty(); }
+std::size_t PickingMesh::getTriangleCount() const { return triangles_.size(); }
+std::size_t PickingMesh::getShapeCount() const { return shapes_.size(); }
+Eigen::AlignedBox3d PickingMesh::getBounds() const { return bvh_.getBounds(); }
+
+bool PickingMesh::raycast(const Eigen::Vector3d& origin,
+                          const Eigen::Vector3d& direction,
+                          double& distance,
+                          int& owner) const
+{
+  bool found{ false };
+  const auto triangle_count = static_cast<int>(triangles_.size());
+  bvh_.raycast(origin, direction, distance, [&](int item, double& max_distance) {
+    bool hit{ false };
+    if (item < triangle_count)
+      hit = raycast(triangles_[static_cast<std::size_t>(item)], origin, direction, max_distance);
+    else
+      hit = raycast(shapes_[static_cast<std::size_t>(item - triangle_count)], origin, direction, max_distance);
+
+    if (hit)
+    {
+      owner = (item < triangle_count) ? triangles_[static_cast<std::size_t>(item)].owner :
+                                        shapes_[static_cast<std::size_t>(item - triangle_count)].owner;
+      found = true;
+    }
+  });
+  return found;
+}
+
+bool PickingMesh::raycast(const Triangle& triangle,
+                          const Eigen::Vector3d& origin,
+                          const Eigen::Vector3d& direction,
+                          double& distance) const
+{
+  // Moller-Trumbore, both faces are pickable
+  const Eigen::Vector3d p = direction.cross(triangle.e2);
+  const double det = triangle.e1.dot(p);
+  if (std::abs(det) < 1e-12)
+    return false;
+
+  const double inv_det = 1.0 / det;
+  const Eigen::Vector3d s = origin - triangle.v0;
+  const double u = s.dot(p) * inv_det;
+  if (u < 0 || u > 1)
+    return false;
+
+  const Eigen::Vector3d q = s.cross(triangle.e1);
+  const double v = direction.dot(q) * inv_det;
+  if (v < 0 || (u + v) > 1)
+    return false;
+
+  const double t = triangle.e2.dot(q) * inv_det;
+  if (t < 0 || t >= distance)
+    return false;
+
+  distance = t;
+  return true;
+}
+
+bool PickingMesh::raycast(const Shape& shape,
+                          const Eigen::Vector3d& origin,
+                          const Eigen::Vector3d& direction,
+                          double& distance) const
+{
+  // The pose is rigid so distances in the shape frame are the same as in the mesh frame
+  const Eigen::Vector3d local_origin = shape.inv_pose * origin;
+  const Eigen::Vector3d local_direction = shape.inv_pose.linear() * direction;
+
+  double t{ std::numeric_limits<double>::max() };
+  bool hit{ false };
+  switch (shape.type)
+  {
+    case ShapeType::BOX:
+    {
+      const Eigen::Vector3d half_extents = 0.5 * shape.dimensions;
+      const Eigen::AlignedBox3d box(-half_extents, half_extents);
+      hit = PickingBVH::intersect(box, local_origin, local_direction.cwiseInverse(), distance, t);
+      break;
+    }
+    case ShapeType::SPHERE:
+    {
+      hit = intersectSphere(local_origin, local_direction, Eigen::Vector3d::Zero(), shape.dimensions.x(), t);
+      break;
+    }
+    case ShapeType::CYLINDER:
+    {
+      const double radius = shape.dimensions.x();
+      const double half_length = 0.5 * shape.dimensions.y();
+      hit = intersectCylinderSide(local_origin, local_direction, radius, half_length, t);
+
+      // Caps
+      if (std::abs(local_direction.z()) > std::numeric_limits<double>::epsilon())
+      {
+        for (double z : { -half_length, half_length })
+        {
+          const double t_cap = (z - local_origin.z()) / local_direction.z();
+          const Eigen::Vector3d p = local_origin + (t_cap * local_direction);
+          if (t_cap >= 0 && t_cap < t && p.head<2>().squaredNorm() <= radius * radius)
+          {
+            t = t_cap;
+            hit = true;
+          }
+        }
+      }
+      break;
+    }
+    case ShapeType::CAPSULE:
+    {
+      const double radius = shape.dimensions.x();
+      const double half_length = 0.5 * shape.dimensions.y();
+      hit = intersectCylinderSide(local_origin, local_direction, radius, half_length, t);
+      for (double z : { -half_length, half_length })
+      {
+        double t_sphere{ 0 };
+        if (intersectSphere(local_origin, local_direction, Eigen::Vector3d(0, 0, z), radius, t_sphere) && t_sphere < t)
+        {
+          t = t_sphere;
+          hit = true;
+        }
+      }
+      break;
+    }
+  }
+
+  if (!hit || t >= distance)
+    return false;
+
+  distance = t;
+  return true;
+}
+
+/////////////////////////////////////////////////
+PickingMesh::Ptr createPickingMesh(const tesseract::scene_graph::Link& link)
+{
+  auto mesh = std::make_shared<PickingMesh>();
+  for (std::size_t i = 0; i < link.visual.size(); ++i)
+  {
+    const auto& visual = link.visual[i];
+    const auto owner = static_cast<int>(i);
+    const tesseract::geometry::Geometry& geometry = *visual->geometry;
+    switch (geometry.getType())
+    {
+      case tesseract::geometry::GeometryType::BOX:
+      {
+        const auto& shape = static_cast<const tesseract::geometry::Box&>(geometry);
+        mesh->addShape(PickingMesh::ShapeType::BOX,
+                       visual->origin,
+                       Eigen::Vector3d(shape.getX(), shape.getY(), shape.getZ()),
+                       owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::SPHERE:
+      {
+        const auto& shape = static_cast<const tesseract::geometry::Sphere&>(geometry);
+        mesh->addShape(PickingMesh::ShapeType::SPHERE, visual->origin, Eigen::Vector3d(shape.getRadius(), 0, 0), owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::CYLINDER:
+      {
+        const auto& shape = static_cast<const tesseract::geometry::Cylinder&>(geometry);
+        mesh->addShape(PickingMesh::ShapeType::CYLINDER,
+                       visual->origin,
+                       Eigen::Vector3d(shape.getRadius(), shape.getLength(), 0),
+                       owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::CONE:
+      {
+        // Approximated by the enclosing cylinder
+        const auto& shape = static_cast<const tesseract::geometry::Cone&>(geometry);
+        mesh->addShape(PickingMesh::ShapeType::CYLINDER,
+                       visual->origin,
+                       Eigen::Vector3d(shape.getRadius(), shape.getLength(), 0),
+                       owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::CAPSULE:
+      {
+        const auto& shape = static_cast<const tesseract::geometry::Capsule&>(geometry);
+        mesh->addShape(PickingMesh::ShapeType::CAPSULE,
+                       visual->origin,
+                       Eigen::Vector3d(shape.getRadius(), shape.getLength(), 0),
+                       owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::MESH:
+      case tesseract::geometry::GeometryType::CONVEX_MESH:
+      case tesseract::geometry::GeometryType::SDF_MESH:
+      case tesseract::geometry::GeometryType::POLYGON_MESH:
+      {
+        addPolygonMesh(*mesh, static_cast<const tesseract::geometry::PolygonMesh&>(geometry), visual->origin, owner);
+        break;
+      }
+      case tesseract::geometry::GeometryType::COMPOUND_MESH:
+      {
+        const auto& shape = static_cast<const tesseract::geometry::CompoundMesh&>(geometry);
+        for (const auto& sub_mesh : shape.getMeshes())
+          addPolygonMesh(*mesh, *sub_mesh, visual->origin, owner);
+        break;
+      }
+      default:
+        // Planes and octrees are not pickable
+        break;
+    }
+  }
+
+  mesh->build();
+  return mesh;
+}
+
+/////////////////////////////////////////////////
+void PickingScene::setInstance(const std::string& key,
+                               std::shared_ptr<const InstanceInfo> info,
+                               const Eigen::Isometry3d& pose)
+{
+  auto it = index_.find(key);
+  if (it == index_.end())
+  {
+    index_[key] = infos_.size();
+    infos_.push_back(std::move(info));
+    poses_.push_back(pose);
+    inv_poses_.push_back(pose.inverse());
+    visible_.push_back(true);
+  }
+  else
+  {
+    infos_[it->second] = std::move(info);
+    poses_[it->second] = pose;
+    inv_poses_[it->second] = pose.inverse();
+  }
+  rebuild_ = true;
+}
+
+void PickingScene::removeInstance(const std::string& key)
+{
+  auto it = index_.find(key);
+  if (it == index_.end())
+    return;
+
+  // Swap with the last instance to keep the arrays dense
+  const std::size_t index = it->second;
+  const std::size_t last = infos_.size() - 1;
+  if (index != last)
+  {
+    const std::string last_key = std::find_if(index_.begin(), index_.end(), [last](const auto& entry) {
+                                   return entry.second == last;
+                                 })->first;
+    infos_[index] = std::move(infos_[last]);
+    poses_[index] = poses_[last];
+    inv_poses_[index] = inv_poses_[last];
+    visible_[index] = visible_[last];
+    index_[last_key] = index;
+  }
+
+  infos_.pop_back();
+  poses_.pop_back();
+  inv_poses_.pop_back();
+  visible_.pop_back();
+  index_.erase(key);
+  rebuild_ = true;
+}
+
+bool PickingScene::hasInstance(const std::string& key) const { return (index_.find(key) != index_.end()); }
+
+void PickingScene::clear()
+{
+  infos_.clear();
+  poses_.clear();
+  inv_poses_.clear();
+  visible_.clear();
+  index_.clear();
+  bvh_.clear();
+  rebuild_ = false;
+  refit_ = false;
+}
+
+void PickingScene::setPoses(const tesseract::common::TransformMap& poses)
+{
+  for (const auto& pose : poses)
+  {
+    auto it = index_.find(pose.first);
+    if (it == index_.end())
+      continue;
+
+    poses_[it->second] = pose.second;
+    inv_poses_[it->second] = pose.second.inverse();
+    refit_ = true;
+  }
+}
+
+void PickingScene::setVisible(const std::string& key, bool visible)
+{
+  auto it = index_.find(key);
+  if (it != index_.end())
+    visible_[it->second] = visible;
+}
+
+void PickingScene::update()
+{
+  if (!rebuild_ && !refit_)
+    return;
+
+  std::vector<Eigen::AlignedBox3d> boxes;
+  boxes.reserve(infos_.size());
+  for (std::size_t i = 0; i < infos_.size(); ++i)
+    boxes.push_back(getWorldBounds(i));
+
+  if (rebuild_)
+    bvh_.build(boxes, 1);
+  else
+    bvh_.refit(boxes);
+
+  rebuild_ = false;
+  refit_ = false;
+}
+
+std::size_t PickingScene::size() const { return infos_.size(); }
+
+PickResult PickingScene::pick(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, double max_distance)
+    const
+{
+  assert(!rebuild_ && !refit_);
+
+  PickResult result;
+  double distance = max_distance;
+  int hit_instance{ -1 };
+  int hit_owner{ -1 };
+  bvh_.raycast(origin, direction, distance, [&](int item, double& max) {
+    const auto index = static_cast<std::size_t>(item);
+    if (!visible_[index])
+      return;
+
+    const Eigen::Isometry3d& inv_pose = inv_poses_[index];
+    int owner{ -1 };
+    if (infos_[index]->mesh->raycast(inv_pose * origin, inv_pose.linear() * direction, max, owner))
+    {
+      hit_instance = item;
+      hit_owner = owner;
+    }
+  });
+
+  if (hit_instance < 0)
+    return result;
+
+  const InstanceInfo& info = *infos_[static_cast<std::size_t>(hit_instance)];
+  const auto owner = static_cast<std::size_t>(hit_owner);
+  result.type = info.type;
+  result.distance = distance;
+  result.point = origin + (distance * direction);
+  if (info.type == PickResult::Type::LINK)
+  {
+    result.link_name = info.link_name;
+    result.visual_index = hit_owner;
+    if (owner < info.visual_names.size())
+      result.visual_name = info.visual_names[owner];
+  }
+  else if (owner < info.pose_uuids.size())
+  {
+    result.tool_path_uuid = info.tool_path_uuid;
+    result.segment_uuid = info.pose_uuids[owner].first;
+    result.pose_uuid = info.pose_uuids[owner].second;
+  }
+
+  return result;
+}
+
+Eigen::AlignedBox3d PickingScene::getWorldBounds(std::size_t index) const
+{
+  const Eigen::AlignedBox3d local = infos_[index]->mesh->getBounds();
+  if (local.isEmpty())
+    return local;
+
+  const Eigen::Isometry3d& pose = poses_[index];
+  const Eigen::Vector3d center = pose * local.center();
+  const Eigen::Vector3d extents = pose.linear().cwiseAbs() * (0.5 * local.sizes());
+  return { center - extents, center + extents };
+}
+
+}  // namespace tesseract::gui
@@ -159,6 +159,16 @@ public:
   gz::common::MouseEvent mouse;
 };
 
+class PickOnScene::Implementation
+{
+public:
+  /// \brief The pick result.
+  tesseract::gui::PickResult result;
+
+  /// \brief The input which triggered the pick.
+  PickType pick_type{ PickType::HOVER };
+};
+
 SnapIntervals::SnapIntervals(const gz::math::Vector3d& _xyz,
                              const gz::math::Vector3d& _rpy,
                              const gz::math::Vector3d& _scale,
@@ -389,6 +399,22 @@ MousePressOnScene::~MousePressOnScene() = default;
 /////////////////////////////////////////////////
 const gz::common::MouseEvent& MousePressOnScene::getMouse() const { return data_->mouse; }
 
+/////////////////////////////////////////////////
+PickOnScene::PickOnScene(tesseract::gui::PickResult result, PickType pick_type, std::string scene_name)
+  : RenderEvent(std::move(scene_name), QEvent::Type(EventType::PICK_ON_SCENE))
+  , data_(std::make_unique<Implementation>())
+{
+  data_->result = std::move(result);
+  data_->pick_type = pick_type;
+}
+PickOnScene::~PickOnScene() = default;
+
+/////////////////////////////////////////////////
+const tesseract::gui::PickResult& PickOnScene::getResult() const { return data_->result; }
+
+/////////////////////////////////////////////////
+PickOnScene::PickType PickOnScene::getPickType() const { return data_->pick_type; }
+
 /////////////////////////////////////////////////
 // WorldControl::WorldControl(const gz::msgs::WorldControl &_worldControl)
 //  :SceneEvent(scene_name, kType)
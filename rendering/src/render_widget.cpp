@@ -19,6 +19,12 @@
 #include <tesseract_qt/rendering/render_events.h>
 #include <tesseract_qt/rendering/conversions.h>
 #include <tesseract_qt/rendering/interactive_view_control.h>
+#include <tesseract_qt/rendering/scene_picker.h>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/component_events.h>
+#include <tesseract_qt/common/events/render_events.h>
+#include <tesseract_qt/common/tracing.h>
 
 // TODO(louise) Remove these pragmas once ign-rendering
 // is disabling the warnings
@@ -27,11 +33,15 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
 #include <map>
 #include <sstream>
 #include <vector>
 #include <gz/rendering/Material.hh>
 #include <gz/rendering/Camera.hh>
+#include <gz/rendering/DirectionalLight.hh>
 #include <gz/rendering/RayQuery.hh>
 #include <gz/rendering/RenderEngine.hh>
 #include <gz/rendering/RenderingIface.hh>
@@ -42,11 +52,13 @@
 #include <gz/common/MouseEvent.hh>
 #include <gz/common/Console.hh>
 #include <gz/math/Color.hh>
+#include <gz/math/Matrix4.hh>
 
 #include <QOpenGLTextureBlitter>
 #include <QOffscreenSurface>
 #include <QApplication>
 #include <QTimer>
+#include <QElapsedTimer>
 #include <QKeyEvent>
 
 #ifdef _MSC_VER
@@ -55,6 +67,9 @@
 
 namespace tesseract::gui
 {
+/** @brief The name of the light shared by the cameras of a scene */
+const std::string USER_LIGHT_NAME = "tesseract_user_light";
+
 /** @brief Private data class for Renderer */
 class Renderer::Implementation
 {
@@ -65,6 +80,9 @@ public:
   /** @brief Unique scene name */
   std::string scene_name{ "scene" };
 
+  /** @brief Unique name of the user camera, several renderers may share a scene each with their own camera */
+  std::string camera_name;
+
   /** @brief Scene background color */
   gz::math::Color background_color{ 0.8f, 0.8f, 0.8f, 1.0f };
 
@@ -179,7 +197,13 @@ public:
 };
 
 /////////////////////////////////////////////////
-Renderer::Renderer() : data_(std::make_unique<Implementation>()) {}
+Renderer::Renderer() : data_(std::make_unique<Implementation>())
+{
+  static std::atomic<int> camera_counter{ 0 };
+  data_->camera_name = "tesseract_user_camera_" + std::to_string(++camera_counter);
+}
+
+Renderer::~Renderer() = default;
 
 void Renderer::setEngineName(const std::string& name)
 {
@@ -201,6 +225,8 @@ void Renderer::setSceneName(const std::string& name)
 
 const std::string& Renderer::getSceneName() const { return data_->scene_name; }
 
+const std::string& Renderer::getCameraName() const { return data_->camera_name; }
+
 void Renderer::setBackgroundColor(const gz::math::Color& color)
 {
   data_->background_color = color;
@@ -332,6 +358,38 @@ bool Renderer::hoverEventEnabled() const
   return data_->hover_event_enable;
 }
 
+bool Renderer::getCameraRay(const gz::math::Vector2i& screen_pos,
+                            gz::math::Vector3d& origin,
+                            gz::math::Vector3d& direction) const
+{
+  if (!data_->initialized)
+    return false;
+
+  // Normalize point on the image
+  double width = data_->camera->ImageWidth();
+  double height = data_->camera->ImageHeight();
+
+  double nx = 2.0 * screen_pos.X() / width - 1.0;
+  double ny = 1.0 - 2.0 * screen_pos.Y() / height;
+
+  // Unproject the point on the near and far planes which is the same as the ray query
+  gz::math::Matrix4d inv_view_projection =
+      (data_->camera->ProjectionMatrix() * data_->camera->ViewMatrix()).Inverse();
+  auto unproject = [&inv_view_projection, nx, ny](double z) {
+    const double in[4] = { nx, ny, z, 1.0 };
+    double out[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 4; ++j)
+        out[i] += inv_view_projection(i, j) * in[j];
+
+    return gz::math::Vector3d(out[0] / out[3], out[1] / out[3], out[2] / out[3]);
+  };
+
+  origin = unproject(-1.0);
+  direction = (unproject(0.0) - origin).Normalize();
+  return true;
+}
+
 const QSize& Renderer::getTextureSize() const { return data_->texture_size; }
 
 unsigned int Renderer::getTextureId() const { return data_->texture_id; }
@@ -342,6 +400,8 @@ void Renderer::render()
   if (!data_->initialized)
     return;
 
+  TESSERACT_QT_TRACE_ZONE("Renderer::render");
+
   if (data_->texture_dirty)
   {
     std::lock_guard<std::mutex> lock(data_->mutex);
@@ -361,10 +421,12 @@ void Renderer::render()
   if (qApp != nullptr)
   {
     events::PreRender event(data_->scene_name);
+    event.setCameraName(data_->camera_name);
     QApplication::sendEvent(qApp, &event);
   }
 
   {
+    TESSERACT_QT_TRACE_ZONE("Camera::Update");
     std::lock_guard<std::mutex> lock(data_->mutex);
     data_->camera->Update();
     assert(data_->texture_id == data_->camera->RenderTextureGLId());
@@ -373,6 +435,7 @@ void Renderer::render()
   if (qApp != nullptr)
   {
     events::Render event(data_->scene_name);
+    event.setCameraName(data_->camera_name);
     QApplication::sendEvent(qApp, &event);
   }
 
@@ -439,6 +502,7 @@ void Renderer::broadcastDrop()
   if (!data_->drop_dirty)
     return;
   events::DropOnScene dropOnSceneEvent(data_->drop_text, data_->mouse_drop_pos, data_->scene_name);
+  dropOnSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &dropOnSceneEvent);
   data_->drop_dirty = false;
 }
@@ -452,6 +516,7 @@ void Renderer::broadcastHoverPos()
   auto pos = screenToScene(data_->mouse_hover_pos);
 
   events::HoverToScene hoverToSceneEvent(pos, data_->scene_name);
+  hoverToSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &hoverToSceneEvent);
 
   gz::common::MouseEvent hoverMouseEvent = data_->mouse_event;
@@ -459,6 +524,7 @@ void Renderer::broadcastHoverPos()
   hoverMouseEvent.SetDragging(false);
   hoverMouseEvent.SetType(gz::common::MouseEvent::MOVE);
   events::HoverOnScene hoverOnSceneEvent(hoverMouseEvent, data_->scene_name);
+  hoverOnSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &hoverOnSceneEvent);
 
   data_->hover_dirty = false;
@@ -475,6 +541,7 @@ void Renderer::broadcastDrag()
     return;
 
   events::DragOnScene dragEvent(data_->mouse_event, data_->scene_name);
+  dragEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &dragEvent);
 }
 
@@ -491,9 +558,11 @@ void Renderer::broadcastLeftClick()
   auto pos = screenToScene(data_->mouse_event.Pos());
 
   events::LeftClickToScene leftClickToSceneEvent(pos, data_->scene_name);
+  leftClickToSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &leftClickToSceneEvent);
 
   events::LeftClickOnScene leftClickOnSceneEvent(data_->mouse_event, data_->scene_name);
+  leftClickOnSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &leftClickOnSceneEvent);
 }
 
@@ -510,9 +579,11 @@ void Renderer::broadcastRightClick()
   auto pos = screenToScene(data_->mouse_event.Pos());
 
   events::RightClickToScene rightClickToSceneEvent(pos, data_->scene_name);
+  rightClickToSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &rightClickToSceneEvent);
 
   events::RightClickOnScene rightClickOnSceneEvent(data_->mouse_event, data_->scene_name);
+  rightClickOnSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &rightClickOnSceneEvent);
 }
 
@@ -526,6 +597,7 @@ void Renderer::broadcastMousePress()
     return;
 
   events::MousePressOnScene event(data_->mouse_event, data_->scene_name);
+  event.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &event);
 }
 
@@ -539,6 +611,7 @@ void Renderer::broadcastScroll()
     return;
 
   events::ScrollOnScene scrollOnSceneEvent(data_->mouse_event, data_->scene_name);
+  scrollOnSceneEvent.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &scrollOnSceneEvent);
 }
 
@@ -549,6 +622,7 @@ void Renderer::broadcastKeyRelease()
     return;
 
   events::KeyReleaseOnScene keyRelease(data_->key_event, data_->scene_name);
+  keyRelease.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &keyRelease);
 
   data_->key_event.SetType(gz::common::KeyEvent::NO_EVENT);
@@ -561,6 +635,7 @@ void Renderer::broadcastKeyPress()
     return;
 
   events::KeyPressOnScene keyPress(data_->key_event, data_->scene_name);
+  keyPress.setCameraName(data_->camera_name);
   QApplication::sendEvent(qApp, &keyPress);
 
   data_->key_event.SetType(gz::common::KeyEvent::NO_EVENT);
@@ -633,7 +708,7 @@ void Renderer::initialize()
   auto root = scene->RootVisual();
 
   // Camera
-  data_->camera = scene->CreateCamera();
+  data_->camera = scene->CreateCamera(data_->camera_name);
   data_->camera->SetUserData("user-camera", true);
   root->AddChild(data_->camera);
   data_->camera->SetLocalPose(data_->camera_pose);
@@ -644,14 +719,17 @@ void Renderer::initialize()
   data_->camera->SetAntiAliasing(data_->camera_anti_aliasing);
   data_->camera->SetHFOV(M_PI * 0.5);
 
-  /** @todo LEVI Need figure out haw to get the camera by name. */
-  // create directional light
-  data_->light = scene->CreateDirectionalLight();
-  data_->light->SetDirection(1, 0, 0);
-  data_->light->SetDiffuseColor(0.8, 0.8, 0.8);
-  data_->light->SetSpecularColor(0.5, 0.5, 0.5);
+  // The light follows the first camera of the scene, every camera sharing the scene uses it
+  data_->light = std::dynamic_pointer_cast<gz::rendering::DirectionalLight>(scene->LightByName(USER_LIGHT_NAME));
+  if (data_->light == nullptr)
+  {
+    data_->light = scene->CreateDirectionalLight(USER_LIGHT_NAME);
+    data_->light->SetDirection(1, 0, 0);
+    data_->light->SetDiffuseColor(0.8, 0.8, 0.8);
+    data_->light->SetSpecularColor(0.5, 0.5, 0.5);
+    data_->camera->AddChild(data_->light);
+  }
   data_->light->SetCastShadows(data_->shadows_enable);
-  data_->camera->AddChild(data_->light);
 
   // Generate initial texture
   data_->camera->PreRender();
@@ -673,6 +751,22 @@ void Renderer::destroy()
   auto scene = engine->SceneByName(data_->scene_name);
   if (!scene)
     return;
+
+  // Hand the shared light over to another camera of the scene
+  if (data_->light != nullptr && data_->light->Parent() == data_->camera)
+  {
+    data_->camera->RemoveChild(data_->light);
+    for (unsigned int i = 0; i < scene->SensorCount(); ++i)
+    {
+      auto camera = std::dynamic_pointer_cast<gz::rendering::Camera>(scene->SensorByIndex(i));
+      if (camera != nullptr && camera != data_->camera && camera->HasUserData("user-camera"))
+      {
+        camera->AddChild(data_->light);
+        break;
+      }
+    }
+  }
+
   scene->DestroySensor(data_->camera);
 
   // If that was the last sensor, destroy scene
@@ -744,6 +838,16 @@ gz::math::Vector3d Renderer::screenToScene(const gz::math::Vector2i& screen_pos)
   return data_->ray_query->Origin() + data_->ray_query->Direction() * 10;
 }
 
+/**
+ * @brief The number of frames required to reflect view control input
+ * @details The renderer broadcasts input at the start of a frame but the view control only moves the camera when it
+ * receives the render event after the camera has been updated, so the change is visible on the following frame.
+ */
+const int INPUT_FRAME_COUNT = 2;
+
+/** @brief The lowest update frequency (hz), lower values would give an infinite or negative timer interval */
+const double MIN_UPDATE_FREQUENCY = 1.0;
+
 /// \brief Private data class for RenderWindowItem
 class RenderWidget::Implementation
 {
@@ -773,7 +877,37 @@ public:
   QTimer update_timer;
 
   /** @brief The desired update frequency for rendering, default is 60hz */
-  int update_frequency{ 60 };
+  double update_frequency{ 60 };
+
+  /** @brief The render mode */
+  RenderMode render_mode{ RenderMode::ON_DEMAND };
+
+  /** @brief The number of frames still to be rendered in on-demand mode */
+  int pending_frames{ 0 };
+
+  /** @brief True while rendering so events sent by the render managers do not request another frame */
+  bool rendering{ false };
+
+  /** @brief True while suspended, frames requested meanwhile are rendered once resumed */
+  bool suspended{ false };
+
+  /** @brief The clock used for frame timestamps */
+  QElapsedTimer clock;
+
+  /** @brief The timestamp (ms) of the start of the last frame, negative if no frame has been rendered */
+  qint64 last_frame_start{ -1 };
+
+  /** @brief The timestamps (ms) of the frames rendered over the last second */
+  std::deque<qint64> frame_timestamps;
+
+  /** @brief Frame time statistics */
+  RenderStatistics statistics;
+
+  /** @brief The scene picker used for hover and click picking */
+  std::shared_ptr<ScenePicker> scene_picker;
+
+  /** @brief The minimum time between frames in milliseconds */
+  int frameInterval() const { return static_cast<int>(1000.0 / update_frequency); }
 
   /** @brief List of our QT connections. */
   QList<QMetaObject::Connection> connections;
@@ -785,10 +919,14 @@ RenderWidget::RenderWidget(const std::string& scene_name, const std::string& eng
 {
   data_->renderer.setEngineName(engine_name);
   data_->renderer.setSceneName(scene_name);
-  data_->view_controller = std::make_shared<InteractiveViewControl>(scene_name);
+  data_->view_controller =
+      std::make_shared<InteractiveViewControl>(scene_name, ViewControlType::ORBIT, data_->renderer.getCameraName());
 
+  data_->clock.start();
+  data_->update_timer.setSingleShot(true);
   connect(&data_->update_timer, SIGNAL(timeout()), this, SLOT(onFrameSwapped()));
-  data_->update_timer.start(1000.0 / data_->update_frequency);
+
+  qApp->installEventFilter(this);
 
   // The use of QTimer is prefered over the method below
   //  // This is critical to sync the monitor refresh with rendering of the widget
@@ -861,14 +999,25 @@ void RenderWidget::initializeGL()
   }
 }
 
-void RenderWidget::resizeGL(int w, int h) { data_->renderer.resize(w, h); }
+void RenderWidget::resizeGL(int w, int h)
+{
+  data_->renderer.resize(w, h);
+  requestRender();
+}
 
 /////////////////////////////////////////////////
 void RenderWidget::paintGL()
 {
+  TESSERACT_QT_TRACE_ZONE("RenderWidget::paintGL");
+  const qint64 frame_start = data_->clock.elapsed();
+  QElapsedTimer frame_timer;
+  frame_timer.start();
+
+  data_->rendering = true;
   data_->context->makeCurrent(data_->surface);
   data_->renderer.render();
   data_->context->doneCurrent();
+  data_->rendering = false;
 
   makeCurrent();
   data_->texture_blitter.bind(GL_TEXTURE_2D);
@@ -878,14 +1027,42 @@ void RenderWidget::paintGL()
   data_->texture_blitter.blit(data_->renderer.getTextureId(), target, QOpenGLTextureBlitter::OriginTopLeft);
   data_->texture_blitter.release();
   doneCurrent();
+
+  // Update statistics
+  const double frame_time = static_cast<double>(frame_timer.nsecsElapsed()) / 1.0e6;
+  RenderStatistics& stats = data_->statistics;
+  stats.average_frame_time =
+      (stats.frame_count == 0) ? frame_time : (0.9 * stats.average_frame_time) + (0.1 * frame_time);
+  stats.last_frame_time = frame_time;
+  stats.max_frame_time = std::max(stats.max_frame_time, frame_time);
+  ++stats.frame_count;
+
+  data_->last_frame_start = frame_start;
+  data_->frame_timestamps.push_back(frame_start);
+  while (data_->frame_timestamps.front() <= frame_start - 1000)
+    data_->frame_timestamps.pop_front();
+
+  if (data_->pending_frames > 0)
+    --data_->pending_frames;
+
+  if (data_->render_mode == RenderMode::ON_DEMAND && data_->pending_frames > 0 && !data_->suspended)
+    scheduleFrame();
 }
 
 /////////////////////////////////////////////////
-void RenderWidget::setBackgroundColor(const gz::math::Color& color) { data_->renderer.setBackgroundColor(color); }
+void RenderWidget::setBackgroundColor(const gz::math::Color& color)
+{
+  data_->renderer.setBackgroundColor(color);
+  requestRender();
+}
 gz::math::Color RenderWidget::getBackgroundColor() const { return data_->renderer.getBackgroundColor(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setAmbientLight(const gz::math::Color& ambient) { data_->renderer.setAmbientLight(ambient); }
+void RenderWidget::setAmbientLight(const gz::math::Color& ambient)
+{
+  data_->renderer.setAmbientLight(ambient);
+  requestRender();
+}
 gz::math::Color RenderWidget::getAmbientLight() const { return data_->renderer.getAmbientLight(); }
 
 /////////////////////////////////////////////////
@@ -895,43 +1072,215 @@ const std::string& RenderWidget::getEngineName() const { return data_->renderer.
 /////////////////////////////////////////////////
 void RenderWidget::setSceneName(const std::string& name) { data_->renderer.setSceneName(name); }
 const std::string& RenderWidget::getSceneName() const { return data_->renderer.getSceneName(); }
+const std::string& RenderWidget::getCameraName() const { return data_->renderer.getCameraName(); }
 
 /////////////////////////////////////////////////
 void RenderWidget::setInitialCameraPose(const gz::math::Pose3d& pose) { data_->renderer.setInitialCameraPose(pose); }
 gz::math::Pose3d RenderWidget::getInitialCameraPose() const { return data_->renderer.getInitialCameraPose(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setCameraNearClip(double near) { data_->renderer.setCameraNearClipDistance(near); }
+void RenderWidget::setCameraNearClip(double near)
+{
+  data_->renderer.setCameraNearClipDistance(near);
+  requestRender();
+}
 double RenderWidget::getCameraNearClip() const { return data_->renderer.getCameraNearClipDistance(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setCameraFarClip(double far) { data_->renderer.setCameraFarClipDistance(far); }
+void RenderWidget::setCameraFarClip(double far)
+{
+  data_->renderer.setCameraFarClipDistance(far);
+  requestRender();
+}
 double RenderWidget::getCameraFarClip() const { return data_->renderer.getCameraFarClipDistance(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setCameraAntiAliasing(unsigned int value) { data_->renderer.setCameraAntiAliasing(value); }
+void RenderWidget::setCameraAntiAliasing(unsigned int value)
+{
+  data_->renderer.setCameraAntiAliasing(value);
+  requestRender();
+}
 unsigned int RenderWidget::getCameraAntiAliasing() const { return data_->renderer.getCameraAntiAliasing(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setSkyEnabled(bool enabled) { data_->renderer.setSkyEnabled(enabled); }
+void RenderWidget::setSkyEnabled(bool enabled)
+{
+  data_->renderer.setSkyEnabled(enabled);
+  requestRender();
+}
 bool RenderWidget::skyEnabled() const { return data_->renderer.skyEnabled(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setGridEnabled(bool enabled) { data_->renderer.setGridEnabled(enabled); }
+void RenderWidget::setGridEnabled(bool enabled)
+{
+  data_->renderer.setGridEnabled(enabled);
+  requestRender();
+}
 bool RenderWidget::gridEnabled() const { return data_->renderer.gridEnabled(); }
 
 /////////////////////////////////////////////////
-void RenderWidget::setShadowsEnabled(bool enabled) { data_->renderer.setShadowsEnabled(enabled); }
+void RenderWidget::setShadowsEnabled(bool enabled)
+{
+  data_->renderer.setShadowsEnabled(enabled);
+  requestRender();
+}
 bool RenderWidget::shadowsEnabled() const { return data_->renderer.shadowsEnabled(); }
 
 /////////////////////////////////////////////////
 void RenderWidget::setUpdateFrequency(double hz)
 {
-  data_->update_frequency = hz;
-  data_->update_timer.start(1000.0 / hz);
+  data_->update_frequency = std::isnan(hz) ? MIN_UPDATE_FREQUENCY : std::max(hz, MIN_UPDATE_FREQUENCY);
+  if (data_->render_mode == RenderMode::CONTINUOUS && !data_->suspended)
+    data_->update_timer.start(data_->frameInterval());
 }
 double RenderWidget::getUpdateFrequency() const { return data_->update_frequency; }
 
+/////////////////////////////////////////////////
+void RenderWidget::setRenderMode(RenderMode mode)
+{
+  data_->render_mode = mode;
+  if (mode == RenderMode::CONTINUOUS)
+  {
+    data_->update_timer.setSingleShot(false);
+    if (!data_->suspended)
+      data_->update_timer.start(data_->frameInterval());
+  }
+  else
+  {
+    data_->update_timer.stop();
+    data_->update_timer.setSingleShot(true);
+    requestRender();
+  }
+}
+RenderMode RenderWidget::getRenderMode() const { return data_->render_mode; }
+
+/////////////////////////////////////////////////
+void RenderWidget::setSuspended(bool suspended)
+{
+  if (data_->suspended == suspended)
+    return;
+
+  data_->suspended = suspended;
+  if (suspended)
+  {
+    data_->update_timer.stop();
+  }
+  else if (data_->render_mode == RenderMode::CONTINUOUS)
+  {
+    data_->update_timer.start(data_->frameInterval());
+  }
+  else
+  {
+    // A single frame shows the current state of the scene regardless of how many changes were missed
+    requestRender();
+  }
+}
+bool RenderWidget::isSuspended() const { return data_->suspended; }
+
+/////////////////////////////////////////////////
+RenderStatistics RenderWidget::getRenderStatistics() const
+{
+  RenderStatistics stats = data_->statistics;
+  const qint64 window_start = data_->clock.elapsed() - 1000;
+  stats.frame_rate = static_cast<double>(std::count_if(data_->frame_timestamps.begin(),
+                                                       data_->frame_timestamps.end(),
+                                                       [window_start](qint64 t) { return t > window_start; }));
+  return stats;
+}
+
+void RenderWidget::resetRenderStatistics()
+{
+  data_->statistics = RenderStatistics();
+  data_->frame_timestamps.clear();
+}
+
+/////////////////////////////////////////////////
+void RenderWidget::setScenePicker(std::shared_ptr<ScenePicker> picker)
+{
+  data_->scene_picker = std::move(picker);
+  if (data_->scene_picker != nullptr)
+    setMouseTracking(true);
+}
+
+std::shared_ptr<ScenePicker> RenderWidget::getScenePicker() const { return data_->scene_picker; }
+
+/////////////////////////////////////////////////
+void RenderWidget::pickOnScene(const gz::math::Vector2i& screen_pos, Qt::MouseButton button)
+{
+  gz::math::Vector3d origin;
+  gz::math::Vector3d direction;
+  if (!data_->renderer.getCameraRay(screen_pos, origin, direction))
+    return;
+
+  const Eigen::Vector3d eigen_origin(origin.X(), origin.Y(), origin.Z());
+  const Eigen::Vector3d eigen_direction(direction.X(), direction.Y(), direction.Z());
+  if (button != Qt::NoButton)
+  {
+    auto type = (button == Qt::LeftButton) ? events::PickOnScene::PickType::LEFT_CLICK :
+                                             events::PickOnScene::PickType::RIGHT_CLICK;
+
+    // Clicks are picked immediately so they are never coalesced with hover picks
+    events::PickOnScene event(data_->scene_picker->pickNow(eigen_origin, eigen_direction), type, getSceneName());
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  std::string scene_name = getSceneName();
+  auto callback = [scene_name, eigen_origin, eigen_direction](const PickResult& result) {
+    // Set point to be 10m away if no intersection found which is the same as the ray query
+    Eigen::Vector3d point = result.point;
+    if (result.type == PickResult::Type::NONE)
+      point = eigen_origin + (10 * eigen_direction);
+
+    // This is called on the picker thread so the events are posted to the main thread
+    QApplication::postEvent(qApp, new events::HoverToScene({ point.x(), point.y(), point.z() }, scene_name));
+    QApplication::postEvent(qApp, new events::PickOnScene(result, events::PickOnScene::PickType::HOVER, scene_name));
+  };
+  data_->scene_picker->pick(eigen_origin, eigen_direction, callback);
+}
+
+/////////////////////////////////////////////////
+void RenderWidget::requestRender() { requestRender(1); }
+
+void RenderWidget::requestRender(int frames)
+{
+  data_->pending_frames = std::max(data_->pending_frames, frames);
+  if (data_->render_mode == RenderMode::ON_DEMAND && !data_->suspended)
+    scheduleFrame();
+}
+
+void RenderWidget::scheduleFrame()
+{
+  if (data_->update_timer.isActive())
+    return;
+
+  // Cap the frame rate by delaying the frame until the frame interval has passed since the last frame
+  int delay{ 0 };
+  if (data_->last_frame_start >= 0)
+  {
+    const qint64 elapsed = data_->clock.elapsed() - data_->last_frame_start;
+    delay = std::max(0, data_->frameInterval() - static_cast<int>(elapsed));
+  }
+
+  data_->update_timer.start(delay);
+}
+
+/////////////////////////////////////////////////
+bool RenderWidget::eventFilter(QObject* obj, QEvent* event)
+{
+  // Custom events are registered above QEvent::User so everything else is skipped to keep this cheap
+  if (data_->render_mode == RenderMode::ON_DEMAND && !data_->rendering && event->type() >= QEvent::User &&
+      event->type() != events::EventType::PRE_RENDER && event->type() != events::EventType::RENDER)
+  {
+    auto* e = dynamic_cast<events::ComponentEvent*>(event);
+    if (e != nullptr && e->getComponentInfo() != nullptr &&
+        e->getComponentInfo()->getSceneName() == data_->renderer.getSceneName())
+      requestRender();
+  }
+
+  return QOpenGLWidget::eventFilter(obj, event);
+}
+
 /////////////////////////////////////////////////
 // void MinimalScene::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
 //{
@@ -1054,12 +1403,18 @@ double RenderWidget::getUpdateFrequency() const { return data_->update_frequency
 //}
 
 /////////////////////////////////////////////////
-void RenderWidget::onHovered(int mouse_x, int mouse_y) { data_->renderer.newHoverEvent({ mouse_x, mouse_y }); }
+void RenderWidget::onHovered(int mouse_x, int mouse_y)
+{
+  data_->renderer.newHoverEvent({ mouse_x, mouse_y });
+  if (data_->renderer.hoverEventEnabled())
+    requestRender(INPUT_FRAME_COUNT);
+}
 
 /////////////////////////////////////////////////
 void RenderWidget::onDropped(const QString& drop, int mouse_x, int mouse_y)
 {
   data_->renderer.newDropEvent(drop.toStdString(), { mouse_x, mouse_y });
+  requestRender(INPUT_FRAME_COUNT);
 }
 
 /////////////////////////////////////////////////
@@ -1068,8 +1423,13 @@ void RenderWidget::onFrameSwapped()
 {
   // Weird issue between QFileDialog and update being called, QFileDialogs are launched as application modality and this
   // check was added to prevent the issue.
+  if (data_->suspended)
+    return;
+
   if (QApplication::activeModalWidget() == nullptr)
     update();
+  else if (data_->render_mode == RenderMode::ON_DEMAND)
+    data_->update_timer.start(data_->frameInterval());
 }
 
 /////////////////////////////////////////////////
@@ -1079,6 +1439,7 @@ void RenderWidget::mousePressEvent(QMouseEvent* event)
   data_->mouseEvent.SetPressPos(data_->mouseEvent.Pos());
 
   data_->renderer.newMouseEvent(data_->mouseEvent);
+  requestRender(INPUT_FRAME_COUNT);
 }
 
 ////////////////////////////////////////////////
@@ -1113,6 +1474,11 @@ void RenderWidget::mouseReleaseEvent(QMouseEvent* event)
   data_->mouseEvent.SetDragging(dragging);
 
   data_->renderer.newMouseEvent(data_->mouseEvent);
+  requestRender(INPUT_FRAME_COUNT);
+
+  if (data_->scene_picker != nullptr && !dragging &&
+      (event->button() == Qt::LeftButton || event->button() == Qt::RightButton))
+    pickOnScene(data_->mouseEvent.Pos(), event->button());
 }
 
 ////////////////////////////////////////////////
@@ -1127,6 +1493,15 @@ void RenderWidget::mouseMoveEvent(QMouseEvent* event)
     data_->mouseEvent.SetPressPos(pressPos);
 
   data_->renderer.newMouseEvent(data_->mouseEvent);
+
+  // Hovering only requires a frame if there is no scene picker since the view control only reacts to drags
+  if (data_->scene_picker != nullptr && event->buttons() == Qt::NoButton)
+  {
+    pickOnScene(data_->mouseEvent.Pos(), Qt::NoButton);
+    return;
+  }
+
+  requestRender(INPUT_FRAME_COUNT);
 }
 
 ////////////////////////////////////////////////
@@ -1136,12 +1511,21 @@ void RenderWidget::wheelEvent(QWheelEvent* event)
 
   data_->mouseEvent = convert(*event);
   data_->renderer.newMouseEvent(data_->mouseEvent);
+  requestRender(INPUT_FRAME_COUNT);
 }
 
 ////////////////////////////////////////////////
-void RenderWidget::handleKeyPress(const gz::common::KeyEvent& event) { data_->renderer.handleKeyPress(event); }
+void RenderWidget::handleKeyPress(const gz::common::KeyEvent& event)
+{
+  data_->renderer.handleKeyPress(event);
+  requestRender(INPUT_FRAME_COUNT);
+}
 
 ////////////////////////////////////////////////
-void RenderWidget::handleKeyRelease(const gz::common::KeyEvent& event) { data_->renderer.handleKeyRelease(event); }
+void RenderWidget::handleKeyRelease(const gz::common::KeyEvent& event)
+{
+  data_->renderer.handleKeyRelease(event);
+  requestRender(INPUT_FRAME_COUNT);
+}
 
 }  // namespace tesseract::gui
@@ -0,0 +1,93 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/scene_pick_highlighter.h>
+#include <tesseract_qt/rendering/render_events.h>
+
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/common/events/status_log_events.h>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+ScenePickHighlighter::ScenePickHighlighter(std::shared_ptr<const ComponentInfo> component_info, QObject* parent)
+  : QObject(parent), component_info_(std::move(component_info))
+{
+  qApp->installEventFilter(this);
+}
+
+ScenePickHighlighter::~ScenePickHighlighter() = default;
+
+const std::string& ScenePickHighlighter::getHoveredLink() const { return hovered_link_; }
+
+const std::string& ScenePickHighlighter::getSelectedLink() const { return selected_link_; }
+
+void ScenePickHighlighter::setHighlight(const std::string& link_name)
+{
+  if (link_name.empty())
+    return;
+
+  const bool highlight = (link_name == hovered_link_ || link_name == selected_link_);
+  events::SceneGraphModifyLinkHighlight event(component_info_, { link_name }, highlight);
+  QApplication::sendEvent(qApp, &event);
+}
+
+bool ScenePickHighlighter::eventFilter(QObject* obj, QEvent* event)
+{
+  if (event->type() == events::EventType::PICK_ON_SCENE)
+  {
+    assert(dynamic_cast<events::PickOnScene*>(event) != nullptr);
+    auto* e = static_cast<events::PickOnScene*>(event);
+    if (e->getSceneName() == component_info_->getSceneName())
+    {
+      const PickResult& result = e->getResult();
+      const std::string link_name = (result.type == PickResult::Type::LINK) ? result.link_name : std::string();
+      if (e->getPickType() == events::PickOnScene::PickType::HOVER && link_name != hovered_link_)
+      {
+        std::string previous = std::move(hovered_link_);
+        hovered_link_ = link_name;
+        setHighlight(previous);
+        setHighlight(hovered_link_);
+      }
+      else if (e->getPickType() == events::PickOnScene::PickType::LEFT_CLICK && link_name != selected_link_)
+      {
+        std::string previous = std::move(selected_link_);
+        selected_link_ = link_name;
+        setHighlight(previous);
+        setHighlight(selected_link_);
+
+        if (!selected_link_.empty())
+        {
+          events::StatusLogInfo status_event(QString("Selected link '%1'").arg(QString::fromStdString(selected_link_)));
+          QApplication::sendEvent(qApp, &status_event);
+        }
+      }
+    }
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+}  // namespace tesseract::gui
@@ -0,0 +1,447 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2026 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/rendering/scene_picker.h>
+#include <tesseract_qt/common/component_info.h>
+#include <tesseract_qt/common/events/component_events.h>
+#include <tesseract_qt/common/events/scene_graph_events.h>
+#include <tesseract_qt/common/events/tool_path_events.h>
+#include <tesseract_qt/common/tool_path.h>
+#include <tesseract_qt/common/link_visibility.h>
+#include <tesseract_qt/common/environment_manager.h>
+#include <tesseract_qt/common/environment_wrapper.h>
+
+#include <tesseract/environment/environment.h>
+
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/scene_graph/link.h>
+#include <tesseract/scene_graph/scene_state.h>
+
+#include <boost/uuid/uuid_io.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include <QApplication>
+
+namespace tesseract::gui
+{
+namespace
+{
+std::string getToolPathKey(const boost::uuids::uuid& uuid) { return "tool_path::" + boost::uuids::to_string(uuid); }
+}  // namespace
+
+struct ScenePicker::Implementation
+{
+  std::shared_ptr<const ComponentInfo> component_info;
+
+  /** @brief The scene graph provided by the last scene graph set event used for recursive link removal */
+  std::shared_ptr<const tesseract::scene_graph::SceneGraph> scene_graph;
+
+  /** @brief The scene which is only accessed from the main thread */
+  PickingScene scene;
+
+  /** @brief True if the scene has changed since the last snapshot */
+  bool scene_dirty{ false };
+
+  /** @brief The latest link transforms */
+  tesseract::common::TransformMap link_transforms;
+
+  /** @brief The names of the links with an instance */
+  std::unordered_set<std::string> link_names;
+
+  /** @brief The working frame of each tool path keyed by instance key */
+  std::unordered_map<std::string, std::string> tool_path_frames;
+
+  /** @brief The hidden links, a link is hidden if either the link or its visuals are hidden */
+  std::unordered_set<std::string> hidden_links;
+  std::unordered_set<std::string> hidden_visuals;
+
+  double tool_path_pose_radius{ 0.01 };
+
+  /** @brief Guards the snapshot and the pending request shared with the worker thread */
+  std::mutex mutex;
+  std::condition_variable cv;
+  PickingScene::ConstPtr snapshot{ std::make_shared<const PickingScene>() };
+
+  struct Request
+  {
+    Eigen::Vector3d origin;
+    Eigen::Vector3d direction;
+    Callback callback;
+  };
+  std::unique_ptr<Request> request;
+  bool stop{ false };
+  std::thread worker;
+
+  void run()
+  {
+    while (true)
+    {
+      std::unique_ptr<Request> current;
+      PickingScene::ConstPtr scene_snapshot;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return stop || request != nullptr; });
+        if (stop)
+          return;
+
+        current = std::move(request);
+        scene_snapshot = snapshot;
+      }
+
+      PickResult result = scene_snapshot->pick(current->origin, current->direction);
+      if (current->callback)
+        current->callback(result);
+    }
+  }
+
+  /** @brief Publish a snapshot of the scene if it changed, must be called from the main thread */
+  PickingScene::ConstPtr publish()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (scene_dirty)
+    {
+      scene.update();
+      snapshot = std::make_shared<const PickingScene>(scene);
+      scene_dirty = false;
+    }
+    return snapshot;
+  }
+
+  Eigen::Isometry3d getFramePose(const std::string& frame) const
+  {
+    auto it = link_transforms.find(frame);
+    if (it != link_transforms.end())
+      return it->second;
+
+    return Eigen::Isometry3d::Identity();
+  }
+
+  void addLink(const tesseract::scene_graph::Link& link)
+  {
+    auto mesh = createPickingMesh(link);
+    if (mesh->empty())
+    {
+      scene.removeInstance(link.getName());
+      link_names.erase(link.getName());
+      return;
+    }
+
+    auto info = std::make_shared<PickingScene::InstanceInfo>();
+    info->type = PickResult::Type::LINK;
+    info->mesh = mesh;
+    info->link_name = link.getName();
+    info->visual_names.reserve(link.visual.size());
+    for (const auto& visual : link.visual)
+      info->visual_names.push_back(visual->name);
+
+    scene.setInstance(link.getName(), info, getFramePose(link.getName()));
+    link_names.insert(link.getName());
+    updateLinkVisibility(link.getName());
+  }
+
+  void removeLink(const std::string& link_name, bool recursive)
+  {
+    if (recursive && scene_graph != nullptr && scene_graph->getLink(link_name) != nullptr)
+    {
+      for (const auto& child_name : scene_graph->getLinkChildrenNames(link_name))
+      {
+        scene.removeInstance(child_name);
+        link_names.erase(child_name);
+      }
+    }
+
+    scene.removeInstance(link_name);
+    link_names.erase(link_name);
+  }
+
+  void removeAllLinks()
+  {
+    for (const auto& link_name : link_names)
+      scene.removeInstance(link_name);
+
+    link_names.clear();
+  }
+
+  void updateLinkVisibility(const std::string& link_name)
+  {
+    const bool visible = (hidden_links.count(link_name) == 0 && hidden_visuals.count(link_name) == 0);
+    scene.setVisible(link_name, visible);
+  }
+
+  void setLinkVisibility(const std::string& link_name, LinkVisibilityFlags flags, bool visible)
+  {
+    const bool all = (flags & LinkVisibilityFlags::ALL);
+    if (all || (flags & LinkVisibilityFlags::LINK))
+    {
+      if (visible)
+        hidden_links.erase(link_name);
+      else
+        hidden_links.insert(link_name);
+    }
+
+    if (all || (flags & LinkVisibilityFlags::VISUAL))
+    {
+      if (visible)
+        hidden_visuals.erase(link_name);
+      else
+        hidden_visuals.insert(link_name);
+    }
+
+    updateLinkVisibility(link_name);
+  }
+
+  void addToolPath(const ToolPath& tool_path)
+  {
+    auto mesh = std::make_shared<PickingMesh>();
+    auto info = std::make_shared<PickingScene::InstanceInfo>();
+    info->type = PickResult::Type::TOOL_PATH_POSE;
+    info->tool_path_uuid = tool_path.getUUID();
+
+    const Eigen::Vector3d dimensions(tool_path_pose_radius, 0, 0);
+    for (const auto& segment : tool_path)
+    {
+      for (const auto& pose : segment)
+      {
+        mesh->addShape(PickingMesh::ShapeType::SPHERE,
+                       pose.getTransform(),
+                       dimensions,
+                       static_cast<int>(info->pose_uuids.size()));
+        info->pose_uuids.emplace_back(segment.getUUID(), pose.getUUID());
+      }
+    }
+
+    const std::string key = getToolPathKey(tool_path.getUUID());
+    if (mesh->empty())
+    {
+      scene.removeInstance(key);
+      tool_path_frames.erase(key);
+      return;
+    }
+
+    mesh->build();
+    info->mesh = mesh;
+    tool_path_frames[key] = tool_path.getWorkingFrame();
+    scene.setInstance(key, info, getFramePose(tool_path.getWorkingFrame()));
+  }
+
+  void removeAllToolPaths()
+  {
+    for (const auto& tool_path : tool_path_frames)
+      scene.removeInstance(tool_path.first);
+
+    tool_path_frames.clear();
+  }
+
+  void setState(const tesseract::scene_graph::SceneState& state)
+  {
+    link_transforms = state.link_transforms;
+    scene.setPoses(link_transforms);
+
+    if (!tool_path_frames.empty())
+    {
+      tesseract::common::TransformMap tool_path_poses;
+      for (const auto& tool_path : tool_path_frames)
+        tool_path_poses[tool_path.first] = getFramePose(tool_path.second);
+
+      scene.setPoses(tool_path_poses);
+    }
+  }
+};
+
+ScenePicker::ScenePicker(std::shared_ptr<const ComponentInfo> component_info, QObject* parent)
+  : QObject(parent), data_(std::make_unique<Implementation>())
+{
+  data_->component_info = std::move(component_info);
+
+  // Load the environment if it was created before the picker, the same as the scene graph render manager
+  for (const auto& env_wrapper : EnvironmentManager::getAll())
+  {
+    if (env_wrapper.first == data_->component_info || env_wrapper.first->isParent(data_->component_info))
+    {
+      auto env = env_wrapper.second->getEnvironment();
+      if (env != nullptr && env->isInitialized())
+      {
+        data_->scene_graph = env->getSceneGraph()->clone();
+        for (const auto& link : data_->scene_graph->getLinks())
+          data_->addLink(*link);
+
+        data_->setState(env->getState());
+        data_->scene_dirty = true;
+      }
+    }
+  }
+
+  data_->worker = std::thread([this]() { data_->run(); });
+
+  qApp->installEventFilter(this);
+}
+
+ScenePicker::~ScenePicker()
+{
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->stop = true;
+  }
+  data_->cv.notify_all();
+  data_->worker.join();
+}
+
+std::shared_ptr<const ComponentInfo> ScenePicker::getComponentInfo() const { return data_->component_info; }
+
+void ScenePicker::setToolPathPoseRadius(double radius) { data_->tool_path_pose_radius = radius; }
+
+double ScenePicker::getToolPathPoseRadius() const { return data_->tool_path_pose_radius; }
+
+void ScenePicker::pick(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, Callback callback)
+{
+  data_->publish();
+
+  auto request = std::make_unique<Implementation::Request>();
+  request->origin = origin;
+  request->direction = direction;
+  request->callback = std::move(callback);
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->request = std::move(request);
+  }
+  data_->cv.notify_one();
+}
+
+PickResult ScenePicker::pickNow(const Eigen::Vector3d& origin, const Eigen::Vector3d& direction)
+{
+  return data_->publish()->pick(origin, direction);
+}
+
+PickingScene::ConstPtr ScenePicker::getScene() { return data_->publish(); }
+
+bool ScenePicker::eventFilter(QObject* obj, QEvent* event)
+{
+  if (event->type() < QEvent::User)
+    return QObject::eventFilter(obj, event);
+
+  auto* e = dynamic_cast<events::ComponentEvent*>(event);
+  if (e == nullptr || e->getComponentInfo() == nullptr ||
+      (e->getComponentInfo() != data_->component_info && !e->getComponentInfo()->isParent(data_->component_info)))
+    return QObject::eventFilter(obj, event);
+
+  bool changed{ true };
+  if (event->type() == events::EventType::SCENE_GRAPH_CLEAR)
+  {
+    data_->scene_graph = nullptr;
+    data_->hidden_links.clear();
+    data_->hidden_visuals.clear();
+    data_->link_names.clear();
+    data_->tool_path_frames.clear();
+    data_->scene.clear();
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_SET)
+  {
+    auto& ev = static_cast<events::SceneGraphSet&>(*event);
+    data_->removeAllLinks();
+    data_->scene_graph = ev.getSceneGraph();
+    for (const auto& link : data_->scene_graph->getLinks())
+      data_->addLink(*link);
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_ADD_LINK)
+  {
+    auto& ev = static_cast<events::SceneGraphAddLink&>(*event);
+    data_->addLink(*ev.getLink());
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_REMOVE_LINK)
+  {
+    auto& ev = static_cast<events::SceneGraphRemoveLink&>(*event);
+    data_->removeLink(ev.getLinkName(), ev.isRecursive());
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY)
+  {
+    auto& ev = static_cast<events::SceneGraphModifyLinkVisibility&>(*event);
+    for (const auto& link_name : ev.getLinkNames())
+      data_->setLinkVisibility(link_name, ev.getVisibilityFlags(), ev.visible());
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_MODIFY_LINK_VISIBILITY_ALL)
+  {
+    auto& ev = static_cast<events::SceneGraphModifyLinkVisibilityALL&>(*event);
+    if (data_->scene_graph != nullptr)
+    {
+      for (const auto& link : data_->scene_graph->getLinks())
+        data_->setLinkVisibility(link->getName(), ev.getVisibilityFlags(), ev.visible());
+    }
+  }
+  else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
+  {
+    auto& ev = static_cast<events::SceneStateChanged&>(*event);
+    data_->setState(ev.getState());
+  }
+  else if (event->type() == events::EventType::TOOL_PATH_ADD)
+  {
+    auto& ev = static_cast<events::ToolPathAdd&>(*event);
+    data_->addToolPath(ev.getToolPath());
+  }
+  else if (event->type() == events::EventType::TOOL_PATH_REMOVE)
+  {
+    auto& ev = static_cast<events::ToolPathRemove&>(*event);
+    const std::string key = getToolPathKey(ev.getUUID());
+    data_->scene.removeInstance(key);
+    data_->tool_path_frames.erase(key);
+  }
+  else if (event->type() == events::EventType::TOOL_PATH_REMOVE_ALL)
+  {
+    data_->removeAllToolPaths();
+  }
+  else if (event->type() == events::EventType::TOOL_PATH_HIDE || event->type() == events::EventType::TOOL_PATH_SHOW)
+  {
+    // Only the visibility of whole tool paths is tracked since the meshes are immutable
+    const bool show = (event->type() == events::EventType::TOOL_PATH_SHOW);
+    const auto& uuid = show ? static_cast<events::ToolPathShow&>(*event).getUUID() :
+                              static_cast<events::ToolPathHide&>(*event).getUUID();
+    const auto& child_uuid = show ? static_cast<events::ToolPathShow&>(*event).getChildUUID() :
+                                    static_cast<events::ToolPathHide&>(*event).getChildUUID();
+    if (child_uuid.is_nil())
+      data_->scene.setVisible(getToolPathKey(uuid), show);
+  }
+  else if (event->type() == events::EventType::TOOL_PATH_HIDE_ALL ||
+           event->type() == events::EventType::TOOL_PATH_SHOW_ALL)
+  {
+    const bool show = (event->type() == events::EventType::TOOL_PATH_SHOW_ALL);
+    for (const auto& tool_path : data_->tool_path_frames)
+      data_->scene.setVisible(tool_path.first, show);
+  }
+  else
+  {
+    changed = false;
+  }
+
+  if (changed)
+  {
+    std::unique_lock<std::mutex> lock(data_->mutex);
+    data_->scene_dirty = true;
+  }
+
+  // Standard event processing
+  return QObject::eventFilter(obj, event);
+}
+
+}  // namespace tesseract::gui
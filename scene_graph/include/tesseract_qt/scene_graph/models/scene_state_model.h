@@ -47,6 +47,14 @@ public:
 
   std::shared_ptr<const ComponentInfo> getComponentInfo() const;
 
+  /**
+   * @brief Suspend updates, for example while the views of the model are hidden
+   * @details While suspended only the latest state received is kept and it is applied once resumed
+   * @param suspended True to suspend, false to resume
+   */
+  void setSuspended(bool suspended);
+  bool isSuspended() const;
+
   // Caution when using methods below. In most cases you should use application events.
   void setState(const tesseract::scene_graph::SceneState& scene_state);
   void clear();
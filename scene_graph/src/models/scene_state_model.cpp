@@ -30,6 +30,7 @@
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/environment_manager.h>
 #include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/tracing.h>
 
 #include <tesseract/scene_graph/scene_state.h>
 #include <tesseract/environment/environment.h>
@@ -54,6 +55,12 @@ struct SceneStateModel::Implementation
   std::unordered_map<std::string, TransformStandardItem*> links;
   std::unordered_map<std::string, TransformStandardItem*> joints;
 
+  /** @brief True while suspended */
+  bool suspended{ false };
+
+  /** @brief The latest state received while suspended */
+  std::unique_ptr<tesseract::scene_graph::SceneState> pending_state;
+
   void clear()
   {
     link_names.clear();
@@ -103,8 +110,21 @@ SceneStateModel& SceneStateModel::operator=(const SceneStateModel& other) { retu
 
 std::shared_ptr<const ComponentInfo> SceneStateModel::getComponentInfo() const { return data_->component_info; }
 
+void SceneStateModel::setSuspended(bool suspended)
+{
+  data_->suspended = suspended;
+  if (!suspended && data_->pending_state != nullptr)
+  {
+    std::unique_ptr<tesseract::scene_graph::SceneState> state = std::move(data_->pending_state);
+    setState(*state);
+  }
+}
+
+bool SceneStateModel::isSuspended() const { return data_->suspended; }
+
 void SceneStateModel::setState(const tesseract::scene_graph::SceneState& scene_state)
 {
+  TESSERACT_QT_TRACE_ZONE("SceneStateModel::setState");
   bool sort_required{ false };
 
   std::vector<std::string> joint_names_value;
@@ -273,14 +293,24 @@ bool SceneStateModel::eventFilter(QObject* obj, QEvent* event)
     assert(dynamic_cast<events::SceneGraphClear*>(event) != nullptr);
     auto* e = static_cast<events::SceneGraphClear*>(event);
     if (e->getComponentInfo() == data_->component_info)
+    {
+      data_->pending_state = nullptr;
       clear();
+    }
   }
   else if (event->type() == events::EventType::SCENE_GRAPH_STATE_CHANGED)
   {
     assert(dynamic_cast<events::SceneStateChanged*>(event) != nullptr);
     auto* e = static_cast<events::SceneStateChanged*>(event);
     if (e->getComponentInfo() == data_->component_info)
-      setState(e->getState());
+    {
+      if (!data_->suspended)
+        setState(e->getState());
+      else if (data_->pending_state == nullptr)
+        data_->pending_state = std::make_unique<tesseract::scene_graph::SceneState>(e->getState());
+      else
+        *data_->pending_state = e->getState();
+    }
   }
 
   // Standard event processing
@@ -39,13 +39,10 @@
 #include <tesseract_qt/kinematic_groups/models/group_joint_states_model.h>
 #include <tesseract_qt/kinematic_groups/models/group_tcps_model.h>
 
-#include <tesseract_qt/common/events/group_tcps_events.h>
-#include <tesseract_qt/common/events/group_joint_states_events.h>
-#include <tesseract_qt/common/events/kinematic_groups_events.h>
-#include <tesseract_qt/common/events/allowed_collision_matrix_events.h>
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+#include <tesseract_qt/common/background_loader.h>
 #include <tesseract_qt/common/component_info.h>
-#include <tesseract_qt/common/environment_manager.h>
-#include <tesseract_qt/common/environment_wrapper.h>
+#include <tesseract_qt/common/environment_loader.h>
 
 namespace tesseract::gui
 {
@@ -68,6 +65,10 @@ struct SRDFEditorWidget::Implementation
 
   /** @brief The current environment */
   tesseract::environment::Environment::Ptr env;
+
+  /** @brief Parses the URDF/SRDF and initializes the environment on a worker thread */
+  std::unique_ptr<BackgroundLoader> loader;
+  std::unique_ptr<LoaderProgressDialog> loader_dialog;
 };
 
 SRDFEditorWidget::SRDFEditorWidget(std::shared_ptr<tesseract::common::ResourceLocator> locator, QWidget* parent)
@@ -91,6 +92,16 @@ SRDFEditorWidget::SRDFEditorWidget(std::shared_ptr<const ComponentInfo> componen
 
   ui_->toolBox->setCurrentIndex(0);
 
+  data_->loader = std::make_unique<BackgroundLoader>();
+  data_->loader_dialog = std::make_unique<LoaderProgressDialog>(data_->loader.get(), this);
+  connect(data_->loader.get(),
+          &BackgroundLoader::finished,
+          this,
+          [this](const QString& /*name*/, bool success, const QString& /*message*/) {
+            if (!success)
+              Q_EMIT showStatusMessage("Failed to parse URDF/SRDF!", 2000);
+          });
+
   /** @todo Add validators to kinematic group editor widget */
 
   connect(ui_->urdf_browse_button, SIGNAL(clicked()), this, SLOT(onBrowseURDFLoadClicked()));
@@ -108,60 +119,38 @@ SRDFEditorWidget::~SRDFEditorWidget() {}
 void SRDFEditorWidget::onLoad(const QString& urdf_filepath, const QString& srdf_filepath)
 {
   Q_EMIT showStatusMessage("Parsing URDF/SRDF!", 0);
-  this->data_->env = std::make_shared<tesseract::environment::Environment>();
+  enablePages(false);
+
   this->data_->urdf_filepath =
       QString::fromStdString(this->data_->locator->locateResource(urdf_filepath.toStdString())->getFilePath());
-  bool loaded = false;
-  if (srdf_filepath.toStdString().empty())
-  {
-    loaded =
-        this->data_->env->init(std::filesystem::path(this->data_->urdf_filepath.toStdString()), this->data_->locator);
-  }
-  else
+
+  std::filesystem::path srdf_path;
+  if (!srdf_filepath.toStdString().empty())
   {
     this->data_->srdf_filepath =
         QString::fromStdString(this->data_->locator->locateResource(srdf_filepath.toStdString())->getFilePath());
-    loaded = this->data_->env->init(std::filesystem::path(this->data_->urdf_filepath.toStdString()),
-                                    std::filesystem::path(this->data_->srdf_filepath.toStdString()),
-                                    this->data_->locator);
-
-    // Store the base srdf model
-    if (loaded)
-      this->data_->srdf_model.initFile(
-          *(this->data_->env->getSceneGraph()), this->data_->srdf_filepath.toStdString(), *(this->data_->locator));
-  }
-
-  if (!loaded)
-  {
-    Q_EMIT showStatusMessage("Failed to parse URDF/SRDF!", 2000);
-    enablePages(false);
-    return;
-  }
-
-  if (this->data_->env)
-  {
-    // Remove existing environment wrapper
-    EnvironmentManager::remove(data_->component_info);
-
-    events::AllowedCollisionMatrixClear clear_acm_event(data_->component_info);
-    QApplication::sendEvent(qApp, &clear_acm_event);
-
-    events::KinematicGroupsClear clear_kin_groups_event(data_->component_info);
-    QApplication::sendEvent(qApp, &clear_kin_groups_event);
-
-    events::GroupJointStatesClear clear_group_joint_states_event(data_->component_info);
-    QApplication::sendEvent(qApp, &clear_group_joint_states_event);
-    //    this->data_->user_tcp_model.clear();
-    //    this->data_->opw_kinematics_model.clear();
-
-    auto env_wrapper = std::make_shared<DefaultEnvironmentWrapper>(data_->component_info, data_->env);
-    EnvironmentManager::set(env_wrapper);
-
-    ui_->toolBox->setCurrentIndex(1);
+    srdf_path = std::filesystem::path(this->data_->srdf_filepath.toStdString());
   }
 
-  Q_EMIT showStatusMessage("Successfully parsed URDF/SRDF!", 2000);
-  enablePages(this->data_->env != nullptr);
+  // The environment is parsed on a worker thread, registering it replaces the existing environment wrapper which
+  // clears the ACM, kinematic groups and group states.
+  loadEnvironmentAsync(*data_->loader,
+                       data_->component_info,
+                       std::filesystem::path(this->data_->urdf_filepath.toStdString()),
+                       srdf_path,
+                       data_->locator,
+                       [this, srdf_path](std::shared_ptr<tesseract::environment::Environment> env) {
+                         this->data_->env = std::move(env);
+
+                         // Store the base srdf model
+                         if (!srdf_path.empty())
+                           this->data_->srdf_model.initFile(
+                               *(this->data_->env->getSceneGraph()), srdf_path.string(), *(this->data_->locator));
+
+                         ui_->toolBox->setCurrentIndex(1);
+                         Q_EMIT showStatusMessage("Successfully parsed URDF/SRDF!", 2000);
+                         enablePages(true);
+                       });
 }
 
 void SRDFEditorWidget::onLoad() { onLoad(data_->urdf_filepath, data_->srdf_filepath); }
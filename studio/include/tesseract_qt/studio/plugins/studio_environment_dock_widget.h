@@ -47,6 +47,10 @@ public:
 public Q_SLOTS:
   void onInitialize() override;
 
+protected:
+  void onSuspend() override;
+  void onResume() override;
+
 private:
   struct Implementation;
   std::unique_ptr<Implementation> data_;
@@ -77,8 +77,11 @@ private:
    * @details This looks for studio plugin info. If not found nullptr is returned.
    * @param name The name
    * @param plugin_info The plugin information to create task composer executor object
+   * @param defer_config If true the config is only loaded once the dock widget is first shown
    */
-  StudioDockWidget* createDockWidget(const QString& name, const tesseract::common::PluginInfo& plugin_info);
+  StudioDockWidget* createDockWidget(const QString& name,
+                                     const tesseract::common::PluginInfo& plugin_info,
+                                     bool defer_config = false);
 
   /**
    * @brief Add the dock widget to the manager
@@ -24,6 +24,7 @@
 #define TESSERACT_QT_STUDIO_STUDIO_DOCK_WIDGET_H
 
 #ifndef Q_MOC_RUN
+#include <memory>
 #include <string>
 #if __has_include(<qtadvanceddocking/DockManager.h>)
 #include <qtadvanceddocking/DockAreaWidget.h>
@@ -57,6 +58,7 @@ public:
    * Use the layoutFlags to configure the layout of the dock widget.
    */
   StudioDockWidget(const QString& title, QWidget* parent = nullptr);
+  ~StudioDockWidget() override;
 
   /**
    * @brief Get the class name
@@ -76,6 +78,31 @@ public:
    */
   virtual YAML::Node getConfig() const = 0;
 
+  /**
+   * @brief Defer loading the plugin config until the dock widget is first shown
+   * @details Creating the content of a dock widget can be expensive, for example a render widget creates a render
+   * engine and models copy the environment. Dock widgets which are not visible in the restored layout are only created
+   * once shown.
+   * @param config The yaml config
+   */
+  void setDeferredConfig(const YAML::Node& config);
+
+  /**
+   * @brief Check if loading the plugin config is deferred
+   * @return True if the config is loaded once the dock widget is shown, otherwise false
+   */
+  bool isConfigDeferred() const;
+
+  /**
+   * @brief Get the deferred plugin config
+   * @details This should be used instead of getConfig() while the config is deferred
+   * @return The yaml config
+   */
+  const YAML::Node& getDeferredConfig() const;
+
+  /** @brief Load the deferred plugin config now, does nothing if it is not deferred */
+  void loadDeferredConfig();
+
   /**
    * @brief Set name associated with the plugin
    * @param name The name to assign to the plugin
@@ -100,11 +127,38 @@ public:
    */
   virtual bool isInitialized() const;
 
+  /**
+   * @brief Check if the widget is suspended
+   * @details A dock widget is suspended while it is hidden, for example when it is tabbed away, closed or part of an
+   * inactive perspective.
+   * @return True if suspended, otherwise false
+   */
+  bool isSuspended() const;
+
 public Q_SLOTS:
   virtual void onInitialize();
 
 protected:
   bool assign_as_central_widget_{ false };
+
+  /**
+   * @brief Called when the dock widget is hidden
+   * @details Override to pause rendering and defer model updates until the dock widget is shown again
+   */
+  virtual void onSuspend();
+
+  /**
+   * @brief Called when a suspended dock widget is shown
+   * @details Override to resume rendering and catch up on the updates deferred while suspended
+   */
+  virtual void onResume();
+
+private Q_SLOTS:
+  void onVisibilityChanged(bool visible);
+
+private:
+  bool suspended_{ false };
+  std::unique_ptr<YAML::Node> deferred_config_;
 };
 
 }  // namespace tesseract::gui
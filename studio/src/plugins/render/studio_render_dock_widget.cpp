@@ -26,15 +26,13 @@
 
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/component_info_manager.h>
-#include <tesseract_qt/common/entity_manager.h>
 #include <tesseract_qt/common/icon_utils.h>
 
 #include <tesseract_qt/common/widgets/load_environment_dialog.h>
 
 #include <tesseract_qt/rendering/render_widget.h>
-#include <tesseract_qt/rendering/ign_scene_graph_render_manager.h>
-#include <tesseract_qt/rendering/ign_tool_path_render_manager.h>
-#include <tesseract_qt/rendering/ign_contact_results_render_manager.h>
+#include <tesseract_qt/rendering/ign_shared_scene.h>
+#include <tesseract_qt/rendering/scene_picker.h>
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -47,17 +45,15 @@ namespace tesseract::gui
 struct StudioRenderDockWidget::Implementation
 {
   std::shared_ptr<const ComponentInfo> component_info;
-  EntityManager::Ptr entity_manager;
   RenderWidget* render_widget{ nullptr };
-  std::unique_ptr<IgnSceneGraphRenderManager> scene_graph_manager;
-  std::unique_ptr<IgnToolPathRenderManager> tool_path_manager;
-  std::unique_ptr<IgnContactResultsRenderManager> contact_results_manager;
+
+  /** @brief The render managers, shared with the other docks rendering the same component info */
+  IgnSharedScene::Ptr shared_scene;
 };
 
 StudioRenderDockWidget::StudioRenderDockWidget(const QString& title, QWidget* parent)
   : StudioDockWidget(title, parent), data_(std::make_unique<Implementation>())
 {
-  data_->entity_manager = std::make_shared<EntityManager>();
 }
 
 StudioRenderDockWidget::~StudioRenderDockWidget() = default;
@@ -101,13 +97,26 @@ void StudioRenderDockWidget::loadConfig(const YAML::Node& config)
   if (const YAML::Node& n = config["show_shadows"])  // NOLINT
     data_->render_widget->setShadowsEnabled(n.as<bool>());
 
-  data_->scene_graph_manager =
-      std::make_unique<IgnSceneGraphRenderManager>(data_->component_info, data_->entity_manager);
-  data_->tool_path_manager = std::make_unique<IgnToolPathRenderManager>(data_->component_info, data_->entity_manager);
-  data_->contact_results_manager = std::make_unique<IgnContactResultsRenderManager>(data_->component_info);
+  if (const YAML::Node& n = config["render_mode"])  // NOLINT
+  {
+    const auto mode = n.as<std::string>();
+    if (mode == toString(RenderMode::CONTINUOUS))
+      data_->render_widget->setRenderMode(RenderMode::CONTINUOUS);
+    else if (mode == toString(RenderMode::ON_DEMAND))
+      data_->render_widget->setRenderMode(RenderMode::ON_DEMAND);
+    else
+      throw std::runtime_error("StudioRenderDockWidget, config 'render_mode' is invalid.");
+  }
+
+  if (const YAML::Node& n = config["update_frequency"])  // NOLINT
+    data_->render_widget->setUpdateFrequency(n.as<double>());
+
+  data_->shared_scene = IgnSharedScene::get(data_->component_info);
+  data_->render_widget->setScenePicker(data_->shared_scene->getScenePicker());
 
   setWidget(data_->render_widget);
   setFeature(ads::CDockWidget::DockWidgetFocusable, true);
+  data_->render_widget->setSuspended(isSuspended());
 }
 
 YAML::Node StudioRenderDockWidget::getConfig() const
@@ -119,6 +128,8 @@ YAML::Node StudioRenderDockWidget::getConfig() const
   config_node["show_sky"] = data_->render_widget->skyEnabled();
   config_node["show_grid"] = data_->render_widget->gridEnabled();
   config_node["show_shadows"] = data_->render_widget->shadowsEnabled();
+  config_node["render_mode"] = toString(data_->render_widget->getRenderMode());
+  config_node["update_frequency"] = data_->render_widget->getUpdateFrequency();
   config_node["central_widget"] = assign_as_central_widget_;
 
   return config_node;
@@ -143,13 +154,15 @@ void StudioRenderDockWidget::onInitialize()
     data_->render_widget->setGridEnabled(dialog.gridEnabled());
     data_->render_widget->setShadowsEnabled(dialog.shadowsEnabled());
 
-    data_->scene_graph_manager =
-        std::make_unique<IgnSceneGraphRenderManager>(data_->component_info, data_->entity_manager);
-    data_->tool_path_manager = std::make_unique<IgnToolPathRenderManager>(data_->component_info, data_->entity_manager);
-    data_->contact_results_manager = std::make_unique<IgnContactResultsRenderManager>(data_->component_info);
+    data_->shared_scene = IgnSharedScene::get(data_->component_info);
+    data_->render_widget->setScenePicker(data_->shared_scene->getScenePicker());
 
     setWidget(data_->render_widget);
     setFeature(ads::CDockWidget::DockWidgetFocusable, true);
+    data_->render_widget->setSuspended(isSuspended());
   }
 }
+
+void StudioRenderDockWidget::onSuspend() { data_->render_widget->setSuspended(true); }
+void StudioRenderDockWidget::onResume() { data_->render_widget->setSuspended(false); }
 }  // namespace tesseract::gui
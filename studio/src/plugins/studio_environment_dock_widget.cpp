@@ -124,5 +124,9 @@ void StudioEnvironmentDockWidget::setup()
   setToolBar(data_->tool_bar);
   toolBar()->setIconSize(QSize(25, 25));
   setFeature(ads::CDockWidget::DockWidgetFocusable, true);
+  data_->widget->setSuspended(isSuspended());
 }
+
+void StudioEnvironmentDockWidget::onSuspend() { data_->widget->setSuspended(true); }
+void StudioEnvironmentDockWidget::onResume() { data_->widget->setSuspended(false); }
 }  // namespace tesseract::gui
@@ -23,12 +23,14 @@
 
 #include <tesseract_qt/studio/studio_dock_widget_factory.h>
 #include <tesseract_qt/studio/plugins/manipulation/studio_manipulation_dock_widget.h>
+#include <tesseract_qt/studio/plugins/manipulation/studio_reachability_map_dock_widget.h>
 #include <tesseract_qt/studio/plugins/render/studio_render_dock_widget.h>
 #include <tesseract_qt/studio/plugins/studio_environment_dock_widget.h>
 #include <tesseract_qt/studio/plugins/studio_joint_trajectory_dock_widget.h>
 #include <tesseract_qt/studio/plugins/studio_status_log_dock_widget.h>
 #include <tesseract_qt/studio/plugins/studio_task_composer_dock_widget.h>
 #include <tesseract_qt/studio/plugins/studio_tool_path_dock_widget.h>
+#include <tesseract_qt/studio/plugins/studio_trace_dock_widget.h>
 
 namespace tesseract::gui
 {
@@ -37,8 +39,10 @@ using StudioEnvironmentDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioEnv
 using StudioJointTrajectoryDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioJointTrajectoryDockWidget>;
 using StudioStatusLogDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioStatusLogDockWidget>;
 using StudioManipulationDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioManipulationDockWidget>;
+using StudioReachabilityMapDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioReachabilityMapDockWidget>;
 using StudioTaskComposerDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioTaskComposerDockWidget>;
 using StudioToolPathDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioToolPathDockWidget>;
+using StudioTraceDockWidgetFactory = StudioDockWidgetFactoryImpl<StudioTraceDockWidget>;
 }  // namespace tesseract::gui
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -57,8 +61,15 @@ TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioStatusLogDockWidgetFactory, St
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioManipulationDockWidgetFactory, StudioManipulationDockWidgetFactory)
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioReachabilityMapDockWidgetFactory,
+                            StudioReachabilityMapDockWidgetFactory)
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioTaskComposerDockWidgetFactory, StudioTaskComposerDockWidgetFactory)
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioToolPathDockWidgetFactory, StudioToolPathDockWidgetFactory)
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_STUDIO_PLUGIN(tesseract::gui::StudioTraceDockWidgetFactory, StudioTraceDockWidgetFactory)
@@ -0,0 +1,76 @@
+/**
+ * @author Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @copyright Copyright (C) 2025 Levi Armstrong <levi.armstrong@gmail.com>
+ *
+ * @par License
+ * GNU Lesser General Public License Version 3, 29 June 2007
+ * @par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ * @par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * @par
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <tesseract_qt/studio/plugins/studio_trace_dock_widget.h>
+
+#include <tesseract_qt/common/widgets/trace_widget.h>
+#include <tesseract_qt/common/tracing.h>
+
+#include <yaml-cpp/yaml.h>
+
+namespace tesseract::gui
+{
+struct StudioTraceDockWidget::Implementation
+{
+  TraceWidget* widget{ nullptr };
+};
+
+StudioTraceDockWidget::StudioTraceDockWidget(const QString& title, QWidget* parent)
+  : StudioDockWidget(title, parent), data_(std::make_unique<Implementation>())
+{
+}
+
+StudioTraceDockWidget::~StudioTraceDockWidget() = default;
+
+std::string StudioTraceDockWidget::getFactoryClassName() const { return "StudioTraceDockWidgetFactory"; }
+
+void StudioTraceDockWidget::loadConfig(const YAML::Node& config)
+{
+  setup();
+
+  if (const YAML::Node& n = config["enabled"])  // NOLINT
+    data_->widget->setTracingEnabled(n.as<bool>());
+}
+
+YAML::Node StudioTraceDockWidget::getConfig() const
+{
+  YAML::Node config_node;
+  config_node["enabled"] = Tracer::isEnabled();
+  return config_node;
+}
+
+void StudioTraceDockWidget::onInitialize()
+{
+  if (isInitialized())
+    return;
+
+  setup();
+}
+
+void StudioTraceDockWidget::setup()
+{
+  data_->widget = new TraceWidget();
+  setWidget(data_->widget);
+  setFeature(ads::CDockWidget::DockWidgetFocusable, true);
+}
+}  // namespace tesseract::gui
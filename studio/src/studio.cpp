@@ -27,8 +27,15 @@
 #include <tesseract/common/yaml_extensions.h>
 #include <boost_plugin_loader/plugin_loader.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <thread>
+
+#include <boost/dll/shared_library.hpp>
 
 #include <boost/program_options.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -61,6 +68,7 @@
 #include <QDialog>
 #include <QFileDialog>
 #include <QStandardPaths>
+#include <QElapsedTimer>
 
 static const std::string TESSERACT_STUDIO_PLUGIN_DIRECTORIES_ENV = "TESSERACT_STUDIO_PLUGIN_DIRECTORIES";
 static const std::string TESSERACT_STUDIO_PLUGINS_ENV = "TESSERACT_STUDIO_PLUGINS";
@@ -69,6 +77,107 @@ static const std::string SEARCH_PATHS_KEY{ "search_paths" };
 static const std::string SEARCH_LIBRARIES_KEY{ "search_libraries" };
 static const std::string COMPONENT_INFOS_KEY{ "component_infos" };
 static const std::string DOCK_WIDGETS_KEY{ "dock_widgets" };
+static const std::string DEFERRED_LOADING_KEY{ "deferred_loading" };
+
+namespace
+{
+std::vector<std::string> splitEnv(const std::string& env)
+{
+  std::vector<std::string> values;
+  if (env.empty())
+    return values;
+
+  const char* env_value = std::getenv(env.c_str());  // NOLINT
+  if (env_value == nullptr)
+    return values;
+
+  boost::split(values, env_value, boost::is_any_of(":"), boost::token_compress_on);
+  values.erase(std::remove(values.begin(), values.end(), std::string()), values.end());
+  return values;
+}
+
+/** @brief Get the file paths of the plugin libraries the plugin loader searches */
+std::vector<std::filesystem::path> getPluginLibraryPaths(const boost_plugin_loader::PluginLoader& plugin_loader)
+{
+  std::vector<std::string> search_paths = plugin_loader.search_paths;
+  std::vector<std::string> env_search_paths = splitEnv(plugin_loader.search_paths_env);
+  search_paths.insert(search_paths.end(), env_search_paths.begin(), env_search_paths.end());
+
+  std::vector<std::string> search_libraries = plugin_loader.search_libraries;
+  std::vector<std::string> env_search_libraries = splitEnv(plugin_loader.search_libraries_env);
+  search_libraries.insert(search_libraries.end(), env_search_libraries.begin(), env_search_libraries.end());
+
+  const std::string suffix = boost::dll::shared_library::suffix().string();
+  std::vector<std::filesystem::path> library_paths;
+  for (const auto& library : search_libraries)
+  {
+    if (library.empty())
+      continue;
+
+    std::vector<std::filesystem::path> candidates{ library };
+    for (const auto& search_path : search_paths)
+    {
+      candidates.emplace_back(std::filesystem::path(search_path) / ("lib" + library + suffix));
+      candidates.emplace_back(std::filesystem::path(search_path) / (library + suffix));
+    }
+
+    std::error_code ec;
+    auto it = std::find_if(candidates.begin(), candidates.end(), [&ec](const std::filesystem::path& p) {
+      return p.is_absolute() && std::filesystem::is_regular_file(p, ec);
+    });
+
+    if (it != candidates.end() &&
+        std::find(library_paths.begin(), library_paths.end(), *it) == library_paths.end())
+      library_paths.push_back(*it);
+  }
+
+  return library_paths;
+}
+
+/**
+ * @brief Load the libraries using a pool of threads
+ * @details The plugin loader opens the same files later, which is then only a reference count increment because the
+ * returned libraries keep them loaded. Libraries which fail to load are skipped and left for the plugin loader to
+ * report.
+ */
+std::vector<boost::dll::shared_library> preloadLibraries(const std::vector<std::filesystem::path>& library_paths)
+{
+  std::vector<boost::dll::shared_library> libraries(library_paths.size());
+  std::atomic<std::size_t> next{ 0 };
+  auto worker = [&]() {
+    for (std::size_t i = next++; i < library_paths.size(); i = next++)
+    {
+      boost::dll::fs::error_code ec;
+      libraries[i].load(library_paths[i].string(), ec);
+    }
+  };
+
+  const std::size_t thread_count =
+      std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), library_paths.size());
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i)
+    threads.emplace_back(worker);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  libraries.erase(std::remove_if(libraries.begin(),
+                                 libraries.end(),
+                                 [](const boost::dll::shared_library& library) { return !library.is_loaded(); }),
+                  libraries.end());
+  return libraries;
+}
+
+/** @brief The time it took to create a dock widget while loading a config */
+struct DockWidgetStartupTime
+{
+  std::string name;
+  std::string class_name;
+  double time{ 0 };
+  bool deferred{ false };
+};
+}  // namespace
 
 namespace tesseract::gui
 {
@@ -90,6 +199,12 @@ struct Studio::Implementation
   std::string central_widget;
   std::vector<StudioDockWidget*> dock_widgets;
 
+  /** @brief If true the dock widgets, except the central widget, are only created once first shown */
+  bool deferred_loading{ true };
+
+  /** @brief The plugin libraries loaded ahead of creating the dock widgets */
+  std::vector<boost::dll::shared_library> preloaded_libraries;
+
   std::filesystem::path config_filepath;
   std::filesystem::path settings_filepath;
 
@@ -174,6 +289,7 @@ void Studio::Implementation::clear()
 
   central_widget.clear();
   dock_widgets.clear();
+  deferred_loading = true;
 
   config_filepath.clear();
   settings_filepath.clear();
@@ -186,6 +302,12 @@ void Studio::Implementation::clear()
 
 void Studio::Implementation::loadConfig()
 {
+  QElapsedTimer startup_timer;
+  startup_timer.start();
+
+  double preload_time{ 0 };
+  std::vector<DockWidgetStartupTime> startup_times;
+
   YAML::Node config = YAML::LoadFile(config_filepath.string());
   if (const YAML::Node& config_node = config[STUDIO_CONFIG_KEY])
   {
@@ -223,6 +345,10 @@ void Studio::Implementation::loadConfig()
       plugin_loader.search_libraries.insert(plugin_loader.search_libraries.end(), sl.begin(), sl.end());
     }
 
+    // Load the plugin libraries in the background while the component infos are loaded
+    std::future<std::vector<boost::dll::shared_library>> preload =
+        std::async(std::launch::async, preloadLibraries, getPluginLibraryPaths(plugin_loader));
+
     if (const YAML::Node& component_infos = config_node[COMPONENT_INFOS_KEY])
     {
       if (!component_infos.IsMap())
@@ -241,11 +367,43 @@ void Studio::Implementation::loadConfig()
       }
     }
 
+    {
+      QElapsedTimer preload_timer;
+      preload_timer.start();
+      std::vector<boost::dll::shared_library> libraries = preload.get();
+      preloaded_libraries.insert(preloaded_libraries.end(),
+                                 std::make_move_iterator(libraries.begin()),
+                                 std::make_move_iterator(libraries.end()));
+      preload_time = static_cast<double>(preload_timer.nsecsElapsed()) / 1.0e6;
+    }
+
     if (const YAML::Node& dock_widgets_node = config_node[DOCK_WIDGETS_KEY])
     {
       if (const YAML::Node& n = dock_widgets_node["central_widget"])
         central_widget = n.as<std::string>();
 
+      if (const YAML::Node& n = dock_widgets_node[DEFERRED_LOADING_KEY])
+        deferred_loading = n.as<bool>();
+
+      auto create_dock_widget = [this, &startup_times](const std::string& name,
+                                                       const tesseract::common::PluginInfo& plugin_info,
+                                                       bool defer_config) {
+        QElapsedTimer timer;
+        timer.start();
+        StudioDockWidget* dock_widget = app->createDockWidget(QString::fromStdString(name), plugin_info, defer_config);
+        if (dock_widget == nullptr)
+        {
+          events::StatusLogError event(
+              QString("Studio::loadConfig: Failed to load dock widget '%1' from config.").arg(name.c_str()));
+          QApplication::sendEvent(qApp, &event);
+          return;
+        }
+
+        app->addDockWidget(dock_widget);
+        startup_times.push_back(
+            { name, plugin_info.class_name, static_cast<double>(timer.nsecsElapsed()) / 1.0e6, defer_config });
+      };
+
       if (const YAML::Node& plugins = dock_widgets_node["plugins"])
       {
         if (!plugins.IsMap())
@@ -264,18 +422,8 @@ void Studio::Implementation::loadConfig()
               throw std::runtime_error("Studio::loadConfig: failed find central widget with name '" + central_widget +
                                        "'");
 
-            QString name = QString::fromStdString(it->first);
-            StudioDockWidget* dock_widget = app->createDockWidget(name, it->second);
-            if (dock_widget == nullptr)
-            {
-              events::StatusLogError event(
-                  QString("Studio::loadConfig: Failed to load dock widget '%1' from config.").arg(it->first.c_str()));
-              QApplication::sendEvent(qApp, &event);
-            }
-            else
-            {
-              app->addDockWidget(dock_widget);
-            }
+            // The central widget is always visible so it is never deferred
+            create_dock_widget(it->first, it->second, false);
           }
 
           for (const auto& plugin_info : plugin_infos)
@@ -283,19 +431,7 @@ void Studio::Implementation::loadConfig()
             if (!central_widget.empty() && plugin_info.first == central_widget)
               continue;
 
-            QString name = QString::fromStdString(plugin_info.first);
-            StudioDockWidget* dock_widget = app->createDockWidget(name, plugin_info.second);
-            if (dock_widget == nullptr)
-            {
-              events::StatusLogError event(QString("Studio::loadConfig: Failed to load dock widget "
-                                                   "'%1' "
-                                                   "from config.")
-                                               .arg(plugin_info.first.c_str()));
-              QApplication::sendEvent(qApp, &event);
-              continue;
-            }
-
-            app->addDockWidget(dock_widget);
+            create_dock_widget(plugin_info.first, plugin_info.second, deferred_loading);
           }
         }
         catch (const std::exception& e)
@@ -307,9 +443,29 @@ void Studio::Implementation::loadConfig()
     }
   }
 
-  // Load settings
+  // Load settings, the deferred dock widgets visible in the restored layout are created once the window is shown
+  QElapsedTimer restore_timer;
+  restore_timer.start();
   restoreState();
   restorePerspectives();
+  const double restore_time = static_cast<double>(restore_timer.nsecsElapsed()) / 1.0e6;
+
+  // Startup report
+  std::sort(startup_times.begin(), startup_times.end(), [](const auto& a, const auto& b) { return a.time > b.time; });
+  QString report = QString("Studio::loadConfig: Loaded config in %1 ms (waiting on plugin libraries %2 ms, "
+                           "restore state %3 ms)")
+                       .arg(static_cast<double>(startup_timer.nsecsElapsed()) / 1.0e6, 0, 'f', 1)
+                       .arg(preload_time, 0, 'f', 1)
+                       .arg(restore_time, 0, 'f', 1);
+  for (const auto& startup_time : startup_times)
+  {
+    report += QString("\n  %1 (%2): %3 ms%4")
+                  .arg(startup_time.name.c_str(), startup_time.class_name.c_str())
+                  .arg(startup_time.time, 0, 'f', 1)
+                  .arg(startup_time.deferred ? ", deferred until shown" : "");
+  }
+  events::StatusLogInfo event(report);
+  QApplication::sendEvent(qApp, &event);
 }
 
 void Studio::Implementation::loadConfigAs()
@@ -357,12 +513,15 @@ void Studio::Implementation::saveConfig()
   if (!central_widget.empty())
     studio_plugins[DOCK_WIDGETS_KEY]["central_widget"] = central_widget;
 
+  if (!deferred_loading)
+    studio_plugins[DOCK_WIDGETS_KEY][DEFERRED_LOADING_KEY] = deferred_loading;
+
   tesseract::common::PluginInfoMap plugins;
   for (const auto& dock_widget : dock_widgets)
   {
     tesseract::common::PluginInfo plugin_info;
     plugin_info.class_name = dock_widget->getFactoryClassName();
-    plugin_info.config = dock_widget->getConfig();
+    plugin_info.config = dock_widget->isConfigDeferred() ? dock_widget->getDeferredConfig() : dock_widget->getConfig();
     plugins[dock_widget->getName().toStdString()] = plugin_info;
   }
 
@@ -586,7 +745,9 @@ void Studio::closeEvent(QCloseEvent* event)
 boost_plugin_loader::PluginLoader& Studio::getPluginLoader() { return data_->plugin_loader; }
 const boost_plugin_loader::PluginLoader& Studio::getPluginLoader() const { return data_->plugin_loader; }
 
-StudioDockWidget* Studio::createDockWidget(const QString& name, const tesseract::common::PluginInfo& plugin_info)
+StudioDockWidget* Studio::createDockWidget(const QString& name,
+                                           const tesseract::common::PluginInfo& plugin_info,
+                                           bool defer_config)
 {
   try
   {
@@ -594,9 +755,11 @@ StudioDockWidget* Studio::createDockWidget(const QString& name, const tesseract:
     if (it != data_->factories.end())
     {
       StudioDockWidget* dock_widget = it->second->create(name);
-      if (dock_widget != nullptr)
+      if (dock_widget != nullptr && !plugin_info.config.IsNull())
       {
-        if (!plugin_info.config.IsNull())
+        if (defer_config)
+          dock_widget->setDeferredConfig(plugin_info.config);
+        else
           dock_widget->loadConfig(plugin_info.config);
       }
       return dock_widget;
@@ -612,9 +775,11 @@ StudioDockWidget* Studio::createDockWidget(const QString& name, const tesseract:
     data_->factories[plugin_info.class_name] = plugin;
 
     StudioDockWidget* dock_widget = plugin->create(name);
-    if (dock_widget != nullptr)
+    if (dock_widget != nullptr && !plugin_info.config.IsNull())
     {
-      if (!plugin_info.config.IsNull())
+      if (defer_config)
+        dock_widget->setDeferredConfig(plugin_info.config);
+      else
         dock_widget->loadConfig(plugin_info.config);
     }
     return dock_widget;
@@ -630,7 +795,7 @@ StudioDockWidget* Studio::createDockWidget(const QString& name, const tesseract:
 
 void Studio::addDockWidget(StudioDockWidget* dock_widget)
 {
-  if (!dock_widget->isInitialized())
+  if (!dock_widget->isInitialized() && !dock_widget->isConfigDeferred())
   {
     dock_widget->onInitialize();
     if (!dock_widget->isInitialized())
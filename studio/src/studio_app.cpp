@@ -1,5 +1,6 @@
 #include <tesseract_qt/studio/studio.h>
 #include <tesseract_qt/common/theme_utils.h>
+#include <tesseract_qt/common/tracing_application.h>
 #include <QApplication>
 #include <QDebug>
 #include <QString>
@@ -16,7 +17,7 @@ int main(int argc, char* argv[])
 #endif
   QApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
 
-  QApplication app(argc, argv);
+  tesseract::gui::TracingApplication app(argc, argv);
   QApplication::setApplicationName("Tesseract Studio");
   QApplication::setQuitOnLastWindowClosed(true);
 
@@ -23,9 +23,21 @@
 
 #include <tesseract_qt/studio/studio_dock_widget.h>
 
+#include <tesseract_qt/common/events/status_log_events.h>
+
+#include <yaml-cpp/yaml.h>
+
+#include <QApplication>
+#include <QElapsedTimer>
+
 namespace tesseract::gui
 {
-StudioDockWidget::StudioDockWidget(const QString& title, QWidget* parent) : CDockWidget(title, parent) {}
+StudioDockWidget::StudioDockWidget(const QString& title, QWidget* parent) : CDockWidget(title, parent)
+{
+  connect(this, &ads::CDockWidget::visibilityChanged, this, &StudioDockWidget::onVisibilityChanged);
+}
+
+StudioDockWidget::~StudioDockWidget() = default;
 
 void StudioDockWidget::setName(const QString& name) { setObjectName(name); }
 QString StudioDockWidget::getName() const { return objectName(); }
@@ -35,4 +47,80 @@ bool StudioDockWidget::assignAsCentralWidget() const { return assign_as_central_
 bool StudioDockWidget::isInitialized() const { return (widget() != nullptr); }
 void StudioDockWidget::onInitialize() {}
 
+void StudioDockWidget::setDeferredConfig(const YAML::Node& config)
+{
+  deferred_config_ = std::make_unique<YAML::Node>(config);
+}
+
+bool StudioDockWidget::isConfigDeferred() const { return (deferred_config_ != nullptr); }
+
+const YAML::Node& StudioDockWidget::getDeferredConfig() const
+{
+  if (deferred_config_ == nullptr)
+    throw std::runtime_error("StudioDockWidget, config is not deferred.");
+
+  return *deferred_config_;
+}
+
+void StudioDockWidget::loadDeferredConfig()
+{
+  if (deferred_config_ == nullptr)
+    return;
+
+  std::unique_ptr<YAML::Node> config = std::move(deferred_config_);
+
+  QElapsedTimer timer;
+  timer.start();
+  try
+  {
+    loadConfig(*config);
+  }
+  catch (const std::exception& e)
+  {
+    events::StatusLogError event(
+        QString("StudioDockWidget: Failed to load config of dock widget '%1', Details: %2").arg(getName(), e.what()));
+    QApplication::sendEvent(qApp, &event);
+    return;
+  }
+
+  events::StatusLogInfo event(QString("StudioDockWidget: Created dock widget '%1' on first show in %2 ms")
+                                  .arg(getName())
+                                  .arg(static_cast<double>(timer.nsecsElapsed()) / 1.0e6, 0, 'f', 1));
+  QApplication::sendEvent(qApp, &event);
+}
+
+bool StudioDockWidget::isSuspended() const { return suspended_; }
+void StudioDockWidget::onSuspend() {}
+void StudioDockWidget::onResume() {}
+
+void StudioDockWidget::onVisibilityChanged(bool visible)
+{
+  // Queued so the content is not created while the show event is processed, and not at all if the dock widget is hidden
+  // again meanwhile, for example while the dock manager restores the layout
+  if (visible && isConfigDeferred())
+  {
+    QMetaObject::invokeMethod(
+        this,
+        [this]() {
+          if (!suspended_)
+            loadDeferredConfig();
+        },
+        Qt::QueuedConnection);
+  }
+
+  if (suspended_ == !visible)
+    return;
+
+  suspended_ = !visible;
+
+  // The content is created by onInitialize or loadConfig so there is nothing to suspend or resume before that
+  if (!isInitialized())
+    return;
+
+  if (suspended_)
+    onSuspend();
+  else
+    onResume();
+}
+
 }  // namespace tesseract::gui
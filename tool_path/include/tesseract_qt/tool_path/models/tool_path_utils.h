@@ -37,6 +37,8 @@ class TransformStandardItem;
 class ToolPathSegmentStandardItem;
 class ToolPathStandardItem;
 class ComponentInfo;
+class BackgroundLoader;
+class ToolPath;
 
 /**
  * @brief Find upstream parent transform item given item
@@ -69,6 +71,27 @@ ToolPathStandardItem* findToolPathItem(QStandardItem* item);
  */
 void setCheckedStateRecursive(QStandardItem* item, Qt::CheckState st);
 
+/**
+ * @brief Decode the provided tool path file, this does not use the GUI so it may be called from any thread
+ * @param tool_path The decoded tool path
+ * @param filename The tool path file location
+ * @param link_name The link name the tool path is associated with
+ * @return True if successful, otherwise false
+ */
+bool loadToolPath(ToolPath& tool_path, const QString& filename, const QString& link_name);
+
+/**
+ * @brief Decode the tool path file on the loader's worker thread and add it once it is decoded
+ * @param loader The loader reporting progress and errors
+ * @param component_info The component info the tool path is associated with
+ * @param filename The tool path file location
+ * @param link_name The link name the tool path is associated with
+ */
+void openToolPathAsync(BackgroundLoader& loader,
+                       const std::shared_ptr<const ComponentInfo>& component_info,
+                       const QString& filename,
+                       const QString& link_name);
+
 /**
  * @brief Open the provided tool path
  * @param component_info The component info the tool path is associated with
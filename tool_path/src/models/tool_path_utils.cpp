@@ -28,6 +28,7 @@
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/events/tool_path_events.h>
 #include <tesseract_qt/common/tool_path.h>
+#include <tesseract_qt/common/background_loader.h>
 #include <tesseract_qt/common/cereal_serialization.h>
 
 #include <tesseract/common/yaml_utils.h>
@@ -74,44 +75,75 @@ void setCheckedStateRecursive(QStandardItem* item, Qt::CheckState st)
     setCheckedStateRecursive(item->child(i), st);
 }
 
-bool openToolPath(const std::shared_ptr<const ComponentInfo>& component_info,
-                  const QString& filename,
-                  const QString& link_name)
+bool loadToolPath(ToolPath& tool_path, const QString& filename, const QString& link_name)
 {
   QFileInfo file_info(filename);
   if (file_info.suffix() == "tpx")
   {
-    auto tool_path =
+    auto tp =
         tesseract::common::Serialization::fromArchiveFileXML<tesseract::common::Toolpath>(filename.toStdString());
-    ToolPath qt_tool_path(tool_path, link_name.toStdString());
-    events::ToolPathAdd event(component_info, std::move(qt_tool_path));
-    QApplication::sendEvent(qApp, &event);
+    tool_path = ToolPath(tp, link_name.toStdString());
     return true;
   }
 
   if (file_info.suffix() == "tpb")
   {
-    auto tool_path =
+    auto tp =
         tesseract::common::Serialization::fromArchiveFileBinary<tesseract::common::Toolpath>(filename.toStdString());
-    ToolPath qt_tool_path(tool_path, link_name.toStdString());
-    events::ToolPathAdd event(component_info, std::move(qt_tool_path));
-    QApplication::sendEvent(qApp, &event);
+    tool_path = ToolPath(tp, link_name.toStdString());
     return true;
   }
 
   if (file_info.suffix() == "yaml" || file_info.suffix() == "json")
   {
     YAML::Node node = YAML::LoadFile(filename.toStdString());
-    auto tool_path = node.as<tesseract::common::Toolpath>();
-    ToolPath qt_tool_path(tool_path, link_name.toStdString());
-    events::ToolPathAdd event(component_info, std::move(qt_tool_path));
-    QApplication::sendEvent(qApp, &event);
+    auto tp = node.as<tesseract::common::Toolpath>();
+    tool_path = ToolPath(tp, link_name.toStdString());
     return true;
   }
 
   return false;
 }
 
+void openToolPathAsync(BackgroundLoader& loader,
+                       const std::shared_ptr<const ComponentInfo>& component_info,
+                       const QString& filename,
+                       const QString& link_name)
+{
+  auto job = [component_info, filename, link_name](BackgroundLoader::Context& context) {
+    context.setProgress(-1, "Decoding");
+    auto tool_path = std::make_shared<ToolPath>();
+    if (!loadToolPath(*tool_path, filename, link_name))
+      return false;
+
+    if (context.isCanceled())
+      return false;
+
+    context.setProgress(90, "Adding tool path");
+    context.deliver([component_info, tool_path]() {
+      events::ToolPathAdd event(component_info, std::move(*tool_path));
+      QApplication::sendEvent(qApp, &event);
+    });
+    context.setProgress(100);
+    return true;
+  };
+
+  loader.load(QFileInfo(filename).fileName(), std::move(job));
+}
+
+bool openToolPath(const std::shared_ptr<const ComponentInfo>& component_info,
+                  const QString& filename,
+                  const QString& link_name)
+{
+  ToolPath tool_path;
+  if (!loadToolPath(tool_path, filename, link_name))
+    return false;
+
+  events::ToolPathAdd event(component_info, std::move(tool_path));
+  QApplication::sendEvent(qApp, &event);
+  return true;
+}
+
 bool saveToolPath(const tesseract::common::Toolpath& tool_path, QString filename)
 {
   QFileInfo file_info(filename);
@@ -29,6 +29,8 @@
 #include <tesseract_qt/common/models/tool_path_standard_item.h>
 #include <tesseract_qt/common/models/standard_item_type.h>
 #include <tesseract_qt/common/widgets/tree_view.h>
+#include <tesseract_qt/common/widgets/loader_progress_dialog.h>
+#include <tesseract_qt/common/background_loader.h>
 #include <tesseract_qt/common/events/tool_path_events.h>
 #include <tesseract_qt/common/component_info.h>
 #include <tesseract_qt/common/environment_manager.h>
@@ -52,6 +54,10 @@ struct ToolPathWidget::Implementation
   std::unique_ptr<ToolPathFileDialog> open_dialog;
   std::unique_ptr<ToolPathFileDialog> save_dialog;
 
+  /** @brief Decodes opened files on a worker thread */
+  std::unique_ptr<BackgroundLoader> loader;
+  std::unique_ptr<LoaderProgressDialog> loader_dialog;
+
   // Store the selected item
   QStandardItem* selected_item{ nullptr };
 };
@@ -95,6 +101,10 @@ ToolPathWidget::ToolPathWidget(std::shared_ptr<const ComponentInfo> component_in
   data_->save_dialog->setModal(true);
   connect(data_->save_dialog.get(), SIGNAL(finished(int)), this, SLOT(onSaveFinished(int)));
 
+  // Setup background loading
+  data_->loader = std::make_unique<BackgroundLoader>();
+  data_->loader_dialog = std::make_unique<LoaderProgressDialog>(data_->loader.get(), this);
+
   connect(data_->tree_view->selectionModel(),
           SIGNAL(currentRowChanged(QModelIndex, QModelIndex)),
           this,
@@ -207,7 +217,7 @@ void ToolPathWidget::onOpenFinished(int results)
   {
     QString link_name = data_->open_dialog->getLinkName();
     QString filepath = data_->open_dialog->getFilePath();
-    openToolPath(data_->model->getComponentInfo(), filepath, link_name);
+    openToolPathAsync(*data_->loader, data_->model->getComponentInfo(), filepath, link_name);
   }
 }
 